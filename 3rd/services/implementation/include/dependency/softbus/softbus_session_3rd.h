@@ -17,12 +17,15 @@
 #define OHOS_SOFTBUS_SESSION_3RD_H
 
 #include <map>
+#include <memory>
+#include <string>
 #include "ffrt.h"
 
 #include "inner_session.h"
 #include "session.h"
 
 #include "device_manager_data_struct_3rd.h"
+#include "dm_timer_3rd.h"
 #include "isession_callback_3rd.h"
 
 namespace OHOS {
@@ -32,19 +35,34 @@ public:
     SoftbusSession3rd();
     ~SoftbusSession3rd();
 
-    int32_t OpenSessionServer(const PeerTargetId3rd &targetId);
-    int32_t OpenAuth3rdSessionServer(const PeerTargetId3rd &targetId);
+    // isReused is true when an idle session to the same peer was handed out, it is already opened.
+    int32_t OpenSessionServer(const PeerTargetId3rd &targetId, bool &isReused);
+    int32_t OpenAuth3rdSessionServer(const PeerTargetId3rd &targetId, bool &isReused);
     int32_t SendData(int32_t sessionId, const std::string &message);
     int32_t CloseAuthSession(int32_t sessionId);
-    int32_t OpenCredSession(const PeerTargetId3rd &targetId);
+    int32_t OpenCredSession(const PeerTargetId3rd &targetId, bool &isReused);
+    // Keeps the session for the next request to the same peer, it is closed after idleTimeout seconds.
+    int32_t ReleaseAuthSession(int32_t sessionId, int32_t idleTimeout);
+    void OnSessionClosed(int32_t sessionId);
 
 private:
+    int32_t OpenOrReuseSession(const char *sessionName, const ConnectionAddr &addrInfo, const std::string &peerKey,
+        bool &isReused);
+    int32_t TakeIdleSession(const std::string &peerKey);
+    void OnIdleTimeout(int32_t sessionId);
+    std::string GetPeerKey(const char *sessionName, const PeerTargetId3rd &targetId);
     ConnectionAddr GetAddrByTargetId(const PeerTargetId3rd &targetId);
     ConnectionAddr GetAuth3rdAddrByTargetId(const PeerTargetId3rd &targetId);
     ConnectionAddr CreateWifiAddr(const PeerTargetId3rd &targetId);
     ConnectionAddr CreateBleAddr(const PeerTargetId3rd &targetId);
     ConnectionAddr CreateBrAddr(const PeerTargetId3rd &targetId);
     ConnectionAddr CreateBleDirectAddr(const PeerTargetId3rd &targetId);
+
+    ffrt::mutex sessionMtx_;
+    // Sessions opened by this side, with the session name and peer they were opened to.
+    std::map<int32_t, std::string> sessionPeerKeys_;
+    std::map<std::string, int32_t> idleSessions_;
+    std::shared_ptr<DmTimer3rd> idleTimer_ = nullptr;
 };
 }
 }
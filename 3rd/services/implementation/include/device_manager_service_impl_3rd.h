@@ -96,6 +96,7 @@ private:
         ProcessInfo3rd &processInfo);
     void AuthDeviceAclImpl(const PeerTargetId3rd &targetId, const PinCodeInfo pinCodeInfo,
         const std::map<std::string, std::string> &authParamTmp, const ProcessInfo3rd processInfo3rd);
+    bool WaitSessionEnable(int32_t sessionId, bool isReused);
     void SessionOpenFailed(int32_t sessionId, const ProcessInfo3rd &processInfo3rd);
     void AuthCredentialImpl(const PeerTargetId3rd &targetId,
         const std::map<std::string, std::string> &authParamTmp, const ProcessInfo3rd processInfo3rd);
@@ -19,6 +19,7 @@
 #include "dm_auth_message_processor_cred.h"
 #include "dm_auth_state_cred.h"
 #include "dm_auth_state_machine_cred.h"
+#include "dm_constants_3rd.h"
 #include "dm_crypto_3rd.h"
 #include "dm_log_3rd.h"
 #include "hichain_auth_connector_3rd.h"
@@ -241,6 +242,8 @@ int32_t AuthCredSrcFinishState::Action(std::shared_ptr<DmAuthCredContext> contex
     LOGI("AuthCredSrcFinishState::Action ok");
     if (context->reason != DM_OK) {
         context->connDelayCloseTime = 0;
+    } else {
+        context->connDelayCloseTime = AUTH_3RD_SESSION_IDLE_TIMEOUT;
     }
     if (context->cleanNotifyCallback != nullptr) {
         context->cleanNotifyCallback(context->logicalSessionId, context->connDelayCloseTime, context->processInfo);
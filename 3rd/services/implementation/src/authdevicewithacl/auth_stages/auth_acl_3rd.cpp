@@ -102,6 +102,8 @@ int32_t AuthSrcFinishState::Action(std::shared_ptr<DmAuthContext> context)
     LOGI("AuthSrcFinishState::Action ok");
     if (context->reason != DM_OK) {
         context->connDelayCloseTime = 0;
+    } else {
+        context->connDelayCloseTime = AUTH_3RD_SESSION_IDLE_TIMEOUT;
     }
     if (context->cleanNotifyCallback != nullptr) {
         context->cleanNotifyCallback(context->logicalSessionId, context->connDelayCloseTime, context->processInfo);
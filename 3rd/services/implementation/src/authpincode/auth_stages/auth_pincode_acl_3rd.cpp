@@ -61,6 +61,8 @@ int32_t AuthPincodeSrcFinishState::Action(std::shared_ptr<DmAuthPincodeContext>
     LOGI("AuthPincodeSrcFinishState::Action ok");
     if (context->reason != DM_OK) {
         context->connDelayCloseTime = 0;
+    } else {
+        context->connDelayCloseTime = AUTH_3RD_SESSION_IDLE_TIMEOUT;
     }
     if (context->cleanNotifyCallback != nullptr) {
         context->cleanNotifyCallback(context->logicalSessionId, context->connDelayCloseTime, context->processInfo);
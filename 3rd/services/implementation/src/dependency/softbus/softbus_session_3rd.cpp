@@ -39,16 +39,27 @@ constexpr int32_t MAX_DATA_LEN = 4096000;   // Maximum MTU Value for Logical Ses
 const char* DM_3RD_AUTH_ACL_SESSION_NAME = "ohos.distributedhardware.devicemanager.auth3rdDeviceWithAcl";
 const char* DM_AUTH_3RD_SESSION_NAME = "ohos.distributedhardware.devicemanager.auth3rdDevice";
 const char* DM_AUTH_3RD_CRED_SESSION_NAME = "ohos.distributedhardware.devicemanager.auth3rdDeviceCred";
+const char* AUTH_3RD_SESSION_IDLE_TIMER = "auth3rdSessionIdle_";
 }
 
 SoftbusSession3rd::SoftbusSession3rd()
 {
     LOGD("SoftbusSession3rd constructor.");
+    idleTimer_ = std::make_shared<DmTimer3rd>();
 }
 
 SoftbusSession3rd::~SoftbusSession3rd()
 {
     LOGD("SoftbusSession3rd destructor.");
+    if (idleTimer_ != nullptr) {
+        idleTimer_->DeleteAll();
+    }
+    std::lock_guard<ffrt::mutex> lock(sessionMtx_);
+    for (const auto &item : idleSessions_) {
+        ::CloseSession(item.second);
+    }
+    idleSessions_.clear();
+    sessionPeerKeys_.clear();
 }
 
 ConnectionAddr SoftbusSession3rd::CreateWifiAddr(const PeerTargetId3rd &targetId)
@@ -128,16 +139,11 @@ ConnectionAddr SoftbusSession3rd::GetAuth3rdAddrByTargetId(const PeerTargetId3rd
     return ConnectionAddr{};
 }
 
-int32_t SoftbusSession3rd::OpenAuth3rdSessionServer(const PeerTargetId3rd &targetId)
+int32_t SoftbusSession3rd::OpenAuth3rdSessionServer(const PeerTargetId3rd &targetId, bool &isReused)
 {
-    int32_t sessionId = -1;
     ConnectionAddr addrInfo = GetAuth3rdAddrByTargetId(targetId);
-    sessionId = ::OpenAuthSession(DM_AUTH_3RD_SESSION_NAME, &addrInfo, 1, nullptr);
-    if (sessionId < 0) {
-        LOGE("[SOFTBUS]open session error, sessionId: %{public}d.", sessionId);
-        return sessionId;
-    }
-    return sessionId;
+    return OpenOrReuseSession(DM_AUTH_3RD_SESSION_NAME, addrInfo, GetPeerKey(DM_AUTH_3RD_SESSION_NAME, targetId),
+        isReused);
 }
 
 ConnectionAddr SoftbusSession3rd::GetAddrByTargetId(const PeerTargetId3rd &targetId)
@@ -154,18 +160,121 @@ ConnectionAddr SoftbusSession3rd::GetAddrByTargetId(const PeerTargetId3rd &targe
     return ConnectionAddr{};
 }
 
-int32_t SoftbusSession3rd::OpenSessionServer(const PeerTargetId3rd &targetId)
+int32_t SoftbusSession3rd::OpenSessionServer(const PeerTargetId3rd &targetId, bool &isReused)
 {
-    int32_t sessionId = -1;
     ConnectionAddr addrInfo = GetAddrByTargetId(targetId);
-    sessionId = ::OpenAuthSession(DM_3RD_AUTH_ACL_SESSION_NAME, &addrInfo, 1, nullptr);
+    return OpenOrReuseSession(DM_3RD_AUTH_ACL_SESSION_NAME, addrInfo,
+        GetPeerKey(DM_3RD_AUTH_ACL_SESSION_NAME, targetId), isReused);
+}
+
+std::string SoftbusSession3rd::GetPeerKey(const char *sessionName, const PeerTargetId3rd &targetId)
+{
+    return std::string(sessionName) + "#" + targetId.deviceId + "#" + targetId.wifiIp + "#" +
+        std::to_string(targetId.wifiPort) + "#" + targetId.bleMac + "#" + targetId.brMac;
+}
+
+int32_t SoftbusSession3rd::OpenOrReuseSession(const char *sessionName, const ConnectionAddr &addrInfo,
+    const std::string &peerKey, bool &isReused)
+{
+    isReused = false;
+    int32_t sessionId = TakeIdleSession(peerKey);
+    if (sessionId > 0) {
+        LOGI("reuse idle session, sessionId: %{public}d.", sessionId);
+        isReused = true;
+        return sessionId;
+    }
+    ConnectionAddr addr = addrInfo;
+    sessionId = ::OpenAuthSession(sessionName, &addr, 1, nullptr);
     if (sessionId < 0) {
         LOGE("[SOFTBUS]open session error, sessionId: %{public}d.", sessionId);
         return sessionId;
     }
+    std::lock_guard<ffrt::mutex> lock(sessionMtx_);
+    sessionPeerKeys_[sessionId] = peerKey;
+    return sessionId;
+}
+
+int32_t SoftbusSession3rd::TakeIdleSession(const std::string &peerKey)
+{
+    int32_t sessionId = -1;
+    {
+        std::lock_guard<ffrt::mutex> lock(sessionMtx_);
+        auto iter = idleSessions_.find(peerKey);
+        if (iter == idleSessions_.end()) {
+            return sessionId;
+        }
+        sessionId = iter->second;
+        idleSessions_.erase(iter);
+    }
+    if (idleTimer_ != nullptr) {
+        idleTimer_->DeleteTimer(std::string(AUTH_3RD_SESSION_IDLE_TIMER) + std::to_string(sessionId));
+    }
     return sessionId;
 }
 
+int32_t SoftbusSession3rd::ReleaseAuthSession(int32_t sessionId, int32_t idleTimeout)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(sessionMtx_);
+        auto iter = sessionPeerKeys_.find(sessionId);
+        if (iter != sessionPeerKeys_.end() && idleTimer_ != nullptr &&
+            idleSessions_.find(iter->second) == idleSessions_.end()) {
+            std::string timerName = std::string(AUTH_3RD_SESSION_IDLE_TIMER) + std::to_string(sessionId);
+            int32_t ret = idleTimer_->StartTimer(timerName, idleTimeout, [this, sessionId] (std::string name) {
+                idleTimer_->DeleteTimer(name);
+                OnIdleTimeout(sessionId);
+            });
+            if (ret == DM_OK) {
+                LOGI("keep session idle, sessionId: %{public}d.", sessionId);
+                idleSessions_[iter->second] = sessionId;
+                return DM_OK;
+            }
+        }
+    }
+    // Not opened by this side, already one idle session to that peer, or no timer: close as before.
+    return CloseAuthSession(sessionId);
+}
+
+void SoftbusSession3rd::OnIdleTimeout(int32_t sessionId)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(sessionMtx_);
+        auto iter = sessionPeerKeys_.find(sessionId);
+        if (iter == sessionPeerKeys_.end()) {
+            return;
+        }
+        auto idleIter = idleSessions_.find(iter->second);
+        if (idleIter == idleSessions_.end() || idleIter->second != sessionId) {
+            return;
+        }
+        idleSessions_.erase(idleIter);
+        sessionPeerKeys_.erase(iter);
+    }
+    LOGI("idle session timeout, sessionId: %{public}d.", sessionId);
+    ::CloseSession(sessionId);
+}
+
+void SoftbusSession3rd::OnSessionClosed(int32_t sessionId)
+{
+    bool isIdle = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(sessionMtx_);
+        auto iter = sessionPeerKeys_.find(sessionId);
+        if (iter == sessionPeerKeys_.end()) {
+            return;
+        }
+        auto idleIter = idleSessions_.find(iter->second);
+        if (idleIter != idleSessions_.end() && idleIter->second == sessionId) {
+            idleSessions_.erase(idleIter);
+            isIdle = true;
+        }
+        sessionPeerKeys_.erase(iter);
+    }
+    if (isIdle && idleTimer_ != nullptr) {
+        idleTimer_->DeleteTimer(std::string(AUTH_3RD_SESSION_IDLE_TIMER) + std::to_string(sessionId));
+    }
+}
+
 int32_t SoftbusSession3rd::SendData(int32_t sessionId, const std::string &message)
 {
     if (message.size() > MAX_DATA_LEN) {
@@ -184,20 +293,16 @@ int32_t SoftbusSession3rd::SendData(int32_t sessionId, const std::string &messag
 int32_t SoftbusSession3rd::CloseAuthSession(int32_t sessionId)
 {
     LOGI("CloseAuthSession, sessionId:%{public}d", sessionId);
+    OnSessionClosed(sessionId);
     ::CloseSession(sessionId);
     return DM_OK;
 }
 
-int32_t SoftbusSession3rd::OpenCredSession(const PeerTargetId3rd &targetId)
+int32_t SoftbusSession3rd::OpenCredSession(const PeerTargetId3rd &targetId, bool &isReused)
 {
-    int32_t sessionId = -1;
     ConnectionAddr addrInfo = GetAddrByTargetId(targetId);
-    sessionId = ::OpenAuthSession(DM_AUTH_3RD_CRED_SESSION_NAME, &addrInfo, 1, nullptr);
-    if (sessionId < 0) {
-        LOGE("[SOFTBUS]open session error, sessionId: %{public}d.", sessionId);
-        return sessionId;
-    }
-    return sessionId;
+    return OpenOrReuseSession(DM_AUTH_3RD_CRED_SESSION_NAME, addrInfo,
+        GetPeerKey(DM_AUTH_3RD_CRED_SESSION_NAME, targetId), isReused);
 }
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -81,6 +81,9 @@ int DeviceManagerServiceImpl3rd::OnAuth3rdAclSessionOpened(int sessionId, int re
 void DeviceManagerServiceImpl3rd::OnAuth3rdAclSessionClosed(int sessionId)
 {
     LOGI("OnSessionClosed, success, sessionId: %{public}d.", sessionId);
+    CHECK_NULL_VOID(softbusConnector_);
+    CHECK_NULL_VOID(softbusConnector_->GetSoftbusSession());
+    softbusConnector_->GetSoftbusSession()->OnSessionClosed(sessionId);
     return;
 }
 
@@ -133,6 +136,9 @@ int DeviceManagerServiceImpl3rd::OnAuthCred3rdSessionOpened(int sessionId, int r
 void DeviceManagerServiceImpl3rd::OnAuthCred3rdSessionClosed(int sessionId)
 {
     LOGI("OnSessionClosed, success, sessionId: %{public}d.", sessionId);
+    CHECK_NULL_VOID(softbusConnector_);
+    CHECK_NULL_VOID(softbusConnector_->GetSoftbusSession());
+    softbusConnector_->GetSoftbusSession()->OnSessionClosed(sessionId);
     return;
 }
 
@@ -321,7 +327,8 @@ void DeviceManagerServiceImpl3rd::AuthDeviceAclImpl(const PeerTargetId3rd &targe
         LOGI("Created new AuthMgr for token %{public}s",
             GetAnonyString(std::to_string(processInfo3rd.tokenId)).c_str());
     }
-    int32_t sessionId = softbusConnector_->GetSoftbusSession()->OpenSessionServer(targetId);
+    bool isReused = false;
+    int32_t sessionId = softbusConnector_->GetSoftbusSession()->OpenSessionServer(targetId, isReused);
     if (sessionId < 0) {
         LOGE("OpenAuthSession failed, stop the authentication");
         return;
@@ -343,16 +350,25 @@ void DeviceManagerServiceImpl3rd::AuthDeviceAclImpl(const PeerTargetId3rd &targe
         std::lock_guard<ffrt::mutex> sessionIdLock(logicalSessionId2SessionIdMapMtx_);
         logicalSessionId2SessionIdMap_[logicalSessionId] = sessionId;
     }
-    sessionEnableCvReadyMap_[sessionId] = false;
-    std::unique_lock<ffrt::mutex> cvLock(sessionEnableMutexMap_[sessionId]);
-    if (!sessionEnableCvMap_[sessionId].wait_for(cvLock, std::chrono::milliseconds(OPEN_AUTH_SESSION_TIMEOUT),
-        [&] { return sessionEnableCvReadyMap_[sessionId]; })) {
+    if (!WaitSessionEnable(sessionId, isReused)) {
         SessionOpenFailed(sessionId, processInfo3rd);
         return;
     }
     authMgr->AuthDevice3rd(targetId, authParamTmp, sessionId, logicalSessionId);
 }
 
+bool DeviceManagerServiceImpl3rd::WaitSessionEnable(int32_t sessionId, bool isReused)
+{
+    if (isReused) {
+        LOGI("session reused, sessionId: %{public}d.", sessionId);
+        return true;
+    }
+    sessionEnableCvReadyMap_[sessionId] = false;
+    std::unique_lock<ffrt::mutex> cvLock(sessionEnableMutexMap_[sessionId]);
+    return sessionEnableCvMap_[sessionId].wait_for(cvLock, std::chrono::milliseconds(OPEN_AUTH_SESSION_TIMEOUT),
+        [&] { return sessionEnableCvReadyMap_[sessionId]; });
+}
+
 void DeviceManagerServiceImpl3rd::SessionOpenFailed(int32_t sessionId, const ProcessInfo3rd &processInfo3rd)
 {
     LOGE("wait session enable timeout or enable fail, sessionId: %{public}d.", sessionId);
@@ -680,6 +696,10 @@ void DeviceManagerServiceImpl3rd::CleanAuthMgrByLogicalSessionId(uint64_t logica
     }
     CHECK_NULL_VOID(softbusConnector_);
     CHECK_NULL_VOID(softbusConnector_->GetSoftbusSession());
+    if (sessionId > 0 && connDelayCloseTime > 0) {
+        softbusConnector_->GetSoftbusSession()->ReleaseAuthSession(sessionId, connDelayCloseTime);
+        return;
+    }
     softbusConnector_->GetSoftbusSession()->CloseAuthSession(sessionId);
     return;
 }
@@ -767,7 +787,8 @@ void DeviceManagerServiceImpl3rd::AuthCredentialImpl(const PeerTargetId3rd &targ
         LOGI("Created new AuthMgr for token %{public}s",
             GetAnonyUint32(processInfo3rd.tokenId).c_str());
     }
-    int32_t sessionId = softbusConnector_->GetSoftbusSession()->OpenCredSession(targetId);
+    bool isReused = false;
+    int32_t sessionId = softbusConnector_->GetSoftbusSession()->OpenCredSession(targetId, isReused);
     if (sessionId < 0) {
         EraseAuthMgr(processInfo3rd.tokenId);
         LOGE("OpenAuthSession failed, stop the auth");
@@ -790,10 +811,7 @@ void DeviceManagerServiceImpl3rd::AuthCredentialImpl(const PeerTargetId3rd &targ
         std::lock_guard<ffrt::mutex> sessionIdLock(logicalSessionId2SessionIdMapMtx_);
         logicalSessionId2SessionIdMap_[logicalSessionId] = sessionId;
     }
-    sessionEnableCvReadyMap_[sessionId] = false;
-    std::unique_lock<ffrt::mutex> cvLock(sessionEnableMutexMap_[sessionId]);
-    if (!sessionEnableCvMap_[sessionId].wait_for(cvLock, std::chrono::milliseconds(OPEN_AUTH_SESSION_TIMEOUT),
-        [&] { return sessionEnableCvReadyMap_[sessionId]; })) {
+    if (!WaitSessionEnable(sessionId, isReused)) {
         CredSessionOpenFailed(sessionId, processInfo3rd);
         return;
     }
@@ -922,7 +940,8 @@ void DeviceManagerServiceImpl3rd::AuthPincodeImpl(const PeerTargetId3rd &targetI
         LOGI("Created new AuthMgr for token:%{public}s",
             GetAnonyString(std::to_string(processInfo3rd.tokenId)).c_str());
     }
-    int32_t sessionId = softbusConnector_->GetSoftbusSession()->OpenAuth3rdSessionServer(targetId);
+    bool isReused = false;
+    int32_t sessionId = softbusConnector_->GetSoftbusSession()->OpenAuth3rdSessionServer(targetId, isReused);
     if (sessionId < 0) {
         LOGE("OpenAuthSession failed, stop the authentication");
         return;
@@ -945,10 +964,7 @@ void DeviceManagerServiceImpl3rd::AuthPincodeImpl(const PeerTargetId3rd &targetI
         std::lock_guard<ffrt::mutex> sessionIdLock(logicalSessionId2SessionIdMapMtx_);
         logicalSessionId2SessionIdMap_[logicalSessionId] = sessionId;
     }
-    sessionEnableCvReadyMap_[sessionId] = false;
-    std::unique_lock<ffrt::mutex> cvLock(sessionEnableMutexMap_[sessionId]);
-    if (!sessionEnableCvMap_[sessionId].wait_for(cvLock, std::chrono::milliseconds(OPEN_AUTH_SESSION_TIMEOUT),
-        [&] { return sessionEnableCvReadyMap_[sessionId]; })) {
+    if (!WaitSessionEnable(sessionId, isReused)) {
         LOGE("wait session enable timeout or enable fail, sessionId: %{public}d.", sessionId);
         CredSessionOpenFailed(sessionId, processInfo3rd);
         return;
@@ -973,6 +989,9 @@ int DeviceManagerServiceImpl3rd::OnAuth3rdSessionOpened(int sessionId, int resul
 void DeviceManagerServiceImpl3rd::OnAuth3rdSessionClosed(int sessionId)
 {
     LOGI("OnSessionClosed, success, sessionId: %{public}d.", sessionId);
+    CHECK_NULL_VOID(softbusConnector_);
+    CHECK_NULL_VOID(softbusConnector_->GetSoftbusSession());
+    softbusConnector_->GetSoftbusSession()->OnSessionClosed(sessionId);
     return;
 }
 
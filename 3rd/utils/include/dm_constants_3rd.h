@@ -84,6 +84,8 @@ extern const char* TAG_BIND_CALLER_BIND_LEVEL;
 constexpr int32_t DEVICE_UUID_LENGTH = 65;
 constexpr int32_t DM_POINT_TO_POINT = 256;
 constexpr int32_t DM_OPENID_HASH_LEN = 32;
+// Seconds a source keeps its auth session open for the next request to the same peer.
+constexpr int32_t AUTH_3RD_SESSION_IDLE_TIMEOUT = 10;
 
 extern const char* TAG_OPENID_HASH;
 extern const char* TAG_CRED_TYPE;
@@ -151,6 +151,8 @@ enum DMIpcCmdInterfaceCode {
     GET_PEER_SERVICEINFO_BY_SERVICEID,
     UPDATE_SERVICE_INFO,
     GET_OS_TYPE_BY_NETWORK,
+    BATCH_QUERY,
+    SERVER_LOCAL_DEVICE_NAME_CHANGE_NOTIFY,
     // Add ipc msg here
     IPC_MSG_BUTT
 };
@@ -36,6 +36,7 @@ enum class HidumperFlag {
     HIDUMPER_GET_HELP,
     HIDUMPER_GET_TRUSTED_LIST,
     HIDUMPER_GET_DEVICE_STATE,
+    HIDUMPER_GET_PERF_STATS,
 };
 
 // HiDumper device type
@@ -37,6 +37,7 @@ public:
 private:
     int32_t ProcessDump(const HidumperFlag &flag, std::string &result);
     int32_t ShowAllLoadTrustedList(std::string &result);
+    int32_t ProcessPerfStats(const std::vector<std::string>& args, std::string &result);
     int32_t ShowHelp(std::string &result);
     int32_t ShowIllealInfomation(std::string &result);
     std::string GetDeviceType(int32_t deviceTypeId);
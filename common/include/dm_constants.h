@@ -204,6 +204,7 @@ DM_EXPORT extern const std::map<int32_t, int32_t> MAP_ERROR_CODE;
 DM_EXPORT extern const uint32_t MAX_CONTAINER_SIZE;
 DM_EXPORT extern const int32_t MAX_DEVICE_PROFILE_SIZE;
 const int32_t DEVICE_NAME_MAX_BYTES = 100;
+const int32_t DM_BATCH_QUERY_MAX_NUM = 32;
 
 DM_EXPORT extern const int32_t DEFAULT_DELAY_CLOSE_TIME_US;
 
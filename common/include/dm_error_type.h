@@ -155,6 +155,7 @@ enum {
     ERR_DM_CALLING_TOKENID_FAILED = 969298365,
     ERR_DM_CONSTRAINT_ENABLE = 969298366,
     ERR_DM_GET_OSTYPE_FAILED = 969298367,
+    ERR_DM_IPC_CMD_BUSY = 969298368,
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DEVICE_MANAGER_IPC_BATCH_QUERY_REQ_H
+#define OHOS_DEVICE_MANAGER_IPC_BATCH_QUERY_REQ_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ipc_req.h"
+#include "ipc_rsp.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+// One query of a batch, encoded and decoded with the codec registered for cmdCode.
+struct IpcBatchQueryCmd {
+    int32_t cmdCode = 0;
+    std::shared_ptr<IpcReq> req = nullptr;
+    std::shared_ptr<IpcRsp> rsp = nullptr;
+};
+
+class IpcBatchQueryReq : public IpcReq {
+    DECLARE_IPC_MODEL(IpcBatchQueryReq);
+
+public:
+    const std::vector<IpcBatchQueryCmd> &GetCmds() const
+    {
+        return cmds_;
+    }
+
+    void SetCmds(const std::vector<IpcBatchQueryCmd> &cmds)
+    {
+        cmds_ = cmds;
+    }
+
+private:
+    std::vector<IpcBatchQueryCmd> cmds_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DEVICE_MANAGER_IPC_BATCH_QUERY_REQ_H
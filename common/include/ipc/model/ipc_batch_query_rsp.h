@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DEVICE_MANAGER_IPC_BATCH_QUERY_RSP_H
+#define OHOS_DEVICE_MANAGER_IPC_BATCH_QUERY_RSP_H
+
+#include <vector>
+
+#include "ipc_batch_query_req.h"
+#include "ipc_rsp.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+class IpcBatchQueryRsp : public IpcRsp {
+    DECLARE_IPC_MODEL(IpcBatchQueryRsp);
+
+public:
+    // The same commands as the request, each item response is decoded into cmd.rsp.
+    const std::vector<IpcBatchQueryCmd> &GetCmds() const
+    {
+        return cmds_;
+    }
+
+    void SetCmds(const std::vector<IpcBatchQueryCmd> &cmds)
+    {
+        cmds_ = cmds;
+    }
+
+private:
+    std::vector<IpcBatchQueryCmd> cmds_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DEVICE_MANAGER_IPC_BATCH_QUERY_RSP_H
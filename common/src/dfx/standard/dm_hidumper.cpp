@@ -21,6 +21,7 @@
 #include "dm_anonymous.h"      // for GetAnonyString
 #include "dm_error_type.h"
 #include "dm_log.h"            // for LOGI, LOGE
+#include "dm_perf_stats.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -42,11 +43,22 @@ static DumperInfo g_dumperDeviceType[] = {
 // HiDumper info
 constexpr const char* ARGS_HELP_INFO = "-h";
 constexpr const char* HIDUMPER_GET_TRUSTED_LIST_INFO = "-getTrustlist";
+constexpr const char* HIDUMPER_GET_PERF_STATS_INFO = "-perfStats";
+
+// HiDumper perf stats sub command
+constexpr const char* PERF_STATS_ENABLE = "enable";
+constexpr const char* PERF_STATS_DISABLE = "disable";
+constexpr const char* PERF_STATS_RESET = "reset";
+constexpr const char* PERF_STATS_EXPORT = "export";
+constexpr const char* PERF_STATS_EXPORT_PATH =
+    "/data/service/el1/public/database/distributed_device_manager_service/dm_perf_stats.txt";
+constexpr uint32_t PERF_STATS_MAX_ARGS = 2;
 
 // HiDumper command
 const std::unordered_map<std::string, HidumperFlag> MAP_ARGS = {
     { std::string(ARGS_HELP_INFO), HidumperFlag::HIDUMPER_GET_HELP },
     { std::string(HIDUMPER_GET_TRUSTED_LIST_INFO), HidumperFlag::HIDUMPER_GET_TRUSTED_LIST },
+    { std::string(HIDUMPER_GET_PERF_STATS_INFO), HidumperFlag::HIDUMPER_GET_PERF_STATS },
 };
 
 } // namespace
@@ -60,6 +72,10 @@ int32_t HiDumpHelper::HiDump(const std::vector<std::string>& args, std::string &
         return ProcessDump(HidumperFlag::HIDUMPER_GET_HELP, result);
     }
     auto flag = MAP_ARGS.find(args[0]);
+    if (flag != MAP_ARGS.end() && flag->second == HidumperFlag::HIDUMPER_GET_PERF_STATS &&
+        args.size() <= PERF_STATS_MAX_ARGS) {
+        return ProcessPerfStats(args, result);
+    }
     if ((args.size() > 1) || (flag == MAP_ARGS.end())) {
         errCode = ProcessDump(HidumperFlag::HIDUMPER_UNKNOWN, result);
     } else {
@@ -119,6 +135,36 @@ int32_t HiDumpHelper::ShowAllLoadTrustedList(std::string &result)
     return ret;
 }
 
+int32_t HiDumpHelper::ProcessPerfStats(const std::vector<std::string>& args, std::string &result)
+{
+    LOGI("dump perf stats");
+    if (args.size() == 1) {
+        result.append(DmPerfStats::GetInstance().Dump());
+        return DM_OK;
+    }
+    const std::string &subCmd = args[1];
+    if (subCmd == PERF_STATS_ENABLE) {
+        DmPerfStats::GetInstance().SetEnabled(true);
+        result.append("perf stats enabled\n");
+    } else if (subCmd == PERF_STATS_DISABLE) {
+        DmPerfStats::GetInstance().SetEnabled(false);
+        result.append("perf stats disabled\n");
+    } else if (subCmd == PERF_STATS_RESET) {
+        DmPerfStats::GetInstance().Reset();
+        result.append("perf stats reset\n");
+    } else if (subCmd == PERF_STATS_EXPORT) {
+        int32_t ret = DmPerfStats::GetInstance().ExportToFile(PERF_STATS_EXPORT_PATH);
+        if (ret != DM_OK) {
+            result.append("perf stats export failed\n");
+            return ret;
+        }
+        result.append("perf stats exported to ").append(PERF_STATS_EXPORT_PATH).append("\n");
+    } else {
+        return ShowIllealInfomation(result);
+    }
+    return DM_OK;
+}
+
 std::string HiDumpHelper::GetDeviceType(int32_t deviceTypeId)
 {
     std::string dmDeviceTypeIdString = "";
@@ -138,7 +184,9 @@ int32_t HiDumpHelper::ShowHelp(std::string &result)
     result.append(" -h                       ");
     result.append(": show help\n");
     result.append(" -getTrustlist            ");
-    result.append(": show all trusted device list\n\n");
+    result.append(": show all trusted device list\n");
+    result.append(" -perfStats [enable|disable|reset|export]");
+    result.append(": show, switch, reset or export hot path latency stats\n\n");
     return DM_OK;
 }
 
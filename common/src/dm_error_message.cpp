@@ -51,6 +51,7 @@ ERROR_INFO g_errorMessages[] = {
     {ERR_DM_AUTH_MESSAGE_INCOMPLETE, "authentication message is incomplete."},
     {ERR_DM_CREATE_GROUP_FAILED, "create group failed."},
     {ERR_DM_IPC_READ_FAILED, "ipc read object failed."},
+    {ERR_DM_IPC_CMD_BUSY, "dm service is busy, please try again later."},
     {ERR_DM_PUBLISH_FAILED, "device publish failed."},
     {ERR_DM_PUBLISH_REPEATED, "repeat device publish warning."},
     {DM_BIND_TRUST_TARGET, "bind to trusted target device."},
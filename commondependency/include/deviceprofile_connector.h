@@ -115,6 +115,12 @@ typedef struct DmAclIdParam {
     std::unordered_set<int64_t> tokenIds;
 } DmAclIdParam;
 
+// ACL mutations collected over one snapshot and handed to ApplyAclBatch together.
+typedef struct DmAclBatch {
+    std::vector<DmAclIdParam> delAclInfos;
+    std::vector<OHOS::DistributedDeviceProfile::AccessControlProfile> updateProfiles;
+} DmAclBatch;
+
 typedef struct DmOfflineParam {
     uint32_t bindType;
     std::vector<OHOS::DistributedHardware::ProcessInfo> processVec;
@@ -240,6 +246,9 @@ public:
         DmOfflineParam &offlineParam, std::vector<DmUserRemovedServiceInfo> &serviceInfos);
     DM_EXPORT bool DeleteAclByActhash(const DMAclQuadInfo &info, const std::string &accountIdHash,
         DmOfflineParam &offlineParam, std::vector<DmUserRemovedServiceInfo> &serviceInfos);
+    DM_EXPORT bool DeleteAclByActhash(const std::vector<DistributedDeviceProfile::AccessControlProfile> &profiles,
+        const DMAclQuadInfo &info, const std::string &accountIdHash, DmOfflineParam &offlineParam,
+        std::vector<DmUserRemovedServiceInfo> &serviceInfos);
     DM_EXPORT void CacheOfflineParam(const DmCacheOfflineInputParam &inputParam,
         DmOfflineParam &offlineParam, bool &notifyOffline, std::vector<DmUserRemovedServiceInfo> &serviceInfos);
     DM_EXPORT void DeleteAclForUserRemoved(const DmLocalUserRemovedInfo &userRemovedInfo,
@@ -302,6 +311,7 @@ public:
         GetAllAccessControlProfile();
     DM_EXPORT std::vector<DistributedDeviceProfile::AccessControlProfile> GetAllAclIncludeLnnAcl();
     DM_EXPORT void DeleteAccessControlById(int64_t accessControlId);
+    DM_EXPORT int32_t ApplyAclBatch(const DmAclBatch &batch);
     DM_EXPORT int32_t HandleUserSwitched(const std::string &localUdid,
         const std::vector<std::string> &deviceVec, int32_t currentUserId, int32_t beforeUserId);
     DM_EXPORT int32_t HandleUserSwitched(const std::string &localUdid,
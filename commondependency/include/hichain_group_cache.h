@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_HICHAIN_GROUP_CACHE_H
+#define OHOS_DM_HICHAIN_GROUP_CACHE_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "dm_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+struct HichainGroupRecord {
+    std::string groupName;
+    std::string groupId;
+    std::string groupOwner;
+    int32_t groupType = 0;
+    int32_t groupVisibility = 0;
+    std::string userId;
+};
+
+/*
+ * Parsed results of the hichain group and credential queries. Entries are keyed by the os
+ * account userId and either the query params or the peer udid, and are dropped by the hichain
+ * data change / credential change callbacks. The cache stays disabled until those callbacks are
+ * registered, so a lookup can never return data hichain already changed.
+ */
+class HichainGroupCache {
+    DM_DECLARE_SINGLE_INSTANCE(HichainGroupCache);
+public:
+    DM_EXPORT void SetGroupCacheEnabled(bool enabled);
+    DM_EXPORT void SetCredentialCacheEnabled(bool enabled);
+
+    // Take the generation before querying hichain and hand it back to Put*, a result that raced
+    // with an invalidation is then discarded instead of cached.
+    DM_EXPORT uint64_t GetGeneration();
+
+    DM_EXPORT bool GetGroupInfo(int32_t userId, const std::string &pkgName, const std::string &queryParams,
+        std::vector<HichainGroupRecord> &groups);
+    DM_EXPORT void PutGroupInfo(int32_t userId, const std::string &pkgName, const std::string &queryParams,
+        const std::vector<HichainGroupRecord> &groups, uint64_t generation);
+    DM_EXPORT bool GetRelatedGroups(int32_t userId, const std::string &pkgName, const std::string &peerUdid,
+        std::vector<HichainGroupRecord> &groups);
+    DM_EXPORT void PutRelatedGroups(int32_t userId, const std::string &pkgName, const std::string &peerUdid,
+        const std::vector<HichainGroupRecord> &groups, uint64_t generation);
+    DM_EXPORT bool GetCredentialInfo(int32_t userId, const std::string &credId, std::string &credInfo);
+    DM_EXPORT void PutCredentialInfo(int32_t userId, const std::string &credId, const std::string &credInfo,
+        uint64_t generation);
+
+    DM_EXPORT void InvalidateUser(int32_t userId);
+    DM_EXPORT void InvalidateGroup(const std::string &groupId);
+    DM_EXPORT void InvalidatePeer(const std::string &peerUdid);
+    DM_EXPORT void InvalidateCredential(const std::string &credId);
+    DM_EXPORT void InvalidateAll();
+
+    // Parses the json array returned by getGroupInfo / getRelatedGroups.
+    DM_EXPORT static int32_t ParseGroups(const std::string &groupsStr, std::vector<HichainGroupRecord> &groups);
+
+    template <typename T>
+    static void ToGroupList(const std::vector<HichainGroupRecord> &records, std::vector<T> &groupList)
+    {
+        groupList.clear();
+        groupList.reserve(records.size());
+        for (const auto &record : records) {
+            T group;
+            group.groupName = record.groupName;
+            group.groupId = record.groupId;
+            group.groupOwner = record.groupOwner;
+            group.groupType = record.groupType;
+            group.groupVisibility = record.groupVisibility;
+            group.userId = record.userId;
+            groupList.push_back(group);
+        }
+    }
+
+private:
+    // userId, pkgName, query params or peer udid.
+    using QueryKey = std::tuple<int32_t, std::string, std::string>;
+    using CredentialKey = std::pair<int32_t, std::string>;
+
+    // The bool tells whether the key belongs to relatedGroups_ or groupInfos_.
+    using IndexedKey = std::pair<bool, QueryKey>;
+
+    void InsertQuery(const IndexedKey &indexedKey, const std::vector<HichainGroupRecord> &groups);
+    void EraseQuery(const IndexedKey &indexedKey);
+    void ClearGroupsLocked();
+
+    std::mutex cacheMutex_;
+    bool groupEnabled_ = false;
+    bool credentialEnabled_ = false;
+    uint64_t generation_ = 0;
+    std::map<QueryKey, std::vector<HichainGroupRecord>> groupInfos_;
+    std::map<QueryKey, std::vector<HichainGroupRecord>> relatedGroups_;
+    std::unordered_map<std::string, std::set<IndexedKey>> groupIndex_;
+    std::unordered_map<std::string, std::set<QueryKey>> peerIndex_;
+    std::map<CredentialKey, std::string> credInfos_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_HICHAIN_GROUP_CACHE_H
@@ -22,6 +22,7 @@
 #include "dm_crypto.h"
 #include "dm_device_info.h"
 #include "dm_log.h"
+#include "dm_perf_stats.h"
 #include "multiple_user_connector.h"
 #include "distributed_device_profile_client.h"
 #include "system_ability_definition.h"
@@ -648,6 +649,7 @@ DM_EXPORT std::vector<AccessControlProfile> DeviceProfileConnector::GetAccessCon
 
 std::vector<AccessControlProfile> DeviceProfileConnector::GetAccessControlProfileByUserId(int32_t userId)
 {
+    DM_PERF_SCOPE(DmPerfOp::DP_GET_ACL);
     std::vector<AccessControlProfile> profiles;
     std::map<std::string, std::string> queryParams;
     queryParams[USERID] = std::to_string(userId);
@@ -1382,6 +1384,13 @@ DM_EXPORT bool DeviceProfileConnector::DeleteAclByActhash(
         GetAnonyString(info.localUdid).c_str(), info.localUserId, GetAnonyString(info.peerUdid).c_str(),
         info.peerUserId);
     std::vector<AccessControlProfile> profiles = GetAllAclIncludeLnnAcl();
+    return DeleteAclByActhash(profiles, info, accountIdHash, offlineParam, serviceInfos);
+}
+
+DM_EXPORT bool DeviceProfileConnector::DeleteAclByActhash(const std::vector<AccessControlProfile> &profiles,
+    const DMAclQuadInfo &info, const std::string &accountIdHash, DmOfflineParam &offlineParam,
+    std::vector<DmUserRemovedServiceInfo> &serviceInfos)
+{
     bool notifyOffline = false;
     for (const auto &item : profiles) {
         if (item.GetTrustDeviceId() != info.peerUdid) {
@@ -2555,6 +2564,7 @@ int32_t DeviceProfileConnector::HandleAccountLogoutEvent(int32_t remoteUserId,
         GetAnonyString(localUdid).c_str());
     std::vector<AccessControlProfile> profiles = GetAccessControlProfileByUserId(remoteUserId);
     int32_t bindType = DM_INVALIED_TYPE;
+    DmAclBatch batch;
     for (const auto &item : profiles) {
         if (item.GetTrustDeviceId() != remoteUdid) {
             continue;
@@ -2564,16 +2574,17 @@ int32_t DeviceProfileConnector::HandleAccountLogoutEvent(int32_t remoteUserId,
         int32_t accesserUserId = item.GetAccesser().GetAccesserUserId();
         int32_t accesseeUserId = item.GetAccessee().GetAccesseeUserId();
         if (accesserUdid == localUdid && accesseeUdid == remoteUdid && accesseeUserId == remoteUserId) {
-            DistributedDeviceProfileClient::GetInstance().DeleteAccessControlProfile(item.GetAccessControlId());
+            CacheAcerAclId(item, batch.delAclInfos);
             bindType = DM_IDENTICAL_ACCOUNT;
             continue;
         }
         if (accesseeUdid == localUdid && accesserUdid == remoteUdid && accesserUserId == remoteUserId) {
-            DistributedDeviceProfileClient::GetInstance().DeleteAccessControlProfile(item.GetAccessControlId());
+            CacheAceeAclId(item, batch.delAclInfos);
             bindType = DM_IDENTICAL_ACCOUNT;
             continue;
         }
     }
+    ApplyAclBatch(batch);
     return bindType;
 }
 
@@ -2828,6 +2839,7 @@ DmOfflineParam DeviceProfileConnector::HandleServiceUnBindEvent(int32_t remoteUs
 //LCOV_EXCL_START
 DM_EXPORT std::vector<AccessControlProfile> DeviceProfileConnector::GetAllAccessControlProfile()
 {
+    DM_PERF_SCOPE(DmPerfOp::DP_GET_ALL_ACL);
     std::vector<AccessControlProfile> profiles;
     int32_t ret = DistributedDeviceProfileClient::GetInstance().GetAllAccessControlProfile(profiles);
     if (ret != DM_OK) {
@@ -2838,6 +2850,7 @@ DM_EXPORT std::vector<AccessControlProfile> DeviceProfileConnector::GetAllAccess
 
 DM_EXPORT std::vector<AccessControlProfile> DeviceProfileConnector::GetAllAclIncludeLnnAcl()
 {
+    DM_PERF_SCOPE(DmPerfOp::DP_GET_ALL_ACL);
     std::vector<AccessControlProfile> profiles;
     int32_t ret = DistributedDeviceProfileClient::GetInstance().GetAllAclIncludeLnnAcl(profiles);
     if (ret != DM_OK) {
@@ -2853,6 +2866,40 @@ DM_EXPORT void DeviceProfileConnector::DeleteAccessControlById(
     DistributedDeviceProfileClient::GetInstance().DeleteAccessControlProfile(accessControlId);
 }
 
+DM_EXPORT int32_t DeviceProfileConnector::ApplyAclBatch(const DmAclBatch &batch)
+{
+    std::set<int64_t> delAclIds;
+    for (const auto &item : batch.delAclInfos) {
+        delAclIds.insert(item.accessControlId);
+    }
+    // Last update of an acl wins, acls deleted in the same batch are not updated at all.
+    std::map<int64_t, size_t> updateIndexes;
+    for (size_t i = 0; i < batch.updateProfiles.size(); i++) {
+        int64_t accessControlId = batch.updateProfiles[i].GetAccessControlId();
+        if (delAclIds.find(accessControlId) == delAclIds.end()) {
+            updateIndexes[accessControlId] = i;
+        }
+    }
+    int32_t ret = DM_OK;
+    for (const auto &item : updateIndexes) {
+        int32_t updateRet =
+            DistributedDeviceProfileClient::GetInstance().UpdateAccessControlProfile(batch.updateProfiles[item.second]);
+        if (updateRet != DM_OK) {
+            LOGE("update acl %{public}" PRId64 " failed, ret = %{public}d", item.first, updateRet);
+            ret = (ret == DM_OK) ? updateRet : ret;
+        }
+    }
+    for (const auto &accessControlId : delAclIds) {
+        int32_t delRet = DistributedDeviceProfileClient::GetInstance().DeleteAccessControlProfile(accessControlId);
+        if (delRet != DM_OK) {
+            LOGE("delete acl %{public}" PRId64 " failed, ret = %{public}d", accessControlId, delRet);
+            ret = (ret == DM_OK) ? delRet : ret;
+        }
+    }
+    LOGI("updated %{public}zu, deleted %{public}zu, ret %{public}d.", updateIndexes.size(), delAclIds.size(), ret);
+    return ret;
+}
+
 DM_EXPORT int32_t DeviceProfileConnector::HandleUserSwitched(
     const std::string &localUdid, const std::vector<std::string> &deviceVec, int32_t currentUserId,
     int32_t beforeUserId)
@@ -2895,12 +2942,11 @@ DM_EXPORT void DeviceProfileConnector::HandleUserSwitched(
     const std::vector<AccessControlProfile> &activeProfiles,
     const std::vector<AccessControlProfile> &inActiveProfiles)
 {
-    for (auto &item : inActiveProfiles) {
-        DistributedDeviceProfileClient::GetInstance().UpdateAccessControlProfile(item);
-    }
-    for (auto &item : activeProfiles) {
-        DistributedDeviceProfileClient::GetInstance().UpdateAccessControlProfile(item);
-    }
+    DmAclBatch batch;
+    batch.updateProfiles.reserve(inActiveProfiles.size() + activeProfiles.size());
+    batch.updateProfiles.insert(batch.updateProfiles.end(), inActiveProfiles.begin(), inActiveProfiles.end());
+    batch.updateProfiles.insert(batch.updateProfiles.end(), activeProfiles.begin(), activeProfiles.end());
+    ApplyAclBatch(batch);
 }
 
 std::vector<AccessControlProfile> DeviceProfileConnector::GetAclProfileByUserId(const std::string &localUdid,
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hichain_group_cache.h"
+
+#include "dm_error_type.h"
+#include "dm_log.h"
+#include "json_object.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+DM_IMPLEMENT_SINGLE_INSTANCE(HichainGroupCache);
+namespace {
+constexpr size_t MAX_GROUP_QUERY_NUM = 128;
+constexpr size_t MAX_CREDENTIAL_NUM = 64;
+// Same keys as FIELD_GROUP_* in device_auth_defines.h, this library does not depend on device_auth.
+constexpr const char *GROUP_NAME_KEY = "groupName";
+constexpr const char *GROUP_ID_KEY = "groupId";
+constexpr const char *GROUP_OWNER_KEY = "groupOwner";
+constexpr const char *GROUP_TYPE_KEY = "groupType";
+constexpr const char *GROUP_VISIBILITY_KEY = "groupVisibility";
+constexpr const char *GROUP_USER_ID_KEY = "userId";
+
+void ParseString(const JsonItemObject &item, const char *key, std::string &value)
+{
+    if (item.Contains(key) && item.At(key).IsString()) {
+        value = item.At(key).Get<std::string>();
+    }
+}
+
+void ParseInt(const JsonItemObject &item, const char *key, int32_t &value)
+{
+    if (item.Contains(key) && item.At(key).IsNumberInteger()) {
+        value = item.At(key).Get<int32_t>();
+    }
+}
+}
+
+void HichainGroupCache::SetGroupCacheEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    LOGI("group cache enabled: %{public}d.", enabled);
+    groupEnabled_ = enabled;
+    generation_++;
+    ClearGroupsLocked();
+}
+
+void HichainGroupCache::SetCredentialCacheEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    LOGI("credential cache enabled: %{public}d.", enabled);
+    credentialEnabled_ = enabled;
+    generation_++;
+    credInfos_.clear();
+}
+
+uint64_t HichainGroupCache::GetGeneration()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return generation_;
+}
+
+bool HichainGroupCache::GetGroupInfo(int32_t userId, const std::string &pkgName, const std::string &queryParams,
+    std::vector<HichainGroupRecord> &groups)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (!groupEnabled_) {
+        return false;
+    }
+    auto iter = groupInfos_.find(QueryKey(userId, pkgName, queryParams));
+    if (iter == groupInfos_.end()) {
+        return false;
+    }
+    groups = iter->second;
+    return true;
+}
+
+void HichainGroupCache::PutGroupInfo(int32_t userId, const std::string &pkgName, const std::string &queryParams,
+    const std::vector<HichainGroupRecord> &groups, uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (!groupEnabled_ || generation != generation_) {
+        return;
+    }
+    InsertQuery(IndexedKey(false, QueryKey(userId, pkgName, queryParams)), groups);
+}
+
+bool HichainGroupCache::GetRelatedGroups(int32_t userId, const std::string &pkgName, const std::string &peerUdid,
+    std::vector<HichainGroupRecord> &groups)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (!groupEnabled_) {
+        return false;
+    }
+    auto iter = relatedGroups_.find(QueryKey(userId, pkgName, peerUdid));
+    if (iter == relatedGroups_.end()) {
+        return false;
+    }
+    groups = iter->second;
+    return true;
+}
+
+void HichainGroupCache::PutRelatedGroups(int32_t userId, const std::string &pkgName, const std::string &peerUdid,
+    const std::vector<HichainGroupRecord> &groups, uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (!groupEnabled_ || generation != generation_) {
+        return;
+    }
+    InsertQuery(IndexedKey(true, QueryKey(userId, pkgName, peerUdid)), groups);
+}
+
+bool HichainGroupCache::GetCredentialInfo(int32_t userId, const std::string &credId, std::string &credInfo)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (!credentialEnabled_) {
+        return false;
+    }
+    auto iter = credInfos_.find(CredentialKey(userId, credId));
+    if (iter == credInfos_.end()) {
+        return false;
+    }
+    credInfo = iter->second;
+    return true;
+}
+
+void HichainGroupCache::PutCredentialInfo(int32_t userId, const std::string &credId, const std::string &credInfo,
+    uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (!credentialEnabled_ || generation != generation_) {
+        return;
+    }
+    if (credInfos_.size() >= MAX_CREDENTIAL_NUM) {
+        credInfos_.clear();
+    }
+    credInfos_[CredentialKey(userId, credId)] = credInfo;
+}
+
+void HichainGroupCache::InvalidateUser(int32_t userId)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    generation_++;
+    std::vector<IndexedKey> keys;
+    QueryKey begin(userId, "", "");
+    for (auto iter = groupInfos_.lower_bound(begin); iter != groupInfos_.end() &&
+        std::get<0>(iter->first) == userId; iter++) {
+        keys.emplace_back(false, iter->first);
+    }
+    for (auto iter = relatedGroups_.lower_bound(begin); iter != relatedGroups_.end() &&
+        std::get<0>(iter->first) == userId; iter++) {
+        keys.emplace_back(true, iter->first);
+    }
+    for (const auto &key : keys) {
+        EraseQuery(key);
+    }
+    auto credIter = credInfos_.lower_bound(CredentialKey(userId, ""));
+    while (credIter != credInfos_.end() && credIter->first.first == userId) {
+        credIter = credInfos_.erase(credIter);
+    }
+}
+
+void HichainGroupCache::InvalidateGroup(const std::string &groupId)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    generation_++;
+    auto iter = groupIndex_.find(groupId);
+    if (iter == groupIndex_.end()) {
+        return;
+    }
+    std::set<IndexedKey> keys = iter->second;
+    for (const auto &key : keys) {
+        EraseQuery(key);
+    }
+}
+
+void HichainGroupCache::InvalidatePeer(const std::string &peerUdid)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    generation_++;
+    auto iter = peerIndex_.find(peerUdid);
+    if (iter == peerIndex_.end()) {
+        return;
+    }
+    std::set<QueryKey> keys = iter->second;
+    for (const auto &key : keys) {
+        EraseQuery(IndexedKey(true, key));
+    }
+}
+
+void HichainGroupCache::InvalidateCredential(const std::string &credId)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    generation_++;
+    for (auto iter = credInfos_.begin(); iter != credInfos_.end();) {
+        if (iter->first.second == credId) {
+            iter = credInfos_.erase(iter);
+        } else {
+            iter++;
+        }
+    }
+}
+
+void HichainGroupCache::InvalidateAll()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    generation_++;
+    ClearGroupsLocked();
+    credInfos_.clear();
+}
+
+int32_t HichainGroupCache::ParseGroups(const std::string &groupsStr, std::vector<HichainGroupRecord> &groups)
+{
+    JsonObject jsonObject(groupsStr);
+    if (jsonObject.IsDiscarded()) {
+        LOGE("groups parse error.");
+        return ERR_DM_FAILED;
+    }
+    if (!jsonObject.IsArray()) {
+        LOGE("groups is not an array.");
+        return ERR_DM_FAILED;
+    }
+    std::vector<JsonItemObject> items = jsonObject.Items();
+    groups.clear();
+    groups.reserve(items.size());
+    for (const auto &item : items) {
+        HichainGroupRecord group;
+        ParseString(item, GROUP_NAME_KEY, group.groupName);
+        ParseString(item, GROUP_ID_KEY, group.groupId);
+        ParseString(item, GROUP_OWNER_KEY, group.groupOwner);
+        ParseInt(item, GROUP_TYPE_KEY, group.groupType);
+        ParseInt(item, GROUP_VISIBILITY_KEY, group.groupVisibility);
+        ParseString(item, GROUP_USER_ID_KEY, group.userId);
+        groups.push_back(group);
+    }
+    return DM_OK;
+}
+
+void HichainGroupCache::InsertQuery(const IndexedKey &indexedKey, const std::vector<HichainGroupRecord> &groups)
+{
+    EraseQuery(indexedKey);
+    if (groupInfos_.size() + relatedGroups_.size() >= MAX_GROUP_QUERY_NUM) {
+        ClearGroupsLocked();
+    }
+    const QueryKey &key = indexedKey.second;
+    if (indexedKey.first) {
+        relatedGroups_[key] = groups;
+        peerIndex_[std::get<2>(key)].insert(key);
+    } else {
+        groupInfos_[key] = groups;
+    }
+    for (const auto &group : groups) {
+        groupIndex_[group.groupId].insert(indexedKey);
+    }
+}
+
+void HichainGroupCache::EraseQuery(const IndexedKey &indexedKey)
+{
+    const QueryKey &key = indexedKey.second;
+    auto &queries = indexedKey.first ? relatedGroups_ : groupInfos_;
+    auto iter = queries.find(key);
+    if (iter == queries.end()) {
+        return;
+    }
+    for (const auto &group : iter->second) {
+        auto indexIter = groupIndex_.find(group.groupId);
+        if (indexIter == groupIndex_.end()) {
+            continue;
+        }
+        indexIter->second.erase(indexedKey);
+        if (indexIter->second.empty()) {
+            groupIndex_.erase(indexIter);
+        }
+    }
+    if (indexedKey.first) {
+        auto peerIter = peerIndex_.find(std::get<2>(key));
+        if (peerIter != peerIndex_.end()) {
+            peerIter->second.erase(key);
+            if (peerIter->second.empty()) {
+                peerIndex_.erase(peerIter);
+            }
+        }
+    }
+    queries.erase(iter);
+}
+
+void HichainGroupCache::ClearGroupsLocked()
+{
+    groupInfos_.clear();
+    relatedGroups_.clear();
+    groupIndex_.clear();
+    peerIndex_.clear();
+}
+} // namespace DistributedHardware
+} // namespace OHOS
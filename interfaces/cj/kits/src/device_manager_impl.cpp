@@ -98,6 +98,7 @@ int32_t TransformErrCode(const int32_t errCode)
         case ERR_DM_INPUT_PARA_INVALID:
         case ERR_DM_UNSUPPORTED_AUTH_TYPE:
             return ERR_INVALID_PARAMS;
+        case ERR_DM_IPC_CMD_BUSY:
         case ERR_DM_INIT_FAILED:
             return DM_ERR_OBTAIN_SERVICE;
         case ERR_NOT_SYSTEM_APP:
@@ -712,6 +712,22 @@ public:
         const std::map<std::string, std::string> &unbindParam, const std::string &netWorkId,
         int64_t serviceId) { return 0; }
     virtual int32_t UpdateServiceInfo(int64_t serviceId, const DmRegisterServiceInfo &regServiceInfo) { return 0; }
+    /**
+     * @brief Run several device queries in one IPC round trip.
+     * @param pkgName package name.
+     * @param items   the queries, each result is written back into its item.
+     * @return Returns 0 if the batch was delivered, per query errors are in the items.
+     */
+    virtual int32_t BatchQuery(const std::string &pkgName, std::vector<DmBatchQueryItem> &items) { return 0; }
+    /**
+     * @brief Register a callback invoked when the local device name changes.
+     * @param pkgName  package name.
+     * @param callback called after a rename, query the name again to get the new one.
+     * @return Returns 0 if the service accepted the registration.
+     */
+    virtual int32_t RegisterLocalDeviceNameChangeCallback(const std::string &pkgName,
+        std::shared_ptr<LocalDeviceNameChangeCallback> callback) { return 0; }
+    virtual int32_t UnRegisterLocalDeviceNameChangeCallback(const std::string &pkgName) { return 0; }
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -172,6 +172,14 @@ public:
     virtual void OnDeviceScreenStatus(const DmDeviceInfo &deviceInfo) = 0;
 };
 
+class LocalDeviceNameChangeCallback {
+public:
+    virtual ~LocalDeviceNameChangeCallback()
+    {
+    }
+    virtual void OnLocalDeviceNameChange() = 0;
+};
+
 class CredentialAuthStatusCallback {
 public:
     virtual ~CredentialAuthStatusCallback()
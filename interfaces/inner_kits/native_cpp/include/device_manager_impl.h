@@ -486,6 +486,10 @@ public:
     void SyncServiceCallbacksToService(
         std::map<DmCommonNotifyEvent, std::set<std::pair<std::string, int64_t>>> &callbackMap);
     virtual int32_t UpdateServiceInfo(int64_t serviceId, const DmRegisterServiceInfo &regServiceInfo) override;
+    virtual int32_t BatchQuery(const std::string &pkgName, std::vector<DmBatchQueryItem> &items) override;
+    virtual int32_t RegisterLocalDeviceNameChangeCallback(const std::string &pkgName,
+        std::shared_ptr<LocalDeviceNameChangeCallback> callback) override;
+    virtual int32_t UnRegisterLocalDeviceNameChangeCallback(const std::string &pkgName) override;
 private:
     DeviceManagerImpl() = default;
     ~DeviceManagerImpl() = default;
@@ -502,7 +506,7 @@ private:
     int32_t CheckApiPermission(int32_t permissionLevel);
     void ConvertDeviceInfoToDeviceBasicInfo(const DmDeviceInfo &info, DmDeviceBasicInfo &deviceBasicInfo);
     uint16_t GetSubscribeIdFromMap(const std::string &pkgName);
-    void SyncCallbackToService(DmCommonNotifyEvent dmCommonNotifyEvent, const std::string &pkgName);
+    int32_t SyncCallbackToService(DmCommonNotifyEvent dmCommonNotifyEvent, const std::string &pkgName);
     int32_t GetAnonyLocalUdid(const std::string &pkgName, std::string &anonyUdid);
     bool CheckAclByIpcCode(const DmAccessCaller &caller, const DmAccessCallee &callee,
         const DMIpcCmdInterfaceCode &ipcCode);
@@ -524,6 +528,12 @@ private:
 
     std::set<uint16_t> randSubIdSet_;
     std::set<uint16_t> randPubIdSet_;
+
+    // Levels the service granted and when, cleared when the service dies. The generation is bumped on every
+    // clear so a check that was in flight across the clear does not store its grant.
+    std::mutex permissionCacheLock_;
+    std::map<int32_t, int64_t> grantedPermissionTimeMs_;
+    uint64_t permissionCacheGeneration_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
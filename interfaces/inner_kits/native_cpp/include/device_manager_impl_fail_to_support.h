@@ -266,6 +266,10 @@ public:
         const std::map<std::string, std::string> &unbindParam, const std::string &netWorkId,
         int64_t serviceId) override;
     virtual int32_t UpdateServiceInfo(int64_t serviceId, const DmRegisterServiceInfo &regServiceInfo) override;
+    virtual int32_t BatchQuery(const std::string &pkgName, std::vector<DmBatchQueryItem> &items) override;
+    virtual int32_t RegisterLocalDeviceNameChangeCallback(const std::string &pkgName,
+        std::shared_ptr<LocalDeviceNameChangeCallback> callback) override;
+    virtual int32_t UnRegisterLocalDeviceNameChangeCallback(const std::string &pkgName) override;
 private:
     DeviceManagerImplFailToSupport() = default;
     ~DeviceManagerImplFailToSupport() = default;
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "dm_app_image_info.h"
 #include "dm_subscribe_info.h"
@@ -376,7 +377,9 @@ typedef enum {
     UN_REG_AUTH_CODE_INVALID = 10,
     REG_SERVICE_STATE = 11,
     UN_REG_SERVICE_STATE = 12,
-    MAX = 13,
+    REG_LOCAL_DEVICE_NAME_CHANGE = 13,
+    UN_REG_LOCAL_DEVICE_NAME_CHANGE = 14,
+    MAX = 15,
 } DmCommonNotifyEvent;
 
 DM_EXPORT extern const char* DEVICE_TYPE_UNKNOWN_STRING;
@@ -762,6 +765,32 @@ typedef struct PeerDevInfo {
     }
 } PeerDevInfo;
 
+typedef enum DmBatchQueryType {
+    DM_BATCH_QUERY_LOCAL_DEVICE_INFO = 0,
+    DM_BATCH_QUERY_TRUSTED_DEVICE_LIST = 1,
+    DM_BATCH_QUERY_DEVICE_INFO = 2,
+    DM_BATCH_QUERY_UDID_BY_NETWORK = 3,
+    DM_BATCH_QUERY_UUID_BY_NETWORK = 4,
+    DM_BATCH_QUERY_NETWORK_TYPE_BY_NETWORK = 5,
+} DmBatchQueryType;
+
+/**
+ * One query of DeviceManager::BatchQuery. networkId is the input of the by-network and device info
+ * queries, extra the input of the trusted device list. result carries the error code of this query alone,
+ * the fields matching type are filled when it is DM_OK.
+ */
+typedef struct DmBatchQueryItem {
+    DmBatchQueryType type = DM_BATCH_QUERY_LOCAL_DEVICE_INFO;
+    std::string networkId = "";
+    std::string extra = "";
+    int32_t result = 0;
+    DmDeviceInfo deviceInfo;
+    std::vector<DmDeviceInfo> deviceList;
+    std::string udid = "";
+    std::string uuid = "";
+    int32_t networkType = 0;
+} DmBatchQueryItem;
+
 struct PeerDevInfoHash {
     size_t operator()(const PeerDevInfo& key) const
     {
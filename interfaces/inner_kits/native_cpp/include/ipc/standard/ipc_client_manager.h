@@ -69,9 +69,14 @@ private:
     int32_t ClientInit();
     void SubscribeDMSAChangeListener();
     void UnSubscribeDMSAChangeListener();
+    sptr<IpcRemoteBroker> GetDmInterface();
+    void SetDmInterface(const sptr<IpcRemoteBroker> &dmInterface);
 private:
+    // Serializes Init, UnInit and service death; SendRequest never takes it.
     std::mutex lock_;
     std::map<std::string, sptr<IpcClientStub>> dmListener_;
+    // Only held to copy or swap dmInterface_, never across a binder transaction.
+    std::mutex interfaceLock_;
     sptr<IpcRemoteBroker> dmInterface_ { nullptr };
     sptr<DmDeathRecipient> dmRecipient_ { nullptr };
     std::atomic<bool> isSubscribeDMSAChangeListener = false;
@@ -73,6 +73,9 @@ public:
     void UnRegisterCredentialAuthStatusCallback(const std::string &pkgName);
     void RegisterSinkBindCallback(const std::string &pkgName, std::shared_ptr<BindTargetCallback> callback);
     void UnRegisterSinkBindCallback(const std::string &pkgName);
+    void RegisterLocalDeviceNameChangeCallback(const std::string &pkgName,
+        std::shared_ptr<LocalDeviceNameChangeCallback> callback);
+    void UnRegisterLocalDeviceNameChangeCallback(const std::string &pkgName);
 
     int32_t RegisterGetDeviceProfileInfoListCallback(const std::string &pkgName,
         std::shared_ptr<GetDeviceProfileInfoListCallback> callback);
@@ -162,6 +165,7 @@ public:
     void OnDeviceTrustChange(const std::string &pkgName, const std::string &udid, const std::string &uuid,
         int32_t authForm);
     void OnDeviceScreenStatus(const std::string &pkgName, const DmDeviceInfo &deviceInfo);
+    void OnLocalDeviceNameChange(const std::string &pkgName);
     void OnCredentialAuthStatus(const std::string &pkgName, const std::string &deviceList,
                                 uint16_t deviceTypeId, int32_t errcode);
     std::shared_ptr<DiscoveryCallback> GetDiscoveryCallback(const std::string &pkgName, uint16_t subscribeId);
@@ -200,6 +204,7 @@ private:
     std::map<std::string, std::shared_ptr<DeviceScreenStatusCallback>> deviceScreenStatusCallback_;
     std::map<std::string, std::shared_ptr<CredentialAuthStatusCallback>> credentialAuthStatusCallback_;
     std::map<std::string, std::shared_ptr<BindTargetCallback>> sinkBindTargetCallback_;
+    std::map<std::string, std::shared_ptr<LocalDeviceNameChangeCallback>> localDeviceNameChangeCallback_;
     std::mutex bindLock_;
     std::map<std::string, std::shared_ptr<GetDeviceProfileInfoListCallback>> getDeviceProfileInfoCallback_;
     std::map<std::string,
@@ -14,6 +14,7 @@
  */
 
 #include "device_manager_impl.h"
+#include <chrono>
 #include <random>
 #include "device_manager_notify.h"
 #include "dm_anonymous.h"
@@ -26,6 +27,8 @@
 #include "dm_random.h"
 #include "ipc_acl_profile_req.h"
 #include "ipc_authenticate_device_req.h"
+#include "ipc_batch_query_req.h"
+#include "ipc_batch_query_rsp.h"
 #include "ipc_bind_device_req.h"
 #include "ipc_bind_target_req.h"
 #include "ipc_check_access_control.h"
@@ -132,6 +135,96 @@ const int32_t SYSTEM_CORE = 2;
 const int32_t USLEEP_TIME_US_100000 = 100000; // 100ms
 constexpr int32_t SERVICE_INIT_MAX_NUM = 20;
 constexpr int32_t DM_STRING_LENGTH_MAX = 1024;
+// A revoke is not pushed to the client, so a grant is only reused this long.
+constexpr int64_t API_PERMISSION_CACHE_MS = 500;
+
+namespace {
+int32_t BuildBatchQueryCmd(const std::string &pkgName, const DmBatchQueryItem &item, IpcBatchQueryCmd &cmd)
+{
+    if (item.type == DM_BATCH_QUERY_LOCAL_DEVICE_INFO) {
+        cmd.cmdCode = GET_LOCAL_DEVICE_INFO;
+        cmd.req = std::make_shared<IpcReq>();
+        cmd.rsp = std::make_shared<IpcGetLocalDeviceInfoRsp>();
+        cmd.req->SetPkgName(pkgName);
+        return DM_OK;
+    }
+    if (item.type == DM_BATCH_QUERY_TRUSTED_DEVICE_LIST) {
+        std::shared_ptr<IpcGetTrustDeviceReq> req = std::make_shared<IpcGetTrustDeviceReq>();
+        req->SetPkgName(pkgName);
+        req->SetExtra(item.extra);
+        req->SetRefresh(false);
+        cmd.cmdCode = GET_TRUST_DEVICE_LIST;
+        cmd.req = req;
+        cmd.rsp = std::make_shared<IpcGetTrustDeviceRsp>();
+        return DM_OK;
+    }
+    if (item.networkId.empty()) {
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    std::shared_ptr<IpcGetInfoByNetWorkReq> req = std::make_shared<IpcGetInfoByNetWorkReq>();
+    req->SetPkgName(pkgName);
+    req->SetNetworkId(item.networkId);
+    cmd.req = req;
+    switch (item.type) {
+        case DM_BATCH_QUERY_DEVICE_INFO:
+            cmd.cmdCode = GET_DEVICE_INFO;
+            cmd.rsp = std::make_shared<IpcGetDeviceInfoRsp>();
+            return DM_OK;
+        case DM_BATCH_QUERY_UDID_BY_NETWORK:
+            cmd.cmdCode = GET_UDID_BY_NETWORK;
+            break;
+        case DM_BATCH_QUERY_UUID_BY_NETWORK:
+            cmd.cmdCode = GET_UUID_BY_NETWORK;
+            break;
+        case DM_BATCH_QUERY_NETWORK_TYPE_BY_NETWORK:
+            cmd.cmdCode = GET_NETWORKTYPE_BY_NETWORK;
+            break;
+        default:
+            return ERR_DM_INPUT_PARA_INVALID;
+    }
+    cmd.rsp = std::make_shared<IpcGetInfoByNetWorkRsp>();
+    return DM_OK;
+}
+
+// The service checks DATASYNC on every local device info request and answers a caller without it with the
+// networkId alone. Callers that need the other fields treat that answer as a denial, so a revoke takes effect
+// at once even while the client still holds a cached grant.
+bool IsOnlyNetworkIdShown(const DmDeviceInfo &info)
+{
+    return info.deviceId[0] == '\0';
+}
+
+int32_t ReadBatchQueryResult(const IpcBatchQueryCmd &cmd, DmBatchQueryItem &item)
+{
+    int32_t ret = cmd.rsp->GetErrCode();
+    if (ret != DM_OK) {
+        return ret;
+    }
+    switch (item.type) {
+        case DM_BATCH_QUERY_LOCAL_DEVICE_INFO:
+            item.deviceInfo = std::static_pointer_cast<IpcGetLocalDeviceInfoRsp>(cmd.rsp)->GetLocalDeviceInfo();
+            break;
+        case DM_BATCH_QUERY_TRUSTED_DEVICE_LIST:
+            item.deviceList = std::static_pointer_cast<IpcGetTrustDeviceRsp>(cmd.rsp)->GetDeviceVec();
+            break;
+        case DM_BATCH_QUERY_DEVICE_INFO:
+            item.deviceInfo = std::static_pointer_cast<IpcGetDeviceInfoRsp>(cmd.rsp)->GetDeviceInfo();
+            break;
+        case DM_BATCH_QUERY_UDID_BY_NETWORK:
+            item.udid = std::static_pointer_cast<IpcGetInfoByNetWorkRsp>(cmd.rsp)->GetUdid();
+            break;
+        case DM_BATCH_QUERY_UUID_BY_NETWORK:
+            item.uuid = std::static_pointer_cast<IpcGetInfoByNetWorkRsp>(cmd.rsp)->GetUuid();
+            break;
+        case DM_BATCH_QUERY_NETWORK_TYPE_BY_NETWORK:
+            item.networkType = std::static_pointer_cast<IpcGetInfoByNetWorkRsp>(cmd.rsp)->GetNetworkType();
+            break;
+        default:
+            return ERR_DM_INPUT_PARA_INVALID;
+    }
+    return DM_OK;
+}
+} // namespace
 
 DeviceManagerImpl &DeviceManagerImpl::GetInstance()
 {
@@ -1353,6 +1446,11 @@ int32_t DeviceManagerImpl::DeleteCredential(const std::string &pkgName, const st
 int32_t DeviceManagerImpl::OnDmServiceDied()
 {
     LOGI("Start");
+    {
+        std::lock_guard<std::mutex> autoLock(permissionCacheLock_);
+        grantedPermissionTimeMs_.clear();
+        permissionCacheGeneration_++;
+    }
     int32_t ret = ipcClientProxy_->OnDmServiceDied();
     if (ret != DM_OK) {
         LOGE("ret: %{public}d", ret);
@@ -1464,6 +1562,10 @@ int32_t DeviceManagerImpl::GetLocalDeviceId(const std::string &pkgName, std::str
         LOGI("get local device info failed.");
         return ret;
     }
+    if (IsOnlyNetworkIdShown(info)) {
+        LOGE("The caller does not have permission to get the local device id.");
+        return ERR_DM_NO_PERMISSION;
+    }
     deviceId = std::string(info.deviceId);
     LOGI("End, deviceId : %{public}s", GetAnonyString(deviceId).c_str());
     DmRadarHelper::GetInstance().ReportGetLocalDevInfo(pkgName, "GetLocalDeviceId", info, DM_OK, anonyLocalUdid_);
@@ -1520,6 +1622,10 @@ int32_t DeviceManagerImpl::GetLocalDeviceType(const std::string &pkgName,  int32
         LOGI("get local device info failed.");
         return ret;
     }
+    if (IsOnlyNetworkIdShown(info)) {
+        LOGE("The caller does not have permission to get the local device type.");
+        return ERR_DM_NO_PERMISSION;
+    }
     deviceType = info.deviceTypeId;
     LOGI("End, deviceType : %{public}d", deviceType);
     DmRadarHelper::GetInstance().ReportGetLocalDevInfo(pkgName, "GetLocalDeviceType", info, DM_OK, anonyLocalUdid_);
@@ -2352,6 +2458,17 @@ int32_t DeviceManagerImpl::GetDeviceSecurityLevel(const std::string &pkgName, co
 int32_t DeviceManagerImpl::CheckApiPermission(int32_t permissionLevel)
 {
     LOGI("PermissionLevel: %{public}d", permissionLevel);
+    int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> autoLock(permissionCacheLock_);
+        generation = permissionCacheGeneration_;
+        auto iter = grantedPermissionTimeMs_.find(permissionLevel);
+        if (iter != grantedPermissionTimeMs_.end() && nowMs - iter->second < API_PERMISSION_CACHE_MS) {
+            return DM_OK;
+        }
+    }
     std::shared_ptr<IpcPermissionReq> req = std::make_shared<IpcPermissionReq>();
     std::shared_ptr<IpcRsp> rsp = std::make_shared<IpcRsp>();
     req->SetPermissionLevel(permissionLevel);
@@ -2365,8 +2482,17 @@ int32_t DeviceManagerImpl::CheckApiPermission(int32_t permissionLevel)
     ret = rsp->GetErrCode();
     if (ret != DM_OK) {
         LOGE("Check permission failed with ret: %{public}d", ret);
+        std::lock_guard<std::mutex> autoLock(permissionCacheLock_);
+        grantedPermissionTimeMs_.erase(permissionLevel);
         return ret;
     }
+    // Only grants are kept, a denied caller asks again so a later grant takes effect at once.
+    {
+        std::lock_guard<std::mutex> autoLock(permissionCacheLock_);
+        if (generation == permissionCacheGeneration_) {
+            grantedPermissionTimeMs_[permissionLevel] = nowMs;
+        }
+    }
     LOGD("The caller declare the DM permission!");
     return DM_OK;
 }
@@ -2618,31 +2744,33 @@ uint16_t DeviceManagerImpl::GetSubscribeIdFromMap(const std::string &pkgName)
     return DM_INVALID_FLAG_ID;
 }
 
-void DeviceManagerImpl::SyncCallbackToService(DmCommonNotifyEvent dmCommonNotifyEvent, const std::string &pkgName)
+int32_t DeviceManagerImpl::SyncCallbackToService(DmCommonNotifyEvent dmCommonNotifyEvent,
+    const std::string &pkgName)
 {
     if (pkgName.empty()) {
         LOGE("Invalid parameter, pkgName is empty.");
-        return;
+        return ERR_DM_INPUT_PARA_INVALID;
     }
     if (!IsDmCommonNotifyEventValid(dmCommonNotifyEvent)) {
         LOGE("Invalid dmCommonNotifyEvent: %{public}d.", dmCommonNotifyEvent);
-        return;
+        return ERR_DM_INPUT_PARA_INVALID;
     }
     std::shared_ptr<IpcSyncCallbackReq> req = std::make_shared<IpcSyncCallbackReq>();
     std::shared_ptr<IpcRsp> rsp = std::make_shared<IpcRsp>();
     req->SetPkgName(pkgName);
     req->SetDmCommonNotifyEvent(static_cast<int32_t>(dmCommonNotifyEvent));
-    CHECK_NULL_VOID(ipcClientProxy_);
+    CHECK_NULL_RETURN(ipcClientProxy_, ERR_DM_POINT_NULL);
     int32_t ret = ipcClientProxy_->SendRequest(SYNC_CALLBACK, req, rsp);
     if (ret != DM_OK) {
         LOGE("Send Request failed ret: %{public}d", ret);
-        return;
+        return ret;
     }
     ret = rsp->GetErrCode();
     if (ret != DM_OK) {
         LOGE("Failed with ret %{public}d", ret);
-        return;
+        return ret;
     }
+    return DM_OK;
 }
 
 int32_t DeviceManagerImpl::GetAllTrustedDeviceList(const std::string &pkgName, const std::string &extra,
@@ -3841,5 +3969,85 @@ int32_t DeviceManagerImpl::UpdateServiceInfo(int64_t serviceId, const DmRegister
     LOGI("End");
     return DM_OK;
 }
+
+int32_t DeviceManagerImpl::BatchQuery(const std::string &pkgName, std::vector<DmBatchQueryItem> &items)
+{
+    if (pkgName.empty() || items.empty() || items.size() > static_cast<size_t>(DM_BATCH_QUERY_MAX_NUM)) {
+        LOGE("Invalid para, pkgName: %{public}s, size: %{public}zu", GetAnonyString(pkgName).c_str(), items.size());
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    LOGD("Start, pkgName: %{public}s, size: %{public}zu", GetAnonyString(pkgName).c_str(), items.size());
+    std::vector<IpcBatchQueryCmd> cmds;
+    std::vector<size_t> indexes;
+    for (size_t i = 0; i < items.size(); i++) {
+        IpcBatchQueryCmd cmd;
+        items[i].result = BuildBatchQueryCmd(pkgName, items[i], cmd);
+        if (items[i].result == DM_OK) {
+            cmds.push_back(cmd);
+            indexes.push_back(i);
+        }
+    }
+    if (cmds.empty()) {
+        LOGE("no valid query.");
+        return DM_OK;
+    }
+    std::shared_ptr<IpcBatchQueryReq> req = std::make_shared<IpcBatchQueryReq>();
+    std::shared_ptr<IpcBatchQueryRsp> rsp = std::make_shared<IpcBatchQueryRsp>();
+    req->SetPkgName(pkgName);
+    req->SetCmds(cmds);
+    rsp->SetCmds(cmds);
+    CHECK_NULL_RETURN(ipcClientProxy_, ERR_DM_POINT_NULL);
+    int32_t ret = ipcClientProxy_->SendRequest(BATCH_QUERY, req, rsp);
+    if (ret == DM_OK && rsp->GetErrCode() == ERR_DM_IPC_CMD_BUSY) {
+        // Rejected for load, sending the queries one by one would only add to it.
+        LOGW("Batch rejected, service busy.");
+        for (const auto &cmd : cmds) {
+            cmd.rsp->SetErrCode(ERR_DM_IPC_CMD_BUSY);
+        }
+    } else if (ret != DM_OK || rsp->GetErrCode() != DM_OK) {
+        // A service or ipc backend without the batch command still answers the queries one by one.
+        LOGW("Batch failed ret: %{public}d, send the queries one by one.", ret);
+        for (const auto &cmd : cmds) {
+            if (ipcClientProxy_->SendRequest(cmd.cmdCode, cmd.req, cmd.rsp) != DM_OK) {
+                cmd.rsp->SetErrCode(ERR_DM_IPC_SEND_REQUEST_FAILED);
+            }
+        }
+    }
+    for (size_t i = 0; i < cmds.size(); i++) {
+        items[indexes[i]].result = ReadBatchQueryResult(cmds[i], items[indexes[i]]);
+    }
+    LOGI("Completed, size: %{public}zu", cmds.size());
+    return DM_OK;
+}
+
+int32_t DeviceManagerImpl::RegisterLocalDeviceNameChangeCallback(const std::string &pkgName,
+    std::shared_ptr<LocalDeviceNameChangeCallback> callback)
+{
+    if (pkgName.empty() || callback == nullptr) {
+        LOGE("Invalid para");
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    DeviceManagerNotify::GetInstance().RegisterLocalDeviceNameChangeCallback(pkgName, callback);
+    int32_t ret = SyncCallbackToService(DmCommonNotifyEvent::REG_LOCAL_DEVICE_NAME_CHANGE, pkgName);
+    if (ret != DM_OK) {
+        LOGE("Sync callback failed ret: %{public}d", ret);
+        DeviceManagerNotify::GetInstance().UnRegisterLocalDeviceNameChangeCallback(pkgName);
+        return ret;
+    }
+    LOGI("Completed, pkgName: %{public}s", pkgName.c_str());
+    return DM_OK;
+}
+
+int32_t DeviceManagerImpl::UnRegisterLocalDeviceNameChangeCallback(const std::string &pkgName)
+{
+    if (pkgName.empty()) {
+        LOGE("Invalid para");
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    SyncCallbackToService(DmCommonNotifyEvent::UN_REG_LOCAL_DEVICE_NAME_CHANGE, pkgName);
+    DeviceManagerNotify::GetInstance().UnRegisterLocalDeviceNameChangeCallback(pkgName);
+    LOGI("Completed, pkgName: %{public}s", pkgName.c_str());
+    return DM_OK;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
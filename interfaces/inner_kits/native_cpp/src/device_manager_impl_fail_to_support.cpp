@@ -913,5 +913,24 @@ int32_t DeviceManagerImplFailToSupport::UpdateServiceInfo(int64_t serviceId,
     LOGI("device not support");
     return ERR_DM_DEVICE_NOT_SUPPORT;
 }
+
+int32_t DeviceManagerImplFailToSupport::BatchQuery(const std::string &pkgName, std::vector<DmBatchQueryItem> &items)
+{
+    LOGI("device not support");
+    return ERR_DM_DEVICE_NOT_SUPPORT;
+}
+
+int32_t DeviceManagerImplFailToSupport::RegisterLocalDeviceNameChangeCallback(const std::string &pkgName,
+    std::shared_ptr<LocalDeviceNameChangeCallback> callback)
+{
+    LOGI("device not support");
+    return ERR_DM_DEVICE_NOT_SUPPORT;
+}
+
+int32_t DeviceManagerImplFailToSupport::UnRegisterLocalDeviceNameChangeCallback(const std::string &pkgName)
+{
+    LOGI("device not support");
+    return ERR_DM_DEVICE_NOT_SUPPORT;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -70,10 +70,10 @@ int32_t IpcClientManager::ClientInit()
     }
     if (!object->IsProxyObject()) {
         LOGI("object is not proxy object.");
-        dmInterface_ = sptr<IpcClientServerProxy>(new IpcClientServerProxy(object));
+        SetDmInterface(sptr<IpcClientServerProxy>(new IpcClientServerProxy(object)));
         return DM_OK;
     }
-    dmInterface_ = iface_cast<IpcRemoteBroker>(object);
+    SetDmInterface(iface_cast<IpcRemoteBroker>(object));
     LOGI("Completed");
     return DM_OK;
 }
@@ -141,7 +141,7 @@ int32_t IpcClientManager::UnInit(const std::string &pkgName)
             dmInterface_->AsObject()->RemoveDeathRecipient(dmRecipient_);
             dmRecipient_ = nullptr;
         }
-        dmInterface_ = nullptr;
+        SetDmInterface(nullptr);
     }
     UnSubscribeDMSAChangeListener();
     LOGI("completed, pkgName: %{public}s", pkgName.c_str());
@@ -157,16 +157,29 @@ int32_t IpcClientManager::SendRequest(int32_t cmdCode, std::shared_ptr<IpcReq> r
     if (req == nullptr || rsp == nullptr) {
         return ERR_DM_INPUT_PARA_INVALID;
     }
-    std::lock_guard<std::mutex> autoLock(lock_);
-    if (dmInterface_ != nullptr) {
+    // The local reference keeps the proxy alive if the service dies while the command is in flight.
+    sptr<IpcRemoteBroker> dmInterface = GetDmInterface();
+    if (dmInterface != nullptr) {
         LOGD("cmdCode: %{public}d", cmdCode);
-        return dmInterface_->SendCmd(cmdCode, req, rsp);
+        return dmInterface->SendCmd(cmdCode, req, rsp);
     } else {
         LOGE("dmInterface_ is not init.");
         return ERR_DM_INIT_FAILED;
     }
 }
 
+sptr<IpcRemoteBroker> IpcClientManager::GetDmInterface()
+{
+    std::lock_guard<std::mutex> autoLock(interfaceLock_);
+    return dmInterface_;
+}
+
+void IpcClientManager::SetDmInterface(const sptr<IpcRemoteBroker> &dmInterface)
+{
+    std::lock_guard<std::mutex> autoLock(interfaceLock_);
+    dmInterface_ = dmInterface;
+}
+
 int32_t IpcClientManager::OnDmServiceDied()
 {
     LOGI("begin");
@@ -180,7 +193,7 @@ int32_t IpcClientManager::OnDmServiceDied()
             dmInterface_->AsObject()->RemoveDeathRecipient(dmRecipient_);
             dmRecipient_ = nullptr;
         }
-        dmInterface_ = nullptr;
+        SetDmInterface(nullptr);
     }
     LOGI("complete");
     return DM_OK;
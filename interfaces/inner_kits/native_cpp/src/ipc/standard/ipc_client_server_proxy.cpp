@@ -44,7 +44,16 @@ int32_t IpcClientServerProxy::SendCmd(int32_t cmdCode, std::shared_ptr<IpcReq> r
     if (IpcCmdRegister::GetInstance().SetRequest(cmdCode, req, data) != DM_OK) {
         return ERR_DM_IPC_SEND_REQUEST_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(cmdCode), data, reply, option) != DM_OK) {
+    int32_t ret = remote->SendRequest(static_cast<uint32_t>(cmdCode), data, reply, option);
+    if (ret == ERR_DM_IPC_CMD_BUSY) {
+        // Rejected by the server admission before the handler ran, so the reply is empty. Report the busy code
+        // as the command result, callers already hand rsp->GetErrCode() back to the app unchanged.
+        LOGW("cmd:%{public}d rejected, server busy", cmdCode);
+        CHECK_NULL_RETURN(rsp, ERR_DM_POINT_NULL);
+        rsp->SetErrCode(ERR_DM_IPC_CMD_BUSY);
+        return DM_OK;
+    }
+    if (ret != DM_OK) {
         LOGE("SendRequest fail, cmd:%{public}d", cmdCode);
         return ERR_DM_IPC_SEND_REQUEST_FAILED;
     }
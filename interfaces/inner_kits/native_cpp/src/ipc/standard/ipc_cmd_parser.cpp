@@ -22,6 +22,8 @@
 #include "dm_log.h"
 #include "ipc_acl_profile_req.h"
 #include "ipc_authenticate_device_req.h"
+#include "ipc_batch_query_req.h"
+#include "ipc_batch_query_rsp.h"
 #include "ipc_bind_device_req.h"
 #include "ipc_bind_target_req.h"
 #include "ipc_check_access_control.h"
@@ -1677,6 +1679,15 @@ ON_IPC_CMD(SERVER_DEVICE_SCREEN_STATE_NOTIFY, MessageParcel &data, MessageParcel
     return DM_OK;
 }
 
+ON_IPC_CMD(SERVER_LOCAL_DEVICE_NAME_CHANGE_NOTIFY, MessageParcel &data, MessageParcel &reply)
+{
+    std::string pkgName = data.ReadString();
+    DeviceManagerNotify::GetInstance().OnLocalDeviceNameChange(pkgName);
+
+    reply.WriteInt32(DM_OK);
+    return DM_OK;
+}
+
 ON_IPC_SET_REQUEST(GET_DEVICE_SCREEN_STATUS, std::shared_ptr<IpcReq> pBaseReq, MessageParcel &data)
 {
     CHECK_NULL_RETURN(pBaseReq, ERR_DM_FAILED);
@@ -2920,5 +2931,70 @@ ON_IPC_READ_RESPONSE(UNBIND_SERVICE_TARGET, MessageParcel &reply, std::shared_pt
     pBaseRsp->SetErrCode(reply.ReadInt32());
     return DM_OK;
 }
+
+ON_IPC_SET_REQUEST(BATCH_QUERY, std::shared_ptr<IpcReq> pBaseReq, MessageParcel &data)
+{
+    CHECK_NULL_RETURN(pBaseReq, ERR_DM_FAILED);
+    std::shared_ptr<IpcBatchQueryReq> pReq = std::static_pointer_cast<IpcBatchQueryReq>(pBaseReq);
+    const std::vector<IpcBatchQueryCmd> &cmds = pReq->GetCmds();
+    if (!data.WriteString(pReq->GetPkgName())) {
+        LOGE("write pkgName failed");
+        return ERR_DM_IPC_WRITE_FAILED;
+    }
+    if (!data.WriteInt32(static_cast<int32_t>(cmds.size()))) {
+        LOGE("write cmd num failed");
+        return ERR_DM_IPC_WRITE_FAILED;
+    }
+    // Every query is encoded by its own codec into a sub parcel, so the server can hand it over unchanged.
+    for (const auto &cmd : cmds) {
+        MessageParcel cmdData;
+        int32_t ret = IpcCmdRegister::GetInstance().SetRequest(cmd.cmdCode, cmd.req, cmdData);
+        if (ret != DM_OK) {
+            LOGE("set request cmd %{public}d failed, ret: %{public}d", cmd.cmdCode, ret);
+            return ret;
+        }
+        uint32_t size = static_cast<uint32_t>(cmdData.GetDataSize());
+        if (!data.WriteInt32(cmd.cmdCode) || !data.WriteUint32(size) ||
+            (size > 0 && !data.WriteBuffer(reinterpret_cast<const void *>(cmdData.GetData()), size))) {
+            LOGE("write cmd %{public}d failed", cmd.cmdCode);
+            return ERR_DM_IPC_WRITE_FAILED;
+        }
+    }
+    return DM_OK;
+}
+
+ON_IPC_READ_RESPONSE(BATCH_QUERY, MessageParcel &reply, std::shared_ptr<IpcRsp> pBaseRsp)
+{
+    CHECK_NULL_RETURN(pBaseRsp, ERR_DM_FAILED);
+    std::shared_ptr<IpcBatchQueryRsp> pRsp = std::static_pointer_cast<IpcBatchQueryRsp>(pBaseRsp);
+    const std::vector<IpcBatchQueryCmd> &cmds = pRsp->GetCmds();
+    int32_t num = reply.ReadInt32();
+    if (num != static_cast<int32_t>(cmds.size())) {
+        LOGE("cmd num mismatch, expect: %{public}zu, actual: %{public}d", cmds.size(), num);
+        pRsp->SetErrCode(ERR_DM_IPC_READ_FAILED);
+        return ERR_DM_IPC_READ_FAILED;
+    }
+    for (const auto &cmd : cmds) {
+        CHECK_NULL_RETURN(cmd.rsp, ERR_DM_FAILED);
+        int32_t ret = reply.ReadInt32();
+        uint32_t size = reply.ReadUint32();
+        const uint8_t *buffer = size > 0 ? reply.ReadBuffer(size) : nullptr;
+        if (ret != DM_OK || buffer == nullptr) {
+            cmd.rsp->SetErrCode(ret != DM_OK ? ret : ERR_DM_IPC_READ_FAILED);
+            continue;
+        }
+        MessageParcel cmdReply;
+        if (!cmdReply.WriteBuffer(buffer, size)) {
+            cmd.rsp->SetErrCode(ERR_DM_IPC_READ_FAILED);
+            continue;
+        }
+        ret = IpcCmdRegister::GetInstance().ReadResponse(cmd.cmdCode, cmdReply, cmd.rsp);
+        if (ret != DM_OK) {
+            cmd.rsp->SetErrCode(ret);
+        }
+    }
+    pRsp->SetErrCode(DM_OK);
+    return DM_OK;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
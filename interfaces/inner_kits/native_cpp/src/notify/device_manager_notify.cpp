@@ -1206,6 +1206,52 @@ void DeviceManagerNotify::UnRegisterSinkBindCallback(const std::string &pkgName)
     sinkBindTargetCallback_.erase(pkgName);
 }
 
+void DeviceManagerNotify::RegisterLocalDeviceNameChangeCallback(const std::string &pkgName,
+    std::shared_ptr<LocalDeviceNameChangeCallback> callback)
+{
+    if (pkgName.empty() || callback == nullptr) {
+        LOGE("Invalid parameter, pkgName is empty or callback is nullptr.");
+        return;
+    }
+    std::lock_guard<std::mutex> autoLock(lock_);
+    CHECK_SIZE_VOID(localDeviceNameChangeCallback_);
+    localDeviceNameChangeCallback_[pkgName] = callback;
+}
+
+void DeviceManagerNotify::UnRegisterLocalDeviceNameChangeCallback(const std::string &pkgName)
+{
+    if (pkgName.empty()) {
+        LOGE("Invalid parameter, pkgName is empty.");
+        return;
+    }
+    std::lock_guard<std::mutex> autoLock(lock_);
+    localDeviceNameChangeCallback_.erase(pkgName);
+}
+
+void DeviceManagerNotify::OnLocalDeviceNameChange(const std::string &pkgName)
+{
+    if (pkgName.empty()) {
+        LOGE("Invalid parameter, pkgName is empty.");
+        return;
+    }
+    LOGI("In, pkgName:%{public}s", pkgName.c_str());
+    std::shared_ptr<LocalDeviceNameChangeCallback> tempCbk;
+    {
+        std::lock_guard<std::mutex> autoLock(lock_);
+        auto iter = localDeviceNameChangeCallback_.find(pkgName);
+        if (iter == localDeviceNameChangeCallback_.end()) {
+            LOGE("local device name change not register.");
+            return;
+        }
+        tempCbk = iter->second;
+    }
+    if (tempCbk == nullptr) {
+        LOGE("registered local device name change callback is nullptr.");
+        return;
+    }
+    tempCbk->OnLocalDeviceNameChange();
+}
+
 void DeviceManagerNotify::OnSinkBindResult(const std::string &pkgName, const PeerTargetId &targetId,
     int32_t result, int32_t status, std::string content)
 {
@@ -1291,6 +1337,14 @@ void DeviceManagerNotify::GetCallBack(std::map<DmCommonNotifyEvent, std::set<std
     if (authStatusPkgnameSet.size() > 0) {
         callbackMap[DmCommonNotifyEvent::REG_CREDENTIAL_AUTH_STATUS_NOTIFY] = authStatusPkgnameSet;
     }
+
+    std::set<std::string> nameChangePkgnameSet;
+    for (auto it : localDeviceNameChangeCallback_) {
+        nameChangePkgnameSet.insert(it.first);
+    }
+    if (nameChangePkgnameSet.size() > 0) {
+        callbackMap[DmCommonNotifyEvent::REG_LOCAL_DEVICE_NAME_CHANGE] = nameChangePkgnameSet;
+    }
 }
 
 int32_t DeviceManagerNotify::RegisterGetDeviceProfileInfoListCallback(const std::string &pkgName,
@@ -216,6 +216,7 @@ napi_value CreateBusinessError(napi_env env, int32_t errCode, bool isAsync = tru
             error = CreateErrorForCall(env, static_cast<int32_t>(DMBussinessErrorCode::ERR_INVALID_PARAMS),
                 ERR_MESSAGE_INVALID_PARAMS, isAsync);
             break;
+        case ERR_DM_IPC_CMD_BUSY:
         case ERR_DM_INIT_FAILED:
             error = CreateErrorForCall(env, static_cast<int32_t>(DMBussinessErrorCode::DM_ERR_OBTAIN_SERVICE),
                 ERR_MESSAGE_OBTAIN_SERVICE, isAsync);
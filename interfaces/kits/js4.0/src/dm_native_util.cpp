@@ -269,6 +269,7 @@ napi_value CreateBusinessError(napi_env env, int32_t errCode, bool isAsync)
         case ERR_DM_CALLBACK_REGISTER_FAILED:
             error = CreateErrorForCall(env, ERR_INVALID_PARAMS, ERR_MESSAGE_INVALID_PARAMS, isAsync);
             break;
+        case ERR_DM_IPC_CMD_BUSY:
         case ERR_DM_INIT_FAILED:
             error = CreateErrorForCall(env, DM_ERR_OBTAIN_SERVICE, ERR_MESSAGE_OBTAIN_SERVICE, isAsync);
             break;
@@ -319,6 +320,7 @@ napi_value CreateBusinessErrorSystem(napi_env env, int32_t errCode, bool isAsync
         case ERR_DM_CALLBACK_REGISTER_FAILED:
             error = CreateErrorForCallSystem(env, ERR_INVALID_PARAMS, ERR_MESSAGE_INVALID_PARAMS, isAsync);
             break;
+        case ERR_DM_IPC_CMD_BUSY:
         case ERR_DM_INIT_FAILED:
             error = CreateErrorForCallSystem(env, DM_ERR_OBTAIN_SERVICE, ERR_MESSAGE_OBTAIN_SERVICE, isAsync);
             break;
@@ -16,12 +16,26 @@
 #ifndef OHOS_NDK_DM_CLIENT_H
 #define OHOS_NDK_DM_CLIENT_H
 
+#include <atomic>
 #include <mutex>
 #include <string>
 #include "device_manager_callback.h"
 
 namespace OHOS {
 namespace DistributedHardware {
+// Every Clear() starts a new generation, a fetch begun in an older one cannot store its result.
+class LocalDeviceNameCache {
+public:
+    bool Get(std::string &deviceName, uint64_t &generation);
+    void Put(const std::string &deviceName, uint64_t generation);
+    void Clear();
+private:
+    std::mutex mtx_;
+    bool valid_ = false;
+    std::string deviceName_ = "";
+    uint64_t generation_ = 0;
+};
+
 class DmClient {
 public:
     static DmClient &GetInstance();
@@ -37,15 +51,26 @@ private:
     DmClient &operator=(const DmClient &) = delete;
     DmClient(DmClient &&) = delete;
     DmClient &operator=(DmClient &&) = delete;
+    void OnServiceDied();
+    void ClearLocalDeviceCache();
 private:
     std::mutex initMtx_;
+    std::atomic<bool> initialized_ {false};
     std::string pkgName_ = "";
     std::shared_ptr<DmInitCallback> dmInitCallback_;
+    std::shared_ptr<LocalDeviceNameChangeCallback> nameChangeCallback_;
+    std::atomic<bool> nameChangeRegistered_ {false};
+    LocalDeviceNameCache localDeviceNameCache_;
 
 class InitCallback : public DmInitCallback {
 public:
     void OnRemoteDied() override;
 };
+
+class NameChangeCallback : public LocalDeviceNameChangeCallback {
+public:
+    void OnLocalDeviceNameChange() override;
+};
 };
 } // namespace DistributedHardware
 } // namespace OHOS
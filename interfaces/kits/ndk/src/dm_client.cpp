@@ -23,6 +23,36 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+bool LocalDeviceNameCache::Get(std::string &deviceName, uint64_t &generation)
+{
+    std::lock_guard<std::mutex> lck(mtx_);
+    generation = generation_;
+    if (!valid_) {
+        return false;
+    }
+    deviceName = deviceName_;
+    return true;
+}
+
+void LocalDeviceNameCache::Put(const std::string &deviceName, uint64_t generation)
+{
+    std::lock_guard<std::mutex> lck(mtx_);
+    if (generation != generation_) {
+        LOGI("Local device name changed during the query, not cached.");
+        return;
+    }
+    deviceName_ = deviceName;
+    valid_ = true;
+}
+
+void LocalDeviceNameCache::Clear()
+{
+    std::lock_guard<std::mutex> lck(mtx_);
+    generation_++;
+    deviceName_ = "";
+    valid_ = false;
+}
+
 DmClient &DmClient::GetInstance()
 {
     static DmClient instance;
@@ -31,7 +61,13 @@ DmClient &DmClient::GetInstance()
 
 int32_t DmClient::Init()
 {
+    if (initialized_.load(std::memory_order_acquire)) {
+        return ERR_OK;
+    }
     std::lock_guard<std::mutex> lck(initMtx_);
+    if (initialized_.load(std::memory_order_relaxed)) {
+        return ERR_OK;
+    }
     if (pkgName_.empty()) {
         std::string bundleName = "";
         int32_t ret = AppManager::GetInstance().GetBundleNameForSelf(bundleName);
@@ -49,16 +85,31 @@ int32_t DmClient::Init()
         LOGE("Init failed, ret=%{public}d", ret);
         return DM_ERR_OBTAIN_SERVICE;
     }
+    if (nameChangeCallback_ == nullptr) {
+        nameChangeCallback_ = std::make_shared<DmClient::NameChangeCallback>();
+    }
+    // Without the rename notify a cached name could go stale, so the cache is only used once registered.
+    ret = DeviceManager::GetInstance().RegisterLocalDeviceNameChangeCallback(pkgName_, nameChangeCallback_);
+    if (ret != DM_OK) {
+        LOGW("Register name change callback failed, ret=%{public}d", ret);
+    }
+    nameChangeRegistered_.store(ret == DM_OK, std::memory_order_release);
+    initialized_.store(true, std::memory_order_release);
     return ERR_OK;
 }
 
 int32_t DmClient::UnInit()
 {
     std::lock_guard<std::mutex> lck(initMtx_);
+    initialized_.store(false, std::memory_order_release);
+    if (nameChangeRegistered_.exchange(false, std::memory_order_acq_rel)) {
+        DeviceManager::GetInstance().UnRegisterLocalDeviceNameChangeCallback(pkgName_);
+    }
     if (dmInitCallback_ != nullptr) {
         DeviceManager::GetInstance().UnInitDeviceManager(pkgName_);
     }
     pkgName_ = "";
+    ClearLocalDeviceCache();
     return ERR_OK;
 }
 
@@ -75,17 +126,43 @@ int32_t DmClient::GetLocalDeviceName(std::string &deviceName)
         LOGE("Init dm client failed, ret=%{public}d", ret);
         return ret;
     }
+    bool useCache = nameChangeRegistered_.load(std::memory_order_acquire);
+    uint64_t generation = 0;
+    if (useCache && localDeviceNameCache_.Get(deviceName, generation)) {
+        return ERR_OK;
+    }
     ret = DeviceManager::GetInstance().GetLocalDeviceName(deviceName);
     if (ret != DM_OK) {
         LOGE("Get local device name failed, ret=%{public}d", ret);
         return DM_ERR_FAILED;
     }
+    if (useCache) {
+        localDeviceNameCache_.Put(deviceName, generation);
+    }
     return ERR_OK;
 }
 
+void DmClient::OnServiceDied()
+{
+    // Re-initialized by the next call, the dead service's registration is gone anyway.
+    initialized_.store(false, std::memory_order_release);
+    nameChangeRegistered_.store(false, std::memory_order_release);
+    ClearLocalDeviceCache();
+}
+
+void DmClient::ClearLocalDeviceCache()
+{
+    localDeviceNameCache_.Clear();
+}
+
 void DmClient::InitCallback::OnRemoteDied()
 {
-    DmClient::GetInstance().ReInit();
+    DmClient::GetInstance().OnServiceDied();
+}
+
+void DmClient::NameChangeCallback::OnLocalDeviceNameChange()
+{
+    DmClient::GetInstance().ClearLocalDeviceCache();
 }
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -117,6 +117,7 @@ ani_object CreateBusinessError(int32_t errCode, bool isAsync)
         case ERR_DM_CALLBACK_REGISTER_FAILED:
             error = CreateErrorForCall(env, ERR_INVALID_PARAMS, ERR_MESSAGE_INVALID_PARAMS, isAsync);
             break;
+        case ERR_DM_IPC_CMD_BUSY:
         case ERR_DM_INIT_FAILED:
             error = CreateErrorForCall(env, DM_ERR_OBTAIN_SERVICE, ERR_MESSAGE_OBTAIN_SERVICE, isAsync);
             break;
@@ -313,6 +313,7 @@ struct DmAuthContext {
     bool needAuth{true};
     bool pinCodeFlag{false};
     bool ncmBindTarget{false};
+    bool isSupportSyncV2{false};                // Both sides support the binary sync envelope
     ffrt::mutex certMtx_; // cert lock
     ffrt::mutex certCVMtx_; // cert cv lock
     ffrt::condition_variable certCV_; // cert cv
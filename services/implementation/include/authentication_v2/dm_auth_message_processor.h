@@ -52,6 +52,8 @@ extern const char* TAG_AUTHORIZED_SCOPE;
 extern const char* TAG_AUTHORIZED_APP_LIST;
 extern const char* TAG_CREDENTIAL_OWNER;
 extern const char* TAG_SYNC;
+extern const char* TAG_SYNC_V2;
+extern const char* TAG_SUPPORT_SYNC_V2;
 extern const char* TAG_ACCESS;
 extern const char* TAG_PROXY;
 extern const char* TAG_ACL;
@@ -247,6 +249,11 @@ private:
     // Internal implementations for various message types
     // Used to encrypt the synchronization message
     int32_t EncryptSyncMessage(std::shared_ptr<DmAuthContext> &context, DmAccess &accessSide, std::string &encSyncMsg);
+    // Binary envelope of the sync message, used when both sides announced TAG_SUPPORT_SYNC_V2
+    int32_t EncryptSyncMessageV2(std::shared_ptr<DmAuthContext> &context, DmAccess &accessSide,
+        std::string &encSyncMsg);
+    int32_t BuildSyncMsg(std::shared_ptr<DmAuthContext> &context, DmAccess &accessSide, std::string &syncMsg);
+    int32_t SetSyncMessage(std::shared_ptr<DmAuthContext> &context, DmAccess &accessSide, JsonObject &jsonObject);
     int32_t CreateProxyAccessMessage(std::shared_ptr<DmAuthContext> &context, JsonObject &syncMsgJson);
     // Parse the authentication start message
     int32_t ParseAuthStartMessage(const JsonObject &jsonObject, std::shared_ptr<DmAuthContext> context);
@@ -272,6 +279,8 @@ private:
     int32_t ParseMessageReqPinAuthNegotiate(const JsonObject &json, std::shared_ptr<DmAuthContext> context);
     // Parse the 131 message
     int32_t ParseMessageRespPinAuthNegotiate(const JsonObject &jsonObject, std::shared_ptr<DmAuthContext> context);
+    // Decrypt TAG_DATA of the 140, 141, 150 and 151 messages into plainJson
+    int32_t DecryptDataField(const JsonObject &jsonObject, JsonObject &plainJson);
     // Parse the 140 message
     int32_t ParseMessageReqCredExchange(const JsonObject &jsonObject, std::shared_ptr<DmAuthContext> context);
     // Parse the 150 message
@@ -351,6 +360,9 @@ private:
     // Decrypt the 180 and 190 messages
     int32_t DecryptSyncMessage(std::shared_ptr<DmAuthContext> &context,
         DmAccess &access, std::string &enSyncMsg);
+    int32_t DecryptSyncMessageV2(std::shared_ptr<DmAuthContext> &context,
+        DmAccess &access, std::string &enSyncMsg);
+    int32_t ParseSyncField(const JsonObject &jsonObject, std::shared_ptr<DmAuthContext> &context, DmAccess &access);
     // Parse the sync message
     int32_t ParseSyncMessage(std::shared_ptr<DmAuthContext> &context,
         DmAccess &access, JsonObject &jsonObject);
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_AUTH_MESSAGE_SCHEMA_H
+#define OHOS_DM_AUTH_MESSAGE_SCHEMA_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "dm_error_type.h"
+#include "dm_log.h"
+#include "json_object.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+enum class DmAuthFieldType : int32_t {
+    STRING = 0,
+    INT32,
+    INT64,
+    BOOL,
+};
+
+// Each reads the field once, false when it is missing or does not have the expected type.
+bool ReadAuthField(const JsonItemObject &jsonObject, const char *key, std::string &value);
+bool ReadAuthField(const JsonItemObject &jsonObject, const char *key, int32_t &value);
+bool ReadAuthField(const JsonItemObject &jsonObject, const char *key, int64_t &value);
+bool ReadAuthField(const JsonItemObject &jsonObject, const char *key, bool &value);
+const char *GetAuthFieldTypeName(DmAuthFieldType type);
+
+// Typed views of the auth v2 messages decoded through a DmAuthMsgSchema.
+struct DmAuthCredExchangeMsg {
+    std::string transmitPublicKey;
+    std::string deviceId;
+    int32_t userId = -1;
+    int64_t tokenId = 0;
+    std::string lnnPublicKey;
+    bool hasLnnPublicKey = false;
+};
+
+struct DmAuthSKDeriveMsg {
+    std::string transmitCredentialId;
+    std::string lnnCredentialId;
+    bool hasLnnCredentialId = false;
+};
+
+struct DmAuthFinishMsg {
+    int32_t reply = 0;
+    bool hasReply = false;
+    int32_t reason = 0;
+    bool hasReason = false;
+    int64_t remainingFrozenTime = 0;
+    bool hasRemainingFrozenTime = false;
+};
+
+/*
+ * Field table of one message type. Decode() looks every key up once, writes it straight into
+ * the struct member and reports a missing or mistyped required field the same way for every
+ * message. Optional fields carry the member flagging their presence instead.
+ */
+template <typename Msg>
+class DmAuthMsgSchema {
+public:
+    struct Field {
+        const char *key = nullptr;
+        DmAuthFieldType type = DmAuthFieldType::STRING;
+        std::string Msg::*strMember = nullptr;
+        int32_t Msg::*int32Member = nullptr;
+        int64_t Msg::*int64Member = nullptr;
+        bool Msg::*boolMember = nullptr;
+        bool Msg::*present = nullptr;
+    };
+
+    static Field Str(const char *key, std::string Msg::*member, bool Msg::*present = nullptr)
+    {
+        Field field;
+        field.key = key;
+        field.type = DmAuthFieldType::STRING;
+        field.strMember = member;
+        field.present = present;
+        return field;
+    }
+
+    static Field Int32(const char *key, int32_t Msg::*member, bool Msg::*present = nullptr)
+    {
+        Field field;
+        field.key = key;
+        field.type = DmAuthFieldType::INT32;
+        field.int32Member = member;
+        field.present = present;
+        return field;
+    }
+
+    static Field Int64(const char *key, int64_t Msg::*member, bool Msg::*present = nullptr)
+    {
+        Field field;
+        field.key = key;
+        field.type = DmAuthFieldType::INT64;
+        field.int64Member = member;
+        field.present = present;
+        return field;
+    }
+
+    static Field Bool(const char *key, bool Msg::*member, bool Msg::*present = nullptr)
+    {
+        Field field;
+        field.key = key;
+        field.type = DmAuthFieldType::BOOL;
+        field.boolMember = member;
+        field.present = present;
+        return field;
+    }
+
+    DmAuthMsgSchema(const char *name, std::initializer_list<Field> fields) : name_(name), fields_(fields) {}
+
+    int32_t Decode(const JsonItemObject &jsonObject, Msg &msg) const
+    {
+        if (jsonObject.IsDiscarded()) {
+            LOGE("%{public}s is not a json object.", name_);
+            return ERR_DM_FAILED;
+        }
+        for (const Field &field : fields_) {
+            bool res = ReadField(jsonObject, field, msg);
+            if (field.present != nullptr) {
+                msg.*(field.present) = res;
+                continue;
+            }
+            if (!res) {
+                LOGE("%{public}s field %{public}s missing or not %{public}s.", name_, field.key,
+                    GetAuthFieldTypeName(field.type));
+                return ERR_DM_FAILED;
+            }
+        }
+        return DM_OK;
+    }
+
+private:
+    static bool ReadField(const JsonItemObject &jsonObject, const Field &field, Msg &msg)
+    {
+        switch (field.type) {
+            case DmAuthFieldType::STRING:
+                return ReadAuthField(jsonObject, field.key, msg.*(field.strMember));
+            case DmAuthFieldType::INT32:
+                return ReadAuthField(jsonObject, field.key, msg.*(field.int32Member));
+            case DmAuthFieldType::INT64:
+                return ReadAuthField(jsonObject, field.key, msg.*(field.int64Member));
+            case DmAuthFieldType::BOOL:
+                return ReadAuthField(jsonObject, field.key, msg.*(field.boolMember));
+            default:
+                return false;
+        }
+    }
+
+    const char *name_;
+    std::vector<Field> fields_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_AUTH_MESSAGE_SCHEMA_H
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_AUTH_SYNC_ENVELOPE_H
+#define OHOS_DM_AUTH_SYNC_ENVELOPE_H
+
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Binary plaintext of the v2 sync message (180/190), encrypted as a whole with raw AES-GCM.
+ * Layout, integers in network byte order:
+ *   magic[2] = "DS" | version u8 | bodyType u8 | oriLen u32 | body
+ * The body is the zlib compressed sync json, so the legacy inner json, the inner base64 and
+ * the hex layer of the ciphertext all disappear.
+ */
+class DmAuthSyncEnvelope {
+public:
+    static constexpr uint8_t ENVELOPE_VERSION = 1;
+    static constexpr uint8_t BODY_TYPE_ZLIB_JSON = 1;
+    static constexpr uint32_t HEADER_LEN = 8;
+    static constexpr uint32_t MAX_ORI_LEN = 16 * 1024 * 1024;
+
+    static int32_t Pack(const std::string &syncMsg, std::string &envelope);
+    static int32_t Unpack(const std::string &envelope, std::string &syncMsg);
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_AUTH_SYNC_ENVELOPE_H
@@ -14,9 +14,12 @@
  */
 #ifndef OHOS_DM_FREEZE_PROCESS_V2_H
 #define OHOS_DM_FREEZE_PROCESS_V2_H
+#include <array>
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "deviceprofile_connector.h"
 #include "dm_auth_context.h"
@@ -40,9 +43,37 @@ typedef struct DeviceFreezeState {
     }
 } DeviceFreezeState;
 
+/*
+ * Fixed capacity window of ascending timestamps, the oldest one is overwritten when full.
+ * Only the latest few failures decide a freeze, so the window bounds memory and the persisted size.
+ */
+class FreezeTimeRing {
+public:
+    static constexpr size_t CAPACITY = 16;
+    FreezeTimeRing() = default;
+    FreezeTimeRing(std::initializer_list<int64_t> values);
+    FreezeTimeRing &operator=(std::initializer_list<int64_t> values);
+    FreezeTimeRing &operator=(const std::vector<int64_t> &values);
+    void push_back(int64_t value);
+    void clear();
+    size_t size() const;
+    bool empty() const;
+    int64_t back() const;
+    // index 0 is the oldest entry.
+    int64_t operator[](size_t index) const;
+    // Drops the entries before timeStamp, returns the number dropped.
+    size_t EraseBefore(int64_t timeStamp);
+    std::vector<int64_t> ToVector() const;
+private:
+    void Assign(std::vector<int64_t> values);
+    std::array<int64_t, CAPACITY> items_ {};
+    size_t head_ = 0;
+    size_t count_ = 0;
+};
+
 typedef struct BindFailedEvents {
-    std::vector<int64_t> failedTimeStamps;
-    std::vector<int64_t> freezeTimeStamps;
+    FreezeTimeRing failedTimeStamps;
+    FreezeTimeRing freezeTimeStamps;
     explicit BindFailedEvents() : failedTimeStamps(), freezeTimeStamps() {}
     bool IsEmpty() const
     {
@@ -63,8 +94,8 @@ public:
     int32_t UpdateFreezeRecord();
     bool IsNeedFreeze(std::shared_ptr<DmAuthContext> context);
 private:
-    FreezeProcess() = default;
-    ~FreezeProcess() = default;
+    FreezeProcess();
+    ~FreezeProcess();
     int32_t SyncFreezeData();
     int32_t ConvertJsonToDeviceFreezeState(const std::string &result, DeviceFreezeState &freezeStateObj);
     int32_t ConvertJsonToBindFailedEvents(const std::string &result, BindFailedEvents &bindFailedEvents);
@@ -74,15 +105,30 @@ private:
     int32_t CleanBindFailedEvents(int64_t reservedDataTimeStamp);
     int32_t CleanFreezeState(int64_t reservedDataTimeStamp);
     int32_t UpdateFreezeState(int64_t nowTime);
+    int32_t UpdateFreezeStateLocked(int64_t nowTime);
     void CalculateNextFreezeTime(int64_t nowFreezeTime, int64_t &nextFreezeTime);
+    // The caches are authoritative, kv is written behind them by one coalesced flush task.
+    void MarkDirtyLocked(bool freezeState, bool bindFailedEvents, bool urgent);
+    void FlushFreezeData();
+    int32_t PersistFreezeData(const char *key, const std::string &value, bool isEmpty);
+
+    struct FlushGuard {
+        ffrt::mutex mtx;
+        FreezeProcess *owner = nullptr;
+    };
 
 private:
     bool isSynced_ = false;
     DeviceFreezeState freezeStateCache_;
     BindFailedEvents bindFailedEventsCache_;
-    ffrt::mutex freezeStateCacheMtx_;
-    ffrt::mutex bindFailedEventsCacheMtx_;
+    ffrt::mutex freezeCacheMtx_;
     ffrt::mutex isSyncedMtx_;
+    bool freezeStateDirty_ = false;
+    bool bindFailedEventsDirty_ = false;
+    bool flushScheduled_ = false;
+    bool urgentFlushScheduled_ = false;
+    int32_t flushRetryCount_ = 0;
+    std::shared_ptr<FlushGuard> flushGuard_;
 };
 
 } // namespace DistributedHardware
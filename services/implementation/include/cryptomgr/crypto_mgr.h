@@ -17,9 +17,14 @@
 #define OHOS_DM_CRYPTO_MGR_H
 
 #include <cinttypes>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "ffrt.h"
+
+struct mbedtls_gcm_context;
+
 namespace OHOS {
 namespace DistributedHardware {
 #define SESSION_KEY_LENGTH 32
@@ -36,12 +41,28 @@ typedef struct AesGcmCipherKey {
     unsigned char iv[GCM_IV_LEN] = {0};
 } AesGcmCipherKey;
 
+// One piece of a scattered input buffer.
+typedef struct DmCryptoSegment {
+    const uint8_t *data = nullptr;
+    uint32_t len = 0;
+} DmCryptoSegment;
+
 class CryptoMgr {
 public:
     CryptoMgr();
     ~CryptoMgr();
     int32_t EncryptMessage(const std::string &inputMsg, std::string &outputMsg);
     int32_t DecryptMessage(const std::string &inputMsg, std::string &outputMsg);
+    // Raw AES-GCM, the output is iv | cipher | tag without the hex layer of EncryptMessage.
+    int32_t EncryptData(const std::string &inputData, std::string &outputData);
+    int32_t DecryptData(const std::string &inputData, std::string &outputData);
+    /*
+     * Gather variants over caller owned buffers. The segments are encrypted as one message, the
+     * output vector is resized but keeps its capacity, so a caller reusing it does not allocate.
+     * Decrypt takes iv | cipher | tag split in any way across the segments.
+     */
+    int32_t EncryptSegments(const std::vector<DmCryptoSegment> &segments, std::vector<uint8_t> &output);
+    int32_t DecryptSegments(const std::vector<DmCryptoSegment> &segments, std::vector<uint8_t> &output);
     int32_t SaveSessionKey(const uint8_t *sessionKey, const uint32_t keyLen);
     int32_t ProcessSessionKey(const uint8_t *sessionKey, const uint32_t keyLen);
     void ClearSessionKey();
@@ -58,9 +79,17 @@ private:
         unsigned char *decryptData, uint32_t *decryptLen);
     int32_t MbedAesGcmDecrypt(const AesGcmCipherKey *cipherKey, const unsigned char *cipherText,
         uint32_t cipherTextSize, unsigned char *plain, uint32_t &plainLen);
+    // The gcm context keeps the expanded key of sessionKey_, caller holds sessionKeyMtx_.
+    int32_t PrepareSessionGcmLocked();
+    void ReleaseSessionGcmLocked();
+    int32_t EncryptSegmentsLocked(const std::vector<DmCryptoSegment> &segments, uint8_t *output, uint32_t outLen);
+    int32_t DecryptSegmentsLocked(const std::vector<DmCryptoSegment> &segments, uint32_t totalLen,
+        std::vector<uint8_t> &output);
 private:
     ffrt::mutex sessionKeyMtx_;
     DMSessionKey sessionKey_;
+    std::unique_ptr<mbedtls_gcm_context> sessionGcm_;
+    bool sessionGcmReady_ = false;
     ffrt::mutex randomLock_;
 };
 } // namespace DistributedHardware
@@ -83,6 +83,8 @@ public:
 private:
     void FreeJsonString(char *jsonStr);
     void FreeCharArray(char *charArray);
+    int32_t QueryCredInfoStr(const CredManager *cm, int32_t userId, const std::string &credId,
+        std::string &credInfo);
     static std::shared_ptr<IDmDeviceAuthCallback> GetDeviceAuthCallback(int64_t id);
 
 private:
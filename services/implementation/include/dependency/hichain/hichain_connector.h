@@ -261,7 +261,6 @@ private:
     int32_t GetJsonInt(const JsonObject &jsonObj, const std::string &key);
     std::string GetJsonStr(const JsonObject &jsonObj, const std::string &key);
     void DestroyReturnGroupsAndClear(char *returnGroups);
-    int32_t ParseRelatedGroupsToJson(std::string &relatedGroups, std::vector<GroupInfo> &groupList);
     void ClearSensitiveString(std::string &sensitiveData);
 
 private:
@@ -285,7 +285,7 @@ private:
     void CleanSessionMapByLogicalSessionId(uint64_t logicalSessionId, int32_t connDelayCloseTime);
     int32_t DeleteAclForProcV2(const std::string &localUdid, uint32_t localTokenId, const std::string &remoteUdid,
         int32_t bindLevel, const std::string &extra, int32_t userId);
-    void DeleteCredential(DmAclIdParam &acl);
+    void DeleteCredential(int32_t userId, const std::string &credId, const std::vector<int64_t> &tokenIds);
     void DeleteAclByTokenId(const int32_t accessTokenId,
         std::vector<DistributedDeviceProfile::AccessControlProfile> &profiles,
         std::map<int64_t, DistributedDeviceProfile::AccessControlProfile> &delProfileMap,
@@ -323,6 +323,10 @@ private:
     void OnAuthResultAndOnBindResult(const ProcessInfo &processInfo, const PeerTargetId &targetId,
         const std::string &deviceId, int32_t reason, uint64_t tokenId);
     void GetBundleName(const DMAclQuadInfo &info, std::set<std::string> &pkgNameSet, bool &notifyOffline);
+    void GetBundleName(const std::vector<DistributedDeviceProfile::AccessControlProfile> &profiles,
+        const DMAclQuadInfo &info, std::set<std::string> &pkgNameSet, bool &notifyOffline);
+    void NotifyAccountLogoutOffline(const std::string &remoteUdid, const std::vector<DMAclQuadInfo> &infos,
+        const std::vector<DmOfflineParam> &offlineParams, const std::vector<bool> &notifyOfflines);
     void NotifyDeviceOffline(DmOfflineParam &offlineParam, const std::string &remoteUdid);
     void DeleteSessionKey(int32_t userId, const DistributedDeviceProfile::AccessControlProfile &profile);
     void DeleteGroupByBundleName(const std::string &localUdid, int32_t userId, const std::vector<DmAclIdParam> &acls);
@@ -31,7 +31,9 @@
 #include "dm_anonymous.h"
 #include "dm_auth_manager_base.h"
 #include "dm_auth_context.h"
+#include "dm_auth_message_schema.h"
 #include "dm_auth_state_machine.h"
+#include "dm_auth_sync_envelope.h"
 #include "dm_crypto.h"
 #include "dm_softbus_cache.h"
 #include "i_dm_service_impl_ext_resident.h"
@@ -64,6 +66,8 @@ const char* TAG_AUTHORIZED_SCOPE = "authorizedScope";
 const char* TAG_AUTHORIZED_APP_LIST = "authorizedAppList";
 const char* TAG_CREDENTIAL_OWNER = "credOwner";
 const char* TAG_SYNC = "syncMessage";
+const char* TAG_SYNC_V2 = "syncMessageV2";
+const char* TAG_SUPPORT_SYNC_V2 = "isSupportSyncV2";
 const char* TAG_ACCESS = "dmAccess";
 const char* TAG_PROXY = "proxy";
 const char* TAG_PROXY_SERVICE_ID = "proxyServiceId";
@@ -150,6 +154,47 @@ constexpr int32_t DM_ULTRASONIC_REVERSE = 1;
 constexpr uint32_t MAX_SESSION_KEY_LENGTH = 512;
 constexpr uint32_t MAX_MESSAGE_LENGTH = 64 * 1024 * 1024;
 
+using CredExchangeSchema = DmAuthMsgSchema<DmAuthCredExchangeMsg>;
+using SKDeriveSchema = DmAuthMsgSchema<DmAuthSKDeriveMsg>;
+using FinishSchema = DmAuthMsgSchema<DmAuthFinishMsg>;
+
+// Plaintext of the 140 and 150 messages
+const CredExchangeSchema &GetCredExchangeSchema()
+{
+    static const CredExchangeSchema schema("credential exchange message", {
+        CredExchangeSchema::Str(TAG_TRANSMIT_PUBLIC_KEY, &DmAuthCredExchangeMsg::transmitPublicKey),
+        CredExchangeSchema::Str(TAG_DEVICE_ID, &DmAuthCredExchangeMsg::deviceId),
+        CredExchangeSchema::Int32(TAG_PEER_USER_SPACE_ID, &DmAuthCredExchangeMsg::userId),
+        CredExchangeSchema::Int64(TAG_TOKEN_ID, &DmAuthCredExchangeMsg::tokenId),
+        CredExchangeSchema::Str(TAG_LNN_PUBLIC_KEY, &DmAuthCredExchangeMsg::lnnPublicKey,
+            &DmAuthCredExchangeMsg::hasLnnPublicKey),
+    });
+    return schema;
+}
+
+// Plaintext of the 141 and 151 messages
+const SKDeriveSchema &GetSKDeriveSchema()
+{
+    static const SKDeriveSchema schema("sk derive message", {
+        SKDeriveSchema::Str(TAG_TRANSMIT_CREDENTIAL_ID, &DmAuthSKDeriveMsg::transmitCredentialId),
+        SKDeriveSchema::Str(TAG_LNN_CREDENTIAL_ID, &DmAuthSKDeriveMsg::lnnCredentialId,
+            &DmAuthSKDeriveMsg::hasLnnCredentialId),
+    });
+    return schema;
+}
+
+// The 200 and 201 messages, every field is optional
+const FinishSchema &GetFinishSchema()
+{
+    static const FinishSchema schema("finish message", {
+        FinishSchema::Int32(TAG_REPLY, &DmAuthFinishMsg::reply, &DmAuthFinishMsg::hasReply),
+        FinishSchema::Int32(TAG_REASON, &DmAuthFinishMsg::reason, &DmAuthFinishMsg::hasReason),
+        FinishSchema::Int64(TAG_REMAINING_FROZEN_TIME, &DmAuthFinishMsg::remainingFrozenTime,
+            &DmAuthFinishMsg::hasRemainingFrozenTime),
+    });
+    return schema;
+}
+
 void ParseDmAccessToSync(const std::string &jsonString, DmAccess &access, bool isUseDeviceFullName)
 {
     JsonObject accessjson(jsonString);
@@ -1091,41 +1136,48 @@ int32_t DmAuthMessageProcessor::ParseMessageRespPinAuthNegotiate(const JsonObjec
     return DM_OK;
 }
 
-int32_t DmAuthMessageProcessor::ParseMessageReqCredExchange(const JsonObject &jsonObject,
-    std::shared_ptr<DmAuthContext> context)
+int32_t DmAuthMessageProcessor::DecryptDataField(const JsonObject &jsonObject, JsonObject &plainJson)
 {
-    if (jsonObject.IsDiscarded() || !jsonObject[TAG_DATA].IsString()) {
+    CHECK_NULL_RETURN(cryptoMgr_, ERR_DM_POINT_NULL);
+    std::string cipherText;
+    if (jsonObject.IsDiscarded() || !ReadAuthField(jsonObject, TAG_DATA, cipherText)) {
         LOGE("DecodeRequestAuth jsonStr error");
         return ERR_DM_FAILED;
     }
-
     std::string plainText;
-    if (cryptoMgr_->DecryptMessage(jsonObject[TAG_DATA].Get<std::string>(), plainText) != DM_OK) {
+    if (cryptoMgr_->DecryptMessage(cipherText, plainText) != DM_OK) {
         LOGE("decrypt data failed.");
         return ERR_DM_FAILED;
     }
-    JsonObject jsonData(plainText);
+    if (!plainJson.Parse(plainText)) {
+        LOGE("decrypted data is not json.");
+        return ERR_DM_FAILED;
+    }
+    return DM_OK;
+}
 
+// parse 140
+int32_t DmAuthMessageProcessor::ParseMessageReqCredExchange(const JsonObject &jsonObject,
+    std::shared_ptr<DmAuthContext> context)
+{
+    CHECK_NULL_RETURN(context, ERR_DM_POINT_NULL);
+    JsonObject jsonData;
+    DmAuthCredExchangeMsg msg;
+    if (DecryptDataField(jsonObject, jsonData) != DM_OK || GetCredExchangeSchema().Decode(jsonData, msg) != DM_OK) {
+        return ERR_DM_FAILED;
+    }
     // First authentication, parse lnn public key
     if (context->accessee.isGenerateLnnCredential && context->accessee.bindLevel != static_cast<int32_t>(USER)) {
-        if (!jsonData[TAG_LNN_PUBLIC_KEY].IsString()) {
+        if (!msg.hasLnnPublicKey) {
             LOGE("first auth, no lnnPublicKey.");
             return ERR_DM_FAILED;
         }
-        context->accesser.lnnPublicKey = jsonData[TAG_LNN_PUBLIC_KEY].Get<std::string>();
-    }
-
-    if (!jsonData[TAG_TRANSMIT_PUBLIC_KEY].IsString() ||
-        !jsonData[TAG_DEVICE_ID].IsString() ||
-        !jsonData[TAG_PEER_USER_SPACE_ID].IsNumberInteger() ||
-        !jsonData[TAG_TOKEN_ID].IsNumberInteger()) {
-        LOGE("MSG_TYPE_REQ_CREDENTIAL_EXCHANGE message error.");
-        return ERR_DM_FAILED;
+        context->accesser.lnnPublicKey = std::move(msg.lnnPublicKey);
     }
-    context->accesser.transmitPublicKey = jsonData[TAG_TRANSMIT_PUBLIC_KEY].Get<std::string>();
-    context->accesser.deviceId = jsonData[TAG_DEVICE_ID].Get<std::string>();
-    context->accesser.userId = jsonData[TAG_PEER_USER_SPACE_ID].Get<int32_t>();
-    context->accesser.tokenId = jsonData[TAG_TOKEN_ID].Get<int64_t>();
+    context->accesser.transmitPublicKey = std::move(msg.transmitPublicKey);
+    context->accesser.deviceId = std::move(msg.deviceId);
+    context->accesser.userId = msg.userId;
+    context->accesser.tokenId = msg.tokenId;
     ParseProxyCredExchangeToSync(context, jsonData);
     context->authStateMachine->TransitionTo(std::make_shared<AuthSinkCredentialExchangeState>());
     return DM_OK;
@@ -1136,42 +1188,24 @@ int32_t DmAuthMessageProcessor::ParseMessageRspCredExchange(const JsonObject &js
     std::shared_ptr<DmAuthContext> context)
 {
     LOGI("start.");
-    if (jsonObject.IsDiscarded() || !jsonObject[TAG_DATA].IsString()) {
-        LOGE("DecodeRequestAuth jsonStr error");
-        return ERR_DM_FAILED;
-    }
-
-    std::string plainText;
-    if (cryptoMgr_->DecryptMessage(jsonObject[TAG_DATA].Get<std::string>(), plainText) != DM_OK) {
-        LOGE("decrypt data failed.");
+    CHECK_NULL_RETURN(context, ERR_DM_POINT_NULL);
+    JsonObject jsonData;
+    DmAuthCredExchangeMsg msg;
+    if (DecryptDataField(jsonObject, jsonData) != DM_OK || GetCredExchangeSchema().Decode(jsonData, msg) != DM_OK) {
         return ERR_DM_FAILED;
     }
-
-    JsonObject jsonData(plainText);
-
     // First authentication, parse lnn public key
-    std::string tmpString = "";
     if (context->accesser.isGenerateLnnCredential && context->accesser.bindLevel != static_cast<int32_t>(USER)) {
-        if (!jsonData[TAG_LNN_PUBLIC_KEY].IsString()) {
+        if (!msg.hasLnnPublicKey) {
             LOGE("first auth but no lnnPublicKey.");
             return ERR_DM_FAILED;
         }
-        context->accessee.lnnPublicKey = jsonData[TAG_LNN_PUBLIC_KEY].Get<std::string>();
+        context->accessee.lnnPublicKey = std::move(msg.lnnPublicKey);
     }
-
-    // First authentication, parse transmit public key
-    if (!jsonData[TAG_TRANSMIT_PUBLIC_KEY].IsString() ||
-        !jsonData[TAG_DEVICE_ID].IsString() ||
-        !jsonData[TAG_PEER_USER_SPACE_ID].IsNumberInteger() ||
-        !jsonData[TAG_TOKEN_ID].IsNumberInteger()) {
-        LOGE("decode MSG_TYPE_RESP_CREDENTIAL_EXCHANGE"
-            "message error.");
-        return ERR_DM_FAILED;
-    }
-    context->accessee.transmitPublicKey = jsonData[TAG_TRANSMIT_PUBLIC_KEY].Get<std::string>();
-    context->accessee.deviceId = jsonData[TAG_DEVICE_ID].Get<std::string>();
-    context->accessee.userId = jsonData[TAG_PEER_USER_SPACE_ID].Get<int32_t>();
-    context->accessee.tokenId = jsonData[TAG_TOKEN_ID].Get<int64_t>();
+    context->accessee.transmitPublicKey = std::move(msg.transmitPublicKey);
+    context->accessee.deviceId = std::move(msg.deviceId);
+    context->accessee.userId = msg.userId;
+    context->accessee.tokenId = msg.tokenId;
     ParseProxyCredExchangeToSync(context, jsonData);
     context->authStateMachine->TransitionTo(std::make_shared<AuthSrcCredentialAuthStartState>());
     return DM_OK;
@@ -1182,30 +1216,20 @@ int32_t DmAuthMessageProcessor::ParseMessageReqSKDerive(const JsonObject &jsonOb
     std::shared_ptr<DmAuthContext> context)
 {
     CHECK_NULL_RETURN(context, ERR_DM_POINT_NULL);
-    CHECK_NULL_RETURN(cryptoMgr_, ERR_DM_POINT_NULL);
-    if (jsonObject.IsDiscarded() || !jsonObject[TAG_DATA].IsString()) {
-        LOGE("DecodeRequestAuth jsonStr error");
-        return ERR_DM_FAILED;
-    }
-    std::string plainText;
-    if (cryptoMgr_->DecryptMessage(jsonObject[TAG_DATA].Get<std::string>(), plainText) != DM_OK) {
-        LOGE("decrypt data failed.");
+    JsonObject jsonData;
+    DmAuthSKDeriveMsg msg;
+    if (DecryptDataField(jsonObject, jsonData) != DM_OK || GetSKDeriveSchema().Decode(jsonData, msg) != DM_OK) {
         return ERR_DM_FAILED;
     }
-    JsonObject jsonData(plainText);
     // First authentication, parse lnn public key
     if (context->accessee.isGenerateLnnCredential && context->accessee.bindLevel != static_cast<int32_t>(USER)) {
-        if (!jsonData[TAG_LNN_CREDENTIAL_ID].IsString()) {
+        if (!msg.hasLnnCredentialId) {
             LOGE("first auth, no lnnPublicKey.");
             return ERR_DM_FAILED;
         }
-        context->accesser.lnnCredentialId = jsonData[TAG_LNN_CREDENTIAL_ID].Get<std::string>();
-    }
-    if (!jsonData[TAG_TRANSMIT_CREDENTIAL_ID].IsString()) {
-        LOGE("MSG_TYPE_REQ_SK_DERIVE message error.");
-        return ERR_DM_FAILED;
+        context->accesser.lnnCredentialId = std::move(msg.lnnCredentialId);
     }
-    context->accesser.transmitCredentialId = jsonData[TAG_TRANSMIT_CREDENTIAL_ID].Get<std::string>();
+    context->accesser.transmitCredentialId = std::move(msg.transmitCredentialId);
     context->authStateMachine->TransitionTo(std::make_shared<AuthSinkSKDeriveState>());
     return DM_OK;
 }
@@ -1215,30 +1239,20 @@ int32_t DmAuthMessageProcessor::ParseMessageRspSKDerive(const JsonObject &jsonOb
     std::shared_ptr<DmAuthContext> context)
 {
     CHECK_NULL_RETURN(context, ERR_DM_POINT_NULL);
-    CHECK_NULL_RETURN(cryptoMgr_, ERR_DM_POINT_NULL);
-    if (jsonObject.IsDiscarded() || !jsonObject[TAG_DATA].IsString()) {
-        LOGE("DecodeRequestAuth jsonStr error");
-        return ERR_DM_FAILED;
-    }
-    std::string plainText;
-    if (cryptoMgr_->DecryptMessage(jsonObject[TAG_DATA].Get<std::string>(), plainText) != DM_OK) {
-        LOGE("decrypt data failed.");
+    JsonObject jsonData;
+    DmAuthSKDeriveMsg msg;
+    if (DecryptDataField(jsonObject, jsonData) != DM_OK || GetSKDeriveSchema().Decode(jsonData, msg) != DM_OK) {
         return ERR_DM_FAILED;
     }
-    JsonObject jsonData(plainText);
     // First authentication, parse lnn public key
     if (context->accesser.isGenerateLnnCredential && context->accesser.bindLevel != static_cast<int32_t>(USER)) {
-        if (!jsonData[TAG_LNN_CREDENTIAL_ID].IsString()) {
+        if (!msg.hasLnnCredentialId) {
             LOGE("first auth, no lnnPublicKey.");
             return ERR_DM_FAILED;
         }
-        context->accessee.lnnCredentialId = jsonData[TAG_LNN_CREDENTIAL_ID].Get<std::string>();
-    }
-    if (!jsonData[TAG_TRANSMIT_CREDENTIAL_ID].IsString()) {
-        LOGE("MSG_TYPE_RESP_SK_DERIVE message error.");
-        return ERR_DM_FAILED;
+        context->accessee.lnnCredentialId = std::move(msg.lnnCredentialId);
     }
-    context->accessee.transmitCredentialId = jsonData[TAG_TRANSMIT_CREDENTIAL_ID].Get<std::string>();
+    context->accessee.transmitCredentialId = std::move(msg.transmitCredentialId);
     context->authStateMachine->TransitionTo(std::make_shared<AuthSrcSKDeriveState>());
     return DM_OK;
 }
@@ -1361,6 +1375,7 @@ int32_t DmAuthMessageProcessor::CreateNegotiateMessage(std::shared_ptr<DmAuthCon
         jsonObject[DM_BUSINESS_ID] = context->businessId;
     }
     jsonObject[TAG_NCM_BIND_TARGET] = context->ncmBindTarget;
+    jsonObject[TAG_SUPPORT_SYNC_V2] = true;
     if (context->isServiceBind) {
         CreateServiceNegotiateMessage(context, jsonObject);
         return DM_OK;
@@ -1437,6 +1452,7 @@ int32_t DmAuthMessageProcessor::CreateRespNegotiateMessage(std::shared_ptr<DmAut
 
     jsonObject[TAG_IS_ONLINE] = context->accesser.isOnline;
     jsonObject[TAG_DEVICE_TYPE] = context->accessee.deviceType;
+    jsonObject[TAG_SUPPORT_SYNC_V2] = context->isSupportSyncV2;
     CreateProxyRespNegotiateMessage(context, jsonObject);
     return DM_OK;
 }
@@ -1603,14 +1619,7 @@ int32_t DmAuthMessageProcessor::CreateMessageSyncResp(std::shared_ptr<DmAuthCont
         access = context->accesser;
     }
 
-    std::string encSyncMsg;
-    int32_t ret = EncryptSyncMessage(context, access, encSyncMsg);
-    if (ret != DM_OK) {
-        LOGE("encrypt failed");
-        return ret;
-    }
-    jsonObject[TAG_SYNC] = encSyncMsg;
-    return ret;
+    return SetSyncMessage(context, access, jsonObject);
 }
 
 // Create 200 message.
@@ -1895,17 +1904,52 @@ int32_t DmAuthMessageProcessor::DecryptSyncMessage(std::shared_ptr<DmAuthContext
     return DM_OK;
 }
 
-// Parse 180 message, save remote encrypted quadruple, acl, sp skid
-int32_t DmAuthMessageProcessor::ParseMessageSyncReq(const JsonObject &jsonObject,
-    std::shared_ptr<DmAuthContext> context)
+int32_t DmAuthMessageProcessor::DecryptSyncMessageV2(std::shared_ptr<DmAuthContext> &context,
+    DmAccess &access, std::string &enSyncMsg)
 {
+    std::string cipherData = Base64Decode(enSyncMsg);
+    std::string envelope;
+    int32_t ret = cryptoMgr_->DecryptData(cipherData, envelope);
+    if (ret != DM_OK) {
+        LOGE("syncMsg error");
+        return ret;
+    }
+    std::string syncMsg;
+    ret = DmAuthSyncEnvelope::Unpack(envelope, syncMsg);
+    if (ret != DM_OK) {
+        LOGE("unpack sync envelope failed");
+        return ret;
+    }
+    JsonObject jsonObject(syncMsg);
+    if (jsonObject.IsDiscarded()) {
+        LOGE("jsonStr error");
+        return ERR_DM_FAILED;
+    }
+    return ParseSyncMessage(context, access, jsonObject);
+}
+
+int32_t DmAuthMessageProcessor::ParseSyncField(const JsonObject &jsonObject, std::shared_ptr<DmAuthContext> &context,
+    DmAccess &access)
+{
+    // The envelope is self describing, accept it whatever was negotiated.
+    if (IsString(jsonObject, TAG_SYNC_V2)) {
+        std::string enSyncMsg = jsonObject[TAG_SYNC_V2].Get<std::string>();
+        return DecryptSyncMessageV2(context, access, enSyncMsg);
+    }
     if (!jsonObject[TAG_SYNC].IsString()) {
         LOGE("json error");
         return ERR_DM_FAILED;
     }
     std::string enSyncMsg = jsonObject[TAG_SYNC].Get<std::string>();
+    return DecryptSyncMessage(context, access, enSyncMsg);
+}
+
+// Parse 180 message, save remote encrypted quadruple, acl, sp skid
+int32_t DmAuthMessageProcessor::ParseMessageSyncReq(const JsonObject &jsonObject,
+    std::shared_ptr<DmAuthContext> context)
+{
     // Decrypt data and parse data into context
-    int32_t ret = DecryptSyncMessage(context, context->accesser, enSyncMsg);
+    int32_t ret = ParseSyncField(jsonObject, context, context->accesser);
     if (ret != DM_OK) {
         LOGE("DecryptSyncMessage enSyncMsg error");
         return ret;
@@ -1918,13 +1962,8 @@ int32_t DmAuthMessageProcessor::ParseMessageSyncReq(const JsonObject &jsonObject
 int32_t DmAuthMessageProcessor::ParseMessageSyncResp(const JsonObject &jsonObject,
     std::shared_ptr<DmAuthContext> context)
 {
-    if (!jsonObject[TAG_SYNC].IsString()) {
-        LOGE("json error");
-        return ERR_DM_FAILED;
-    }
-    std::string enSyncMsg = jsonObject[TAG_SYNC].Get<std::string>();
     // Decrypt data and parse data into context
-    int32_t ret = DecryptSyncMessage(context, context->accessee, enSyncMsg);
+    int32_t ret = ParseSyncField(jsonObject, context, context->accessee);
     if (ret != DM_OK) {
         LOGE("DecryptSyncMessage enSyncMsg error");
         return ret;
@@ -1937,11 +1976,15 @@ int32_t DmAuthMessageProcessor::ParseMessageSyncResp(const JsonObject &jsonObjec
 int32_t DmAuthMessageProcessor::ParseMessageSinkFinish(const JsonObject &jsonObject,
     std::shared_ptr<DmAuthContext> context)
 {
-    if (jsonObject[TAG_REPLY].IsNumberInteger()) {
-        context->reply = jsonObject[TAG_REPLY].Get<int32_t>();
+    DmAuthFinishMsg msg;
+    if (GetFinishSchema().Decode(jsonObject, msg) != DM_OK) {
+        return ERR_DM_FAILED;
     }
-    if (jsonObject[TAG_REASON].IsNumberInteger()) {
-        context->reason = jsonObject[TAG_REASON].Get<int32_t>();
+    if (msg.hasReply) {
+        context->reply = msg.reply;
+    }
+    if (msg.hasReason) {
+        context->reason = msg.reason;
     }
 
     /* In case of an exception, there may be a state waiting for an event.
@@ -1957,14 +2000,18 @@ int32_t DmAuthMessageProcessor::ParseMessageSinkFinish(const JsonObject &jsonObj
 int32_t DmAuthMessageProcessor::ParseMessageSrcFinish(const JsonObject &jsonObject,
     std::shared_ptr<DmAuthContext> context)
 {
-    if (IsInt32(jsonObject, TAG_REPLY)) {
-        context->reply = jsonObject[TAG_REPLY].Get<int32_t>();
+    DmAuthFinishMsg msg;
+    if (GetFinishSchema().Decode(jsonObject, msg) != DM_OK) {
+        return ERR_DM_FAILED;
     }
-    if (IsInt32(jsonObject, TAG_REASON)) {
-        context->reason = jsonObject[TAG_REASON].Get<int32_t>();
+    if (msg.hasReply) {
+        context->reply = msg.reply;
     }
-    if (IsInt64(jsonObject, TAG_REMAINING_FROZEN_TIME)) {
-        context->remainingFrozenTime = jsonObject[TAG_REMAINING_FROZEN_TIME].Get<int64_t>();
+    if (msg.hasReason) {
+        context->reason = msg.reason;
+    }
+    if (msg.hasRemainingFrozenTime) {
+        context->remainingFrozenTime = msg.remainingFrozenTime;
     }
 
     /* In case of an exception, there may be a state waiting for an event.
@@ -2009,6 +2056,7 @@ int32_t DmAuthMessageProcessor::ParseNegotiateMessage(
     if (IsBool(jsonObject, TAG_NCM_BIND_TARGET)) {
         context->ncmBindTarget = jsonObject[TAG_NCM_BIND_TARGET].Get<bool>();
     }
+    context->isSupportSyncV2 = IsBool(jsonObject, TAG_SUPPORT_SYNC_V2) && jsonObject[TAG_SUPPORT_SYNC_V2].Get<bool>();
     ParseAccesserInfo(jsonObject, context);
     ParseUltrasonicSide(jsonObject, context);
     ParseServiceNego(jsonObject, context);
@@ -2241,6 +2289,7 @@ int32_t DmAuthMessageProcessor::ParseMessageRespAclNegotiate(const JsonObject &j
     if (jsonObject[TAG_DEVICE_TYPE].IsNumberInteger()) {
         context->accessee.deviceType = jsonObject[TAG_DEVICE_TYPE].Get<int32_t>();
     }
+    context->isSupportSyncV2 = IsBool(jsonObject, TAG_SUPPORT_SYNC_V2) && jsonObject[TAG_SUPPORT_SYNC_V2].Get<bool>();
     ParseMessageProxyRespAclNegotiate(jsonObject, context);
     context->authStateMachine->TransitionTo(std::make_shared<AuthSrcConfirmState>());
     return DM_OK;
@@ -2670,8 +2719,8 @@ std::string DmAuthMessageProcessor::Base64Decode(std::string &inputStr)
     return std::string(reinterpret_cast<const char*>(buffer.data()), decodedLen); // 无需终止符
 }
 
-int32_t DmAuthMessageProcessor::EncryptSyncMessage(std::shared_ptr<DmAuthContext> &context, DmAccess &accessSide,
-                                                   std::string &encSyncMsg)
+int32_t DmAuthMessageProcessor::BuildSyncMsg(std::shared_ptr<DmAuthContext> &context, DmAccess &accessSide,
+    std::string &syncMsg)
 {
     JsonObject syncMsgJson;
     DmAccessToSync accessToSync;
@@ -2683,7 +2732,41 @@ int32_t DmAuthMessageProcessor::EncryptSyncMessage(std::shared_ptr<DmAuthContext
     }
 
     CreateProxyAccessMessage(context, syncMsgJson);
-    std::string syncMsg = syncMsgJson.Dump();
+    syncMsg = syncMsgJson.Dump();
+    return DM_OK;
+}
+
+int32_t DmAuthMessageProcessor::EncryptSyncMessageV2(std::shared_ptr<DmAuthContext> &context, DmAccess &accessSide,
+    std::string &encSyncMsg)
+{
+    std::string syncMsg;
+    if (BuildSyncMsg(context, accessSide, syncMsg) != DM_OK) {
+        return ERR_DM_FAILED;
+    }
+    std::string envelope;
+    int32_t ret = DmAuthSyncEnvelope::Pack(syncMsg, envelope);
+    if (ret != DM_OK) {
+        LOGE("pack sync envelope failed");
+        return ret;
+    }
+    std::string cipherData;
+    ret = cryptoMgr_->EncryptData(envelope, cipherData);
+    if (ret != DM_OK) {
+        LOGE("encrypt sync envelope failed");
+        return ret;
+    }
+    // The outer message is still json, so the raw ciphertext is base64 encoded exactly once.
+    encSyncMsg = Base64Encode(cipherData);
+    return encSyncMsg.empty() ? ERR_DM_FAILED : DM_OK;
+}
+
+int32_t DmAuthMessageProcessor::EncryptSyncMessage(std::shared_ptr<DmAuthContext> &context, DmAccess &accessSide,
+                                                   std::string &encSyncMsg)
+{
+    std::string syncMsg;
+    if (BuildSyncMsg(context, accessSide, syncMsg) != DM_OK) {
+        return ERR_DM_FAILED;
+    }
     std::string compressMsg = CompressSyncMsg(syncMsg);
     if (compressMsg.empty()) {
         LOGE("compress failed");
@@ -2866,13 +2949,20 @@ int32_t DmAuthMessageProcessor::CreateSyncMessage(std::shared_ptr<DmAuthContext>
     } else {
         accessSide = context->accessee;
     }
+    return SetSyncMessage(context, accessSide, jsonObject);
+}
+
+int32_t DmAuthMessageProcessor::SetSyncMessage(std::shared_ptr<DmAuthContext> &context, DmAccess &accessSide,
+    JsonObject &jsonObject)
+{
     std::string encSyncMsg;
-    int32_t ret = EncryptSyncMessage(context, accessSide, encSyncMsg);
+    int32_t ret = context->isSupportSyncV2 ? EncryptSyncMessageV2(context, accessSide, encSyncMsg) :
+        EncryptSyncMessage(context, accessSide, encSyncMsg);
     if (ret != DM_OK) {
         LOGE("encrypt failed");
         return ret;
     }
-    jsonObject[TAG_SYNC] = encSyncMsg;
+    jsonObject[context->isSupportSyncV2 ? TAG_SYNC_V2 : TAG_SYNC] = encSyncMsg;
     return DM_OK;
 }
 
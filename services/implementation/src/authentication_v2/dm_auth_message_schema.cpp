@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dm_auth_message_schema.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+bool ReadAuthField(const JsonItemObject &jsonObject, const char *key, std::string &value)
+{
+    JsonItemObject item = jsonObject.At(key);
+    if (!item.IsString()) {
+        return false;
+    }
+    item.GetTo(value);
+    return true;
+}
+
+bool ReadAuthField(const JsonItemObject &jsonObject, const char *key, int32_t &value)
+{
+    JsonItemObject item = jsonObject.At(key);
+    if (!item.IsNumberInteger()) {
+        return false;
+    }
+    int64_t num = 0;
+    item.GetTo(num);
+    if (num < INT32_MIN || num > INT32_MAX) {
+        return false;
+    }
+    value = static_cast<int32_t>(num);
+    return true;
+}
+
+bool ReadAuthField(const JsonItemObject &jsonObject, const char *key, int64_t &value)
+{
+    JsonItemObject item = jsonObject.At(key);
+    if (!item.IsNumberInteger()) {
+        return false;
+    }
+    item.GetTo(value);
+    return true;
+}
+
+bool ReadAuthField(const JsonItemObject &jsonObject, const char *key, bool &value)
+{
+    JsonItemObject item = jsonObject.At(key);
+    if (!item.IsBoolean()) {
+        return false;
+    }
+    item.GetTo(value);
+    return true;
+}
+
+const char *GetAuthFieldTypeName(DmAuthFieldType type)
+{
+    switch (type) {
+        case DmAuthFieldType::STRING:
+            return "string";
+        case DmAuthFieldType::INT32:
+            return "int32";
+        case DmAuthFieldType::INT64:
+            return "int64";
+        case DmAuthFieldType::BOOL:
+            return "bool";
+        default:
+            return "unknown";
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -14,6 +14,7 @@
  */
 
 #include "dm_log.h"
+#include "dm_perf_stats.h"
 #include "dm_constants.h"
 #include "dm_auth_state.h"
 #include "dm_auth_context.h"
@@ -267,6 +268,7 @@ int32_t DmAuthStateMachine::TransitionTo(std::shared_ptr<DmAuthState> state)
                 preState_ = DmAuthStateType::AUTH_SINK_FINISH_STATE;
             }
         }
+        DM_PERF_GAUGE(DmPerfGauge::AUTH_STATE_QUEUE, static_cast<int64_t>(statesQueue_.size()));
     }
     stateCv_.notify_one();
     return ret;
@@ -348,9 +350,14 @@ void DmAuthStateMachine::Run(std::shared_ptr<DmAuthContext> context)
         }
         // Obtain the status and execute the status action.
         DmAuthStateType stateType = state.value()->GetStateType();
-        int32_t ret = state.value()->Action(context);
+        int32_t ret = DM_OK;
+        {
+            DM_PERF_SCOPE(DmPerfOp::AUTH_STATE_ACTION);
+            ret = state.value()->Action(context);
+        }
         if (ret != DM_OK) {
             LOGE("err:%{public}d", ret);
+            DM_PERF_COUNT(DmPerfCounter::AUTH_STATE_FAILED);
             if (context->reason == DM_OK) {
                 // If the context reason is not set, set action ret.
                 context->reason = ret;
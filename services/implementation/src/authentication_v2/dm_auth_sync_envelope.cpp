@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dm_auth_sync_envelope.h"
+
+#include <zlib.h>
+
+#include "dm_error_type.h"
+#include "dm_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr char ENVELOPE_MAGIC_0 = 'D';
+constexpr char ENVELOPE_MAGIC_1 = 'S';
+constexpr uint32_t VERSION_POS = 2;
+constexpr uint32_t BODY_TYPE_POS = 3;
+constexpr uint32_t ORI_LEN_POS = 4;
+constexpr uint32_t BYTE_BITS = 8;
+constexpr uint32_t UINT32_BYTES = 4;
+constexpr uint32_t BYTE_MASK = 0xFF;
+
+void PutUint32(std::string &buffer, uint32_t pos, uint32_t value)
+{
+    for (uint32_t i = 0; i < UINT32_BYTES; i++) {
+        buffer[pos + i] = static_cast<char>((value >> (BYTE_BITS * (UINT32_BYTES - 1 - i))) & BYTE_MASK);
+    }
+}
+
+uint32_t GetUint32(const std::string &buffer, uint32_t pos)
+{
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < UINT32_BYTES; i++) {
+        value = (value << BYTE_BITS) | static_cast<uint8_t>(buffer[pos + i]);
+    }
+    return value;
+}
+}
+
+int32_t DmAuthSyncEnvelope::Pack(const std::string &syncMsg, std::string &envelope)
+{
+    if (syncMsg.empty() || syncMsg.size() > MAX_ORI_LEN) {
+        LOGE("invalid sync msg size: %{public}zu", syncMsg.size());
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    uLong srcLen = static_cast<uLong>(syncMsg.size());
+    uLong boundSize = compressBound(srcLen);
+    // Compress straight behind the header, no intermediate buffer.
+    std::string buffer(HEADER_LEN + boundSize, '\0');
+    uLongf destLen = boundSize;
+    int32_t ret = compress(reinterpret_cast<Bytef *>(&buffer[HEADER_LEN]), &destLen,
+        reinterpret_cast<const Bytef *>(syncMsg.data()), srcLen);
+    if (ret != Z_OK) {
+        LOGE("zlib compress failed, ret: %{public}d", ret);
+        return ERR_DM_FAILED;
+    }
+    buffer.resize(HEADER_LEN + destLen);
+    buffer[0] = ENVELOPE_MAGIC_0;
+    buffer[1] = ENVELOPE_MAGIC_1;
+    buffer[VERSION_POS] = static_cast<char>(ENVELOPE_VERSION);
+    buffer[BODY_TYPE_POS] = static_cast<char>(BODY_TYPE_ZLIB_JSON);
+    PutUint32(buffer, ORI_LEN_POS, static_cast<uint32_t>(syncMsg.size()));
+    envelope.swap(buffer);
+    return DM_OK;
+}
+
+int32_t DmAuthSyncEnvelope::Unpack(const std::string &envelope, std::string &syncMsg)
+{
+    if (envelope.size() <= HEADER_LEN || envelope[0] != ENVELOPE_MAGIC_0 || envelope[1] != ENVELOPE_MAGIC_1) {
+        LOGE("invalid envelope header, size: %{public}zu", envelope.size());
+        return ERR_DM_FAILED;
+    }
+    uint8_t version = static_cast<uint8_t>(envelope[VERSION_POS]);
+    uint8_t bodyType = static_cast<uint8_t>(envelope[BODY_TYPE_POS]);
+    if (version != ENVELOPE_VERSION || bodyType != BODY_TYPE_ZLIB_JSON) {
+        LOGE("unsupported envelope version: %{public}u, bodyType: %{public}u", version, bodyType);
+        return ERR_DM_FAILED;
+    }
+    uint32_t oriLen = GetUint32(envelope, ORI_LEN_POS);
+    if (oriLen == 0 || oriLen > MAX_ORI_LEN) {
+        LOGE("invalid oriLen: %{public}u", oriLen);
+        return ERR_DM_FAILED;
+    }
+    std::string buffer(oriLen, '\0');
+    uLongf destLen = oriLen;
+    int32_t ret = uncompress(reinterpret_cast<Bytef *>(&buffer[0]), &destLen,
+        reinterpret_cast<const Bytef *>(envelope.data() + HEADER_LEN), envelope.size() - HEADER_LEN);
+    if (ret != Z_OK || destLen != oriLen) {
+        LOGE("zlib uncompress failed, ret: %{public}d", ret);
+        return ERR_DM_FAILED;
+    }
+    syncMsg.swap(buffer);
+    return DM_OK;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -14,6 +14,8 @@
  */
 #include "dm_freeze_process.h"
 
+#include <algorithm>
+
 #include "app_manager.h"
 #include "cJSON.h"
 #include "datetime_ex.h"
@@ -42,10 +44,109 @@ constexpr int64_t FIRST_FREEZE_DURATION_SEC = 60;
 constexpr int64_t SECOND_FREEZE_DURATION_SEC = 3 * 60;
 constexpr int64_t THIRD_FREEZE_DURATION_SEC = 5 * 60;
 constexpr int64_t MAX_FREEZE_DURATION_SEC = 10 * 60;
+// Failure events are written behind at most this long after the first unflushed change.
+constexpr uint64_t FREEZE_FLUSH_DELAY_US = 1000 * 1000;
+constexpr int32_t MAX_FLUSH_RETRY_NUM = 3;
+constexpr const char* FREEZE_FLUSH_TASK = "FreezeFlushTask";
+}
+
+FreezeTimeRing::FreezeTimeRing(std::initializer_list<int64_t> values)
+{
+    Assign(std::vector<int64_t>(values));
+}
+
+FreezeTimeRing &FreezeTimeRing::operator=(std::initializer_list<int64_t> values)
+{
+    Assign(std::vector<int64_t>(values));
+    return *this;
+}
+
+FreezeTimeRing &FreezeTimeRing::operator=(const std::vector<int64_t> &values)
+{
+    Assign(values);
+    return *this;
+}
+
+void FreezeTimeRing::Assign(std::vector<int64_t> values)
+{
+    std::sort(values.begin(), values.end());
+    clear();
+    size_t begin = values.size() > CAPACITY ? values.size() - CAPACITY : 0;
+    for (size_t i = begin; i < values.size(); i++) {
+        push_back(values[i]);
+    }
+}
+
+void FreezeTimeRing::push_back(int64_t value)
+{
+    items_[(head_ + count_) % CAPACITY] = value;
+    if (count_ < CAPACITY) {
+        count_++;
+    } else {
+        head_ = (head_ + 1) % CAPACITY;
+    }
+}
+
+void FreezeTimeRing::clear()
+{
+    head_ = 0;
+    count_ = 0;
+}
+
+size_t FreezeTimeRing::size() const
+{
+    return count_;
+}
+
+bool FreezeTimeRing::empty() const
+{
+    return count_ == 0;
+}
+
+int64_t FreezeTimeRing::back() const
+{
+    return count_ == 0 ? 0 : items_[(head_ + count_ - 1) % CAPACITY];
+}
+
+int64_t FreezeTimeRing::operator[](size_t index) const
+{
+    return index < count_ ? items_[(head_ + index) % CAPACITY] : 0;
+}
+
+size_t FreezeTimeRing::EraseBefore(int64_t timeStamp)
+{
+    size_t erased = 0;
+    while (count_ > 0 && items_[head_] < timeStamp) {
+        head_ = (head_ + 1) % CAPACITY;
+        count_--;
+        erased++;
+    }
+    return erased;
+}
+
+std::vector<int64_t> FreezeTimeRing::ToVector() const
+{
+    std::vector<int64_t> result;
+    result.reserve(count_);
+    for (size_t i = 0; i < count_; i++) {
+        result.push_back((*this)[i]);
+    }
+    return result;
 }
 
 DM_IMPLEMENT_SINGLE_INSTANCE(FreezeProcess);
 
+FreezeProcess::FreezeProcess() : flushGuard_(std::make_shared<FlushGuard>())
+{
+    flushGuard_->owner = this;
+}
+
+FreezeProcess::~FreezeProcess()
+{
+    std::lock_guard<ffrt::mutex> lock(flushGuard_->mtx);
+    flushGuard_->owner = nullptr;
+}
+
 int32_t FreezeProcess::SyncFreezeData()
 {
     LOGI("called");
@@ -62,8 +163,10 @@ int32_t FreezeProcess::SyncFreezeData()
         return ret;
     }
     {
-        std::lock_guard<ffrt::mutex> lock(freezeStateCacheMtx_);
-        freezeStateCache_ = freezeStateObj;
+        std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
+        if (!freezeStateDirty_) {
+            freezeStateCache_ = freezeStateObj;
+        }
     }
     std::string bindFailedEventsValue;
     ret = KVAdapterManager::GetInstance().GetFreezeData(BIND_FAILED_EVENTS_KEY, bindFailedEventsValue);
@@ -77,8 +180,10 @@ int32_t FreezeProcess::SyncFreezeData()
         LOGE("ConvertJsonToBindFailedEvents, ret: %{public}d", ret);
         return ret;
     }
-    std::lock_guard<ffrt::mutex> lock(bindFailedEventsCacheMtx_);
-    bindFailedEventsCache_ = bindFailedEventsObj;
+    std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
+    if (!bindFailedEventsDirty_) {
+        bindFailedEventsCache_ = bindFailedEventsObj;
+    }
     LOGI("Sync freeze data success");
     return DM_OK;
 }
@@ -140,7 +245,7 @@ bool FreezeProcess::IsFrozen(int64_t &remainingFrozenTime)
     }
     int64_t stopFreezeTimeStamp = 0;
     {
-        std::lock_guard<ffrt::mutex> lock(freezeStateCacheMtx_);
+        std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
         if (bindFailedEventsCache_.IsEmpty()) {
             LOGI("bindFailedEventsCache is empty");
             return false;
@@ -175,43 +280,24 @@ int32_t FreezeProcess::CleanFreezeRecord(int64_t nowTime)
 
 int32_t FreezeProcess::CleanBindFailedEvents(int64_t reservedDataTimeStamp)
 {
-    std::lock_guard<ffrt::mutex> lock(bindFailedEventsCacheMtx_);
+    std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
     if (bindFailedEventsCache_.IsEmpty()) {
         LOGI("bindFailedEventsCache is empty, no need to clean");
         return DM_OK;
     }
-    BindFailedEvents bindFailedEventsTmp = bindFailedEventsCache_;
-    int32_t needCleanBindFailedStampNum = std::count_if(bindFailedEventsTmp.failedTimeStamps.begin(),
-        bindFailedEventsTmp.failedTimeStamps.end(),
-        [reservedDataTimeStamp](int64_t v) { return v < reservedDataTimeStamp; });
-    if (needCleanBindFailedStampNum == 0) {
+    if (bindFailedEventsCache_.failedTimeStamps.EraseBefore(reservedDataTimeStamp) == 0) {
         LOGI("no stamp is before 20mins, no need to clean");
         return DM_OK;
     }
-    bindFailedEventsTmp.failedTimeStamps.erase(
-        std::remove_if(bindFailedEventsTmp.failedTimeStamps.begin(),
-            bindFailedEventsTmp.failedTimeStamps.end(),
-            [reservedDataTimeStamp](int64_t n) { return n < reservedDataTimeStamp; }),
-        bindFailedEventsTmp.failedTimeStamps.end());
-    bindFailedEventsTmp.freezeTimeStamps.erase(
-        std::remove_if(bindFailedEventsTmp.freezeTimeStamps.begin(),
-            bindFailedEventsTmp.freezeTimeStamps.end(),
-            [reservedDataTimeStamp](int64_t n) { return n < reservedDataTimeStamp; }),
-        bindFailedEventsTmp.freezeTimeStamps.end());
-    std::string valueStr = "";
-    ConvertBindFailedEventsToJson(bindFailedEventsTmp, valueStr);
-    if (KVAdapterManager::GetInstance().PutFreezeData(BIND_FAILED_EVENTS_KEY, valueStr) != DM_OK) {
-        LOGE("within 20mins failed");
-        return ERR_DM_FAILED;
-    }
-    bindFailedEventsCache_ = bindFailedEventsTmp;
+    bindFailedEventsCache_.freezeTimeStamps.EraseBefore(reservedDataTimeStamp);
+    MarkDirtyLocked(false, true, false);
     LOGI("success");
     return DM_OK;
 }
 
 int32_t FreezeProcess::CleanFreezeState(int64_t reservedDataTimeStamp)
 {
-    std::lock_guard<ffrt::mutex> lock(freezeStateCacheMtx_);
+    std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
     if (freezeStateCache_.IsEmpty()) {
         LOGI("freezeStateCache is empty, no need to clean");
         return DM_OK;
@@ -220,11 +306,8 @@ int32_t FreezeProcess::CleanFreezeState(int64_t reservedDataTimeStamp)
         LOGI("startFreezeTimeStamp is in 20 mins, no need to clean");
         return DM_OK;
     }
-    if (KVAdapterManager::GetInstance().DeleteFreezeData(FREEZE_STATE_KEY) != DM_OK) {
-        LOGE("delete freeze states data within 20mins failed");
-        return ERR_DM_FAILED;
-    }
     freezeStateCache_.Reset();
+    MarkDirtyLocked(true, false, false);
     LOGI("success");
     return DM_OK;
 }
@@ -232,8 +315,8 @@ int32_t FreezeProcess::CleanFreezeState(int64_t reservedDataTimeStamp)
 void FreezeProcess::ConvertBindFailedEventsToJson(const BindFailedEvents &value, std::string &result)
 {
     JsonObject jsonObj;
-    jsonObj[FAILED_TIMES_STAMPS_KEY] = value.failedTimeStamps;
-    jsonObj[FREEZE_TIMES_STAMPS_KEY] = value.freezeTimeStamps;
+    jsonObj[FAILED_TIMES_STAMPS_KEY] = value.failedTimeStamps.ToVector();
+    jsonObj[FREEZE_TIMES_STAMPS_KEY] = value.freezeTimeStamps.ToVector();
     result = jsonObj.Dump();
 }
 
@@ -247,77 +330,144 @@ void FreezeProcess::ConvertDeviceFreezeStateToJson(const DeviceFreezeState &valu
 
 int32_t FreezeProcess::DeleteFreezeRecord()
 {
-    if (KVAdapterManager::GetInstance().DeleteFreezeData(FREEZE_STATE_KEY) != DM_OK) {
-        LOGE("delete freezeStates data failed");
-        return ERR_DM_FAILED;
-    }
+    bool isSynced = false;
     {
-        std::lock_guard<ffrt::mutex> lock(freezeStateCacheMtx_);
-        freezeStateCache_.Reset();
+        std::lock_guard<ffrt::mutex> lock(isSyncedMtx_);
+        isSynced = isSynced_;
     }
-    if (KVAdapterManager::GetInstance().DeleteFreezeData(BIND_FAILED_EVENTS_KEY) != DM_OK) {
-        LOGE("delete bindFailedEvents data failed");
-        return ERR_DM_FAILED;
+    std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
+    // every successful bind gets here, skip the kv round trip when there is nothing to delete.
+    if (isSynced && freezeStateCache_.IsEmpty() && bindFailedEventsCache_.IsEmpty() && !freezeStateDirty_ &&
+        !bindFailedEventsDirty_) {
+        return DM_OK;
     }
-    std::lock_guard<ffrt::mutex> lock(bindFailedEventsCacheMtx_);
+    freezeStateCache_.Reset();
     bindFailedEventsCache_.Reset();
+    MarkDirtyLocked(true, true, true);
     return DM_OK;
 }
 
 int32_t FreezeProcess::UpdateFreezeRecord()
 {
     int64_t nowTime = GetSecondsSince1970ToNow();
-    std::lock_guard<ffrt::mutex> lock(bindFailedEventsCacheMtx_);
-    BindFailedEvents bindFailedEventsTmp = bindFailedEventsCache_;
-    int64_t lastFreezeTimeStamps = 0;
-    if (!bindFailedEventsTmp.freezeTimeStamps.empty()) {
-        lastFreezeTimeStamps = bindFailedEventsTmp.freezeTimeStamps.back();
-    }
-    int32_t continueBindFailedNum = std::count_if(bindFailedEventsTmp.failedTimeStamps.begin(),
-        bindFailedEventsTmp.failedTimeStamps.end(),
-        [nowTime, lastFreezeTimeStamps](
-            int64_t v) { return v > nowTime - CONTINUEOUS_FAILED_INTERVAL && v > lastFreezeTimeStamps; });
-    if (continueBindFailedNum < MAX_CONTINUOUS_BIND_FAILED_NUM) {
-        bindFailedEventsTmp.failedTimeStamps.push_back(nowTime);
-        std::string bindFailedEventsStr = "";
-        ConvertBindFailedEventsToJson(bindFailedEventsTmp, bindFailedEventsStr);
-        if (KVAdapterManager::GetInstance().PutFreezeData(BIND_FAILED_EVENTS_KEY, bindFailedEventsStr) != DM_OK) {
-            LOGE("UpdateBindFailedEvents failed");
-            return ERR_DM_FAILED;
+    std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
+    BindFailedEvents &bindFailedEvents = bindFailedEventsCache_;
+    int64_t lastFreezeTimeStamps = bindFailedEvents.freezeTimeStamps.back();
+    int32_t continueBindFailedNum = 0;
+    for (size_t i = 0; i < bindFailedEvents.failedTimeStamps.size(); i++) {
+        int64_t v = bindFailedEvents.failedTimeStamps[i];
+        if (v > nowTime - CONTINUEOUS_FAILED_INTERVAL && v > lastFreezeTimeStamps) {
+            continueBindFailedNum++;
         }
-        bindFailedEventsCache_ = bindFailedEventsTmp;
-        return DM_OK;
     }
-    bindFailedEventsTmp.failedTimeStamps.push_back(nowTime);
-    bindFailedEventsTmp.freezeTimeStamps.push_back(nowTime);
-    std::string bindFailedEventsStr = "";
-    ConvertBindFailedEventsToJson(bindFailedEventsTmp, bindFailedEventsStr);
-    if (KVAdapterManager::GetInstance().PutFreezeData(BIND_FAILED_EVENTS_KEY, bindFailedEventsStr) != DM_OK) {
-        LOGE("UpdateBindFailedEvents failed");
-        return ERR_DM_FAILED;
+    bindFailedEvents.failedTimeStamps.push_back(nowTime);
+    if (continueBindFailedNum < MAX_CONTINUOUS_BIND_FAILED_NUM) {
+        MarkDirtyLocked(false, true, false);
+        return DM_OK;
     }
-    bindFailedEventsCache_ = bindFailedEventsTmp;
-    return UpdateFreezeState(nowTime);
+    bindFailedEvents.freezeTimeStamps.push_back(nowTime);
+    return UpdateFreezeStateLocked(nowTime);
 }
 
 int32_t FreezeProcess::UpdateFreezeState(int64_t nowTime)
 {
-    std::lock_guard<ffrt::mutex> lock(freezeStateCacheMtx_);
-    DeviceFreezeState freezeStateTmp = freezeStateCache_;
+    std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
+    return UpdateFreezeStateLocked(nowTime);
+}
+
+int32_t FreezeProcess::UpdateFreezeStateLocked(int64_t nowTime)
+{
     int64_t nextFreezeTime = 0;
-    CalculateNextFreezeTime(freezeStateTmp.stopFreezeTimeStamp - freezeStateTmp.startFreezeTimeStamp, nextFreezeTime);
-    freezeStateTmp.startFreezeTimeStamp = nowTime;
-    freezeStateTmp.stopFreezeTimeStamp = nowTime + nextFreezeTime;
-    std::string freezeStateStr = "";
-    ConvertDeviceFreezeStateToJson(freezeStateTmp, freezeStateStr);
-    if (KVAdapterManager::GetInstance().PutFreezeData(FREEZE_STATE_KEY, freezeStateStr) != DM_OK) {
-        LOGE("PutFreezeData failed");
-        return ERR_DM_FAILED;
-    }
-    freezeStateCache_ = freezeStateTmp;
+    CalculateNextFreezeTime(freezeStateCache_.stopFreezeTimeStamp - freezeStateCache_.startFreezeTimeStamp,
+        nextFreezeTime);
+    freezeStateCache_.startFreezeTimeStamp = nowTime;
+    freezeStateCache_.stopFreezeTimeStamp = nowTime + nextFreezeTime;
+    // a new freeze is checkpointed right away, a restart must not lift it.
+    MarkDirtyLocked(true, true, true);
     return DM_OK;
 }
 
+void FreezeProcess::MarkDirtyLocked(bool freezeState, bool bindFailedEvents, bool urgent)
+{
+    freezeStateDirty_ = freezeStateDirty_ || freezeState;
+    bindFailedEventsDirty_ = bindFailedEventsDirty_ || bindFailedEvents;
+    // a pending delayed flush is enough unless this change has to reach kv right away.
+    if (flushScheduled_ && (!urgent || urgentFlushScheduled_)) {
+        return;
+    }
+    flushScheduled_ = true;
+    urgentFlushScheduled_ = urgentFlushScheduled_ || urgent;
+    std::weak_ptr<FlushGuard> weakGuard = flushGuard_;
+    auto flushTask = [weakGuard]() {
+        auto guard = weakGuard.lock();
+        if (guard == nullptr) {
+            return;
+        }
+        std::lock_guard<ffrt::mutex> lock(guard->mtx);
+        if (guard->owner != nullptr) {
+            guard->owner->FlushFreezeData();
+        }
+    };
+    ffrt::submit(flushTask, ffrt::task_attr().name(FREEZE_FLUSH_TASK).delay(urgent ? 0 : FREEZE_FLUSH_DELAY_US));
+}
+
+void FreezeProcess::FlushFreezeData()
+{
+    DeviceFreezeState freezeState;
+    BindFailedEvents bindFailedEvents;
+    bool freezeStateDirty = false;
+    bool bindFailedEventsDirty = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
+        flushScheduled_ = false;
+        urgentFlushScheduled_ = false;
+        freezeStateDirty = freezeStateDirty_;
+        bindFailedEventsDirty = bindFailedEventsDirty_;
+        freezeStateDirty_ = false;
+        bindFailedEventsDirty_ = false;
+        freezeState = freezeStateCache_;
+        bindFailedEvents = bindFailedEventsCache_;
+    }
+    if (!freezeStateDirty && !bindFailedEventsDirty) {
+        return;
+    }
+    bool freezeStateFailed = false;
+    bool bindFailedEventsFailed = false;
+    if (freezeStateDirty) {
+        std::string freezeStateStr = "";
+        ConvertDeviceFreezeStateToJson(freezeState, freezeStateStr);
+        freezeStateFailed = PersistFreezeData(FREEZE_STATE_KEY, freezeStateStr, freezeState.IsEmpty()) != DM_OK;
+    }
+    if (bindFailedEventsDirty) {
+        std::string bindFailedEventsStr = "";
+        ConvertBindFailedEventsToJson(bindFailedEvents, bindFailedEventsStr);
+        bindFailedEventsFailed = PersistFreezeData(BIND_FAILED_EVENTS_KEY, bindFailedEventsStr,
+            bindFailedEvents.IsEmpty()) != DM_OK;
+    }
+    std::lock_guard<ffrt::mutex> lock(freezeCacheMtx_);
+    if (!freezeStateFailed && !bindFailedEventsFailed) {
+        flushRetryCount_ = 0;
+        return;
+    }
+    if (flushRetryCount_ >= MAX_FLUSH_RETRY_NUM) {
+        LOGE("flush freeze data failed, give up until next change.");
+        flushRetryCount_ = 0;
+        return;
+    }
+    flushRetryCount_++;
+    MarkDirtyLocked(freezeStateFailed, bindFailedEventsFailed, false);
+}
+
+int32_t FreezeProcess::PersistFreezeData(const char *key, const std::string &value, bool isEmpty)
+{
+    int32_t ret = isEmpty ? KVAdapterManager::GetInstance().DeleteFreezeData(key) :
+        KVAdapterManager::GetInstance().PutFreezeData(key, value);
+    if (ret != DM_OK) {
+        LOGE("persist %{public}s failed, ret: %{public}d", key, ret);
+    }
+    return ret;
+}
+
 void FreezeProcess::CalculateNextFreezeTime(int64_t nowFreezeTime, int64_t &nextFreezeTime)
 {
     switch (nowFreezeTime) {
@@ -15,6 +15,7 @@
 
 #include "crypto_mgr.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdlib>
 #include <string>
@@ -41,6 +42,49 @@ constexpr uint32_t OVERHEAD_LEN = GCM_IV_LEN + TAG_LEN;
 constexpr uint32_t MAX_ENCRY_MSG_LEN = 10 * 1024 * 1024; // 10MB
 constexpr uint32_t KEY_BITS_UNIT = 8;
 constexpr uint32_t HEX_TO_UINT8 = 2;
+
+namespace {
+bool GetSegmentsLen(const std::vector<DmCryptoSegment> &segments, uint32_t maxLen, uint32_t &totalLen)
+{
+    uint64_t sum = 0;
+    for (const auto &segment : segments) {
+        if (segment.data == nullptr && segment.len != 0) {
+            return false;
+        }
+        sum += segment.len;
+        if (sum > maxLen) {
+            return false;
+        }
+    }
+    totalLen = static_cast<uint32_t>(sum);
+    return true;
+}
+
+// Copies [begin, begin + len) of the concatenated segments into dst.
+bool CopySegmentRange(const std::vector<DmCryptoSegment> &segments, uint32_t begin, uint32_t len, uint8_t *dst)
+{
+    uint32_t offset = 0;
+    uint32_t copied = 0;
+    for (const auto &segment : segments) {
+        if (copied == len) {
+            break;
+        }
+        if (begin + copied >= offset + segment.len) {
+            offset += segment.len;
+            continue;
+        }
+        uint32_t from = begin + copied - offset;
+        uint32_t count = std::min(segment.len - from, len - copied);
+        if (memcpy_s(dst + copied, len - copied, segment.data + from, count) != EOK) {
+            return false;
+        }
+        copied += count;
+        offset += segment.len;
+    }
+    return copied == len;
+}
+}
+
 CryptoMgr::CryptoMgr()
 {
     LOGI("ctor");
@@ -59,50 +103,199 @@ int32_t CryptoMgr::EncryptMessage(const std::string &inputMsg, std::string &outp
         LOGE("Encrypt msg too long, size: %{public}zu", inputMsg.size());
         return ERR_DM_CRYPTO_PARA_INVALID;
     }
+    std::vector<uint8_t> encData;
+    int32_t ret = EncryptSegments({ { reinterpret_cast<const uint8_t *>(inputMsg.data()),
+        static_cast<uint32_t>(inputMsg.length()) } }, encData);
+    if (ret != DM_OK) {
+        LOGE("EncryptData fail=%{public}d", ret);
+        return ERR_DM_CRYPTO_OPT_FAILED;
+    }
+    uint32_t hexLen = static_cast<uint32_t>(encData.size()) * HEX_TO_UINT8;
+    std::string hexStr(hexLen + 1, '\0');
+    if (Crypto::ConvertBytesToHexString(&hexStr[0], hexLen + 1, encData.data(),
+        static_cast<uint32_t>(encData.size())) != DM_OK) {
+        LOGE("convert to hex failed.");
+        return ERR_DM_CRYPTO_OPT_FAILED;
+    }
+    hexStr.resize(hexLen);
+    outputMsg.swap(hexStr);
+    return DM_OK;
+}
+//LCOV_EXCL_STOP
 
+int32_t CryptoMgr::EncryptData(const std::string &inputData, std::string &outputData)
+{
+    if (inputData.empty() || inputData.length() > MAX_ENCRY_MSG_LEN) {
+        LOGE("Encrypt data invalid, size: %{public}zu", inputData.size());
+        return ERR_DM_CRYPTO_PARA_INVALID;
+    }
+    std::string encData(inputData.length() + OVERHEAD_LEN, '\0');
     std::lock_guard<ffrt::mutex> lock(sessionKeyMtx_);
-    AesGcmCipherKey cipherKey = {.keyLen = sessionKey_.keyLen};
-    if (memcpy_s(cipherKey.key, SESSION_KEY_LENGTH, sessionKey_.key, sessionKey_.keyLen) != EOK) {
-        LOGE("set key fail");
+    int32_t ret = PrepareSessionGcmLocked();
+    if (ret == DM_OK) {
+        ret = EncryptSegmentsLocked({ { reinterpret_cast<const uint8_t *>(inputData.data()),
+            static_cast<uint32_t>(inputData.length()) } }, reinterpret_cast<uint8_t *>(&encData[0]),
+            static_cast<uint32_t>(encData.length()));
+    }
+    if (ret != DM_OK) {
+        LOGE("EncryptData fail=%{public}d", ret);
         return ERR_DM_CRYPTO_OPT_FAILED;
     }
+    outputData.swap(encData);
+    return DM_OK;
+}
 
-    uint32_t encDataLen = inputMsg.length() + OVERHEAD_LEN;
-    unsigned char *encData = (unsigned char *)calloc(encDataLen, sizeof(unsigned char));
-    if (encData == nullptr) {
-        LOGE("calloc fail");
+int32_t CryptoMgr::DecryptData(const std::string &inputData, std::string &outputData)
+{
+    if (inputData.length() <= OVERHEAD_LEN || inputData.length() > MAX_ENCRY_MSG_LEN + OVERHEAD_LEN) {
+        LOGE("Decrypt data invalid, size: %{public}zu", inputData.size());
+        return ERR_DM_CRYPTO_PARA_INVALID;
+    }
+    std::vector<uint8_t> outData;
+    int32_t ret = DecryptSegments({ { reinterpret_cast<const uint8_t *>(inputData.data()),
+        static_cast<uint32_t>(inputData.length()) } }, outData);
+    if (ret != DM_OK) {
+        LOGE("DecryptData fail=%{public}d", ret);
         return ERR_DM_CRYPTO_OPT_FAILED;
     }
-    int32_t ret = DoEncryptData(&cipherKey, reinterpret_cast<const unsigned char*>(inputMsg.c_str()),
-        static_cast<uint32_t>(inputMsg.length()), encData, &encDataLen);
+    outputData.assign(outData.begin(), outData.end());
+    (void)memset_s(outData.data(), outData.size(), 0, outData.size());
+    return DM_OK;
+}
+
+int32_t CryptoMgr::EncryptSegments(const std::vector<DmCryptoSegment> &segments, std::vector<uint8_t> &output)
+{
+    uint32_t totalLen = 0;
+    if (!GetSegmentsLen(segments, MAX_ENCRY_MSG_LEN, totalLen) || totalLen == 0) {
+        LOGE("Encrypt segments invalid.");
+        return ERR_DM_CRYPTO_PARA_INVALID;
+    }
+    output.resize(totalLen + OVERHEAD_LEN);
+    std::lock_guard<ffrt::mutex> lock(sessionKeyMtx_);
+    int32_t ret = PrepareSessionGcmLocked();
     if (ret != DM_OK) {
-        LOGE("EncryptData fail=%{public}d", ret);
-        free(encData);
-        encData = nullptr;
+        output.clear();
+        return ret;
+    }
+    ret = EncryptSegmentsLocked(segments, output.data(), static_cast<uint32_t>(output.size()));
+    if (ret != DM_OK) {
+        output.clear();
+    }
+    return ret;
+}
+
+int32_t CryptoMgr::DecryptSegments(const std::vector<DmCryptoSegment> &segments, std::vector<uint8_t> &output)
+{
+    uint32_t totalLen = 0;
+    if (!GetSegmentsLen(segments, MAX_ENCRY_MSG_LEN + OVERHEAD_LEN, totalLen) || totalLen <= OVERHEAD_LEN) {
+        LOGE("Decrypt segments invalid.");
+        return ERR_DM_CRYPTO_PARA_INVALID;
+    }
+    std::lock_guard<ffrt::mutex> lock(sessionKeyMtx_);
+    int32_t ret = PrepareSessionGcmLocked();
+    if (ret != DM_OK) {
+        output.clear();
+        return ret;
+    }
+    return DecryptSegmentsLocked(segments, totalLen, output);
+}
+
+int32_t CryptoMgr::PrepareSessionGcmLocked()
+{
+    if (sessionGcmReady_) {
+        return DM_OK;
+    }
+    if (sessionKey_.key == nullptr || sessionKey_.keyLen == 0 || sessionKey_.keyLen > SESSION_KEY_LENGTH) {
+        LOGE("session key invalid.");
+        return ERR_DM_CRYPTO_PARA_INVALID;
+    }
+    if (sessionGcm_ == nullptr) {
+        sessionGcm_ = std::make_unique<mbedtls_gcm_context>();
+    }
+    mbedtls_gcm_init(sessionGcm_.get());
+    int32_t ret = mbedtls_gcm_setkey(sessionGcm_.get(), MBEDTLS_CIPHER_ID_AES, sessionKey_.key,
+        sessionKey_.keyLen * KEY_BITS_UNIT);
+    if (ret != 0) {
+        LOGE("mbedtls_gcm_setkey fail, ret=%{public}d", ret);
+        mbedtls_gcm_free(sessionGcm_.get());
+        return ERR_DM_CRYPTO_OPT_FAILED;
+    }
+    sessionGcmReady_ = true;
+    return DM_OK;
+}
+
+void CryptoMgr::ReleaseSessionGcmLocked()
+{
+    if (sessionGcm_ != nullptr && sessionGcmReady_) {
+        // mbedtls_gcm_free zeroizes the expanded key schedule.
+        mbedtls_gcm_free(sessionGcm_.get());
+    }
+    sessionGcmReady_ = false;
+}
+
+int32_t CryptoMgr::EncryptSegmentsLocked(const std::vector<DmCryptoSegment> &segments, uint8_t *output,
+    uint32_t outLen)
+{
+    if (outLen <= OVERHEAD_LEN) {
+        return ERR_DM_CRYPTO_PARA_INVALID;
+    }
+    if (GenerateRandomArray(output, GCM_IV_LEN) != DM_OK) {
+        LOGE("generate random iv error.");
+        return ERR_DM_CRYPTO_OPT_FAILED;
+    }
+    uint32_t plainLen = outLen - OVERHEAD_LEN;
+    uint8_t *body = output + GCM_IV_LEN;
+    const uint8_t *input = nullptr;
+    if (segments.size() == 1) {
+        input = segments[0].data;
+    } else {
+        // gather into the output buffer and encrypt in place.
+        if (!CopySegmentRange(segments, 0, plainLen, body)) {
+            return ERR_DM_CRYPTO_OPT_FAILED;
+        }
+        input = body;
+    }
+    int32_t ret = mbedtls_gcm_crypt_and_tag(sessionGcm_.get(), MBEDTLS_GCM_ENCRYPT, plainLen, output, GCM_IV_LEN,
+        nullptr, 0, input, body, TAG_LEN, body + plainLen);
+    if (ret != 0) {
+        LOGE("mbedtls_gcm_crypt_and_tag fail, ret=%{public}d", ret);
+        return ERR_DM_CRYPTO_OPT_FAILED;
+    }
+    return DM_OK;
+}
+
+int32_t CryptoMgr::DecryptSegmentsLocked(const std::vector<DmCryptoSegment> &segments, uint32_t totalLen,
+    std::vector<uint8_t> &output)
+{
+    uint32_t plainLen = totalLen - OVERHEAD_LEN;
+    output.resize(plainLen);
+    unsigned char iv[GCM_IV_LEN] = { 0 };
+    unsigned char tag[TAG_LEN] = { 0 };
+    const uint8_t *input = nullptr;
+    if (segments.size() == 1) {
+        input = segments[0].data + GCM_IV_LEN;
+    } else {
+        // scatter the body into the output buffer and decrypt in place.
+        if (!CopySegmentRange(segments, GCM_IV_LEN, plainLen, output.data())) {
+            output.clear();
+            return ERR_DM_CRYPTO_OPT_FAILED;
+        }
+        input = output.data();
+    }
+    if (!CopySegmentRange(segments, 0, GCM_IV_LEN, iv) ||
+        !CopySegmentRange(segments, GCM_IV_LEN + plainLen, TAG_LEN, tag)) {
+        output.clear();
+        return ERR_DM_CRYPTO_OPT_FAILED;
+    }
+    int32_t ret = mbedtls_gcm_auth_decrypt(sessionGcm_.get(), plainLen, iv, GCM_IV_LEN, nullptr, 0, tag, TAG_LEN,
+        input, output.data());
+    if (ret != 0) {
+        LOGE("mbedtls_gcm_auth_decrypt fail, ret=%{public}d", ret);
+        output.clear();
         return ERR_DM_CRYPTO_OPT_FAILED;
     }
-    if (memset_s(&cipherKey, sizeof(AesGcmCipherKey), 0, sizeof(AesGcmCipherKey)) != DM_OK) {
-        LOGE("memset_s failed.");
-        free(encData);
-        encData = nullptr;
-        return ERR_DM_SECURITY_FUNC_FAILED;
-    }
-    const uint32_t hexStrLen = encDataLen * HEX_TO_UINT8 + 1;
-    char hexStrTemp[hexStrLen];
-    if (memset_s(hexStrTemp, hexStrLen, 0, hexStrLen) != DM_OK) {
-        LOGE("memset_s failed.");
-        free(encData);
-        encData = nullptr;
-        return ERR_DM_SECURITY_FUNC_FAILED;
-    }
-    Crypto::ConvertBytesToHexString(hexStrTemp, hexStrLen, encData, encDataLen);
-    outputMsg.clear();
-    outputMsg.assign(hexStrTemp, encDataLen * HEX_TO_UINT8);
-    free(encData);
-    encData = nullptr;
     return DM_OK;
 }
-//LCOV_EXCL_STOP
 
 int32_t CryptoMgr::DoEncryptData(AesGcmCipherKey *cipherKey, const unsigned char *input, uint32_t inLen,
     unsigned char *encryptData, uint32_t *encryptLen)
@@ -202,49 +395,24 @@ int32_t CryptoMgr::GenerateRandomArray(unsigned char *randStr, uint32_t len)
 int32_t CryptoMgr::DecryptMessage(const std::string &inputMsg, std::string &outputMsg)
 {
     const uint32_t inputMsgBytesLen = inputMsg.length() / HEX_TO_UINT8;
-    unsigned char inputMsgBytsTemp[inputMsgBytesLen];
-    if (memset_s(inputMsgBytsTemp, inputMsgBytesLen, 0, inputMsgBytesLen) != DM_OK) {
-        LOGE("memset_s failed.");
-        return ERR_DM_CRYPTO_OPT_FAILED;
-    }
-    Crypto::ConvertHexStringToBytes(inputMsgBytsTemp, inputMsgBytesLen,
-        reinterpret_cast<const char*>(inputMsg.c_str()), inputMsg.length());
-    std::lock_guard<ffrt::mutex> lock(sessionKeyMtx_);
-    AesGcmCipherKey cipherKey = {.keyLen = sessionKey_.keyLen};
-    if (memcpy_s(cipherKey.key, SESSION_KEY_LENGTH, sessionKey_.key, sessionKey_.keyLen) != EOK) {
-        LOGE("set key fail");
-        return ERR_DM_CRYPTO_OPT_FAILED;
-    }
-
-    if (inputMsgBytesLen < OVERHEAD_LEN) {
+    if (inputMsgBytesLen <= OVERHEAD_LEN || inputMsgBytesLen > MAX_ENCRY_MSG_LEN + OVERHEAD_LEN) {
         LOGE("invalid para.");
         return ERR_DM_CRYPTO_PARA_INVALID;
     }
-    uint32_t outLen = inputMsgBytesLen - OVERHEAD_LEN + 1; /* for '\0' */
-    unsigned char *outData = (unsigned char *)calloc(outLen, sizeof(unsigned char));
-    if (outData == nullptr) {
-        LOGE("calloc fail");
-        return ERR_DM_CRYPTO_OPT_FAILED;
+    std::vector<uint8_t> inputMsgBytes(inputMsgBytesLen);
+    if (Crypto::ConvertHexStringToBytes(inputMsgBytes.data(), inputMsgBytesLen, inputMsg.c_str(),
+        static_cast<uint32_t>(inputMsg.length())) != DM_OK) {
+        LOGE("convert hex failed.");
+        return ERR_DM_CRYPTO_PARA_INVALID;
     }
-
-    int32_t ret = DoDecryptData(&cipherKey, inputMsgBytsTemp,
-        static_cast<uint32_t>(inputMsg.length() / HEX_TO_UINT8), outData, &outLen);
+    std::vector<uint8_t> outData;
+    int32_t ret = DecryptSegments({ { inputMsgBytes.data(), inputMsgBytesLen } }, outData);
     if (ret != DM_OK) {
         LOGE("SoftBusDecryptDataWithSeq fail=%{public}d", ret);
-        free(outData);
-        outData = nullptr;
         return ERR_DM_CRYPTO_OPT_FAILED;
     }
-    if (memset_s(&cipherKey, sizeof(AesGcmCipherKey), 0, sizeof(AesGcmCipherKey)) != DM_OK) {
-        LOGE("memset_s failed.");
-        free(outData);
-        outData = nullptr;
-        return ERR_DM_SECURITY_FUNC_FAILED;
-    }
-    outputMsg.clear();
-    outputMsg.assign(reinterpret_cast<const char*>(outData), outLen);
-    free(outData);
-    outData = nullptr;
+    outputMsg.assign(reinterpret_cast<const char *>(outData.data()), outData.size());
+    (void)memset_s(outData.data(), outData.size(), 0, outData.size());
     return DM_OK;
 }
 //LCOV_EXCL_STOP
@@ -326,6 +494,7 @@ std::vector<unsigned char> CryptoMgr::GetSessionKey()
 void CryptoMgr::ClearSessionKey()
 {
     std::lock_guard<ffrt::mutex> lock(sessionKeyMtx_);
+    ReleaseSessionGcmLocked();
     if (sessionKey_.key != nullptr) {
         (void)memset_s(sessionKey_.key, sessionKey_.keyLen, 0, sessionKey_.keyLen);
         free(sessionKey_.key);
@@ -22,6 +22,7 @@
 #include "dm_constants.h"
 #include "dm_crypto.h"
 #include "hichain_connector_callback.h"
+#include "hichain_group_cache.h"
 #include "parameter.h"
 #include "cJSON.h"
 
@@ -58,6 +59,28 @@ void HiChainAuthConnector::FreeCharArray(char *charArray)
     }
 }
 
+int32_t HiChainAuthConnector::QueryCredInfoStr(const CredManager *cm, int32_t userId, const std::string &credId,
+    std::string &credInfo)
+{
+    if (HichainGroupCache::GetInstance().GetCredentialInfo(userId, credId, credInfo)) {
+        return DM_OK;
+    }
+    uint64_t generation = HichainGroupCache::GetInstance().GetGeneration();
+    char *returnCredInfo = nullptr;
+    int32_t ret = cm->queryCredInfoByCredId(userId, credId.c_str(), &returnCredInfo);
+    if (ret != DM_OK) {
+        FreeJsonString(returnCredInfo);
+        return ret;
+    }
+    if (returnCredInfo == nullptr) {
+        return ERR_DM_FAILED;
+    }
+    credInfo = std::string(returnCredInfo);
+    FreeJsonString(returnCredInfo);
+    HichainGroupCache::GetInstance().PutCredentialInfo(userId, credId, credInfo, generation);
+    return DM_OK;
+}
+
 HiChainAuthConnector::HiChainAuthConnector()
 {
     deviceAuthCallback_ = {.onTransmit = HiChainAuthConnector::onTransmit,
@@ -250,6 +273,7 @@ int32_t HiChainAuthConnector::DeleteCredential(int32_t osAccountId, const std::s
         credId.c_str());
     const CredManager *credManager = GetCredMgrInstance();
     int32_t ret = credManager->deleteCredential(osAccountId, credId.c_str());
+    HichainGroupCache::GetInstance().InvalidateCredential(credId);
     if (ret != HC_SUCCESS) {
         LOGE("Hichain deleteCredential failed ret %{public}d.", ret);
         return ERR_DM_FAILED;
@@ -443,15 +467,13 @@ int32_t HiChainAuthConnector::QueryCredentialInfo(int32_t userId, const JsonObje
         }
         std::string credId = element.Get<std::string>();
 
-        char *returnCredInfo = nullptr;
-        ret = cm->queryCredInfoByCredId(userId, credId.c_str(), &returnCredInfo);
+        std::string credInfo;
+        ret = QueryCredInfoStr(cm, userId, credId, credInfo);
         if (ret != DM_OK) {
             LOGE("fail to query credential info.");
-            FreeJsonString(returnCredInfo);
             return ERR_DM_FAILED;
         }
-        JsonObject credInfoJson(returnCredInfo);
-        FreeJsonString(returnCredInfo);
+        JsonObject credInfoJson(credInfo);
         if (credInfoJson.IsDiscarded()) {
             LOGE("credential info jsonStr error");
             return ERR_DM_FAILED;
@@ -466,15 +488,13 @@ int32_t HiChainAuthConnector::QueryCredentialInfo(int32_t userId, const JsonObje
 int32_t HiChainAuthConnector::QueryCredInfoByCredId(int32_t userId, const std::string &credId, JsonObject &resultJson)
 {
     const CredManager *cm = GetCredMgrInstance();
-    char *returnCredInfo = nullptr;
-    int32_t ret = cm->queryCredInfoByCredId(userId, credId.c_str(), &returnCredInfo);
+    std::string credInfo;
+    int32_t ret = QueryCredInfoStr(cm, userId, credId, credInfo);
     if (ret != DM_OK) {
         LOGE("[HICHAIN]::QueryCredInfoByCredId failed, ret: %{public}d.", ret);
-        FreeJsonString(returnCredInfo);
         return ret;
     }
-    JsonObject credInfoJson(returnCredInfo);
-    FreeJsonString(returnCredInfo);
+    JsonObject credInfoJson(credInfo);
     if (credInfoJson.IsDiscarded()) {
         LOGE("credential info jsonStr error");
         return ERR_DM_FAILED;
@@ -594,15 +614,13 @@ int32_t HiChainAuthConnector::AddTokensToCredential(const std::string &credId, i
         LOGE("cm is null.");
         return ERR_DM_FAILED;
     }
-    char *returnCredInfo = nullptr;
-    int32_t ret = cm->queryCredInfoByCredId(userId, credId.c_str(), &returnCredInfo);
+    std::string credInfo;
+    int32_t ret = QueryCredInfoStr(cm, userId, credId, credInfo);
     if (ret != DM_OK) {
-        FreeCharArray(returnCredInfo);
         LOGE("[HICHAIN]::QueryCredInfoByCredId failed, ret: %{public}d.", ret);
         return ret;
     }
-    JsonObject credInfoJson(returnCredInfo);
-    FreeCharArray(returnCredInfo);
+    JsonObject credInfoJson(credInfo);
     if (credInfoJson.IsDiscarded()) {
         LOGE("QueryCredInfoByCredId credential info jsonStr error");
         return ERR_DM_FAILED;
@@ -615,6 +633,7 @@ int32_t HiChainAuthConnector::AddTokensToCredential(const std::string &credId, i
     JsonObject jsonObj;
     jsonObj[FIELD_AUTHORIZED_APP_LIST] = appList;
     ret = cm->updateCredInfo(userId, credId.c_str(), jsonObj.Dump().c_str());
+    HichainGroupCache::GetInstance().InvalidateCredential(credId);
     if (ret != DM_OK) {
         LOGE("[HICHAIN]::updateCredInfo failed, ret: %{public}d.", ret);
         return ret;
@@ -630,15 +649,13 @@ int32_t HiChainAuthConnector::UpdateCredential(const std::string &credId, int32_
         LOGE("cm is null.");
         return ERR_DM_FAILED;
     }
-    char *returnCredInfo = nullptr;
-    int32_t ret = cm->queryCredInfoByCredId(userId, credId.c_str(), &returnCredInfo);
+    std::string credInfo;
+    int32_t ret = QueryCredInfoStr(cm, userId, credId, credInfo);
     if (ret != DM_OK) {
-        FreeCharArray(returnCredInfo);
         LOGE("[HICHAIN]::QueryCredInfoByCredId failed, ret: %{public}d.", ret);
         return ret;
     }
-    JsonObject credInfoJson(returnCredInfo);
-    FreeCharArray(returnCredInfo);
+    JsonObject credInfoJson(credInfo);
     if (credInfoJson.IsDiscarded()) {
         LOGE("QueryCredInfoByCredId credential info jsonStr error");
         return ERR_DM_FAILED;
@@ -646,6 +663,7 @@ int32_t HiChainAuthConnector::UpdateCredential(const std::string &credId, int32_
     JsonObject jsonObj;
     jsonObj[FIELD_AUTHORIZED_APP_LIST] = tokenIds;
     ret = cm->updateCredInfo(userId, credId.c_str(), jsonObj.Dump().c_str());
+    HichainGroupCache::GetInstance().InvalidateCredential(credId);
     if (ret != DM_OK) {
         LOGE("[HICHAIN]::updateCredInfo failed, ret: %{public}d.", ret);
         return ret;
@@ -29,6 +29,7 @@
 #include "dm_random.h"
 #include "dm_radar_helper.h"
 #include "hichain_connector_callback.h"
+#include "hichain_group_cache.h"
 #include "multiple_user_connector.h"
 #include "json_object.h"
 #include "parameter.h"
@@ -246,12 +247,21 @@ bool HiChainConnector::GetGroupInfoExt(const int32_t userId, const std::string &
 bool HiChainConnector::GetGroupInfoCommon(const int32_t userId, const std::string &queryParams, const char* pkgName,
     std::vector<GroupInfo> &groupList)
 {
+    std::vector<HichainGroupRecord> groupRecords;
+    if (HichainGroupCache::GetInstance().GetGroupInfo(userId, pkgName, queryParams, groupRecords)) {
+        if (groupRecords.empty()) {
+            return false;
+        }
+        HichainGroupCache::ToGroupList(groupRecords, groupList);
+        return true;
+    }
     char *groupVec = nullptr;
     uint32_t num = 0;
     if (deviceGroupManager_ == nullptr) {
         LOGE("deviceGroupManager_ is null");
         return false;
     }
+    uint64_t generation = HichainGroupCache::GetInstance().GetGeneration();
     int32_t ret = deviceGroupManager_->getGroupInfo(userId, pkgName, queryParams.c_str(), &groupVec, &num);
     if (ret != 0) {
         LOGE("[HICHAIN]fail to get group info with ret:%{public}d.", ret);
@@ -265,27 +275,21 @@ bool HiChainConnector::GetGroupInfoCommon(const int32_t userId, const std::strin
     if (num == 0) {
         LOGE("[HICHAIN]return groups info number is zero.");
         deviceGroupManager_->destroyInfo(&groupVec);
+        HichainGroupCache::GetInstance().PutGroupInfo(userId, pkgName, queryParams, groupRecords, generation);
         return false;
     }
     LOGI("groupNum(%{public}u)", num);
     std::string relatedGroups = std::string(groupVec);
     deviceGroupManager_->destroyInfo(&groupVec);
-    JsonObject jsonObject(relatedGroups);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("returnGroups parse error");
+    if (HichainGroupCache::ParseGroups(relatedGroups, groupRecords) != DM_OK) {
         return false;
     }
-    if (!jsonObject.IsArray()) {
-        LOGE("json string is not array.");
-        return false;
-    }
-    std::vector<GroupInfo> groupInfos;
-    jsonObject.Get(groupInfos);
-    if (groupInfos.empty()) {
+    HichainGroupCache::GetInstance().PutGroupInfo(userId, pkgName, queryParams, groupRecords, generation);
+    if (groupRecords.empty()) {
         LOGE("group failed, groupInfos is empty.");
         return false;
     }
-    groupList = groupInfos;
+    HichainGroupCache::ToGroupList(groupRecords, groupList);
     return true;
 }
 
@@ -379,6 +383,8 @@ void HiChainConnector::onFinish(int64_t requestId, int operationCode, const char
 {
     std::string data = (returnData != nullptr) ? std::string(returnData) : "";
     LOGI("reqId:%{public}" PRId64 ", operation:%{public}d", requestId, operationCode);
+    // Own group operation finished, do not wait for the data change broadcast before querying again.
+    HichainGroupCache::GetInstance().InvalidateAll();
     if (operationCode == GroupOperationCode::MEMBER_JOIN) {
         LOGI("Add Member To Group success");
         if (!DmRadarHelper::GetInstance().ReportAuthAddGroupCb(
@@ -1190,32 +1196,12 @@ int32_t HiChainConnector::GetRelatedGroupsCommon(const std::string &deviceId, co
     std::vector<GroupInfo> &groupList)
 {
     LOGI("Start to get local related groups.");
-    uint32_t groupNum = 0;
-    char *returnGroups = nullptr;
     int32_t userId = MultipleUserConnector::GetCurrentAccountUserID();
     if (userId < 0) {
         LOGE("get current process account user id failed");
         return ERR_DM_FAILED;
     }
-    int32_t ret =
-        deviceGroupManager_->getRelatedGroups(userId, pkgName, deviceId.c_str(), &returnGroups, &groupNum);
-    if (ret != 0) {
-        LOGE("[HICHAIN] fail to get related groups with ret:%{public}d.", ret);
-        DestroyReturnGroupsAndClear(returnGroups);
-        return ERR_DM_FAILED;
-    }
-    if (returnGroups == nullptr) {
-        LOGE("[HICHAIN] return related goups point is nullptr");
-        return ERR_DM_FAILED;
-    }
-    if (groupNum == 0) {
-        LOGE("[HICHAIN]return related goups number is zero.");
-        DestroyReturnGroupsAndClear(returnGroups);
-        return ERR_DM_FAILED;
-    }
-    std::string relatedGroups = std::string(returnGroups);
-    DestroyReturnGroupsAndClear(returnGroups);
-    return ParseRelatedGroupsToJson(relatedGroups, groupList);
+    return GetRelatedGroupsCommon(userId, deviceId, pkgName, groupList);
 }
 
 int32_t HiChainConnector::DeleteGroup(const int32_t userId, std::string &groupId)
@@ -1245,8 +1231,17 @@ int32_t HiChainConnector::GetRelatedGroupsCommon(int32_t userId, const std::stri
         LOGE("user id failed");
         return ERR_DM_FAILED;
     }
+    std::vector<HichainGroupRecord> groupRecords;
+    if (HichainGroupCache::GetInstance().GetRelatedGroups(userId, pkgName, deviceId, groupRecords)) {
+        if (groupRecords.empty()) {
+            return ERR_DM_FAILED;
+        }
+        HichainGroupCache::ToGroupList(groupRecords, groupList);
+        return DM_OK;
+    }
     uint32_t groupNum = 0;
     char *returnGroups = nullptr;
+    uint64_t generation = HichainGroupCache::GetInstance().GetGeneration();
     int32_t ret =
         deviceGroupManager_->getRelatedGroups(userId, pkgName, deviceId.c_str(), &returnGroups, &groupNum);
     if (ret != 0) {
@@ -1261,11 +1256,23 @@ int32_t HiChainConnector::GetRelatedGroupsCommon(int32_t userId, const std::stri
     if (groupNum == 0) {
         LOGE("[HICHAIN]return related goups number is zero.");
         DestroyReturnGroupsAndClear(returnGroups);
+        HichainGroupCache::GetInstance().PutRelatedGroups(userId, pkgName, deviceId, groupRecords, generation);
         return ERR_DM_FAILED;
     }
     std::string relatedGroups = std::string(returnGroups);
     DestroyReturnGroupsAndClear(returnGroups);
-    return ParseRelatedGroupsToJson(relatedGroups, groupList);
+    ret = HichainGroupCache::ParseGroups(relatedGroups, groupRecords);
+    ClearSensitiveString(relatedGroups);
+    if (ret != DM_OK) {
+        return ERR_DM_FAILED;
+    }
+    HichainGroupCache::GetInstance().PutRelatedGroups(userId, pkgName, deviceId, groupRecords, generation);
+    if (groupRecords.empty()) {
+        LOGE("group failed, groupInfos is empty.");
+        return ERR_DM_FAILED;
+    }
+    HichainGroupCache::ToGroupList(groupRecords, groupList);
+    return DM_OK;
 }
 
 void HiChainConnector::DestroyReturnGroupsAndClear(char *returnGroups)
@@ -1277,32 +1284,6 @@ void HiChainConnector::DestroyReturnGroupsAndClear(char *returnGroups)
     deviceGroupManager_->destroyInfo(&returnGroups);
 }
 
-int32_t HiChainConnector::ParseRelatedGroupsToJson(std::string &relatedGroups,
-    std::vector<GroupInfo> &groupList)
-{
-    JsonObject jsonObject(relatedGroups);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("returnGroups parse error");
-        ClearSensitiveString(relatedGroups);
-        return ERR_DM_FAILED;
-    }
-    if (!jsonObject.IsArray()) {
-        LOGE("jsonObject is not an array.");
-        ClearSensitiveString(relatedGroups);
-        return ERR_DM_FAILED;
-    }
-    std::vector<GroupInfo> groupInfos;
-    jsonObject.Get(groupInfos);
-    if (groupInfos.empty()) {
-        LOGE("group failed, groupInfos is empty.");
-        ClearSensitiveString(relatedGroups);
-        return ERR_DM_FAILED;
-    }
-    groupList = groupInfos;
-    ClearSensitiveString(relatedGroups);
-    return DM_OK;
-}
-
 void HiChainConnector::ClearSensitiveString(std::string &sensitiveData)
 {
     if (!sensitiveData.empty()) {
@@ -30,6 +30,7 @@
 #include "dm_constants.h"
 #include "dm_crypto.h"
 #include "dm_log.h"
+#include "dm_perf_stats.h"
 #include "dm_radar_helper.h"
 #include "dm_softbus_cache.h"
 #include "multiple_user_connector.h"
@@ -785,6 +786,8 @@ void DeviceManagerServiceImpl::CreateGlobalClassicalAuthMgr()
 
 void DeviceManagerServiceImpl::HandleOffline(DmDeviceState devState, DmDeviceInfo &devInfo, const bool isOnline)
 {
+    DM_PERF_SCOPE(DmPerfOp::HANDLE_OFFLINE);
+    DM_PERF_COUNT(DmPerfCounter::DEVICE_OFFLINE);
     std::string trustDeviceId = deviceStateMgr_->GetUdidByNetWorkId(std::string(devInfo.networkId));
     LOGI("deviceStateMgr Udid: %{public}s", GetAnonyString(trustDeviceId).c_str());
     if (trustDeviceId == "") {
@@ -836,6 +839,8 @@ void DeviceManagerServiceImpl::HandleOffline(DmDeviceState devState, DmDeviceInf
 
 void DeviceManagerServiceImpl::HandleOnline(DmDeviceState devState, DmDeviceInfo &devInfo, const bool isOnline)
 {
+    DM_PERF_SCOPE(DmPerfOp::HANDLE_ONLINE);
+    DM_PERF_COUNT(DmPerfCounter::DEVICE_ONLINE);
     LOGI("networkId: %{public}s.", GetAnonyString(devInfo.networkId).c_str());
     std::string trustDeviceId = "";
     if (softbusConnector_->GetUdidByNetworkId(devInfo.networkId, trustDeviceId) != DM_OK) {
@@ -2133,6 +2138,13 @@ void DeviceManagerServiceImpl::GetBundleName(const DMAclQuadInfo &info, std::set
 {
     std::vector<DistributedDeviceProfile::AccessControlProfile> profiles =
         DeviceProfileConnector::GetInstance().GetAllAclIncludeLnnAcl();
+    GetBundleName(profiles, info, pkgNameSet, notifyOffline);
+}
+
+void DeviceManagerServiceImpl::GetBundleName(
+    const std::vector<DistributedDeviceProfile::AccessControlProfile> &profiles, const DMAclQuadInfo &info,
+    std::set<std::string> &pkgNameSet, bool &notifyOffline)
+{
     for (auto &item : profiles) {
         std::string accesserUdid = item.GetAccesser().GetAccesserDeviceId();
         std::string accesseeUdid = item.GetAccessee().GetAccesseeDeviceId();
@@ -2335,34 +2347,74 @@ void DeviceManagerServiceImpl::HandleAccountLogoutEvent(int32_t remoteUserId, co
     std::string uuid = "";
     SoftbusCache::GetInstance().GetUuidByUdid(remoteUdid, uuid);
     listener_->OnDeviceTrustChange(remoteUdid, uuid, DmAuthForm::IDENTICAL_ACCOUNT);
+    if (devIdAndUserMap.empty()) {
+        return;
+    }
+    CHECK_NULL_VOID(hiChainConnector_);
+    CHECK_NULL_VOID(hiChainAuthConnector_);
+    LOGI("remoteUdid %{public}s, local user num %{public}zu.", GetAnonyString(remoteUdid).c_str(),
+        devIdAndUserMap.size());
+    // One snapshot and one batched delete for every local user, then a single offline notification.
+    std::vector<DistributedDeviceProfile::AccessControlProfile> profiles =
+        DeviceProfileConnector::GetInstance().GetAllAclIncludeLnnAcl();
+    std::vector<DMAclQuadInfo> infos;
+    std::vector<DmOfflineParam> offlineParams;
+    std::vector<bool> notifyOfflines;
+    std::vector<DmAclIdParam> needDelAclInfos;
     for (const auto &item : devIdAndUserMap) {
-        DmOfflineParam offlineParam;
-        LOGI("remoteUdid %{public}s.", GetAnonyString(remoteUdid).c_str());
         DMAclQuadInfo info = {item.first, item.second, remoteUdid, remoteUserId};
-        bool notifyOffline = DeviceProfileConnector::GetInstance().DeleteAclByActhash(info,
-            remoteAccountHash, offlineParam, serviceInfos);
-
-        CHECK_NULL_VOID(hiChainConnector_);
+        DmOfflineParam offlineParam;
+        notifyOfflines.push_back(DeviceProfileConnector::GetInstance().DeleteAclByActhash(profiles, info,
+            remoteAccountHash, offlineParam, serviceInfos));
+        needDelAclInfos.insert(needDelAclInfos.end(), offlineParam.needDelAclInfos.begin(),
+            offlineParam.needDelAclInfos.end());
         hiChainConnector_->DeleteAllGroup(item.second, remoteUdid);
-        CHECK_NULL_VOID(hiChainAuthConnector_);
-        {
-            std::lock_guard lock(logoutMutex_);
+        infos.push_back(info);
+        offlineParams.push_back(offlineParam);
+    }
+    {
+        std::lock_guard lock(logoutMutex_);
+        for (const auto &item : devIdAndUserMap) {
             hiChainAuthConnector_->DeleteCredential(remoteUdid, item.second, remoteUserId);
-            DeleteSkCredAndAcl(offlineParam.needDelAclInfos);
         }
+        DeleteSkCredAndAcl(needDelAclInfos);
+    }
+    NotifyAccountLogoutOffline(remoteUdid, infos, offlineParams, notifyOfflines);
+}
 
-        std::set<std::string> pkgNameSet;
-        GetBundleName(info, pkgNameSet, notifyOffline);
-        if (notifyOffline) {
-            CHECK_NULL_VOID(softbusConnector_);
-            softbusConnector_->SetProcessInfoVec(offlineParam.processVec);
-            CHECK_NULL_VOID(listener_);
-            listener_->SetExistPkgName(pkgNameSet);
-            CHECK_NULL_VOID(deviceStateMgr_);
-            bool isOnline = SoftbusCache::GetInstance().CheckIsOnlineByPeerUdid(remoteUdid);
-            deviceStateMgr_->OnDeviceOffline(remoteUdid, isOnline);
+void DeviceManagerServiceImpl::NotifyAccountLogoutOffline(const std::string &remoteUdid,
+    const std::vector<DMAclQuadInfo> &infos, const std::vector<DmOfflineParam> &offlineParams,
+    const std::vector<bool> &notifyOfflines)
+{
+    std::vector<DistributedDeviceProfile::AccessControlProfile> profiles =
+        DeviceProfileConnector::GetInstance().GetAllAclIncludeLnnAcl();
+    bool notifyOffline = false;
+    std::set<std::string> pkgNameSet;
+    std::vector<ProcessInfo> processVec;
+    for (size_t i = 0; i < infos.size(); i++) {
+        bool userNotifyOffline = notifyOfflines[i];
+        std::set<std::string> userPkgNameSet;
+        GetBundleName(profiles, infos[i], userPkgNameSet, userNotifyOffline);
+        if (!userNotifyOffline) {
+            continue;
+        }
+        notifyOffline = true;
+        pkgNameSet.insert(userPkgNameSet.begin(), userPkgNameSet.end());
+        for (const auto &processInfo : offlineParams[i].processVec) {
+            if (std::find(processVec.begin(), processVec.end(), processInfo) == processVec.end()) {
+                processVec.push_back(processInfo);
+            }
         }
     }
+    if (notifyOffline) {
+        CHECK_NULL_VOID(softbusConnector_);
+        softbusConnector_->SetProcessInfoVec(processVec);
+        CHECK_NULL_VOID(listener_);
+        listener_->SetExistPkgName(pkgNameSet);
+        CHECK_NULL_VOID(deviceStateMgr_);
+        bool isOnline = SoftbusCache::GetInstance().CheckIsOnlineByPeerUdid(remoteUdid);
+        deviceStateMgr_->OnDeviceOffline(remoteUdid, isOnline);
+    }
 }
 
 DmAuthForm DeviceManagerServiceImpl::ConvertBindTypeToAuthForm(int32_t bindType)
@@ -3098,46 +3150,39 @@ int32_t DeviceManagerServiceImpl::DeleteAcl(const std::string &pkgName, const st
     return ERR_DM_FAILED;
 }
 
-void DeviceManagerServiceImpl::DeleteCredential(DmAclIdParam &acl)
+void DeviceManagerServiceImpl::DeleteCredential(int32_t userId, const std::string &credId,
+    const std::vector<int64_t> &tokenIds)
 {
     CHECK_NULL_VOID(hiChainAuthConnector_);
     JsonObject credJson;
-    int32_t ret = hiChainAuthConnector_->QueryCredInfoByCredId(acl.userId, acl.credId, credJson);
-    if (ret != DM_OK || !credJson.Contains(acl.credId)) {
+    int32_t ret = hiChainAuthConnector_->QueryCredInfoByCredId(userId, credId, credJson);
+    if (ret != DM_OK || !credJson.Contains(credId)) {
         LOGE("err, ret:%{public}d", ret);
         return;
     }
-    if (!credJson[acl.credId].Contains(FILED_AUTHORIZED_APP_LIST)) {
-        ret = hiChainAuthConnector_->DeleteCredential(acl.userId, acl.credId);
+    if (!credJson[credId].Contains(FILED_AUTHORIZED_APP_LIST)) {
+        ret = hiChainAuthConnector_->DeleteCredential(userId, credId);
         if (ret != DM_OK) {
             LOGE("DeletecredId err, ret:%{public}d", ret);
         }
         return;
     }
-    DistributedDeviceProfile::AccessControlProfile profile =
-        DeviceProfileConnector::GetInstance().GetAccessControlProfileByAccessControlId(acl.accessControlId);
-    if (profile.GetAccessControlId() != acl.accessControlId) {
-        LOGE("no found profile");
-        return;
-    }
     std::vector<std::string> appList;
-    credJson[acl.credId][FILED_AUTHORIZED_APP_LIST].Get(appList);
-    auto erIt = std::find(appList.begin(), appList.end(), std::to_string(profile.GetAccesser().GetAccesserTokenId()));
-    if (erIt != appList.end()) {
-        appList.erase(erIt);
-    }
-    auto eeIt = std::find(appList.begin(), appList.end(), std::to_string(profile.GetAccessee().GetAccesseeTokenId()));
-    if (eeIt != appList.end()) {
-        appList.erase(eeIt);
+    credJson[credId][FILED_AUTHORIZED_APP_LIST].Get(appList);
+    for (const auto &tokenId : tokenIds) {
+        auto it = std::find(appList.begin(), appList.end(), std::to_string(tokenId));
+        if (it != appList.end()) {
+            appList.erase(it);
+        }
     }
     if (appList.size() == 0) {
-        ret = hiChainAuthConnector_->DeleteCredential(acl.userId, acl.credId);
+        ret = hiChainAuthConnector_->DeleteCredential(userId, credId);
         if (ret != DM_OK) {
             LOGE("DeletecredId err, ret:%{public}d", ret);
         }
         return;
     }
-    hiChainAuthConnector_->UpdateCredential(acl.credId, acl.userId, appList);
+    hiChainAuthConnector_->UpdateCredential(credId, userId, appList);
 }
 
 int32_t DeviceManagerServiceImpl::DeleteSkCredAndAcl(const std::vector<DmAclIdParam> &acls)
@@ -3148,16 +3193,31 @@ int32_t DeviceManagerServiceImpl::DeleteSkCredAndAcl(const std::vector<DmAclIdPa
         return ret;
     }
     CHECK_NULL_RETURN(hiChainAuthConnector_, ERR_DM_POINT_NULL);
-    for (auto item : acls) {
+    // Each session key and credential is touched once however many of the acls share it.
+    std::set<int64_t> aclIds;
+    std::set<std::pair<int32_t, int32_t>> skIds;
+    std::map<std::pair<int32_t, std::string>, std::vector<int64_t>> credTokenIds;
+    DmAclBatch batch;
+    for (const auto &item : acls) {
+        if (!aclIds.insert(item.accessControlId).second) {
+            continue;
+        }
         LOGI("userId:%{public}d, skId:%{public}d, credId:%{public}s",
             item.userId, item.skId, GetAnonyString(item.credId).c_str());
-        ret = DeviceProfileConnector::GetInstance().DeleteSessionKey(item.userId, item.skId);
-        if (ret != DM_OK) {
-            LOGE("DeleteSessionKey err, ret:%{public}d", ret);
+        if (skIds.insert(std::make_pair(item.userId, item.skId)).second) {
+            ret = DeviceProfileConnector::GetInstance().DeleteSessionKey(item.userId, item.skId);
+            if (ret != DM_OK) {
+                LOGE("DeleteSessionKey err, ret:%{public}d", ret);
+            }
         }
-        DeleteCredential(item);
-        DeviceProfileConnector::GetInstance().DeleteAccessControlById(item.accessControlId);
+        std::vector<int64_t> &tokenIds = credTokenIds[std::make_pair(item.userId, item.credId)];
+        tokenIds.insert(tokenIds.end(), item.tokenIds.begin(), item.tokenIds.end());
+        batch.delAclInfos.push_back(item);
+    }
+    for (const auto &item : credTokenIds) {
+        DeleteCredential(item.first.first, item.first.second, item.second);
     }
+    DeviceProfileConnector::GetInstance().ApplyAclBatch(batch);
     return ret;
 }
 
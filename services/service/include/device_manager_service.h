@@ -60,6 +60,18 @@ public:
 
     int32_t InitSoftbusListener();
 
+    void CreateServiceListener();
+
+    void CreateSoftbusListener();
+
+    void PreloadDMServiceImpl();
+
+    void SaveOnlineDeviceInfo();
+
+    void SubscribeSoftbusCommonEvent();
+
+    int32_t InitSoftbusServerResident();
+
     void InitHichainListener();
 
     void StartDetectDeviceRisk();
@@ -229,6 +241,7 @@ public:
     int32_t SetDnPolicy(const std::string &pkgName, std::map<std::string, std::string> &policy);
     void ClearDiscoveryCache(const ProcessInfo &processInfo);
     void HandleDeviceScreenStatusChange(DmDeviceInfo &devInfo);
+    void HandleLocalDeviceNameChange();
     int32_t GetDeviceScreenStatus(const std::string &pkgName, const std::string &networkId,
         int32_t &screenStatus);
     void SubscribePackageCommonEvent();
@@ -421,6 +434,8 @@ private:
     void HandleUserRemoved(int32_t removedUserId);
     void HandleUserIdsBroadCast(const std::vector<UserIdInfo> &remoteUserIdInfos,
         const std::string &remoteUdid, bool isNeedResponse);
+    void HandleUserIdsDeltaGap(const std::string &remoteUdid);
+    void SendUserIdsRelationShip(RelationShipChangeMsg &msg);
     void ProcessReceivedUserIds(const std::vector<UserIdInfo> &remoteUserIdInfos, const std::string &remoteUdid);
     void ProcessServiceBindings(const std::vector<UserIdInfo> &remoteUserIdInfos, const std::string &remoteUdid);
     void ProcessActiveServices(const DmUserRemovedServiceInfo &serviceInfo);
@@ -450,6 +465,10 @@ private:
     void HandleUserStopBroadCast(int32_t stopUserId, const std::string &remoteUdid);
     void NotifyRemoteLocalUserStopByWifi(const std::string &localUdid,
         const std::map<std::string, std::string> &wifiDevices, int32_t stopUserId);
+    bool StartUserStopByWifiTimer(int32_t stopUserId, const std::string &localUdid, const std::string &udid,
+        int32_t sendResult);
+    void SplitWifiDevices(const std::map<std::string, std::string> &wifiDevices,
+        std::vector<std::string> &udids, std::vector<std::string> &networkIds);
     bool InitDPLocalServiceInfo(const DMLocalServiceInfo &serviceInfo,
         DistributedDeviceProfile::LocalServiceInfo &dpLocalServiceItem);
     void InitServiceInfo(const DistributedDeviceProfile::LocalServiceInfo &dpLocalServiceItem,
@@ -474,6 +493,8 @@ private:
         const std::vector<int32_t> &backgroundUserIds);
     int32_t SendAccountCommonEventByWifi(const std::string &networkId,
         const std::vector<int32_t> &foregroundUserIds, const std::vector<int32_t> &backgroundUserIds);
+    bool StartCommonEventByWifiTimer(const std::string &localUdid, const std::vector<int32_t> &foregroundUserIds,
+        const std::vector<int32_t> &backgroundUserIds, const std::string &udid, int32_t sendResult);
     void HandleCommonEventTimeout(const std::string &localUdid, const std::vector<int32_t> &foregroundUserIds,
         const std::vector<int32_t> &backgroundUserIds, const std::string &udid);
     void UpdateAcl(const std::string &localUdid, const std::vector<std::string> &peerUdids,
@@ -24,6 +24,7 @@
 
 #include "dm_device_info.h"
 #include "dm_device_profile_info.h"
+#include "dm_notify_state_table.h"
 #include "idevice_manager_service_listener.h"
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
 #include "kv_adapter_manager.h"
@@ -100,6 +101,7 @@ public:
     void OnLeaveLNNResult(const std::string &pkgName, const std::string &networkId, int32_t retCode) override;
     void OnAuthCodeInvalid(const std::string &pkgName, const std::string &consumerPkgName) override;
     std::set<ProcessInfo> GetAlreadyOnlineProcess() override;
+    void OnLocalDeviceNameChange();
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
     void OnServiceDiscoveryResult(const ProcessInfo &processInfo, const std::string &serviceType,
         int32_t reason) override;
@@ -162,7 +164,7 @@ private:
     void ProcessAppOnline(std::vector<ProcessInfo> &procInfoVec, const ProcessInfo &processInfo,
         const DmDeviceState &state, const DmDeviceInfo &info, const DmDeviceBasicInfo &deviceBasicInfo,
         const std::vector<int64_t> &serviceIds);
-    void ClearDbReadyMap(std::string &notifyPkgName);
+    void ClearDbReadyMap(const ProcessInfo &processInfo, const std::string &deviceId);
     void SetNeedNotifyProcessInfos(const ProcessInfo &processInfo, std::vector<ProcessInfo> &procInfoVec);
 #ifdef CAR_DEVICE_ENABLE
     std::vector<ProcessInfo> GetWhiteListSAProcessInfo(DmCommonNotifyEvent dmCommonNotifyEvent,
@@ -175,9 +177,9 @@ private:
 #if !defined(__LITEOS_M__)
     IpcServerListener ipcServerListener_;
     static std::mutex alreadyNotifyPkgNameLock_;
-    static std::map<std::string, DmDeviceInfo> alreadyOnlinePkgName_;
+    static DmNotifyStateTable alreadyOnlinePkgName_;
     static std::mutex alreadyDbReadyPkgNameLock_;
-    static std::map<std::string, DmDeviceInfo> alreadyDbReadyPkgName_;
+    static DmNotifyStateTable alreadyDbReadyPkgName_;
     static std::unordered_set<std::string> highPriorityPkgNameSet_;
     static std::mutex actUnrelatedPkgNameLock_;
     static std::set<std::string> actUnrelatedPkgName_;
@@ -16,6 +16,7 @@
 #ifndef OHOS_DEVICE_NAME_MANAGER_H
 #define OHOS_DEVICE_NAME_MANAGER_H
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -46,6 +47,7 @@ public:
     int32_t InitDeviceNameWhenLanguageOrRegionChanged();
     std::string GetUserDefinedDeviceName();
     std::string GetLocalMarketName();
+    void ClearSettingsCache(int32_t userId);
 
 private:
     DeviceNameManager() = default;
@@ -77,6 +79,13 @@ private:
     std::shared_ptr<DataShare::DataShareHelper> CreateDataShareHelper(const std::string &proxyUri);
     Uri MakeUri(const std::string &proxyUri, const std::string &key);
     bool ReleaseDataShareHelper(std::shared_ptr<DataShare::DataShareHelper> helper);
+    std::shared_ptr<DataShare::DataShareHelper> AcquireDataShareHelper(const std::string &proxyUri);
+    void DropDataShareHelper(const std::string &proxyUri);
+    void ClearDataShareHelpers();
+    bool IsSettingsCacheable(const std::string &tableName, int32_t userId, const std::string &key);
+    bool GetCachedSettings(int32_t userId, const std::string &cacheKey, std::string &value, uint64_t &generation);
+    void UpdateCachedSettings(int32_t userId, const std::string &cacheKey, const std::string &value,
+        uint64_t generation);
 
     sptr<IRemoteObject> GetRemoteObj();
 private:
@@ -86,6 +95,13 @@ private:
     std::string localMarketName_ = "";
     ffrt::mutex monitorMapMtx_;
     std::map<int32_t, sptr<DeviceNameChangeMonitor>> monitorMap_;
+    // Long-lived helpers keyed by proxy uri, one per settings table of a user.
+    ffrt::mutex helperPoolMtx_;
+    std::map<std::string, std::shared_ptr<DataShare::DataShareHelper>> helperPool_;
+    // Settings values of observed keys, userId -> (uri&key -> value).
+    ffrt::mutex settingsCacheMtx_;
+    std::map<int32_t, std::map<std::string, std::string>> settingsCache_;
+    uint64_t settingsCacheGen_ = 0;
     std::atomic<bool> isDataShareReady_ = false;
     std::atomic<bool> isAccountSysReady_ = false;
 };
@@ -70,14 +70,18 @@ public:
     int64_t GenRequestId();
     int32_t DeleteCredential(int32_t osAccountId, const std::string &credId);
 
+    static void OnHichainGroupChanged(const char *groupInfo);
+    static void OnHichainDeviceBound(const char *peerUdid, const char *groupInfo);
     static void OnHichainDeviceUnBound(const char *peerUdid, const char *groupInfo);
+    static void OnHichainDeviceNotTrusted(const char *peerUdid);
+    static void OnHichainLastGroupDeleted(const char *peerUdid, int groupType);
+    static void OnCredentialChanged(const char *credId, const char *credInfo);
     static void OnCredentialDeleted(const char *credId, const char *credInfo);
 
 private:
     const DeviceGroupManager *deviceGroupManager_ = nullptr;
     const CredManager *credManager_ = nullptr;
     void DestroyReturnGroupsAndClear(char *returnGroups);
-    int32_t ParseRelatedGroupsToJson(std::string &relatedGroups, std::vector<GroupsInfo> &groupList);
     void ClearSensitiveString(std::string &sensitiveData);
 };
 } // namespace DistributedHardware
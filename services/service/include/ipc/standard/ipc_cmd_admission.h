@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_IPC_CMD_ADMISSION_H
+#define OHOS_DM_IPC_CMD_ADMISSION_H
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace OHOS {
+namespace DistributedHardware {
+// Cost class of an ipc command, each class has its own share of the binder threads.
+enum class IpcCmdLane : int32_t {
+    LIGHT = 0,
+    NORMAL,
+    HEAVY,
+    LANE_MAX,
+};
+
+struct IpcLaneBudget {
+    int32_t maxRunning = 0;
+    int32_t maxWaiting = 0;
+    int64_t waitTimeoutMs = 0;
+};
+
+using IpcLaneBudgets = std::array<IpcLaneBudget, static_cast<size_t>(IpcCmdLane::LANE_MAX)>;
+
+/*
+ * Admission control in front of the ipc command handlers. The normal and heavy lanes can only
+ * occupy part of the binder thread pool, so a burst of slow commands leaves threads for the
+ * light queries. A command that finds its lane and the lane's waiting slots full, or waits
+ * longer than the lane allows, is rejected with ERR_DM_IPC_CMD_BUSY.
+ */
+class IpcCmdAdmission {
+public:
+    IpcCmdAdmission();
+    explicit IpcCmdAdmission(const IpcLaneBudgets &budgets);
+    ~IpcCmdAdmission() = default;
+
+    static IpcCmdLane GetLane(int32_t cmdCode);
+    int32_t Acquire(IpcCmdLane lane);
+    void Release(IpcCmdLane lane);
+    int32_t GetRunning(IpcCmdLane lane);
+
+private:
+    struct LaneState {
+        int32_t running = 0;
+        int32_t waiting = 0;
+        std::condition_variable cond;
+    };
+
+    IpcLaneBudgets budgets_;
+    std::mutex laneLock_;
+    std::array<LaneState, static_cast<size_t>(IpcCmdLane::LANE_MAX)> lanes_;
+};
+
+class IpcCmdAdmissionGuard {
+public:
+    IpcCmdAdmissionGuard(IpcCmdAdmission &admission, IpcCmdLane lane);
+    ~IpcCmdAdmissionGuard();
+    IpcCmdAdmissionGuard(const IpcCmdAdmissionGuard &) = delete;
+    IpcCmdAdmissionGuard &operator=(const IpcCmdAdmissionGuard &) = delete;
+
+    int32_t GetResult() const;
+
+private:
+    IpcCmdAdmission &admission_;
+    IpcCmdLane lane_;
+    int32_t result_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_IPC_CMD_ADMISSION_H
@@ -19,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <shared_mutex>
 #include <tuple>
 #include <unordered_set>
 #include <vector>
@@ -33,6 +34,7 @@
 #include "dm_device_info.h"
 #include "dm_single_instance.h"
 #include "iipc_service_stub_3rd.h"
+#include "ipc_cmd_admission.h"
 namespace OHOS {
 namespace DistributedHardware {
 enum class ServiceRunningState { STATE_NOT_START, STATE_RUNNING };
@@ -166,6 +168,7 @@ private:
     IpcServerStub();
     ~IpcServerStub() override = default;
     bool Init();
+    bool PublishService();
     void AddSystemSA(const std::string &pkgName);
     void RemoveSystemSA(const std::string &pkgName);
     std::string JoinPath(const std::string &prefixPath, const std::string &midPath,
@@ -175,16 +178,24 @@ private:
     void ReclaimMemmgrFileMemForDM();
     void HandleSoftBusServerAdd();
     bool IsIpcServiceStub3rdReady();
+    void AddListenerIndex(const ProcessInfo &processInfo, const sptr<IpcRemoteBroker> &listener);
+    void RemoveListenerIndex(const ProcessInfo &processInfo, const sptr<IpcRemoteBroker> &listener);
 
 private:
     ffrt::mutex registerLock_;
     bool registerToService_;
     ServiceRunningState state_;
-    mutable ffrt::mutex listenerLock_;
+    // Read-mostly: every callback delivery looks a listener up, only register and death write.
+    mutable std::shared_mutex listenerLock_;
     std::map<ProcessInfo, sptr<AppDeathRecipient>> appRecipient_;
     std::map<ProcessInfo, sptr<IpcRemoteBroker>> dmListener_;
+    // Keys of dmListener_ grouped by (pkgName, userId), so a lookup only compares that group.
+    std::map<std::pair<std::string, int32_t>, std::set<ProcessInfo>> listenerIndex_;
+    // Owner of every listener remote object, for the death recipient.
+    std::map<IRemoteObject *, ProcessInfo> remoteIndex_;
     std::set<std::string> systemSA_;
     int64_t startBeginTime_ = 0;
+    IpcCmdAdmission cmdAdmission_;
 
 private:
     void *ipcServiceStub3rdSoHandle_ = nullptr;
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_NOTIFY_STATE_TABLE_H
+#define OHOS_DM_NOTIFY_STATE_TABLE_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "dm_device_info.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Records which device each subscriber (pkgName, userId, tokenId) has already been notified
+ * about. Subscribers and devices are interned once and linked by two sorted id lists, so
+ * dropping a device, a process or a package only touches the pairs it owns.
+ * Not thread safe, the owner serializes the calls.
+ */
+class DmNotifyStateTable {
+public:
+    // Returns false when the pair is already recorded.
+    bool Insert(const ProcessInfo &processInfo, const std::string &deviceId);
+    bool Contains(const ProcessInfo &processInfo, const std::string &deviceId) const;
+    bool Erase(const ProcessInfo &processInfo, const std::string &deviceId);
+    // The Erase* calls below return the number of pairs removed.
+    size_t EraseDevice(const std::string &deviceId);
+    size_t EraseProcess(const ProcessInfo &processInfo);
+    size_t ErasePkgName(const std::string &pkgName);
+    // Drops the subscribers matched by pred, pred sees every subscriber once.
+    size_t EraseProcessIf(const std::function<bool(const ProcessInfo &)> &pred);
+    // Subscribers with at least one recorded device, carrying pkgName, userId and tokenId only.
+    std::vector<ProcessInfo> GetProcesses() const;
+    std::vector<std::string> GetDevices(const ProcessInfo &processInfo) const;
+    size_t Size() const;
+    bool Empty() const;
+    size_t GetProcessNum() const;
+    size_t GetDeviceNum() const;
+    void Clear();
+
+private:
+    using Id = uint32_t;
+    using ProcessKey = std::tuple<std::string, int32_t, uint32_t>;
+
+    struct Process {
+        ProcessInfo processInfo;
+        std::vector<Id> devices;
+    };
+
+    struct Device {
+        std::string deviceId;
+        std::vector<Id> processes;
+    };
+
+    static ProcessKey MakeProcessKey(const ProcessInfo &processInfo);
+    const Id *FindProcessId(const ProcessInfo &processInfo) const;
+    void Unlink(Id processId, Id deviceId);
+    void RemoveProcess(Id processId);
+    void RemoveDevice(Id deviceId);
+    size_t EraseProcessById(Id processId);
+
+    std::map<ProcessKey, Id> processIds_;
+    std::unordered_map<std::string, Id> deviceIds_;
+    std::unordered_map<Id, Process> processes_;
+    std::unordered_map<Id, Device> devices_;
+    std::unordered_map<std::string, std::vector<Id>> pkgNameIndex_;
+    Id nextId_ = 0;
+    size_t size_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_NOTIFY_STATE_TABLE_H
@@ -16,6 +16,8 @@
 #ifndef OHOS_PIN_HOLDER_H
 #define OHOS_PIN_HOLDER_H
 
+#include <map>
+
 #include "dm_timer.h"
 #include "idevice_manager_service_listener.h"
 #include "pin_holder_session.h"
@@ -37,9 +39,23 @@ typedef enum DestroyState {
     STATE_TIME_OUT = 0x2,
 } DestroyState;
 
+// A pin holder message, parsed once on receive and handed to the handler of its type.
+struct PinHolderMsg {
+    int32_t msgType = -1;
+    DmPinType pinType = NUMBER_PIN_CODE;
+    std::string payload = "";
+    int32_t reply = -1;
+    bool hasPinType = false;
+    bool hasPayload = false;
+    bool hasReply = false;
+    bool hasVersion = false;
+};
+
 class PinHolder final : public IPinholderSessionCallback,
                         public std::enable_shared_from_this<PinHolder> {
 public:
+    using ProcessMsgFuncPtr = void (PinHolder::*)(const PinHolderMsg &msg);
+
     PinHolder(std::shared_ptr<IDeviceManagerServiceListener> listener);
     ~PinHolder();
     int32_t RegisterPinHolderCallback(const std::string &pkgName);
@@ -56,21 +72,27 @@ public:
 
 private:
     int32_t CreateGeneratePinHolderMsg();
-    int32_t ParseMsgType(const std::string &message);
-    void ProcessCloseSessionMsg(const std::string &message);
-    void ProcessCreateMsg(const std::string &message);
-    void ProcessCreateRespMsg(const std::string &message);
-    void ProcessDestroyMsg(const std::string &message);
-    void ProcessDestroyResMsg(const std::string &message);
-    void ProcessChangeMsg(const std::string &message);
-    void ProcessChangeRespMsg(const std::string &message);
+    static int32_t ParsePinHolderMsg(const std::string &message, PinHolderMsg &msg);
+    void ProcessCloseSessionMsg(const PinHolderMsg &msg);
+    void ProcessCreateMsg(const PinHolderMsg &msg);
+    void ProcessCreateRespMsg(const PinHolderMsg &msg);
+    void ProcessDestroyMsg(const PinHolderMsg &msg);
+    void ProcessDestroyResMsg(const PinHolderMsg &msg);
+    void ProcessChangeMsg(const PinHolderMsg &msg);
+    void ProcessChangeRespMsg(const PinHolderMsg &msg);
     void CloseSession(const std::string &name);
+    // Keeps the session of a finished exchange open for the next one with the same peer.
+    void KeepSessionIdle(int32_t timeout);
+    void ResumeIdleSession();
+    void CloseIdleSession();
+    static std::string GetPeerKey(const PeerTargetId &targetId);
     void GetPeerDeviceId(int32_t sessionId, std::string &udidHash);
     int32_t CheckTargetIdVaild(const PeerTargetId &targetId);
 private:
     std::shared_ptr<IDeviceManagerServiceListener> listener_ = nullptr;
     std::shared_ptr<PinHolderSession> session_ = nullptr;
     std::shared_ptr<DmTimer> timer_ = nullptr;
+    std::map<int32_t, ProcessMsgFuncPtr> processMsgFuncMap_;
 
     std::string remoteDeviceId_ = "";
     std::string payload_ = "";
@@ -78,6 +100,8 @@ private:
     PinHolderState sinkState_;
     PinHolderState sourceState_;
     int32_t sessionId_ = -1;
+    std::string sessionPeerKey_ = "";
+    bool isSessionIdle_ = false;
     bool isRemoteSupported_ = false;
     std::atomic<bool> isDestroy_ {false};
     DestroyState destroyState_ = STATE_UNKNOW;
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_BROADCAST_DEDUP_H
+#define OHOS_DM_BROADCAST_DEDUP_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Fixed size identity of a received relationship broadcast. The variable length fields
+ * (account id, peer udid, user id list, cred id) are folded into digest, the rest is kept as is.
+ */
+struct BroadCastFingerprint {
+    uint64_t digest = 0;
+    uint64_t tokenId = 0;
+    uint64_t peerTokenId = 0;
+    uint32_t userId = 0;
+    uint8_t type = 0;
+    uint8_t flags = 0;
+    uint8_t broadCastId = 0;
+
+    bool operator==(const BroadCastFingerprint &other) const
+    {
+        return digest == other.digest && tokenId == other.tokenId && peerTokenId == other.peerTokenId &&
+            userId == other.userId && type == other.type && flags == other.flags &&
+            broadCastId == other.broadCastId;
+    }
+};
+
+// Incremental FNV-1a, each field is length prefixed so adjacent fields can not shift into each other.
+class BroadCastDigest {
+public:
+    void Update(const void *data, size_t len);
+    void Update(const std::string &value);
+    void Update(uint64_t value);
+    uint64_t Final() const
+    {
+        return hash_;
+    }
+
+private:
+    uint64_t hash_ = 0xcbf29ce484222325ULL;
+};
+
+/*
+ * Remembers fingerprints for windowSec seconds. Fingerprints are stored in one second buckets
+ * and a whole bucket is dropped when the clock moves past it, no per entry timer is needed.
+ * Not thread safe, the owner serializes the calls.
+ */
+class BroadCastDedupSet {
+public:
+    BroadCastDedupSet(int64_t windowSec, size_t maxSize);
+
+    // Returns true and records the fingerprint if it was not seen within the window.
+    bool CheckAndInsert(const BroadCastFingerprint &fingerprint, int64_t nowSec);
+    size_t Size() const;
+    void Clear();
+
+private:
+    struct FingerprintHash {
+        size_t operator()(const BroadCastFingerprint &fingerprint) const
+        {
+            return static_cast<size_t>(fingerprint.digest ^ (fingerprint.tokenId * 0x9e3779b97f4a7c15ULL) ^
+                fingerprint.peerTokenId ^ fingerprint.broadCastId);
+        }
+    };
+
+    void Rotate(int64_t nowSec);
+
+    std::vector<std::unordered_set<BroadCastFingerprint, FingerprintHash>> buckets_;
+    size_t maxSize_ = 0;
+    size_t currentIndex_ = 0;
+    int64_t currentSec_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_BROADCAST_DEDUP_H
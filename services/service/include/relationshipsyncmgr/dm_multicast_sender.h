@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_MULTICAST_SENDER_H
+#define OHOS_DM_MULTICAST_SENDER_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedHardware {
+using DmPeerSendFunc = std::function<int32_t (const std::string &networkId)>;
+// index is the position of the peer in the networkIds handed to Send().
+using DmPeerLateResultFunc = std::function<void (size_t index, int32_t result)>;
+
+struct DmPeerSendResult {
+    std::string networkId;
+    // ERR_DM_TIME_OUT if the send was not finished before the deadline.
+    int32_t result;
+    int64_t costMs;
+    // The send was still running at the deadline and may yet succeed, see lateResultFunc.
+    bool isInFlight = false;
+};
+
+/*
+ * Sends one message to many peers. At most maxConcurrency sends run at the same time on ffrt
+ * workers, all of them share one deadline. Send() returns when every peer finished or the
+ * deadline expired, with one result per peer in the input order. A peer not started before the
+ * deadline is never sent to. A send still blocked in the transport at the deadline is reported
+ * with isInFlight set and keeps running in the background; its real result is handed to
+ * lateResultFunc on the worker once it completes, or dropped when lateResultFunc is null.
+ */
+class DmMulticastSender {
+public:
+    static constexpr uint32_t DEFAULT_MAX_CONCURRENCY = 4;
+
+    static std::vector<DmPeerSendResult> Send(const std::vector<std::string> &networkIds,
+        DmPeerSendFunc sendFunc, int64_t timeoutMs, uint32_t maxConcurrency = DEFAULT_MAX_CONCURRENCY,
+        DmPeerLateResultFunc lateResultFunc = nullptr);
+    static size_t CountSuccess(const std::vector<DmPeerSendResult> &results);
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_MULTICAST_SENDER_H
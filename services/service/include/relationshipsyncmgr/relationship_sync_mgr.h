@@ -19,8 +19,10 @@
 #include <string>
 #include <map>
 #include <mutex>
+#include <vector>
 #include "cJSON.h"
 #include "json_object.h"
+#include "dm_broadcast_dedup.h"
 #include "dm_single_instance.h"
 #include "dm_timer.h"
 #include "dm_msg_comm.h"
@@ -38,7 +40,8 @@ enum class RelationShipChangeType : uint32_t {
     SHARE_UNBIND = 8,
     SERVICEINFO_UNREGISTER = 9,
     ACCOUNT_EVENT = 10,
-    TYPE_MAX = 11
+    SYNC_USERID_DELTA = 11,
+    TYPE_MAX = 12
 };
 
 struct UserIdInfo {
@@ -74,6 +77,14 @@ struct RelationShipChangeMsg {
     bool isLastBatch;
     uint8_t broadCastId;
     int64_t serviceId;
+    // Versioned user id sync: the full list carries its sequence number, a delta also the one it applies to.
+    bool isUserIdVersioned = false;
+    // Asks the peer to send its next user id list in full.
+    bool needUserIdResync = false;
+    uint8_t userIdSeq = 0;
+    uint8_t baseUserIdSeq = 0;
+    // The user ids a delta removes, userIdInfos then holds the added or changed ones.
+    std::vector<uint16_t> removedUserIds;
 
     explicit RelationShipChangeMsg();
     bool ToBroadcastPayLoad(uint8_t *&msg, uint32_t &len) const;
@@ -88,6 +99,7 @@ struct RelationShipChangeMsg {
     void ToAppUninstallPayLoad(uint8_t *&msg, uint32_t &len) const;
     void ToServiceUnbindPayLoad(uint8_t *&msg, uint32_t &len) const;
     bool ToSyncFrontOrBackUserIdPayLoad(uint8_t *&msg, uint32_t &len) const;
+    bool ToSyncUserIdDeltaPayLoad(uint8_t *&msg, uint32_t &len) const;
     void ToDelUserPayLoad(uint8_t *&msg, uint32_t &len) const;
     void ToStopUserPayLoad(uint8_t *&msg, uint32_t &len) const;
     void ToShareUnbindPayLoad(uint8_t *&msg, uint32_t &len) const;
@@ -100,6 +112,7 @@ struct RelationShipChangeMsg {
     bool FromAppUnbindPayLoad(const cJSON *payloadJson);
     bool FromServiceUnbindPayLoad(const cJSON *payloadJson);
     bool FromSyncFrontOrBackUserIdPayLoad(const cJSON *payloadJson);
+    bool FromSyncUserIdDeltaPayLoad(const cJSON *payloadJson);
     bool FromDelUserPayLoad(const cJSON *payloadJson);
     bool FromStopUserPayLoad(const cJSON *payloadJson);
     bool FromShareUnbindPayLoad(const cJSON *payloadJson);
@@ -113,6 +126,7 @@ struct RelationShipChangeMsg {
 
     const std::string ToString() const;
     const std::string ToMapKey() const;
+    BroadCastFingerprint ToFingerprint() const;
 private:
     bool HandleBroadcastPayLoadByType(uint8_t *&msg, uint32_t &len) const;
     bool HandleBroadcastPayLoadBase(uint8_t *&msg, uint32_t &len) const;
@@ -126,19 +140,41 @@ DM_DECLARE_SINGLE_INSTANCE(ReleationShipSyncMgr);
 public:
     std::string SyncTrustRelationShip(RelationShipChangeMsg &msg);
     std::string SyncTrustRelationShip(RelationShipChangeMsg &msg, uint8_t &broadCastId);
+    /**
+     * @brief Encodes a SYNC_USERID message, as a delta to the peers holding the previous list and in full
+     *        to the others. Returns one broadcast message per group.
+     */
+    std::vector<std::string> SyncUserIdsRelationShip(RelationShipChangeMsg &msg);
     RelationShipChangeMsg ParseTrustRelationShipChange(const std::string &msgJson);
     bool IsNewBroadCastId(const RelationShipChangeMsg &msg);
 private:
-    void HandleRecvBroadCastTimeout(const std::string &key);
+    struct PeerUserIdState {
+        uint8_t seq = 0;
+        std::vector<UserIdInfo> userIdInfos;
+    };
+
     bool GetCurrentTimeSec(int32_t &sec);
-    std::map<std::string, int32_t> recvBroadCastIdMap_;
-    std::shared_ptr<DmTimer> timer_;
+    bool BuildUserIdDelta(RelationShipChangeMsg &msg, RelationShipChangeMsg &deltaMsg);
+    void UpdatePeerUserIds(RelationShipChangeMsg &msg);
+    std::shared_ptr<BroadCastDedupSet> recvBroadCastIds_;
     ffrt::mutex lock_;
+    ffrt::mutex userIdLock_;
+    // Counts local user id changes, the low byte is the sequence number sent.
+    uint64_t localUserIdGen_ = 0;
+    std::vector<UserIdInfo> localUserIdInfos_;
+    // The user id generation last sent to each peer.
+    std::map<std::string, uint64_t> sentUserIdGens_;
+    // The user id list last received from each peer sending versioned messages.
+    std::map<std::string, PeerUserIdState> recvUserIdStates_;
 };
 
 const std::string GetUserIdInfoList(const std::vector<UserIdInfo> &list);
 void GetFrontAndBackUserIdInfos(const std::vector<UserIdInfo> &remoteUserIdInfos,
     std::vector<UserIdInfo> &foregroundUserIdInfos, std::vector<UserIdInfo> &backgroundUserIdInfos);
+void GetUserIdInfosDelta(const std::vector<UserIdInfo> &baseUserIdInfos, const std::vector<UserIdInfo> &userIdInfos,
+    std::vector<UserIdInfo> &changedUserIdInfos, std::vector<uint16_t> &removedUserIds);
+void ApplyUserIdInfosDelta(std::vector<UserIdInfo> &userIdInfos, const std::vector<UserIdInfo> &changedUserIdInfos,
+    const std::vector<uint16_t> &removedUserIds);
 } // DistributedHardware
 } // OHOS
 #endif // OHOS_RELATIONSHIP_SYNC_MGR_H
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_DISCOVERED_DEVICE_CACHE_H
+#define OHOS_DM_DISCOVERED_DEVICE_CACHE_H
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "softbus_bus_center.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * String keyed map that keeps its entries in recency order, the least recently used entry
+ * is dropped when a new key does not fit. Lookups and updates are O(1).
+ * Not thread safe, the owner serializes the calls.
+ */
+template <typename Value>
+class DmLruMap {
+public:
+    explicit DmLruMap(size_t capacity) : capacity_(capacity == 0 ? 1 : capacity) {}
+
+    // Returns the slot of key and marks it most recent, a new slot is value initialized.
+    Value &Put(const std::string &key, bool &inserted, bool &evicted)
+    {
+        inserted = false;
+        evicted = false;
+        auto iter = index_.find(key);
+        if (iter != index_.end()) {
+            entries_.splice(entries_.begin(), entries_, iter->second);
+            return iter->second->second;
+        }
+        if (index_.size() >= capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+            evicted = true;
+        }
+        entries_.emplace_front(key, Value {});
+        index_.emplace(key, entries_.begin());
+        inserted = true;
+        return entries_.front().second;
+    }
+
+    Value &Put(const std::string &key)
+    {
+        bool inserted = false;
+        bool evicted = false;
+        return Put(key, inserted, evicted);
+    }
+
+    // Returns nullptr when key is absent, otherwise marks it most recent.
+    Value *Find(const std::string &key)
+    {
+        auto iter = index_.find(key);
+        if (iter == index_.end()) {
+            return nullptr;
+        }
+        entries_.splice(entries_.begin(), entries_, iter->second);
+        return &iter->second->second;
+    }
+
+    bool Contains(const std::string &key) const
+    {
+        return index_.find(key) != index_.end();
+    }
+
+    bool Erase(const std::string &key)
+    {
+        auto iter = index_.find(key);
+        if (iter == index_.end()) {
+            return false;
+        }
+        entries_.erase(iter->second);
+        index_.erase(iter);
+        return true;
+    }
+
+    void Clear()
+    {
+        index_.clear();
+        entries_.clear();
+    }
+
+    size_t Size() const
+    {
+        return index_.size();
+    }
+
+    size_t Capacity() const
+    {
+        return capacity_;
+    }
+
+    // Key of the entry that would be evicted next, empty when the map is empty.
+    std::string Oldest() const
+    {
+        return entries_.empty() ? "" : entries_.back().first;
+    }
+
+private:
+    using Entry = std::pair<std::string, Value>;
+    size_t capacity_;
+    std::list<Entry> entries_;
+    std::unordered_map<std::string, typename std::list<Entry>::iterator> index_;
+};
+
+struct DiscoveredDeviceCacheStats {
+    uint64_t hit = 0;
+    uint64_t miss = 0;
+    uint64_t insert = 0;
+    uint64_t update = 0;
+    uint64_t evict = 0;
+    uint64_t expire = 0;
+};
+
+/*
+ * Connection addresses of recently discovered devices. Every device owns one slot per
+ * address type which is overwritten in place by later found events of the same type, the
+ * most recently written slot is the preferred target. Entries older than ttlMs are treated
+ * as absent. Not thread safe, the owner serializes the calls.
+ */
+class DiscoveredDeviceCache {
+public:
+    DiscoveredDeviceCache(size_t capacity, int64_t ttlMs);
+
+    // Records addr[0] of the device, the only address softbus fills for a found event.
+    bool Put(const std::string &deviceId, const DeviceInfo &device, int64_t nowMs);
+    // Most recently written address of the device.
+    bool GetLatestAddr(const std::string &deviceId, int64_t nowMs, ConnectionAddr &addr);
+    // Type of the ip based (eth, wlan, ncm) address of the device whose ip equals ip.
+    bool GetIpAddrType(const std::string &deviceId, const std::string &ip, int64_t nowMs,
+        ConnectionAddrType &addrType);
+    bool Erase(const std::string &deviceId);
+    void Clear();
+    size_t Size() const;
+    DiscoveredDeviceCacheStats GetStats() const;
+    void ResetStats();
+
+private:
+    static constexpr size_t ADDR_SLOT_NUM = static_cast<size_t>(CONNECTION_ADDR_MAX);
+
+    struct Entry {
+        std::array<ConnectionAddr, ADDR_SLOT_NUM> slots {};
+        uint32_t validMask = 0;
+        ConnectionAddrType latestType = CONNECTION_ADDR_MAX;
+        int64_t updateTimeMs = 0;
+    };
+
+    Entry *FindLive(const std::string &deviceId, int64_t nowMs);
+
+    int64_t ttlMs_;
+    DmLruMap<Entry> entries_;
+    DiscoveredDeviceCacheStats stats_;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_DISCOVERED_DEVICE_CACHE_H
@@ -26,6 +26,7 @@ namespace DistributedHardware {
 
 #define DM_DEVICE_NUMBER_LEN 11
 #define DM_HASH_DATA_LEN 16
+#define DM_MAX_MATCH_QUEUE_SIZE 64
 
 typedef struct {
     string type;
@@ -67,6 +68,17 @@ typedef struct {
     char number[DM_DEVICE_NUMBER_LEN];
 } DevicePolicyInfo;
 
+struct MatchQueueStats {
+    uint64_t enqueued = 0;
+    uint64_t deduplicated = 0;
+    uint64_t dropped = 0;
+    uint64_t processed = 0;
+    size_t depth = 0;
+    size_t peakDepth = 0;
+    uint64_t totalWaitUs = 0;
+    uint64_t maxWaitUs = 0;
+};
+
 typedef enum {
     BUSINESS_EXACT_MATCH = 0x01,
     BUSINESS_PARTIAL_MATCH,
@@ -86,6 +98,7 @@ public:
     static void OnPublishResult(int publishId, PublishResult reason);
     static void OnPublishDeviceFound(const DeviceInfo *deviceInfo);
     static void OnRePublish(void);
+    static MatchQueueStats GetMatchQueueStats();
     static IDmRadarHelper* GetDmRadarHelperObj();
     static bool IsDmRadarHelperReady();
     static bool CloseDmRadarHelperObj(std::string name);
@@ -113,6 +126,8 @@ private:
     static Action MatchSearchScopeDevice(DeviceInfo &deviceInfo, char *output,
         const DevicePolicyInfo &devicePolicyInfo, const BroadcastHead &broadcastHead);
     static void GetVertexDevicePolicyInfo(DevicePolicyInfo &devicePolicyInfo);
+    static void RefreshLocalIdentityLocked();
+    static void ClearLocalIdentityCache();
     static Action MatchSearchVertexDevice(DeviceInfo &deviceInfo, char *output,
         const DevicePolicyInfo &devicePolicyInfo, const BroadcastHead &broadcastHead);
     static int32_t SendReturnwave(DeviceInfo &deviceInfo, const BroadcastHead &broadcastHead, Action matchResult);
@@ -124,9 +139,6 @@ private:
     static bool CheckDeviceAliasMatch(const DevicePolicyInfo &devicePolicyInfo, const char *data);
     static bool CheckDeviceNumberMatch(const DevicePolicyInfo &devicePolicyInfo,
         int32_t startNumber, int32_t endNumber);
-    static bool CheckDeviceSnMatch(const DevicePolicyInfo &devicePolicyInfo, const char *data);
-    static bool CheckDeviceTypeMatch(const DevicePolicyInfo &devicePolicyInfo, const char *data);
-    static bool CheckDeviceUdidMatch(const DevicePolicyInfo &devicePolicyInfo, const char *data);
     static Action GetMatchResult(const vector<int> &matchItemNum, const vector<int> &matchItemResult);
     int32_t DmBase64Encode(char *output, size_t outputLen, const char *input, size_t inputLen, size_t &base64OutLen);
     int32_t DmBase64Decode(char *output, size_t outputLen, const char *input, size_t inputLen, size_t &base64OutLen);
@@ -33,6 +33,7 @@
 #include "dm_radar_helper.h"
 #include "i_softbus_discovering_callback.h"
 #include "dm_anonymous.h"
+#include "discovered_device_cache.h"
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
 #include "access_control_profile.h"
 #endif
@@ -80,6 +81,7 @@ public:
 
     static void CacheDiscoveredDevice(const DeviceInfo *device);
     static void ClearDiscoveredDevice();
+    static DiscoveredDeviceCacheStats GetDiscoveredDeviceCacheStats();
     static void ConvertDeviceInfoToDmDevice(const DeviceInfo &device, DmDeviceInfo &dmDevice);
     static int32_t GetUdidByNetworkId(const char *networkId, std::string &udid);
     static int32_t GetTargetInfoFromCache(const std::string &deviceId, PeerTargetId &targetId,
@@ -124,8 +126,9 @@ public:
     int32_t PublishSoftbusLNN(const DmPublishInfo &dmPubInfo, const std::string &capability,
         const std::string &customData);
     int32_t StopPublishSoftbusLNN(int32_t publishId);
+    // asyncDispatch moves the callbacks of this subscriber off the softbus thread, in order.
     int32_t RegisterSoftbusLnnOpsCbk(const std::string &pkgName,
-        const std::shared_ptr<ISoftbusDiscoveringCallback> callback);
+        const std::shared_ptr<ISoftbusDiscoveringCallback> callback, bool asyncDispatch = false);
     int32_t UnRegisterSoftbusLnnOpsCbk(const std::string &pkgName);
     static IDmRadarHelper* GetDmRadarHelperObj();
     static bool IsDmRadarHelperReady();
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_INIT_STAGE_GRAPH_H
+#define OHOS_DM_INIT_STAGE_GRAPH_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ffrt.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+using DmInitStageTask = std::function<void()>;
+
+/*
+ * Service startup expressed as a dependency graph. A stage is submitted to ffrt as soon as
+ * all of its dependencies finished, so independent stages run concurrently. Run() blocks until
+ * every stage completed and reports the begin offset and cost of each stage.
+ */
+class DmInitStageGraph {
+public:
+    DmInitStageGraph() = default;
+    ~DmInitStageGraph() = default;
+
+    int32_t AddStage(const std::string &name, const std::vector<std::string> &depends, DmInitStageTask task);
+    int32_t Run();
+    int64_t GetStageCostMs(const std::string &name) const;
+
+private:
+    struct Stage {
+        std::string name;
+        std::vector<std::string> depends;
+        std::vector<size_t> dependents;
+        DmInitStageTask task;
+        size_t pendingDepends = 0;
+        int64_t beginMs = 0;
+        int64_t costMs = 0;
+    };
+
+    bool BuildDependents();
+    void Submit(size_t index);
+    void OnStageDone(size_t index);
+
+    std::vector<Stage> stages_;
+    std::unordered_map<std::string, size_t> stageIndex_;
+    ffrt::mutex stageMutex_;
+    ffrt::condition_variable stageCv_;
+    size_t finishedCount_ = 0;
+    int64_t runBeginMs_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_INIT_STAGE_GRAPH_H
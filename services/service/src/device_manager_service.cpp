@@ -26,6 +26,7 @@
 #include "dm_crypto.h"
 #include "dm_device_info.h"
 #include "dm_hidumper.h"
+#include "dm_perf_stats.h"
 #include "dm_softbus_cache.h"
 #include "json_object.h"
 #include "parameter.h"
@@ -39,6 +40,7 @@
 #include "distributed_device_profile_client.h"
 #include "dm_comm_tool.h"
 #include "dm_library_manager.h"
+#include "dm_multicast_sender.h"
 #include "dm_random.h"
 #include "dm_transport_msg.h"
 #include "dm_jsonstr_handle.h"
@@ -102,6 +104,9 @@ namespace {
     constexpr const char* ACCOUNT_COMMON_EVENT_BY_WIFI_TIMEOUT_TASK = "deviceManagerTimer:accountCommonEventByWifi";
     constexpr const char* SERVICE_UNBIND_PROXY_BY_WIFI_TIMEOUT_TASK = "deviceManagerTimer:serviceUnbindProxyByWifi";
     const int32_t USER_SWITCH_BY_WIFI_TIMEOUT_S = 2;
+    // Fan-out to WiFi peers, all peers share one deadline that covers the socket retries.
+    constexpr int64_t NOTIFY_BY_WIFI_DEADLINE_MS = 5000;
+    constexpr uint32_t NOTIFY_BY_WIFI_MAX_CONCURRENCY = 4;
     const int32_t SEND_DELAY_MAX_TIME = 5;
     const int32_t SEND_DELAY_MIN_TIME = 0;
     const int32_t DELAY_TIME_SEC_CONVERSION = 1000000;      // 1000*1000
@@ -144,6 +149,7 @@ namespace {
     constexpr const char* HANDLE_ACCOUNT_LOGOUT_EVENT_TASK = "HandleAccountLogoutEventTask";
     constexpr const char* HANDLE_COMMON_EVENT_BROAD_CAST_TASK = "HandleCommonEventBroadCastTask";
     constexpr const char* HANDLE_USER_IDS_BROAD_CAST_TASK = "HandleUserIdsBroadCastTask";
+    constexpr const char* HANDLE_USER_IDS_DELTA_GAP_TASK = "HandleUserIdsDeltaGapTask";
     constexpr const char* HANDLE_REMOTE_USER_REMOVED_TASK = "HandleRemoteUserRemovedTask";
     constexpr const char* ON_SET_LOCAL_DEVICE_NAME_RESULT_TASK = "OnSetLocalDeviceNameResultTask";
     constexpr const char* HANDLE_SERVICE_UN_REG_EVENT_TASK = "HandleServiceUnRegEventTask";
@@ -191,16 +197,47 @@ int32_t DeviceManagerService::HandleProcessRestart()
 }
 
 int32_t DeviceManagerService::InitSoftbusListener()
+{
+    CreateSoftbusListener();
+    SoftbusCache::GetInstance().UpdateDeviceInfoCache();
+    SaveOnlineDeviceInfo();
+    SubscribeSoftbusCommonEvent();
+    LOGI("SoftbusListener init success.");
+    return InitSoftbusServerResident();
+}
+
+void DeviceManagerService::CreateServiceListener()
+{
+    if (listener_ == nullptr) {
+        listener_ = std::make_shared<DeviceManagerServiceListener>();
+    }
+}
+
+void DeviceManagerService::CreateSoftbusListener()
 {
     if (softbusListener_ == nullptr) {
         softbusListener_ = std::make_shared<SoftbusListener>();
     }
-    SoftbusCache::GetInstance().UpdateDeviceInfoCache();
+}
+
+void DeviceManagerService::PreloadDMServiceImpl()
+{
+    if (!IsDMServiceImplReady()) {
+        LOGE("preload dm service impl failed.");
+    }
+}
+
+void DeviceManagerService::SaveOnlineDeviceInfo()
+{
     std::vector<DmDeviceInfo> onlineDeviceList;
     SoftbusCache::GetInstance().GetDeviceInfoFromCache(onlineDeviceList);
     if (onlineDeviceList.size() > 0 && IsDMServiceImplReady()) {
         dmServiceImpl_->SaveOnlineDeviceInfo(onlineDeviceList);
     }
+}
+
+void DeviceManagerService::SubscribeSoftbusCommonEvent()
+{
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
 #if defined(SUPPORT_BLUETOOTH) || defined(SUPPORT_WIFI)
     SubscribePublishCommonEvent();
@@ -208,7 +245,10 @@ int32_t DeviceManagerService::InitSoftbusListener()
 #endif // SUPPORT_BLUETOOTH SUPPORT_WIFI
     SubscribeDataShareCommonEvent();
 #endif
-    LOGI("SoftbusListener init success.");
+}
+
+int32_t DeviceManagerService::InitSoftbusServerResident()
+{
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
     if (IsDMServiceAdapterResidentLoad()) {
         int32_t ret = dmServiceImplExtResident_->InitSoftbusServer();
@@ -523,6 +563,7 @@ int32_t DeviceManagerService::GetTrustedDeviceList(const std::string &pkgName, c
                                                    std::vector<DmDeviceInfo> &deviceList)
 {
     CHECK_EMPTY_RETURN(pkgName, ERR_DM_INPUT_PARA_INVALID);
+    DM_PERF_SCOPE(DmPerfOp::GET_TRUSTED_DEVICE_LIST);
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
     if (DmConstrainsManager::GetInstance().CheckOsAccountConstraintEnabled(
         MultipleUserConnector::GetForgroundUserId(), DM_ACCOUNT_CONSTRAINT)) {
@@ -3193,25 +3234,61 @@ void DeviceManagerService::NotifyRemoteAccountCommonEventByWifi(const std::strin
     const std::map<std::string, std::string> &wifiDevices, const std::vector<int32_t> &foregroundUserIds,
     const std::vector<int32_t> &backgroundUserIds)
 {
-    for (const auto &it : wifiDevices) {
-        int32_t result = SendAccountCommonEventByWifi(it.second, foregroundUserIds, backgroundUserIds);
-        if (result != DM_OK) {
-            LOGE("by wifi failed: %{public}s", GetAnonyString(it.first).c_str());
-            std::vector<std::string> updateUdids;
-            updateUdids.push_back(it.first);
-            UpdateAcl(localUdid, updateUdids, foregroundUserIds, backgroundUserIds);
+    std::vector<std::string> udids;
+    std::vector<std::string> networkIds;
+    SplitWifiDevices(wifiDevices, udids, networkIds);
+    std::vector<DmPeerSendResult> results = DmMulticastSender::Send(networkIds,
+        [this, foregroundUserIds, backgroundUserIds] (const std::string &networkId) {
+            return SendAccountCommonEventByWifi(networkId, foregroundUserIds, backgroundUserIds);
+        }, NOTIFY_BY_WIFI_DEADLINE_MS, NOTIFY_BY_WIFI_MAX_CONCURRENCY,
+        [this, localUdid, foregroundUserIds, backgroundUserIds, udids] (size_t index, int32_t result) {
+            // Still sending at the deadline, handled the same way once the send completes.
+            if (!StartCommonEventByWifiTimer(localUdid, foregroundUserIds, backgroundUserIds, udids[index], result)) {
+                UpdateAcl(localUdid, { udids[index] }, foregroundUserIds, backgroundUserIds);
+            }
+        });
+    std::vector<std::string> failedUdids;
+    for (size_t i = 0; i < results.size(); i++) {
+        if (results[i].isInFlight) {
+            LOGI("by wifi still sending: %{public}s", GetAnonyString(udids[i]).c_str());
             continue;
         }
-        std::lock_guard<std::mutex> autoLock(timerLocks_);
-        if (timer_ == nullptr) {
-            timer_ = std::make_shared<DmTimer>();
+        if (!StartCommonEventByWifiTimer(localUdid, foregroundUserIds, backgroundUserIds, udids[i],
+            results[i].result)) {
+            failedUdids.push_back(udids[i]);
         }
-        std::string udid = it.first;
-        timer_->StartTimer(std::string(ACCOUNT_COMMON_EVENT_BY_WIFI_TIMEOUT_TASK) + Crypto::Sha256(udid),
-            USER_SWITCH_BY_WIFI_TIMEOUT_S,
-            [this, localUdid, foregroundUserIds, backgroundUserIds, udid] (std::string name) {
-                DeviceManagerService::HandleCommonEventTimeout(localUdid, foregroundUserIds, backgroundUserIds, udid);
-            });
+    }
+    if (!failedUdids.empty()) {
+        UpdateAcl(localUdid, failedUdids, foregroundUserIds, backgroundUserIds);
+    }
+}
+
+bool DeviceManagerService::StartCommonEventByWifiTimer(const std::string &localUdid,
+    const std::vector<int32_t> &foregroundUserIds, const std::vector<int32_t> &backgroundUserIds,
+    const std::string &udid, int32_t sendResult)
+{
+    if (sendResult != DM_OK) {
+        LOGE("by wifi failed: %{public}s, ret: %{public}d", GetAnonyString(udid).c_str(), sendResult);
+        return false;
+    }
+    std::lock_guard<std::mutex> autoLock(timerLocks_);
+    if (timer_ == nullptr) {
+        timer_ = std::make_shared<DmTimer>();
+    }
+    timer_->StartTimer(std::string(ACCOUNT_COMMON_EVENT_BY_WIFI_TIMEOUT_TASK) + Crypto::Sha256(udid),
+        USER_SWITCH_BY_WIFI_TIMEOUT_S,
+        [this, localUdid, foregroundUserIds, backgroundUserIds, udid] (std::string name) {
+            DeviceManagerService::HandleCommonEventTimeout(localUdid, foregroundUserIds, backgroundUserIds, udid);
+        });
+    return true;
+}
+
+void DeviceManagerService::SplitWifiDevices(const std::map<std::string, std::string> &wifiDevices,
+    std::vector<std::string> &udids, std::vector<std::string> &networkIds)
+{
+    for (const auto &it : wifiDevices) {
+        udids.push_back(it.first);
+        networkIds.push_back(it.second);
     }
 }
 
@@ -3467,9 +3544,45 @@ void DeviceManagerService::SendUserIdsBroadCast(const std::vector<std::string> &
     for (auto const &userId : backgroundUserIds) {
         msg.userIdInfos.push_back({ false, static_cast<uint16_t>(userId) });
     }
-    std::string broadCastMsg = ReleationShipSyncMgr::GetInstance().SyncTrustRelationShip(msg);
+    SendUserIdsRelationShip(msg);
+}
+
+void DeviceManagerService::SendUserIdsRelationShip(RelationShipChangeMsg &msg)
+{
+    std::vector<std::string> broadCastMsgs = ReleationShipSyncMgr::GetInstance().SyncUserIdsRelationShip(msg);
     CHECK_NULL_VOID(softbusListener_);
-    softbusListener_->SendAclChangedBroadcast(broadCastMsg);
+    for (const auto &broadCastMsg : broadCastMsgs) {
+        softbusListener_->SendAclChangedBroadcast(broadCastMsg);
+    }
+}
+
+void DeviceManagerService::HandleUserIdsDeltaGap(const std::string &remoteUdid)
+{
+    LOGI("rmtUdid: %{public}s", GetAnonyString(remoteUdid).c_str());
+    std::vector<int32_t> foregroundUserVec;
+    std::vector<int32_t> backgroundUserVec;
+    int32_t retFront = MultipleUserConnector::GetForegroundUserIds(foregroundUserVec);
+    int32_t retBack = MultipleUserConnector::GetBackgroundUserIds(backgroundUserVec);
+    if (IsPC()) {
+        MultipleUserConnector::ClearLockedUser(foregroundUserVec, backgroundUserVec);
+    }
+    if (retFront != DM_OK || retBack != DM_OK) {
+        LOGE("Get userid failed, retFront: %{public}d, retBack: %{public}d", retFront, retBack);
+        return;
+    }
+    // Ours go out in full and ask for the full list back, which also brings the peer's response.
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::SYNC_USERID;
+    msg.peerUdids = { remoteUdid };
+    msg.syncUserIdFlag = true;
+    msg.needUserIdResync = true;
+    for (const auto &userId : foregroundUserVec) {
+        msg.userIdInfos.push_back({ true, static_cast<uint16_t>(userId) });
+    }
+    for (auto const &userId : backgroundUserVec) {
+        msg.userIdInfos.push_back({ false, static_cast<uint16_t>(userId) });
+    }
+    SendUserIdsRelationShip(msg);
 }
 
 void DeviceManagerService::HandleUserIdsBroadCast(const std::vector<UserIdInfo> &remoteUserIdInfos,
@@ -3688,9 +3801,7 @@ void DeviceManagerService::SendCommonEventBroadCast(const std::vector<std::strin
     for (auto const &userId : backgroundUserIds) {
         msg.userIdInfos.push_back({ false, static_cast<uint16_t>(userId) });
     }
-    std::string broadCastMsg = ReleationShipSyncMgr::GetInstance().SyncTrustRelationShip(msg);
-    CHECK_NULL_VOID(softbusListener_);
-    softbusListener_->SendAclChangedBroadcast(broadCastMsg);
+    SendUserIdsRelationShip(msg);
 }
 
 void DeviceManagerService::SendForegroundAccountBroadcast(const std::vector<std::string> &peerUdids,
@@ -4454,6 +4565,11 @@ bool DeviceManagerService::ParseRelationShipChangeTypeTwo(const RelationShipChan
         case RelationShipChangeType::ACCOUNT_EVENT:
             HandleAccountEventBroadCast(relationShipMsg);
             break;
+        case RelationShipChangeType::SYNC_USERID_DELTA:
+            // Resolved deltas arrive as SYNC_USERID, this one missed the list it applies to.
+            ffrt::submit([=]() { HandleUserIdsDeltaGap(relationShipMsg.peerUdid); },
+                ffrt::task_attr().name(HANDLE_USER_IDS_DELTA_GAP_TASK));
+            break;
         default:
             LOGI("Dm have not this event type.");
             return false;
@@ -4653,6 +4769,12 @@ void DeviceManagerService::HandleDeviceScreenStatusChange(DmDeviceInfo &deviceIn
     }
 }
 
+void DeviceManagerService::HandleLocalDeviceNameChange()
+{
+    CHECK_NULL_VOID(listener_);
+    listener_->OnLocalDeviceNameChange();
+}
+
 int32_t DeviceManagerService::GetDeviceScreenStatus(const std::string &pkgName, const std::string &networkId,
     int32_t &screenStatus)
 {
@@ -4816,6 +4938,7 @@ int32_t DeviceManagerService::RegDevStateCallbackToService(const std::string &pk
 #ifdef CAR_DEVICE_ENABLE
 int32_t DeviceManagerService::GetTrustedDeviceList(ProcessInfo processInfo, std::vector<DmDeviceInfo> &deviceList)
 {
+    DM_PERF_SCOPE(DmPerfOp::GET_TRUSTED_DEVICE_LIST);
     LOGI("pkgName: %{public}s, userId: %{public}d, accountId: %{public}s",
         processInfo.pkgName.c_str(), processInfo.userId, GetAnonyString(processInfo.accountId).c_str());
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
@@ -4861,6 +4984,7 @@ int32_t DeviceManagerService::GetTrustedDeviceList(ProcessInfo processInfo, std:
 
 int32_t DeviceManagerService::GetTrustedDeviceList(const std::string &pkgName, std::vector<DmDeviceInfo> &deviceList)
 {
+    DM_PERF_SCOPE(DmPerfOp::GET_TRUSTED_DEVICE_LIST);
     LOGI("Begin for pkgName = %{public}s.", pkgName.c_str());
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
     if (DmConstrainsManager::GetInstance().CheckOsAccountConstraintEnabled(
@@ -5278,28 +5402,55 @@ void DeviceManagerService::HandleUserStopBroadCast(int32_t stopUserId, const std
 void DeviceManagerService::NotifyRemoteLocalUserStopByWifi(const std::string &localUdid,
     const std::map<std::string, std::string> &wifiDevices, int32_t stopUserId)
 {
-    for (const auto &it : wifiDevices) {
-        std::vector<std::string> updateUdids;
-        updateUdids.push_back(it.first);
-        CHECK_NULL_VOID(DMCommTool::GetInstance());
-        int32_t result = DMCommTool::GetInstance()->SendUserStop(it.second, stopUserId);
-        if (result != DM_OK) {
-            LOGE("by wifi failed: %{public}s", GetAnonyString(it.first).c_str());
-            HandleUserStop(stopUserId, localUdid, updateUdids);
+    std::shared_ptr<DMCommTool> dmCommTool = DMCommTool::GetInstance();
+    CHECK_NULL_VOID(dmCommTool);
+    std::vector<std::string> udids;
+    std::vector<std::string> networkIds;
+    SplitWifiDevices(wifiDevices, udids, networkIds);
+    std::vector<DmPeerSendResult> results = DmMulticastSender::Send(networkIds,
+        [dmCommTool, stopUserId] (const std::string &networkId) {
+            return dmCommTool->SendUserStop(networkId, stopUserId);
+        }, NOTIFY_BY_WIFI_DEADLINE_MS, NOTIFY_BY_WIFI_MAX_CONCURRENCY,
+        [this, stopUserId, localUdid, udids] (size_t index, int32_t result) {
+            // Still sending at the deadline, handled the same way once the send completes.
+            if (!StartUserStopByWifiTimer(stopUserId, localUdid, udids[index], result)) {
+                HandleUserStop(stopUserId, localUdid, { udids[index] });
+            }
+        });
+    std::vector<std::string> failedUdids;
+    for (size_t i = 0; i < results.size(); i++) {
+        if (results[i].isInFlight) {
+            LOGI("by wifi still sending: %{public}s", GetAnonyString(udids[i]).c_str());
             continue;
         }
-        std::lock_guard<std::mutex> autoLock(timerLocks_);
-        if (timer_ == nullptr) {
-            timer_ = std::make_shared<DmTimer>();
+        if (!StartUserStopByWifiTimer(stopUserId, localUdid, udids[i], results[i].result)) {
+            failedUdids.push_back(udids[i]);
         }
-        std::string udid = it.first;
-        timer_->StartTimer(std::string(USER_STOP_BY_WIFI_TIMEOUT_TASK) + Crypto::Sha256(udid),
-            USER_SWITCH_BY_WIFI_TIMEOUT_S,
-            [this, stopUserId, localUdid, updateUdids] (std::string name) {
-                DeviceManagerService::HandleUserStop(stopUserId, localUdid, updateUdids);
-            });
+    }
+    if (!failedUdids.empty()) {
+        HandleUserStop(stopUserId, localUdid, failedUdids);
     }
 }
+
+bool DeviceManagerService::StartUserStopByWifiTimer(int32_t stopUserId, const std::string &localUdid,
+    const std::string &udid, int32_t sendResult)
+{
+    if (sendResult != DM_OK) {
+        LOGE("by wifi failed: %{public}s, ret: %{public}d", GetAnonyString(udid).c_str(), sendResult);
+        return false;
+    }
+    std::vector<std::string> updateUdids = { udid };
+    std::lock_guard<std::mutex> autoLock(timerLocks_);
+    if (timer_ == nullptr) {
+        timer_ = std::make_shared<DmTimer>();
+    }
+    timer_->StartTimer(std::string(USER_STOP_BY_WIFI_TIMEOUT_TASK) + Crypto::Sha256(udid),
+        USER_SWITCH_BY_WIFI_TIMEOUT_S,
+        [this, stopUserId, localUdid, updateUdids] (std::string name) {
+            DeviceManagerService::HandleUserStop(stopUserId, localUdid, updateUdids);
+        });
+    return true;
+}
 #endif
 
 int32_t DeviceManagerService::RegisterAuthenticationType(const std::string &pkgName,
@@ -5611,11 +5762,16 @@ void DeviceManagerService::NotifyRemoteLocalLogout(const std::vector<std::string
         SendAccountLogoutBroadCast(bleUdids, accountIdHash, accountName, userId);
     }
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
-    for (const auto &it : wifiDevices) {
-        CHECK_NULL_VOID(DMCommTool::GetInstance());
-        int32_t ret = DMCommTool::GetInstance()->SendLogoutAccountInfo(it, accountIdHash, userId);
-        if (ret != DM_OK) {
-            LOGE("Send LogoutAccount Info error, ret = %{public}d", ret);
+    std::shared_ptr<DMCommTool> dmCommTool = DMCommTool::GetInstance();
+    CHECK_NULL_VOID(dmCommTool);
+    std::vector<DmPeerSendResult> results = DmMulticastSender::Send(wifiDevices,
+        [dmCommTool, accountIdHash, userId] (const std::string &networkId) {
+            return dmCommTool->SendLogoutAccountInfo(networkId, accountIdHash, userId);
+        }, NOTIFY_BY_WIFI_DEADLINE_MS, NOTIFY_BY_WIFI_MAX_CONCURRENCY);
+    for (const auto &item : results) {
+        if (item.result != DM_OK) {
+            LOGE("Send LogoutAccount Info error, networkId: %{public}s, ret = %{public}d",
+                GetAnonyString(item.networkId).c_str(), item.result);
         }
     }
 #endif
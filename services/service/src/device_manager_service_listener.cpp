@@ -16,7 +16,6 @@
 #include <algorithm>
 #include <cstdlib>
 #include <set>
-#include <sstream>
 #include "cJSON.h"
 
 #include "device_manager_service_listener.h"
@@ -63,38 +62,14 @@
 namespace OHOS {
 namespace DistributedHardware {
 std::mutex DeviceManagerServiceListener::alreadyNotifyPkgNameLock_;
-std::map<std::string, DmDeviceInfo> DeviceManagerServiceListener::alreadyOnlinePkgName_ = {};
+DmNotifyStateTable DeviceManagerServiceListener::alreadyOnlinePkgName_;
 std::mutex DeviceManagerServiceListener::alreadyDbReadyPkgNameLock_;
-std::map<std::string, DmDeviceInfo> DeviceManagerServiceListener::alreadyDbReadyPkgName_ = {};
+DmNotifyStateTable DeviceManagerServiceListener::alreadyDbReadyPkgName_;
 std::mutex DeviceManagerServiceListener::actUnrelatedPkgNameLock_;
 std::set<std::string> DeviceManagerServiceListener::actUnrelatedPkgName_ = {};
 std::unordered_set<std::string> DeviceManagerServiceListener::highPriorityPkgNameSet_ = { "ohos.deviceprofile",
     "ohos.distributeddata.service" };
 
-std::string MakeNotifyKey(const ProcessInfo &processInfo, const std::string &deviceId)
-{
-    return processInfo.pkgName + "#" + std::to_string(processInfo.userId) + "#" +
-        std::to_string(processInfo.tokenId) + "#" + deviceId;
-}
-
-#ifdef CAR_DEVICE_ENABLE
-std::string MakeNotifyKey(const ProcessInfo &processInfo, const DmDeviceInfo &info)
-{
-    return processInfo.pkgName + "#" + std::to_string(processInfo.userId) + "#" +
-        std::to_string(processInfo.tokenId) + "#" + info.deviceId;
-}
-#endif
-
-std::string MakeNotifyPrefix(const ProcessInfo &processInfo)
-{
-    return processInfo.pkgName + "#" + std::to_string(processInfo.userId) + "#" + std::to_string(processInfo.tokenId);
-}
-
-bool StartsWith(const std::string &value, const std::string &prefix)
-{
-    return value.compare(0, prefix.length(), prefix) == 0;
-}
-
 ProcessInfo FindExactProcessInfo(const std::vector<ProcessInfo> &processInfos, const ProcessInfo &target)
 {
     for (const auto &item : processInfos) {
@@ -121,36 +96,6 @@ ProcessInfo FindUniqueProcessInfoByPkgName(const std::vector<ProcessInfo> &proce
     return matchedProcessInfo;
 }
 
-bool ParseNotifyKey(const std::string &notifyKey, ProcessInfo &processInfo)
-{
-#ifdef CAR_DEVICE_ENABLE
-    std::istringstream stream(notifyKey);
-    std::string userId;
-    std::string tokenId;
-    std::string accountId;
-    if (!std::getline(stream, processInfo.pkgName, '#') ||
-        !std::getline(stream, userId, '#') ||
-        !std::getline(stream, tokenId, '#') ||
-        !std::getline(stream, processInfo.accountId, '#')) {
-        return false;
-    }
-    processInfo.userId = std::stoi(userId);
-    processInfo.tokenId = std::stoul(tokenId);
-#else
-    std::istringstream stream(notifyKey);
-    std::string userId;
-    std::string tokenId;
-    if (!std::getline(stream, processInfo.pkgName, '#') ||
-        !std::getline(stream, userId, '#') ||
-        !std::getline(stream, tokenId, '#')) {
-        return false;
-    }
-    processInfo.userId = std::atoi(userId.c_str());
-    processInfo.tokenId = std::stoul(tokenId);
-#endif
-    return true;
-}
-
 void handleExtraData(const DmDeviceInfo &info, DmDeviceBasicInfo &deviceBasicInfo)
 {
     cJSON *extraDataJsonObj = cJSON_Parse(info.extraData.c_str());
@@ -652,6 +597,24 @@ void DeviceManagerServiceListener::OnDeviceTrustChange(const std::string &udid,
     }
 }
 
+void DeviceManagerServiceListener::OnLocalDeviceNameChange()
+{
+    LOGI("start.");
+    std::shared_ptr<IpcReq> pReq = std::make_shared<IpcReq>();
+    std::shared_ptr<IpcRsp> pRsp = std::make_shared<IpcRsp>();
+    int32_t userId = -1;
+#if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
+    userId = MultipleUserConnector::GetFirstForegroundUserId();
+#endif
+    std::vector<ProcessInfo> processInfoVec = GetNotifyProcessInfoByUserId(userId,
+        DmCommonNotifyEvent::REG_LOCAL_DEVICE_NAME_CHANGE);
+    for (const auto &item : processInfoVec) {
+        pReq->SetPkgName(item.pkgName);
+        pReq->SetProcessInfo(item);
+        ipcServerListener_.SendRequest(SERVER_LOCAL_DEVICE_NAME_CHANGE_NOTIFY, pReq, pRsp);
+    }
+}
+
 void DeviceManagerServiceListener::SetDeviceScreenInfo(std::shared_ptr<IpcNotifyDeviceStateReq> pReq,
     const ProcessInfo &processInfo, const DmDeviceInfo &deviceInfo)
 {
@@ -706,13 +669,7 @@ void DeviceManagerServiceListener::RemoveOnlinePkgName(const DmDeviceInfo &info)
     LOGI("udidHash: %{public}s.", GetAnonyString(info.deviceId).c_str());
     {
         std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-        for (auto item = alreadyOnlinePkgName_.begin(); item != alreadyOnlinePkgName_.end();) {
-            if (std::string(item->second.deviceId) == std::string(info.deviceId)) {
-                item = alreadyOnlinePkgName_.erase(item);
-            } else {
-                ++item;
-            }
-        }
+        alreadyOnlinePkgName_.EraseDevice(std::string(info.deviceId));
     }
 }
 
@@ -741,14 +698,7 @@ void DeviceManagerServiceListener::OnCredentialAuthStatus(const ProcessInfo &pro
 void DeviceManagerServiceListener::OnAppUnintall(const std::string &pkgName)
 {
     std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-    std::string prefix = pkgName + "#";
-    for (auto it = alreadyOnlinePkgName_.begin(); it != alreadyOnlinePkgName_.end();) {
-        if (StartsWith(it->first, prefix)) {
-            it = alreadyOnlinePkgName_.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    alreadyOnlinePkgName_.ErasePkgName(pkgName);
 }
 
 void DeviceManagerServiceListener::OnSinkBindResult(const ProcessInfo &processInfo, const PeerTargetId &targetId,
@@ -949,18 +899,12 @@ void DeviceManagerServiceListener::ProcessDeviceOnline(const std::vector<Process
     std::shared_ptr<IpcNotifyDeviceStateReq> pReq = std::make_shared<IpcNotifyDeviceStateReq>();
     std::shared_ptr<IpcRsp> pRsp = std::make_shared<IpcRsp>();
     for (const auto &it : procInfoVec) {
-#ifdef CAR_DEVICE_ENABLE
-        std::string notifyPkgName = MakeNotifyKey(it, info);
-#else
-        std::string notifyPkgName = MakeNotifyKey(it, std::string(info.deviceId));
-#endif
+        std::string notifyDeviceId = std::string(info.deviceId);
         DmDeviceState notifyState = state;
         {
             std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-            if (alreadyOnlinePkgName_.find(notifyPkgName) != alreadyOnlinePkgName_.end()) {
+            if (!alreadyOnlinePkgName_.Insert(it, notifyDeviceId)) {
                 notifyState = DmDeviceState::DEVICE_INFO_CHANGED;
-            } else {
-                alreadyOnlinePkgName_[notifyPkgName] = info;
             }
         }
         SetDeviceInfo(pReq, it, notifyState, info, deviceBasicInfo);
@@ -983,14 +927,11 @@ void DeviceManagerServiceListener::ProcessDeviceOffline(const std::vector<Proces
         if (isOnline && find(whiteListVec.begin(), whiteListVec.end(), it) != whiteListVec.end()) {
             continue;
         }
-        std::string notifyPkgName = MakeNotifyKey(it, info);
-        LOGI("notifyPkgName: %{public}s.", notifyPkgName.c_str());
-        ClearDbReadyMap(notifyPkgName);
+        std::string notifyDeviceId = std::string(info.deviceId);
+        ClearDbReadyMap(it, notifyDeviceId);
         {
             std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-            if (alreadyOnlinePkgName_.find(notifyPkgName) != alreadyOnlinePkgName_.end()) {
-                alreadyOnlinePkgName_.erase(notifyPkgName);
-            } else {
+            if (!alreadyOnlinePkgName_.Erase(it, notifyDeviceId)) {
                 continue;
             }
         }
@@ -1019,13 +960,11 @@ void DeviceManagerServiceListener::ProcessDeviceOffline(const std::vector<Proces
                 continue;
             }
         }
-        std::string notifyPkgName = MakeNotifyKey(it, std::string(info.deviceId));
-        ClearDbReadyMap(notifyPkgName);
+        std::string notifyDeviceId = std::string(info.deviceId);
+        ClearDbReadyMap(it, notifyDeviceId);
         {
             std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-            if (alreadyOnlinePkgName_.find(notifyPkgName) != alreadyOnlinePkgName_.end()) {
-                alreadyOnlinePkgName_.erase(notifyPkgName);
-            } else {
+            if (!alreadyOnlinePkgName_.Erase(it, notifyDeviceId)) {
                 continue;
             }
         }
@@ -1063,17 +1002,12 @@ void DeviceManagerServiceListener::ProcessDeviceInfoChange(std::vector<ProcessIn
     std::shared_ptr<IpcRsp> pRsp = std::make_shared<IpcRsp>();
     for (const auto &it : procInfoVec) {
         if (state == DmDeviceState::DEVICE_INFO_READY) {
-#ifdef CAR_DEVICE_ENABLE
-            std::string notifyPkgName = MakeNotifyKey(it, info);
-#else
-            std::string notifyPkgName = MakeNotifyKey(it, std::string(info.deviceId));
-#endif
+            std::string notifyDeviceId = std::string(info.deviceId);
             {
                 std::lock_guard<std::mutex> autoLock(alreadyDbReadyPkgNameLock_);
-                if (alreadyDbReadyPkgName_.find(notifyPkgName) != alreadyDbReadyPkgName_.end()) {
+                if (!alreadyDbReadyPkgName_.Insert(it, notifyDeviceId)) {
                     continue;
                 }
-                alreadyDbReadyPkgName_[notifyPkgName] = info;
             }
         }
         SetDeviceInfo(pReq, it, state, info, deviceBasicInfo);
@@ -1104,18 +1038,12 @@ void DeviceManagerServiceListener::ProcessAppOnline(std::vector<ProcessInfo> &pr
     std::shared_ptr<IpcNotifyDeviceStateReq> pReq = std::make_shared<IpcNotifyDeviceStateReq>();
     std::shared_ptr<IpcRsp> pRsp = std::make_shared<IpcRsp>();
     for (const auto &it : procInfoVec) {
-#ifdef CAR_DEVICE_ENABLE
-        std::string notifyPkgName = MakeNotifyKey(it, info);
-#else
-        std::string notifyPkgName = MakeNotifyKey(it, std::string(info.deviceId));
-#endif
+        std::string notifyDeviceId = std::string(info.deviceId);
         DmDeviceState notifyState = state;
         {
             std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-            if (alreadyOnlinePkgName_.find(notifyPkgName) != alreadyOnlinePkgName_.end()) {
+            if (!alreadyOnlinePkgName_.Insert(it, notifyDeviceId)) {
                 notifyState = DmDeviceState::DEVICE_INFO_CHANGED;
-            } else {
-                alreadyOnlinePkgName_[notifyPkgName] = info;
             }
         }
         LOGI("notifyState = %{public}d", notifyState);
@@ -1153,17 +1081,11 @@ void DeviceManagerServiceListener::ProcessAppOffline(std::vector<ProcessInfo> &p
     SetNeedNotifyProcessInfos(processInfo, procInfoVec);
 #endif
     for (const auto &it : procInfoVec) {
-#ifdef CAR_DEVICE_ENABLE
-        std::string notifyPkgName = MakeNotifyKey(it, info);
-#else
-        std::string notifyPkgName = MakeNotifyKey(it, std::string(info.deviceId));
-#endif
-        ClearDbReadyMap(notifyPkgName);
+        std::string notifyDeviceId = std::string(info.deviceId);
+        ClearDbReadyMap(it, notifyDeviceId);
         {
             std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-            if (alreadyOnlinePkgName_.find(notifyPkgName) != alreadyOnlinePkgName_.end()) {
-                alreadyOnlinePkgName_.erase(notifyPkgName);
-            } else {
+            if (!alreadyOnlinePkgName_.Erase(it, notifyDeviceId)) {
                 continue;
             }
         }
@@ -1175,14 +1097,7 @@ void DeviceManagerServiceListener::ProcessAppOffline(std::vector<ProcessInfo> &p
 void DeviceManagerServiceListener::OnProcessRemove(const ProcessInfo &processInfo)
 {
     std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-    std::string notifyPkgName = MakeNotifyPrefix(processInfo) + "#";
-    for (auto it = alreadyOnlinePkgName_.begin(); it != alreadyOnlinePkgName_.end();) {
-        if (StartsWith(it->first, notifyPkgName)) {
-            it = alreadyOnlinePkgName_.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    alreadyOnlinePkgName_.EraseProcess(processInfo);
 }
 
 void DeviceManagerServiceListener::OnDevStateCallbackAdd(const ProcessInfo &processInfo,
@@ -1190,17 +1105,12 @@ void DeviceManagerServiceListener::OnDevStateCallbackAdd(const ProcessInfo &proc
 {
     ProcessInfo bindProcessInfo = DealBindProcessInfo(processInfo);
     for (auto item : deviceList) {
-#ifdef CAR_DEVICE_ENABLE
-        std::string notifyPkgName = MakeNotifyKey(bindProcessInfo, item);
-#else
-        std::string notifyPkgName = MakeNotifyKey(bindProcessInfo, std::string(item.deviceId));
-#endif
+        std::string notifyDeviceId = std::string(item.deviceId);
         {
             std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-            if (alreadyOnlinePkgName_.find(notifyPkgName) != alreadyOnlinePkgName_.end()) {
+            if (!alreadyOnlinePkgName_.Insert(bindProcessInfo, notifyDeviceId)) {
                 continue;
             }
-            alreadyOnlinePkgName_[notifyPkgName] = item;
         }
         DmDeviceBasicInfo deviceBasicInfo;
         std::shared_ptr<IpcNotifyDeviceStateReq> pReq = std::make_shared<IpcNotifyDeviceStateReq>();
@@ -1216,17 +1126,12 @@ void DeviceManagerServiceListener::OnDevDbReadyCallbackAdd(const ProcessInfo &pr
 {
     ProcessInfo bindProcessInfo = DealBindProcessInfo(processInfo);
     for (auto item : deviceList) {
-#ifdef CAR_DEVICE_ENABLE
-        std::string notifyPkgName = MakeNotifyKey(bindProcessInfo, item);
-#else
-        std::string notifyPkgName = MakeNotifyKey(bindProcessInfo, std::string(item.deviceId));
-#endif
+        std::string notifyDeviceId = std::string(item.deviceId);
         {
             std::lock_guard<std::mutex> autoLock(alreadyDbReadyPkgNameLock_);
-            if (alreadyDbReadyPkgName_.find(notifyPkgName) != alreadyDbReadyPkgName_.end()) {
+            if (!alreadyDbReadyPkgName_.Insert(bindProcessInfo, notifyDeviceId)) {
                 continue;
             }
-            alreadyDbReadyPkgName_[notifyPkgName] = item;
         }
         DmDeviceBasicInfo deviceBasicInfo;
         std::shared_ptr<IpcNotifyDeviceStateReq> pReq = std::make_shared<IpcNotifyDeviceStateReq>();
@@ -1242,28 +1147,16 @@ void DeviceManagerServiceListener::RemoveNotExistProcess()
     std::set<ProcessInfo> notifyProcessInfos;
     DeviceManagerServiceNotify::GetInstance().GetCallBack(DmCommonNotifyEvent::REG_DEVICE_STATE, notifyProcessInfos);
     std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-    for (auto it = alreadyOnlinePkgName_.begin(); it != alreadyOnlinePkgName_.end();) {
-        ProcessInfo processInfo;
-        if (!ParseNotifyKey(it->first, processInfo)) {
-            LOGE("ParseNotifyKey failed.");
-            it = alreadyOnlinePkgName_.erase(it);
-            continue;
-        }
-        bool isExistFlag = false;
+    alreadyOnlinePkgName_.EraseProcessIf([&notifyProcessInfos](const ProcessInfo &processInfo) {
         for (const auto &iter : notifyProcessInfos) {
             if (iter == processInfo) {
-                isExistFlag = true;
-                break;
+                return false;
             }
         }
-        if (!isExistFlag) {
-            LOGI("Erase stale online, userId:%{public}d, tokenId:%{public}s, pkgname:%{public}s,", processInfo.userId,
-                GetAnonyInt32(static_cast<int32_t>(processInfo.tokenId)).c_str(), processInfo.pkgName.c_str());
-            it = alreadyOnlinePkgName_.erase(it);
-        } else {
-            ++it;
-        }
-    }
+        LOGI("Erase stale online, userId:%{public}d, tokenId:%{public}s, pkgname:%{public}s,", processInfo.userId,
+            GetAnonyInt32(static_cast<int32_t>(processInfo.tokenId)).c_str(), processInfo.pkgName.c_str());
+        return true;
+    });
 }
 
 void DeviceManagerServiceListener::OnGetDeviceProfileInfoListResult(const ProcessInfo &processInfo,
@@ -1400,14 +1293,12 @@ void DeviceManagerServiceListener::ProcessDeviceOnline(const std::vector<Process
         std::shared_ptr<IpcNotifyDeviceStateReq> pReq = std::make_shared<IpcNotifyDeviceStateReq>();
         std::shared_ptr<IpcRsp> pRsp = std::make_shared<IpcRsp>();
         pReq->SetServiceIds(serviceIds);
-        std::string notifyPkgName = MakeNotifyKey(it, std::string(info.deviceId));
+        std::string notifyDeviceId = std::string(info.deviceId);
         DmDeviceState notifyState = state;
         {
             std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-            if (alreadyOnlinePkgName_.find(notifyPkgName) != alreadyOnlinePkgName_.end()) {
+            if (!alreadyOnlinePkgName_.Insert(it, notifyDeviceId)) {
                 notifyState = DmDeviceState::DEVICE_INFO_CHANGED;
-            } else {
-                alreadyOnlinePkgName_[notifyPkgName] = info;
             }
         }
         SetDeviceInfo(pReq, it, notifyState, info, deviceBasicInfo);
@@ -1426,14 +1317,12 @@ void DeviceManagerServiceListener::ProcessAppOnline(std::vector<ProcessInfo> &pr
         std::shared_ptr<IpcNotifyDeviceStateReq> pReq = std::make_shared<IpcNotifyDeviceStateReq>();
         std::shared_ptr<IpcRsp> pRsp = std::make_shared<IpcRsp>();
         pReq->SetServiceIds(serviceIds);
-        std::string notifyPkgName = MakeNotifyKey(it, std::string(info.deviceId));
+        std::string notifyDeviceId = std::string(info.deviceId);
         DmDeviceState notifyState = state;
         {
             std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
-            if (alreadyOnlinePkgName_.find(notifyPkgName) != alreadyOnlinePkgName_.end()) {
+            if (!alreadyOnlinePkgName_.Insert(it, notifyDeviceId)) {
                 notifyState = DmDeviceState::DEVICE_INFO_CHANGED;
-            } else {
-                alreadyOnlinePkgName_[notifyPkgName] = info;
             }
         }
         SetDeviceInfo(pReq, it, notifyState, info, deviceBasicInfo);
@@ -1441,12 +1330,10 @@ void DeviceManagerServiceListener::ProcessAppOnline(std::vector<ProcessInfo> &pr
     }
 }
 
-void DeviceManagerServiceListener::ClearDbReadyMap(std::string &notifyPkgName)
+void DeviceManagerServiceListener::ClearDbReadyMap(const ProcessInfo &processInfo, const std::string &deviceId)
 {
     std::lock_guard<std::mutex> autoLock(alreadyDbReadyPkgNameLock_);
-    if (alreadyDbReadyPkgName_.find(notifyPkgName) != alreadyDbReadyPkgName_.end()) {
-        alreadyDbReadyPkgName_.erase(notifyPkgName);
-    }
+    alreadyDbReadyPkgName_.Erase(processInfo, deviceId);
 }
 
 std::string DeviceManagerServiceListener::GetLocalDisplayDeviceName()
@@ -1597,23 +1484,18 @@ std::set<ProcessInfo> DeviceManagerServiceListener::GetAlreadyOnlineProcess()
 {
     std::lock_guard<std::mutex> autoLock(alreadyNotifyPkgNameLock_);
     std::set<ProcessInfo> processInfoSet;
- 
+    for (const auto &processInfo : alreadyOnlinePkgName_.GetProcesses()) {
 #ifdef CAR_DEVICE_ENABLE
-    for (const auto &item : alreadyOnlinePkgName_) {
-        ProcessInfo processInfo;
-        if (ParseNotifyKey(item.first, processInfo)) {
-            processInfoSet.insert(processInfo);
+        // Car builds tell the notified devices apart through accountId.
+        for (const auto &deviceId : alreadyOnlinePkgName_.GetDevices(processInfo)) {
+            ProcessInfo deviceProcessInfo = processInfo;
+            deviceProcessInfo.accountId = deviceId;
+            processInfoSet.insert(deviceProcessInfo);
         }
-    }
 #else
-    for (const auto &item : alreadyOnlinePkgName_) {
-        LOGI("item:%{public}s", item.first.c_str());
-        ProcessInfo processInfo;
-        if (ParseNotifyKey(item.first, processInfo)) {
-            processInfoSet.insert(processInfo);
-        }
-    }
+        processInfoSet.insert(processInfo);
 #endif
+    }
     return processInfoSet;
 }
 //LCOV_EXCL_START
@@ -26,6 +26,7 @@ DeviceNameChangeMonitor::DeviceNameChangeMonitor(int32_t userId)
 void DeviceNameChangeMonitor::OnChange()
 {
     LOGI("Settings OnChange");
+    DeviceNameManager::GetInstance().ClearSettingsCache(userId_);
     DeviceNameManager::GetInstance().InitDeviceNameWhenNameChange(userId_);
 }
 } // DistributedHardware
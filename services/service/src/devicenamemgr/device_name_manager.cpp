@@ -134,6 +134,12 @@ int32_t DeviceNameManager::UnInit()
         std::lock_guard<ffrt::mutex> lock(monitorMapMtx_);
         monitorMap_.clear();
     }
+    ClearDataShareHelpers();
+    {
+        std::lock_guard<ffrt::mutex> lock(settingsCacheMtx_);
+        settingsCache_.clear();
+        settingsCacheGen_++;
+    }
     return DM_OK;
 }
 
@@ -229,7 +235,7 @@ void DeviceNameManager::RegisterDeviceNameChangeMonitor(int32_t curUserId, int32
         monitorMap_[curUserId] = monitor;
     }
     std::string proxyUri = GetProxyUriStr(SETTINGSDATA_SECURE, curUserId);
-    auto helper = CreateDataShareHelper(proxyUri);
+    auto helper = AcquireDataShareHelper(proxyUri);
     if (helper == nullptr) {
         LOGE("helper is nullptr");
         {
@@ -243,7 +249,6 @@ void DeviceNameManager::RegisterDeviceNameChangeMonitor(int32_t curUserId, int32
     }
     Uri uri = MakeUri(proxyUri, SETTINGS_GENERAL_USER_DEFINED_DEVICE_NAME);
     helper->RegisterObserver(uri, monitor);
-    ReleaseDataShareHelper(helper);
 }
 
 void DeviceNameManager::UnRegisterDeviceNameChangeMonitor(int32_t userId)
@@ -262,19 +267,21 @@ void DeviceNameManager::UnRegisterDeviceNameChangeMonitor(int32_t userId)
             monitorMap_.erase(iter);
         }
     }
+    ClearSettingsCache(userId);
     if (monitor == nullptr) {
         LOGW("monitor is nullptr");
         return;
     }
     std::string proxyUri = GetProxyUriStr(SETTINGSDATA_SECURE, userId);
-    auto helper = CreateDataShareHelper(proxyUri);
+    auto helper = AcquireDataShareHelper(proxyUri);
     if (helper == nullptr) {
         LOGE("helper is nullptr");
         return;
     }
     Uri uri = MakeUri(proxyUri, SETTINGS_GENERAL_USER_DEFINED_DEVICE_NAME);
     helper->UnregisterObserver(uri, monitor);
-    ReleaseDataShareHelper(helper);
+    // the user is switched out, its helper is not needed any more.
+    DropDataShareHelper(proxyUri);
 }
 
 void DeviceNameManager::InitDeviceName(int32_t userId)
@@ -328,6 +335,8 @@ void DeviceNameManager::InitDeviceNameToSoftBus(const std::string &prefixName, c
     std::string displayName = jsonChar;
     cJSON_free(jsonChar);
     DeviceManagerService::GetInstance().SetLocalDisplayNameToSoftbus(displayName);
+    // Every rename ends up here, let clients drop the local device name they cached.
+    DeviceManagerService::GetInstance().HandleLocalDeviceNameChange();
 }
 
 int32_t DeviceNameManager::GetLocalDisplayDeviceName(int32_t maxNamelength, std::string &displayName)
@@ -600,7 +609,13 @@ int32_t DeviceNameManager::GetValue(const std::string &tableName, int32_t userId
     const std::string &key, std::string &value)
 {
     std::string proxyUri = GetProxyUriStr(tableName, userId);
-    auto helper = CreateDataShareHelper(proxyUri);
+    bool cacheable = IsSettingsCacheable(tableName, userId, key);
+    std::string cacheKey = proxyUri + "&key=" + key;
+    uint64_t generation = 0;
+    if (cacheable && GetCachedSettings(userId, cacheKey, value, generation)) {
+        return DM_OK;
+    }
+    auto helper = AcquireDataShareHelper(proxyUri);
     if (helper == nullptr) {
         LOGE("helper is nullptr, proxyUri=%{public}s", proxyUri.c_str());
         return ERR_DM_POINT_NULL;
@@ -610,9 +625,9 @@ int32_t DeviceNameManager::GetValue(const std::string &tableName, int32_t userId
     predicates.EqualTo(SETTING_COLUMN_KEYWORD, key);
     Uri uri = MakeUri(proxyUri, key);
     auto resultSet = helper->Query(uri, predicates, columns);
-    ReleaseDataShareHelper(helper);
     if (resultSet == nullptr) {
         LOGE("Query failed key=%{public}s, proxyUri=%{public}s", key.c_str(), proxyUri.c_str());
+        DropDataShareHelper(proxyUri);
         return ERR_DM_POINT_NULL;
     }
     int32_t count = 0;
@@ -620,6 +635,9 @@ int32_t DeviceNameManager::GetValue(const std::string &tableName, int32_t userId
     if (count == 0) {
         LOGW("no value, key=%{public}s, proxyUri=%{public}s", key.c_str(), proxyUri.c_str());
         resultSet->Close();
+        if (cacheable) {
+            UpdateCachedSettings(userId, cacheKey, "", generation);
+        }
         return DM_OK;
     }
     int32_t index = 0;
@@ -631,6 +649,9 @@ int32_t DeviceNameManager::GetValue(const std::string &tableName, int32_t userId
         return ret;
     }
     resultSet->Close();
+    if (cacheable) {
+        UpdateCachedSettings(userId, cacheKey, value, generation);
+    }
     LOGI("proxyUri=%{public}s, value=%{public}s", proxyUri.c_str(), GetAnonyString(value).c_str());
     return DM_OK;
 }
@@ -639,7 +660,11 @@ int32_t DeviceNameManager::SetValue(const std::string &tableName, int32_t userId
     const std::string &key, const std::string &value)
 {
     std::string proxyUri = GetProxyUriStr(tableName, userId);
-    auto helper = CreateDataShareHelper(proxyUri);
+    if (IsSettingsCacheable(tableName, userId, key)) {
+        // the observer fires for our own write as well, drop the value now so no reader sees the old one.
+        ClearSettingsCache(userId);
+    }
+    auto helper = AcquireDataShareHelper(proxyUri);
     if (helper == nullptr) {
         LOGE("helper is nullptr, proxyUri=%{public}s, value=%{public}s",
             proxyUri.c_str(), GetAnonyString(value).c_str());
@@ -657,10 +682,10 @@ int32_t DeviceNameManager::SetValue(const std::string &tableName, int32_t userId
             ret, proxyUri.c_str(), GetAnonyString(value).c_str());
         ret = helper->Insert(uri, val);
     }
-    ReleaseDataShareHelper(helper);
     if (ret <= 0) {
         LOGE("set value failed, ret=%{public}d, proxyUri=%{public}s, value=%{public}s",
             ret, proxyUri.c_str(), GetAnonyString(value).c_str());
+        DropDataShareHelper(proxyUri);
         return ret;
     }
     return ret;
@@ -713,5 +738,111 @@ bool DeviceNameManager::ReleaseDataShareHelper(std::shared_ptr<DataShare::DataSh
     }
     return true;
 }
+
+std::shared_ptr<DataShare::DataShareHelper> DeviceNameManager::AcquireDataShareHelper(const std::string &proxyUri)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(helperPoolMtx_);
+        auto iter = helperPool_.find(proxyUri);
+        if (iter != helperPool_.end()) {
+            return iter->second;
+        }
+    }
+    auto helper = CreateDataShareHelper(proxyUri);
+    if (helper == nullptr) {
+        return nullptr;
+    }
+    std::shared_ptr<DataShare::DataShareHelper> redundant = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(helperPoolMtx_);
+        auto iter = helperPool_.find(proxyUri);
+        if (iter != helperPool_.end()) {
+            // another thread created one meanwhile, keep the pooled helper.
+            redundant = helper;
+            helper = iter->second;
+        } else if (helperPool_.size() < MAX_CONTAINER_SIZE) {
+            helperPool_[proxyUri] = helper;
+        }
+    }
+    if (redundant != nullptr) {
+        ReleaseDataShareHelper(redundant);
+    }
+    return helper;
+}
+
+void DeviceNameManager::DropDataShareHelper(const std::string &proxyUri)
+{
+    std::shared_ptr<DataShare::DataShareHelper> helper = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(helperPoolMtx_);
+        auto iter = helperPool_.find(proxyUri);
+        if (iter == helperPool_.end()) {
+            return;
+        }
+        helper = iter->second;
+        helperPool_.erase(iter);
+    }
+    ReleaseDataShareHelper(helper);
+}
+
+void DeviceNameManager::ClearDataShareHelpers()
+{
+    std::map<std::string, std::shared_ptr<DataShare::DataShareHelper>> helpers;
+    {
+        std::lock_guard<ffrt::mutex> lock(helperPoolMtx_);
+        helpers.swap(helperPool_);
+    }
+    for (auto &item : helpers) {
+        ReleaseDataShareHelper(item.second);
+    }
+}
+
+bool DeviceNameManager::IsSettingsCacheable(const std::string &tableName, int32_t userId, const std::string &key)
+{
+    // only keys with a registered change monitor can be invalidated in time.
+    if (tableName != SETTINGSDATA_SECURE || key != SETTINGS_GENERAL_USER_DEFINED_DEVICE_NAME) {
+        return false;
+    }
+    std::lock_guard<ffrt::mutex> lock(monitorMapMtx_);
+    return monitorMap_.find(userId) != monitorMap_.end();
+}
+
+bool DeviceNameManager::GetCachedSettings(int32_t userId, const std::string &cacheKey, std::string &value,
+    uint64_t &generation)
+{
+    std::lock_guard<ffrt::mutex> lock(settingsCacheMtx_);
+    generation = settingsCacheGen_;
+    auto userIter = settingsCache_.find(userId);
+    if (userIter == settingsCache_.end()) {
+        return false;
+    }
+    auto iter = userIter->second.find(cacheKey);
+    if (iter == userIter->second.end()) {
+        return false;
+    }
+    value = iter->second;
+    return true;
+}
+
+void DeviceNameManager::UpdateCachedSettings(int32_t userId, const std::string &cacheKey, const std::string &value,
+    uint64_t generation)
+{
+    std::lock_guard<ffrt::mutex> lock(settingsCacheMtx_);
+    // an invalidation happened while querying, the value read may already be stale.
+    if (generation != settingsCacheGen_) {
+        return;
+    }
+    if (settingsCache_.find(userId) == settingsCache_.end() && settingsCache_.size() >= MAX_CONTAINER_SIZE) {
+        return;
+    }
+    settingsCache_[userId][cacheKey] = value;
+}
+
+void DeviceNameManager::ClearSettingsCache(int32_t userId)
+{
+    std::lock_guard<ffrt::mutex> lock(settingsCacheMtx_);
+    settingsCache_.erase(userId);
+    settingsCacheGen_++;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
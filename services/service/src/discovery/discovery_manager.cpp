@@ -104,7 +104,7 @@ int32_t DiscoveryManager::EnableDiscoveryListener(const std::string &pkgName,
         LOGE("softbus refresh lnn ret: %{public}d.", ret);
         return ret;
     }
-    softbusListener_->RegisterSoftbusLnnOpsCbk(pkgNameTemp, shared_from_this());
+    softbusListener_->RegisterSoftbusLnnOpsCbk(pkgNameTemp, shared_from_this(), true);
     return DM_OK;
 }
 
@@ -164,7 +164,7 @@ int32_t DiscoveryManager::StartDiscovering(const std::string &pkgName,
         isStandardMetaNode = (metaType == MetaNodeType::PROXY_TRANSMISION);
     }
 
-    softbusListener_->RegisterSoftbusLnnOpsCbk(pkgNameTemp, shared_from_this());
+    softbusListener_->RegisterSoftbusLnnOpsCbk(pkgNameTemp, shared_from_this(), true);
     StartDiscoveryTimer(pkgNameTemp);
 
     auto it = filterOptions.find(PARAM_KEY_FILTER_OPTIONS);
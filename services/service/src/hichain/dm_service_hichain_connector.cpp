@@ -28,6 +28,7 @@
 #include "dm_log.h"
 #include "dm_random.h"
 #include "dm_radar_helper.h"
+#include "hichain_group_cache.h"
 #include "json_object.h"
 #include "multiple_user_connector.h"
 #include "parameter.h"
@@ -118,6 +119,8 @@ void DmServiceHiChainConnector::onFinish(int64_t requestId, int operationCode, c
     std::string data = (returnData != nullptr) ? std::string(returnData) : "";
     LOGI("reqId:%{public}" PRId64 ", operation:%{public}d",
         requestId, operationCode);
+    // Own group operation finished, do not wait for the data change broadcast before querying again.
+    HichainGroupCache::GetInstance().InvalidateAll();
     if (operationCode == GroupOperationCode::GROUP_CREATE) {
         LOGI("Create group success");
         if (!DmRadarHelper::GetInstance().ReportAuthCreateGroupCb(
@@ -204,12 +207,21 @@ int32_t DmServiceHiChainConnector::GetJsonInt(const JsonObject &jsonObj, const s
 bool DmServiceHiChainConnector::GetGroupInfoCommon(const int32_t userId, const std::string &queryParams,
     const char* pkgName, std::vector<DmGroupInfo> &groupList)
 {
+    std::vector<HichainGroupRecord> groupRecords;
+    if (HichainGroupCache::GetInstance().GetGroupInfo(userId, pkgName, queryParams, groupRecords)) {
+        if (groupRecords.empty()) {
+            return false;
+        }
+        HichainGroupCache::ToGroupList(groupRecords, groupList);
+        return true;
+    }
     char *groupVec = nullptr;
     uint32_t num = 0;
     if (deviceGroupManager_ == nullptr) {
         LOGE("deviceGroupManager_ is null");
         return false;
     }
+    uint64_t generation = HichainGroupCache::GetInstance().GetGeneration();
     int32_t ret = deviceGroupManager_->getGroupInfo(userId, pkgName, queryParams.c_str(), &groupVec, &num);
     if (ret != 0) {
         LOGE("[HICHAIN]fail to get group info with ret:%{public}d.", ret);
@@ -223,27 +235,21 @@ bool DmServiceHiChainConnector::GetGroupInfoCommon(const int32_t userId, const s
     if (num == 0) {
         LOGE("[HICHAIN]return groups info number is zero.");
         deviceGroupManager_->destroyInfo(&groupVec);
+        HichainGroupCache::GetInstance().PutGroupInfo(userId, pkgName, queryParams, groupRecords, generation);
         return false;
     }
     LOGI("groupNum(%{public}u)", num);
     std::string relatedGroups = std::string(groupVec);
     deviceGroupManager_->destroyInfo(&groupVec);
-    JsonObject jsonObject(relatedGroups);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("returnGroups parse error");
-        return false;
-    }
-    if (!jsonObject.IsArray()) {
-        LOGE("json string is not array.");
+    if (HichainGroupCache::ParseGroups(relatedGroups, groupRecords) != DM_OK) {
         return false;
     }
-    std::vector<DmGroupInfo> groupInfos;
-    jsonObject.Get(groupInfos);
-    if (groupInfos.empty()) {
+    HichainGroupCache::GetInstance().PutGroupInfo(userId, pkgName, queryParams, groupRecords, generation);
+    if (groupRecords.empty()) {
         LOGE("group failed, groupInfos is empty.");
         return false;
     }
-    groupList = groupInfos;
+    HichainGroupCache::ToGroupList(groupRecords, groupList);
     return true;
 }
 
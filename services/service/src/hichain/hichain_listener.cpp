@@ -22,6 +22,7 @@
 #include "dm_constants.h"
 #include "dm_log.h"
 #include "dm_random.h"
+#include "hichain_group_cache.h"
 #include "multiple_user_connector.h"
 
 namespace OHOS {
@@ -32,14 +33,57 @@ namespace {
     constexpr uint32_t DM_IDENTICAL_ACCOUNT = 1;
     constexpr uint32_t ACCOUNT_SHARED = 3;
     constexpr const char* DM_PKG_NAME_EXT = "com.huawei.devicemanager";
+
+    void InvalidateGroupCache(const char *groupInfo)
+    {
+        if (groupInfo == nullptr || strlen(groupInfo) > MAX_DATA_LEN) {
+            HichainGroupCache::GetInstance().InvalidateAll();
+            return;
+        }
+        std::string groupStr(groupInfo);
+        JsonObject groupJson(groupStr);
+        if (groupJson.IsDiscarded() || !IsInt32(groupJson, FIELD_OS_ACCOUNT_ID)) {
+            HichainGroupCache::GetInstance().InvalidateAll();
+            return;
+        }
+        HichainGroupCache::GetInstance().InvalidateUser(groupJson[FIELD_OS_ACCOUNT_ID].Get<int32_t>());
+        if (IsString(groupJson, FIELD_GROUP_ID)) {
+            HichainGroupCache::GetInstance().InvalidateGroup(groupJson[FIELD_GROUP_ID].Get<std::string>());
+        }
+    }
+
+    void InvalidatePeerCache(const char *peerUdid)
+    {
+        if (peerUdid == nullptr || strlen(peerUdid) > MAX_DATA_LEN) {
+            HichainGroupCache::GetInstance().InvalidateAll();
+            return;
+        }
+        HichainGroupCache::GetInstance().InvalidatePeer(peerUdid);
+    }
+
+    void InvalidateCredentialCache(const char *credId)
+    {
+        if (credId == nullptr || strlen(credId) > MAX_DATA_LEN) {
+            HichainGroupCache::GetInstance().InvalidateAll();
+            return;
+        }
+        HichainGroupCache::GetInstance().InvalidateCredential(credId);
+    }
 }
 
 static DataChangeListener dataChangeListener_ = {
+    .onGroupCreated = HichainListener::OnHichainGroupChanged,
+    .onGroupDeleted = HichainListener::OnHichainGroupChanged,
+    .onDeviceBound = HichainListener::OnHichainDeviceBound,
     .onDeviceUnBound = HichainListener::OnHichainDeviceUnBound,
+    .onDeviceNotTrusted = HichainListener::OnHichainDeviceNotTrusted,
+    .onLastGroupDeleted = HichainListener::OnHichainLastGroupDeleted,
 };
 
 static CredChangeListener credChangeListener_ = {
+    .onCredAdd = HichainListener::OnCredentialChanged,
     .onCredDelete = HichainListener::OnCredentialDeleted,
+    .onCredUpdate = HichainListener::OnCredentialChanged,
 };
 
 void FromJson(const JsonItemObject &jsonObject, GroupInformation &groupInfo)
@@ -122,6 +166,7 @@ void HichainListener::RegisterDataChangeCb()
         LOGE("[HICHAIN]regDataChangeListener failed with ret: %{public}d.", ret);
         return;
     }
+    HichainGroupCache::GetInstance().SetGroupCacheEnabled(true);
     LOGI("success!");
 }
 
@@ -137,13 +182,38 @@ void HichainListener::RegisterCredentialCb()
         LOGE("[HICHAIN]registerChangeListener failed with ret: %{public}d.", ret);
         return;
     }
+    HichainGroupCache::GetInstance().SetCredentialCacheEnabled(true);
     LOGI("success!");
 }
 //LCOV_EXCL_STOP
 
+void HichainListener::OnHichainGroupChanged(const char *groupInfo)
+{
+    InvalidateGroupCache(groupInfo);
+}
+
+void HichainListener::OnHichainDeviceBound(const char *peerUdid, const char *groupInfo)
+{
+    InvalidatePeerCache(peerUdid);
+    InvalidateGroupCache(groupInfo);
+}
+
+void HichainListener::OnHichainDeviceNotTrusted(const char *peerUdid)
+{
+    InvalidatePeerCache(peerUdid);
+}
+
+void HichainListener::OnHichainLastGroupDeleted(const char *peerUdid, int groupType)
+{
+    (void)groupType;
+    InvalidatePeerCache(peerUdid);
+}
+
 void HichainListener::OnHichainDeviceUnBound(const char *peerUdid, const char *groupInfo)
 {
     LOGI("start");
+    InvalidatePeerCache(peerUdid);
+    InvalidateGroupCache(groupInfo);
     if (peerUdid == nullptr || groupInfo == nullptr) {
         LOGE("peerUdid or groupInfo is null!");
         return;
@@ -172,8 +242,15 @@ void HichainListener::OnHichainDeviceUnBound(const char *peerUdid, const char *g
     }
 }
 
+void HichainListener::OnCredentialChanged(const char *credId, const char *credInfo)
+{
+    (void)credInfo;
+    InvalidateCredentialCache(credId);
+}
+
 void HichainListener::OnCredentialDeleted(const char *credId, const char *credInfo)
 {
+    InvalidateCredentialCache(credId);
     if (credId == nullptr || credInfo == nullptr) {
         LOGE("credId or credInfo is null!");
         return;
@@ -249,8 +326,17 @@ int32_t HichainListener::GetRelatedGroupsCommon(int32_t userId, const std::strin
         LOGE("user id failed");
         return ERR_DM_FAILED;
     }
+    std::vector<HichainGroupRecord> groupRecords;
+    if (HichainGroupCache::GetInstance().GetRelatedGroups(userId, pkgName, deviceId, groupRecords)) {
+        if (groupRecords.empty()) {
+            return ERR_DM_FAILED;
+        }
+        HichainGroupCache::ToGroupList(groupRecords, groupList);
+        return DM_OK;
+    }
     uint32_t groupNum = 0;
     char *returnGroups = nullptr;
+    uint64_t generation = HichainGroupCache::GetInstance().GetGeneration();
     int32_t ret =
         deviceGroupManager_->getRelatedGroups(userId, pkgName, deviceId.c_str(), &returnGroups, &groupNum);
     if (ret != 0) {
@@ -265,11 +351,23 @@ int32_t HichainListener::GetRelatedGroupsCommon(int32_t userId, const std::strin
     if (groupNum == 0) {
         LOGE("[HICHAIN]return related goups number is zero.");
         DestroyReturnGroupsAndClear(returnGroups);
+        HichainGroupCache::GetInstance().PutRelatedGroups(userId, pkgName, deviceId, groupRecords, generation);
         return ERR_DM_FAILED;
     }
     std::string relatedGroups = std::string(returnGroups);
     DestroyReturnGroupsAndClear(returnGroups);
-    return ParseRelatedGroupsToJson(relatedGroups, groupList);
+    ret = HichainGroupCache::ParseGroups(relatedGroups, groupRecords);
+    ClearSensitiveString(relatedGroups);
+    if (ret != DM_OK) {
+        return ERR_DM_FAILED;
+    }
+    HichainGroupCache::GetInstance().PutRelatedGroups(userId, pkgName, deviceId, groupRecords, generation);
+    if (groupRecords.empty()) {
+        LOGE("group failed, groupInfos is empty.");
+        return ERR_DM_FAILED;
+    }
+    HichainGroupCache::ToGroupList(groupRecords, groupList);
+    return DM_OK;
 }
 
 void HichainListener::DestroyReturnGroupsAndClear(char *returnGroups)
@@ -281,32 +379,6 @@ void HichainListener::DestroyReturnGroupsAndClear(char *returnGroups)
     deviceGroupManager_->destroyInfo(&returnGroups);
 }
 
-int32_t HichainListener::ParseRelatedGroupsToJson(std::string &relatedGroups,
-    std::vector<GroupsInfo> &groupList)
-{
-    JsonObject jsonObject(relatedGroups);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("returnGroups parse error");
-        ClearSensitiveString(relatedGroups);
-        return ERR_DM_FAILED;
-    }
-    if (!jsonObject.IsArray()) {
-        LOGE("jsonObject is not an array.");
-        ClearSensitiveString(relatedGroups);
-        return ERR_DM_FAILED;
-    }
-    std::vector<GroupsInfo> groupInfos;
-    jsonObject.Get(groupInfos);
-    if (groupInfos.empty()) {
-        LOGE("group failed, groupInfos is empty.");
-        ClearSensitiveString(relatedGroups);
-        return ERR_DM_FAILED;
-    }
-    groupList = groupInfos;
-    ClearSensitiveString(relatedGroups);
-    return DM_OK;
-}
-
 void HichainListener::ClearSensitiveString(std::string &sensitiveData)
 {
     if (!sensitiveData.empty()) {
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ipc_cmd_admission.h"
+
+#include <chrono>
+#include <unordered_set>
+
+#include "device_manager_ipc_interface_code.h"
+#include "dm_error_type.h"
+#include "dm_log.h"
+#include "dm_perf_stats.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+// Together the normal and heavy lanes take at most 24 of the 32 binder threads.
+constexpr IpcLaneBudget LIGHT_LANE_BUDGET = { 32, 0, 0 };
+constexpr IpcLaneBudget NORMAL_LANE_BUDGET = { 12, 4, 500 };
+constexpr IpcLaneBudget HEAVY_LANE_BUDGET = { 6, 2, 1000 };
+
+// Binds, credentials and profile writes. Read-only queries such as the trust lists and BATCH_QUERY stay in the
+// normal lane.
+const std::unordered_set<int32_t> HEAVY_CMD_CODES = {
+    AUTHENTICATE_DEVICE, UNAUTHENTICATE_DEVICE,
+    BIND_DEVICE, UNBIND_DEVICE, BIND_TARGET, UNBIND_TARGET, BIND_SERVICE_TARGET, UNBIND_SERVICE_TARGET,
+    REQUEST_CREDENTIAL, IMPORT_CREDENTIAL, DELETE_CREDENTIAL, GET_DEVICE_PROFILE_INFO_LIST,
+    PUT_DEVICE_PROFILE_INFO_LIST, GET_DEVICE_ICON_INFO, SET_LOCAL_DEVICE_NAME, SET_REMOTE_DEVICE_NAME,
+    CHECK_ACCESS_CONTROL, CHECK_SAME_ACCOUNT, CHECK_SRC_ACCESS_CONTROL, CHECK_SINK_ACCESS_CONTROL,
+    CHECK_SRC_SAME_ACCOUNT, CHECK_SINK_SAME_ACCOUNT,
+};
+
+const std::unordered_set<int32_t> LIGHT_CMD_CODES = {
+    REGISTER_DEVICE_MANAGER_LISTENER, UNREGISTER_DEVICE_MANAGER_LISTENER, GET_LOCAL_DEVICE_INFO,
+    GET_UDID_BY_NETWORK, GET_UUID_BY_NETWORK, GET_NETWORKTYPE_BY_NETWORK, GET_DEVICE_INFO,
+    CHECK_API_PERMISSION, GET_ANONY_LOCAL_UDID, GET_LOCAL_DEVICE_NAME, GET_LOCAL_DEVICE_NAME_OLD,
+    SYNC_CALLBACK, GET_OS_TYPE_BY_NETWORK, GET_DEVICE_SCREEN_STATUS,
+};
+
+const DmPerfOp LANE_WAIT_OPS[] = {
+    DmPerfOp::IPC_LIGHT_QUEUE_WAIT,
+    DmPerfOp::IPC_NORMAL_QUEUE_WAIT,
+    DmPerfOp::IPC_HEAVY_QUEUE_WAIT,
+};
+
+const DmPerfCounter LANE_REJECT_COUNTERS[] = {
+    DmPerfCounter::IPC_LIGHT_REJECTED,
+    DmPerfCounter::IPC_NORMAL_REJECTED,
+    DmPerfCounter::IPC_HEAVY_REJECTED,
+};
+
+static_assert(sizeof(LANE_WAIT_OPS) / sizeof(LANE_WAIT_OPS[0]) == static_cast<size_t>(IpcCmdLane::LANE_MAX),
+    "LANE_WAIT_OPS must cover every IpcCmdLane");
+static_assert(sizeof(LANE_REJECT_COUNTERS) / sizeof(LANE_REJECT_COUNTERS[0]) ==
+    static_cast<size_t>(IpcCmdLane::LANE_MAX), "LANE_REJECT_COUNTERS must cover every IpcCmdLane");
+}
+
+IpcCmdAdmission::IpcCmdAdmission()
+    : budgets_({ LIGHT_LANE_BUDGET, NORMAL_LANE_BUDGET, HEAVY_LANE_BUDGET })
+{
+}
+
+IpcCmdAdmission::IpcCmdAdmission(const IpcLaneBudgets &budgets) : budgets_(budgets)
+{
+}
+
+IpcCmdLane IpcCmdAdmission::GetLane(int32_t cmdCode)
+{
+    if (LIGHT_CMD_CODES.find(cmdCode) != LIGHT_CMD_CODES.end()) {
+        return IpcCmdLane::LIGHT;
+    }
+    if (HEAVY_CMD_CODES.find(cmdCode) != HEAVY_CMD_CODES.end()) {
+        return IpcCmdLane::HEAVY;
+    }
+    return IpcCmdLane::NORMAL;
+}
+
+int32_t IpcCmdAdmission::Acquire(IpcCmdLane lane)
+{
+    if (lane < IpcCmdLane::LIGHT || lane >= IpcCmdLane::LANE_MAX) {
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    size_t index = static_cast<size_t>(lane);
+    const IpcLaneBudget &budget = budgets_[index];
+    LaneState &state = lanes_[index];
+    auto begin = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> autoLock(laneLock_);
+    // Commands already waiting go first, a newcomer only takes a free slot when nobody waits.
+    if (state.running < budget.maxRunning && state.waiting == 0) {
+        state.running++;
+        return DM_OK;
+    }
+    bool admitted = false;
+    if (state.waiting < budget.maxWaiting) {
+        state.waiting++;
+        admitted = state.cond.wait_for(autoLock, std::chrono::milliseconds(budget.waitTimeoutMs),
+            [&state, &budget] { return state.running < budget.maxRunning; });
+        state.waiting--;
+    }
+    if (!admitted) {
+        autoLock.unlock();
+        LOGW("lane %{public}d busy, command rejected.", static_cast<int32_t>(lane));
+        DmPerfStats::GetInstance().IncCounter(LANE_REJECT_COUNTERS[index]);
+        return ERR_DM_IPC_CMD_BUSY;
+    }
+    state.running++;
+    autoLock.unlock();
+    if (DmPerfStats::GetInstance().IsEnabled()) {
+        uint64_t waitUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count());
+        DmPerfStats::GetInstance().RecordLatency(LANE_WAIT_OPS[index], waitUs);
+    }
+    return DM_OK;
+}
+
+void IpcCmdAdmission::Release(IpcCmdLane lane)
+{
+    if (lane < IpcCmdLane::LIGHT || lane >= IpcCmdLane::LANE_MAX) {
+        return;
+    }
+    LaneState &state = lanes_[static_cast<size_t>(lane)];
+    {
+        std::lock_guard<std::mutex> autoLock(laneLock_);
+        if (state.running > 0) {
+            state.running--;
+        }
+    }
+    state.cond.notify_one();
+}
+
+int32_t IpcCmdAdmission::GetRunning(IpcCmdLane lane)
+{
+    if (lane < IpcCmdLane::LIGHT || lane >= IpcCmdLane::LANE_MAX) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> autoLock(laneLock_);
+    return lanes_[static_cast<size_t>(lane)].running;
+}
+
+IpcCmdAdmissionGuard::IpcCmdAdmissionGuard(IpcCmdAdmission &admission, IpcCmdLane lane)
+    : admission_(admission), lane_(lane), result_(admission.Acquire(lane))
+{
+}
+
+IpcCmdAdmissionGuard::~IpcCmdAdmissionGuard()
+{
+    if (result_ == DM_OK) {
+        admission_.Release(lane_);
+    }
+}
+
+int32_t IpcCmdAdmissionGuard::GetResult() const
+{
+    return result_;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -17,6 +17,8 @@
 #include "xcollie/xcollie_define.h"
 
 #include <securec.h>
+#include <unordered_set>
+
 #include "device_manager_ipc_interface_code.h"
 #include "device_manager_service.h"
 #include "device_manager_service_notify.h"
@@ -62,6 +64,9 @@ namespace DistributedHardware {
 const unsigned int XCOLLIE_TIMEOUT_S = 5;
 constexpr const char* SCENEBOARD_PROCESS = "com.ohos.sceneboard";
 constexpr int32_t SERVICE_LIST_MAX_SIZE = 1024;
+// Only read-only queries may be batched, they have no side effect a partial batch could leave behind.
+const std::unordered_set<int32_t> BATCH_QUERY_CODES { GET_LOCAL_DEVICE_INFO, GET_TRUST_DEVICE_LIST, GET_DEVICE_INFO,
+    GET_UDID_BY_NETWORK, GET_UUID_BY_NETWORK, GET_NETWORKTYPE_BY_NETWORK };
 
 void DecodeDmAccessCaller(MessageParcel &parcel, DmAccessCaller &caller)
 {
@@ -1611,6 +1616,24 @@ ON_IPC_READ_RESPONSE(SERVER_DEVICE_SCREEN_STATE_NOTIFY, MessageParcel &reply, st
     return DM_OK;
 }
 
+ON_IPC_SET_REQUEST(SERVER_LOCAL_DEVICE_NAME_CHANGE_NOTIFY, std::shared_ptr<IpcReq> pBaseReq, MessageParcel &data)
+{
+    CHECK_NULL_RETURN(pBaseReq, ERR_DM_FAILED);
+    std::string pkgName = pBaseReq->GetPkgName();
+    if (!data.WriteString(pkgName)) {
+        LOGE("write pkgName failed");
+        return ERR_DM_IPC_WRITE_FAILED;
+    }
+    return DM_OK;
+}
+
+ON_IPC_READ_RESPONSE(SERVER_LOCAL_DEVICE_NAME_CHANGE_NOTIFY, MessageParcel &reply, std::shared_ptr<IpcRsp> pBaseRsp)
+{
+    CHECK_NULL_RETURN(pBaseRsp, ERR_DM_FAILED);
+    pBaseRsp->SetErrCode(reply.ReadInt32());
+    return DM_OK;
+}
+
 ON_IPC_CMD(GET_DEVICE_SCREEN_STATUS, MessageParcel &data, MessageParcel &reply)
 {
     std::string pkgName = data.ReadString();
@@ -2611,5 +2634,46 @@ ON_IPC_CMD(GET_PEER_SERVICEINFO_BY_SERVICEID, MessageParcel &data, MessageParcel
     }
     return DM_OK;
 }
+
+ON_IPC_CMD(BATCH_QUERY, MessageParcel &data, MessageParcel &reply)
+{
+    std::string pkgName = data.ReadString();
+    int32_t num = data.ReadInt32();
+    if (num <= 0 || num > DM_BATCH_QUERY_MAX_NUM) {
+        LOGE("invalid cmd num: %{public}d", num);
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    LOGI("pkgName: %{public}s, cmd num: %{public}d", GetAnonyString(pkgName).c_str(), num);
+    if (!reply.WriteInt32(num)) {
+        LOGE("write cmd num failed");
+        return ERR_DM_IPC_WRITE_FAILED;
+    }
+    for (int32_t i = 0; i < num; i++) {
+        int32_t cmdCode = data.ReadInt32();
+        uint32_t size = data.ReadUint32();
+        const uint8_t *buffer = size > 0 ? data.ReadBuffer(size) : nullptr;
+        if (size > 0 && buffer == nullptr) {
+            LOGE("read cmd %{public}d failed", cmdCode);
+            return ERR_DM_IPC_READ_FAILED;
+        }
+        int32_t ret = ERR_DM_UNSUPPORTED_IPC_COMMAND;
+        MessageParcel cmdData;
+        MessageParcel cmdReply;
+        if (BATCH_QUERY_CODES.find(cmdCode) == BATCH_QUERY_CODES.end()) {
+            LOGE("cmd %{public}d can not be batched", cmdCode);
+        } else if (size > 0 && !cmdData.WriteBuffer(buffer, size)) {
+            ret = ERR_DM_IPC_READ_FAILED;
+        } else {
+            ret = IpcCmdRegister::GetInstance().OnIpcCmd(cmdCode, cmdData, cmdReply);
+        }
+        uint32_t replySize = ret == DM_OK ? static_cast<uint32_t>(cmdReply.GetDataSize()) : 0;
+        if (!reply.WriteInt32(ret) || !reply.WriteUint32(replySize) ||
+            (replySize > 0 && !reply.WriteBuffer(reinterpret_cast<const void *>(cmdReply.GetData()), replySize))) {
+            LOGE("write cmd %{public}d reply failed", cmdCode);
+            return ERR_DM_IPC_WRITE_FAILED;
+        }
+    }
+    return DM_OK;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
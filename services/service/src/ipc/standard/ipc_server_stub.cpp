@@ -35,6 +35,7 @@
 #include "dm_error_type.h"
 #include "dm_device_info.h"
 #include "ffrt.h"
+#include "hichain_group_cache.h"
 #include <unistd.h>
 #include <string>
 #include <fcntl.h>
@@ -43,6 +44,8 @@
 #include "multiple_user_connector.h"
 #include "permission_manager.h"
 #include "dm_crypto.h"
+#include "dm_init_stage_graph.h"
+#include "dm_softbus_cache.h"
 
 #include "ipc_interface_code_3rd.h"
 
@@ -55,7 +58,7 @@ SERVER_CREATE_PIN_HOLDER, SERVER_DESTROY_PIN_HOLDER, SERVER_CREATE_PIN_HOLDER_RE
 SERVER_ON_PIN_HOLDER_EVENT, UNBIND_TARGET_RESULT, REMOTE_DEVICE_TRUST_CHANGE, SERVER_DEVICE_SCREEN_STATE_NOTIFY,
 SERVICE_CREDENTIAL_AUTH_STATUS_NOTIFY, SINK_BIND_TARGET_RESULT, GET_DEVICE_PROFILE_INFO_LIST_RESULT,
 GET_DEVICE_ICON_INFO_RESULT, SET_LOCAL_DEVICE_NAME_RESULT, SET_REMOTE_DEVICE_NAME_RESULT, SERVICE_PUBLISH_RESULT,
-ON_AUTH_CODE_INVALID, SERVER_SERVICE_STATE_NOTIFY};
+ON_AUTH_CODE_INVALID, SERVER_SERVICE_STATE_NOTIFY, SERVER_LOCAL_DEVICE_NAME_CHANGE_NOTIFY};
 
 const std::unordered_set<int32_t> CLIENT_CODE_3RD { INIT_DEVICE_MANAGER, UNINIT_DEVICE_MANAGER, IMPORT_PINCODE_3RD,
     GENERATE_PINCODE_3RD, AUTH_PINCODE_3RD, AUTH_DEVICE_3RD, SAVE_TRUST_RELATION_3RD, QUERY_TRUST_RELATION_3RD,
@@ -65,6 +68,18 @@ constexpr const char* LIB_IPC_SERVICE_STUB_3RD_NAME = "libdevicemanager3rdservic
 
 constexpr const char* RECLAIM_MEMMGR_FILE_MEM_FOR_DMTASK = "ReclaimMemmgrFileMemForDMTask";
 constexpr const char* START_DETECT_DEVICE_RISK_TASK = "StartDetectDeviceRiskTask";
+constexpr const char* INIT_HICHAIN_LISTENER_TASK = "InitHichainListenerTask";
+
+// Service init stages, see IpcServerStub::Init for the dependencies.
+constexpr const char* STAGE_SOFTBUS_LISTENER = "SoftbusListener";
+constexpr const char* STAGE_SOFTBUS_CACHE = "SoftbusCache";
+constexpr const char* STAGE_KV_STORE = "KvStore";
+constexpr const char* STAGE_IMPL_PRELOAD = "ImplPreload";
+constexpr const char* STAGE_RESIDENT_INIT = "ResidentInit";
+constexpr const char* STAGE_COMMON_EVENT = "CommonEvent";
+constexpr const char* STAGE_SAVE_ONLINE_DEVICE = "SaveOnlineDevice";
+constexpr const char* STAGE_SERVICE_LISTENER = "ServiceListener";
+constexpr const char* STAGE_PUBLISH = "Publish";
 }
 
 DM_IMPLEMENT_SINGLE_INSTANCE(IpcServerStub);
@@ -167,7 +182,6 @@ std::string IpcServerStub::JoinPath(const std::string &prefixPath, const std::st
 //LCOV_EXCL_START
 void IpcServerStub::HandleSoftBusServerAdd()
 {
-    DeviceManagerService::GetInstance().InitSoftbusListener();
     if (!Init()) {
         LOGE("failed to init IpcServerStub");
         state_ = ServiceRunningState::STATE_NOT_START;
@@ -215,12 +229,9 @@ void IpcServerStub::OnAddSystemAbility(int32_t systemAbilityId, const std::strin
         return;
     }
 
-    if (systemAbilityId == DEVICE_AUTH_SERVICE_ID) {
-        DeviceManagerService::GetInstance().InitHichainListener();
-        return;
-    }
-    if (systemAbilityId == ACCESS_TOKEN_MANAGER_SERVICE_ID) {
-        DeviceManagerService::GetInstance().InitHichainListener();
+    if (systemAbilityId == DEVICE_AUTH_SERVICE_ID || systemAbilityId == ACCESS_TOKEN_MANAGER_SERVICE_ID) {
+        ffrt::submit([=]() { DeviceManagerService::GetInstance().InitHichainListener(); },
+            ffrt::task_attr().name(INIT_HICHAIN_LISTENER_TASK));
         return;
     }
     if (systemAbilityId == RISK_ANALYSIS_MANAGER_SA_ID) {
@@ -237,6 +248,13 @@ void IpcServerStub::OnRemoveSystemAbility(int32_t systemAbilityId, const std::st
         DeviceManagerService::GetInstance().UninitSoftbusListener();
         // call notify service offline
         DeviceManagerService::GetInstance().HandleServiceStatusChange(DmDeviceState::DEVICE_STATE_OFFLINE, deviceId);
+        return;
+    }
+    if (systemAbilityId == DEVICE_AUTH_SERVICE_ID) {
+        // The hichain change callbacks died with the service, nothing would invalidate the cached results.
+        // Re-registering the callbacks on restart enables the caches again.
+        HichainGroupCache::GetInstance().SetGroupCacheEnabled(false);
+        HichainGroupCache::GetInstance().SetCredentialCacheEnabled(false);
     }
 }
 
@@ -244,8 +262,36 @@ void IpcServerStub::OnRemoveSystemAbility(int32_t systemAbilityId, const std::st
 bool IpcServerStub::Init()
 {
     LOGI("ready to init.");
-    KVAdapterManager::GetInstance().Init();
-    DeviceManagerService::GetInstance().InitDMServiceListener();
+    DeviceManagerService::GetInstance().CreateServiceListener();
+    bool published = false;
+    DmInitStageGraph graph;
+    graph.AddStage(STAGE_SOFTBUS_LISTENER, {},
+        []() { DeviceManagerService::GetInstance().CreateSoftbusListener(); });
+    graph.AddStage(STAGE_SOFTBUS_CACHE, {}, []() { SoftbusCache::GetInstance().UpdateDeviceInfoCache(); });
+    graph.AddStage(STAGE_KV_STORE, {}, []() { KVAdapterManager::GetInstance().Init(); });
+    graph.AddStage(STAGE_IMPL_PRELOAD, {}, []() { DeviceManagerService::GetInstance().PreloadDMServiceImpl(); });
+    // Same order as the serial init: resident init after the softbus listener is registered, and the
+    // service listener after the kv store is ready.
+    graph.AddStage(STAGE_RESIDENT_INIT, { STAGE_SOFTBUS_LISTENER },
+        []() { DeviceManagerService::GetInstance().InitSoftbusServerResident(); });
+    graph.AddStage(STAGE_COMMON_EVENT, { STAGE_SOFTBUS_LISTENER },
+        []() { DeviceManagerService::GetInstance().SubscribeSoftbusCommonEvent(); });
+    graph.AddStage(STAGE_SAVE_ONLINE_DEVICE, { STAGE_SOFTBUS_CACHE, STAGE_IMPL_PRELOAD },
+        []() { DeviceManagerService::GetInstance().SaveOnlineDeviceInfo(); });
+    graph.AddStage(STAGE_SERVICE_LISTENER, { STAGE_SOFTBUS_LISTENER, STAGE_RESIDENT_INIT, STAGE_KV_STORE },
+        []() { DeviceManagerService::GetInstance().InitDMServiceListener(); });
+    // The implementation library and the online device snapshot are not needed to serve the first IPC.
+    graph.AddStage(STAGE_PUBLISH, { STAGE_SERVICE_LISTENER, STAGE_SOFTBUS_CACHE, STAGE_KV_STORE },
+        [this, &published]() { published = PublishService(); });
+    if (graph.Run() != DM_OK) {
+        LOGE("run init stages failed.");
+        return false;
+    }
+    return published;
+}
+
+bool IpcServerStub::PublishService()
+{
     std::lock_guard<ffrt::mutex> autoLock(registerLock_);
     if (!registerToService_) {
         bool ret = Publish(this);
@@ -325,6 +371,11 @@ int32_t IpcServerStub::OnRemoteRequest(uint32_t code, MessageParcel &data, Messa
         LOGI("ReadInterfaceToken fail!");
         return ERR_DM_IPC_READ_FAILED;
     }
+    IpcCmdAdmissionGuard admissionGuard(cmdAdmission_, IpcCmdAdmission::GetLane(static_cast<int32_t>(code)));
+    if (admissionGuard.GetResult() != DM_OK) {
+        LOGW("code: %{public}d rejected by admission.", code);
+        return admissionGuard.GetResult();
+    }
     int32_t ret = IpcCmdRegister::GetInstance().OnIpcCmd(static_cast<int32_t>(code), data, reply);
     if (ret == ERR_DM_UNSUPPORTED_IPC_COMMAND) {
         LOGW("unsupported code: %{public}d", code);
@@ -371,34 +422,49 @@ int32_t IpcServerStub::RegisterDeviceManagerListener(const ProcessInfo &processI
     int pid = getpid();
     Memory::MemMgrClient::GetInstance().SetCritical(pid, true, DISTRIBUTED_HARDWARE_DEVICEMANAGER_SA_ID);
 #endif // SUPPORT_MEMMGR
-    std::lock_guard<ffrt::mutex> autoLock(listenerLock_);
-    auto iter = dmListener_.find(processInfo);
-    if (iter != dmListener_.end()) {
-        LOGI("Listener already exists");
-        auto recipientIter = appRecipient_.find(processInfo);
-        if (recipientIter == appRecipient_.end()) {
-            LOGI("AppRecipient not exists");
-            dmListener_.erase(processInfo);
-        } else {
-            auto listener = iter->second;
-            auto appRecipient = recipientIter->second;
-            listener->AsObject()->RemoveDeathRecipient(appRecipient);
-            appRecipient_.erase(processInfo);
-            dmListener_.erase(processInfo);
-        }
-    }
+    // Death recipients are binder calls, keep them out of the lock callback delivery waits on.
     sptr<AppDeathRecipient> appRecipient = sptr<AppDeathRecipient>(new AppDeathRecipient());
     LOGI("Add death recipient.");
     if (!listener->AsObject()->AddDeathRecipient(appRecipient)) {
         LOGE("AddDeathRecipient Failed");
     }
-    if (dmListener_.size() > MAX_CALLBACK_NUM || appRecipient_.size() > MAX_CALLBACK_NUM) {
-        LOGE("dmListener_ or appRecipient_ size exceed the limit!");
-        return ERR_DM_FAILED;
+    sptr<IpcRemoteBroker> oldListener = nullptr;
+    sptr<AppDeathRecipient> oldRecipient = nullptr;
+    int32_t ret = DM_OK;
+    {
+        std::unique_lock<std::shared_mutex> autoLock(listenerLock_);
+        auto iter = dmListener_.find(processInfo);
+        if (iter != dmListener_.end()) {
+            LOGI("Listener already exists");
+            oldListener = iter->second;
+            auto recipientIter = appRecipient_.find(processInfo);
+            if (recipientIter == appRecipient_.end()) {
+                LOGI("AppRecipient not exists");
+                oldListener = nullptr;
+            } else {
+                oldRecipient = recipientIter->second;
+                appRecipient_.erase(recipientIter);
+            }
+            RemoveListenerIndex(processInfo, iter->second);
+            dmListener_.erase(iter);
+        }
+        if (dmListener_.size() > MAX_CALLBACK_NUM || appRecipient_.size() > MAX_CALLBACK_NUM) {
+            LOGE("dmListener_ or appRecipient_ size exceed the limit!");
+            ret = ERR_DM_FAILED;
+        } else {
+            dmListener_[processInfo] = listener;
+            appRecipient_[processInfo] = appRecipient;
+            AddListenerIndex(processInfo, listener);
+            AddSystemSA(processInfo.pkgName);
+        }
+    }
+    if (oldListener != nullptr && oldListener->AsObject() != nullptr) {
+        oldListener->AsObject()->RemoveDeathRecipient(oldRecipient);
+    }
+    if (ret != DM_OK) {
+        listener->AsObject()->RemoveDeathRecipient(appRecipient);
+        return ret;
     }
-    dmListener_[processInfo] = listener;
-    appRecipient_[processInfo] = appRecipient;
-    AddSystemSA(processInfo.pkgName);
     LOGI("complete.");
     return DM_OK;
 }
@@ -410,39 +476,72 @@ int32_t IpcServerStub::UnRegisterDeviceManagerListener(const ProcessInfo &proces
         LOGE("Invalid parameter, pkgName is empty.");
         return ERR_DM_INPUT_PARA_INVALID;
     }
-    std::lock_guard<ffrt::mutex> autoLock(listenerLock_);
-    auto listenerIter = dmListener_.find(processInfo);
-    if (listenerIter == dmListener_.end()) {
-        LOGI("Listener not exists");
-        return DM_OK;
-    }
-    auto recipientIter = appRecipient_.find(processInfo);
-    if (recipientIter == appRecipient_.end()) {
-        LOGI("AppRecipient not exists");
-        dmListener_.erase(processInfo);
-        return DM_OK;
-    }
-    auto listener = listenerIter->second;
-    auto appRecipient = recipientIter->second;
-    listener->AsObject()->RemoveDeathRecipient(appRecipient);
-    appRecipient_.erase(processInfo);
-    dmListener_.erase(processInfo);
+    sptr<IpcRemoteBroker> listener = nullptr;
+    sptr<AppDeathRecipient> appRecipient = nullptr;
+    bool isEmpty = false;
+    {
+        std::unique_lock<std::shared_mutex> autoLock(listenerLock_);
+        auto listenerIter = dmListener_.find(processInfo);
+        if (listenerIter == dmListener_.end()) {
+            LOGI("Listener not exists");
+            return DM_OK;
+        }
+        listener = listenerIter->second;
+        RemoveListenerIndex(processInfo, listener);
+        dmListener_.erase(listenerIter);
+        auto recipientIter = appRecipient_.find(processInfo);
+        if (recipientIter == appRecipient_.end()) {
+            LOGI("AppRecipient not exists");
+            return DM_OK;
+        }
+        appRecipient = recipientIter->second;
+        appRecipient_.erase(recipientIter);
+        isEmpty = dmListener_.empty();
+        RemoveSystemSA(processInfo.pkgName);
+    }
+    if (listener != nullptr && listener->AsObject() != nullptr) {
+        listener->AsObject()->RemoveDeathRecipient(appRecipient);
+    }
 #ifdef SUPPORT_MEMMGR
-    if (dmListener_.size() == 0) {
+    if (isEmpty) {
         int pid = getpid();
         Memory::MemMgrClient::GetInstance().SetCritical(pid, false, DISTRIBUTED_HARDWARE_DEVICEMANAGER_SA_ID);
     }
+#else
+    (void)isEmpty;
 #endif // SUPPORT_MEMMGR
-    RemoveSystemSA(processInfo.pkgName);
     DeviceManagerService::GetInstance().RemoveNotifyRecord(processInfo);
     return DM_OK;
 }
 
+void IpcServerStub::AddListenerIndex(const ProcessInfo &processInfo, const sptr<IpcRemoteBroker> &listener)
+{
+    listenerIndex_[std::make_pair(processInfo.pkgName, processInfo.userId)].insert(processInfo);
+    if (listener != nullptr && listener->AsObject() != nullptr) {
+        remoteIndex_[listener->AsObject().GetRefPtr()] = processInfo;
+    }
+}
+
+void IpcServerStub::RemoveListenerIndex(const ProcessInfo &processInfo, const sptr<IpcRemoteBroker> &listener)
+{
+    auto indexIter = listenerIndex_.find(std::make_pair(processInfo.pkgName, processInfo.userId));
+    if (indexIter != listenerIndex_.end()) {
+        indexIter->second.erase(processInfo);
+        if (indexIter->second.empty()) {
+            listenerIndex_.erase(indexIter);
+        }
+    }
+    if (listener != nullptr && listener->AsObject() != nullptr) {
+        remoteIndex_.erase(listener->AsObject().GetRefPtr());
+    }
+}
+
 //LCOV_EXCL_START
 std::vector<ProcessInfo> IpcServerStub::GetAllProcessInfo()
 {
     std::vector<ProcessInfo> processInfoVec;
-    std::lock_guard<ffrt::mutex> autoLock(listenerLock_);
+    std::shared_lock<std::shared_mutex> autoLock(listenerLock_);
+    processInfoVec.reserve(dmListener_.size());
     for (const auto &iter : dmListener_) {
         processInfoVec.push_back(iter.first);
     }
@@ -457,12 +556,20 @@ const sptr<IpcRemoteBroker> IpcServerStub::GetListenerByProcessInfo(ProcessInfo
         LOGE("Invalid parameter, pkgName is empty.");
         return nullptr;
     }
-    std::lock_guard<ffrt::mutex> autoLock(listenerLock_);
-    for (auto &iter : dmListener_) {
-        if ((iter.first.tokenId == processInfo.tokenId || processInfo.tokenId == 0) &&
-            iter.first.pkgName == processInfo.pkgName) {
-            LOGI("tokenId %{public}" PRIu32", pkgName %{public}s.", processInfo.tokenId, processInfo.pkgName.c_str());
-            return iter.second;
+    std::shared_lock<std::shared_mutex> autoLock(listenerLock_);
+    // Any userId matches here, walk the groups of this pkgName only.
+    for (auto indexIter = listenerIndex_.lower_bound(std::make_pair(processInfo.pkgName, INT32_MIN));
+        indexIter != listenerIndex_.end() && indexIter->first.first == processInfo.pkgName; ++indexIter) {
+        for (const auto &item : indexIter->second) {
+            if (item.tokenId != processInfo.tokenId && processInfo.tokenId != 0) {
+                continue;
+            }
+            auto iter = dmListener_.find(item);
+            if (iter != dmListener_.end()) {
+                LOGI("tokenId %{public}" PRIu32", pkgName %{public}s.", processInfo.tokenId,
+                    processInfo.pkgName.c_str());
+                return iter->second;
+            }
         }
     }
     return nullptr;
@@ -475,10 +582,15 @@ const sptr<IpcRemoteBroker> IpcServerStub::GetDmListener(ProcessInfo processInfo
         LOGE("Invalid parameter, pkgName is empty.");
         return nullptr;
     }
-    std::lock_guard<ffrt::mutex> autoLock(listenerLock_);
-    for (auto &iter : dmListener_) {
-        if (iter.first == processInfo) {
-            return iter.second;
+    std::shared_lock<std::shared_mutex> autoLock(listenerLock_);
+    auto indexIter = listenerIndex_.find(std::make_pair(processInfo.pkgName, processInfo.userId));
+    if (indexIter == listenerIndex_.end()) {
+        return nullptr;
+    }
+    for (const auto &item : indexIter->second) {
+        if (item == processInfo) {
+            auto iter = dmListener_.find(item);
+            return iter != dmListener_.end() ? iter->second : nullptr;
         }
     }
     return nullptr;
@@ -487,12 +599,14 @@ const sptr<IpcRemoteBroker> IpcServerStub::GetDmListener(ProcessInfo processInfo
 const ProcessInfo IpcServerStub::GetDmListenerPkgName(const wptr<IRemoteObject> &remote) const
 {
     ProcessInfo processInfo;
-    std::lock_guard<ffrt::mutex> autoLock(listenerLock_);
-    for (const auto &iter : dmListener_) {
-        if ((iter.second)->AsObject() == remote.promote()) {
-            processInfo = iter.first;
-            break;
-        }
+    sptr<IRemoteObject> remoteObject = remote.promote();
+    if (remoteObject == nullptr) {
+        return processInfo;
+    }
+    std::shared_lock<std::shared_mutex> autoLock(listenerLock_);
+    auto iter = remoteIndex_.find(remoteObject.GetRefPtr());
+    if (iter != remoteIndex_.end()) {
+        processInfo = iter->second;
     }
     return processInfo;
 }
@@ -549,7 +663,7 @@ void IpcServerStub::RemoveSystemSA(const std::string &pkgName)
 //LCOV_EXCL_START
 std::set<std::string> IpcServerStub::GetSystemSA()
 {
-    std::lock_guard<ffrt::mutex> autoLock(listenerLock_);
+    std::shared_lock<std::shared_mutex> autoLock(listenerLock_);
     std::set<std::string> systemSA;
     for (const auto &item : systemSA_) {
         systemSA.insert(item);
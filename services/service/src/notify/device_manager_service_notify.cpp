@@ -31,6 +31,7 @@ const static std::map<DmCommonNotifyEvent, DmCommonNotifyEvent> unRegNotifyEvent
     {DmCommonNotifyEvent::UN_REG_CREDENTIAL_AUTH_STATUS_NOTIFY, DmCommonNotifyEvent::REG_CREDENTIAL_AUTH_STATUS_NOTIFY},
     {DmCommonNotifyEvent::UN_REG_AUTH_CODE_INVALID, DmCommonNotifyEvent::REG_AUTH_CODE_INVALID},
     {DmCommonNotifyEvent::UN_REG_SERVICE_STATE, DmCommonNotifyEvent::REG_SERVICE_STATE},
+    {DmCommonNotifyEvent::UN_REG_LOCAL_DEVICE_NAME_CHANGE, DmCommonNotifyEvent::REG_LOCAL_DEVICE_NAME_CHANGE},
 };
 
 const static std::set<DmCommonNotifyEvent> regNotifyEventSet_ = {
@@ -40,13 +41,22 @@ const static std::set<DmCommonNotifyEvent> regNotifyEventSet_ = {
     DmCommonNotifyEvent::REG_CREDENTIAL_AUTH_STATUS_NOTIFY,
     DmCommonNotifyEvent::REG_AUTH_CODE_INVALID,
     DmCommonNotifyEvent::REG_SERVICE_STATE,
+    DmCommonNotifyEvent::REG_LOCAL_DEVICE_NAME_CHANGE,
+};
+
+// The notify carries no data, so apps that may only read the local device name can subscribe.
+const static std::set<DmCommonNotifyEvent> noPermissionNotifyEventSet_ = {
+    DmCommonNotifyEvent::REG_LOCAL_DEVICE_NAME_CHANGE,
+    DmCommonNotifyEvent::UN_REG_LOCAL_DEVICE_NAME_CHANGE,
 };
 }
 
 int32_t DeviceManagerServiceNotify::RegisterCallBack(int32_t dmCommonNotifyEvent, const ProcessInfo &processInfo)
 {
     LOGI("start event %{public}d pkgName: %{public}s.", dmCommonNotifyEvent, processInfo.pkgName.c_str());
-    if (!PermissionManager::GetInstance().CheckDataSyncPermission() &&
+    DmCommonNotifyEvent notifyEvent = static_cast<DmCommonNotifyEvent>(dmCommonNotifyEvent);
+    if (noPermissionNotifyEventSet_.find(notifyEvent) == noPermissionNotifyEventSet_.end() &&
+        !PermissionManager::GetInstance().CheckDataSyncPermission() &&
         !PermissionManager::GetInstance().CheckAccessServicePermission()) {
         LOGE("The caller does not have permission.");
         return ERR_DM_NO_PERMISSION;
@@ -55,7 +65,6 @@ int32_t DeviceManagerServiceNotify::RegisterCallBack(int32_t dmCommonNotifyEvent
         LOGE("Invalid parameter, pkgName is empty.");
         return ERR_DM_INPUT_PARA_INVALID;
     }
-    DmCommonNotifyEvent notifyEvent = static_cast<DmCommonNotifyEvent>(dmCommonNotifyEvent);
     std::lock_guard<std::mutex> autoLock(callbackLock_);
     if (unRegNotifyEventMap_.find(notifyEvent) != unRegNotifyEventMap_.end()) {
         if (callbackMap_.find(unRegNotifyEventMap_.at(notifyEvent)) == callbackMap_.end()) {
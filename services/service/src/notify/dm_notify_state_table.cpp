@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dm_notify_state_table.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+template <typename T>
+bool InsertSorted(std::vector<T> &ids, T id)
+{
+    auto iter = std::lower_bound(ids.begin(), ids.end(), id);
+    if (iter != ids.end() && *iter == id) {
+        return false;
+    }
+    ids.insert(iter, id);
+    return true;
+}
+
+template <typename T>
+bool EraseSorted(std::vector<T> &ids, T id)
+{
+    auto iter = std::lower_bound(ids.begin(), ids.end(), id);
+    if (iter == ids.end() || *iter != id) {
+        return false;
+    }
+    ids.erase(iter);
+    return true;
+}
+
+template <typename T>
+bool ContainsSorted(const std::vector<T> &ids, T id)
+{
+    return std::binary_search(ids.begin(), ids.end(), id);
+}
+}
+
+DmNotifyStateTable::ProcessKey DmNotifyStateTable::MakeProcessKey(const ProcessInfo &processInfo)
+{
+    return ProcessKey(processInfo.pkgName, processInfo.userId, processInfo.tokenId);
+}
+
+const DmNotifyStateTable::Id *DmNotifyStateTable::FindProcessId(const ProcessInfo &processInfo) const
+{
+    auto iter = processIds_.find(MakeProcessKey(processInfo));
+    return iter == processIds_.end() ? nullptr : &iter->second;
+}
+
+bool DmNotifyStateTable::Insert(const ProcessInfo &processInfo, const std::string &deviceId)
+{
+    Id processId = 0;
+    auto processIter = processIds_.find(MakeProcessKey(processInfo));
+    if (processIter == processIds_.end()) {
+        processId = nextId_++;
+        processIds_.emplace(MakeProcessKey(processInfo), processId);
+        ProcessInfo &stored = processes_[processId].processInfo;
+        stored.pkgName = processInfo.pkgName;
+        stored.userId = processInfo.userId;
+        stored.tokenId = processInfo.tokenId;
+        InsertSorted(pkgNameIndex_[processInfo.pkgName], processId);
+    } else {
+        processId = processIter->second;
+    }
+    Id devId = 0;
+    auto deviceIter = deviceIds_.find(deviceId);
+    if (deviceIter == deviceIds_.end()) {
+        devId = nextId_++;
+        deviceIds_.emplace(deviceId, devId);
+        devices_[devId].deviceId = deviceId;
+    } else {
+        devId = deviceIter->second;
+    }
+    if (!InsertSorted(processes_[processId].devices, devId)) {
+        return false;
+    }
+    InsertSorted(devices_[devId].processes, processId);
+    size_++;
+    return true;
+}
+
+bool DmNotifyStateTable::Contains(const ProcessInfo &processInfo, const std::string &deviceId) const
+{
+    const Id *processId = FindProcessId(processInfo);
+    auto deviceIter = deviceIds_.find(deviceId);
+    if (processId == nullptr || deviceIter == deviceIds_.end()) {
+        return false;
+    }
+    return ContainsSorted(processes_.at(*processId).devices, deviceIter->second);
+}
+
+bool DmNotifyStateTable::Erase(const ProcessInfo &processInfo, const std::string &deviceId)
+{
+    const Id *processId = FindProcessId(processInfo);
+    auto deviceIter = deviceIds_.find(deviceId);
+    if (processId == nullptr || deviceIter == deviceIds_.end()) {
+        return false;
+    }
+    Id devId = deviceIter->second;
+    Id procId = *processId;
+    if (!EraseSorted(processes_[procId].devices, devId)) {
+        return false;
+    }
+    Unlink(procId, devId);
+    size_--;
+    return true;
+}
+
+// Called once the device is gone from the process list, finishes the other side.
+void DmNotifyStateTable::Unlink(Id processId, Id deviceId)
+{
+    Device &device = devices_[deviceId];
+    EraseSorted(device.processes, processId);
+    if (device.processes.empty()) {
+        RemoveDevice(deviceId);
+    }
+    if (processes_[processId].devices.empty()) {
+        RemoveProcess(processId);
+    }
+}
+
+void DmNotifyStateTable::RemoveProcess(Id processId)
+{
+    auto iter = processes_.find(processId);
+    if (iter == processes_.end()) {
+        return;
+    }
+    const ProcessInfo &processInfo = iter->second.processInfo;
+    processIds_.erase(MakeProcessKey(processInfo));
+    auto pkgIter = pkgNameIndex_.find(processInfo.pkgName);
+    if (pkgIter != pkgNameIndex_.end()) {
+        EraseSorted(pkgIter->second, processId);
+        if (pkgIter->second.empty()) {
+            pkgNameIndex_.erase(pkgIter);
+        }
+    }
+    processes_.erase(iter);
+}
+
+void DmNotifyStateTable::RemoveDevice(Id deviceId)
+{
+    auto iter = devices_.find(deviceId);
+    if (iter == devices_.end()) {
+        return;
+    }
+    deviceIds_.erase(iter->second.deviceId);
+    devices_.erase(iter);
+}
+
+size_t DmNotifyStateTable::EraseDevice(const std::string &deviceId)
+{
+    auto deviceIter = deviceIds_.find(deviceId);
+    if (deviceIter == deviceIds_.end()) {
+        return 0;
+    }
+    Id devId = deviceIter->second;
+    std::vector<Id> processIds = std::move(devices_[devId].processes);
+    for (Id processId : processIds) {
+        Process &process = processes_[processId];
+        EraseSorted(process.devices, devId);
+        if (process.devices.empty()) {
+            RemoveProcess(processId);
+        }
+    }
+    RemoveDevice(devId);
+    size_ -= processIds.size();
+    return processIds.size();
+}
+
+size_t DmNotifyStateTable::EraseProcessById(Id processId)
+{
+    std::vector<Id> deviceIds = std::move(processes_[processId].devices);
+    for (Id devId : deviceIds) {
+        Device &device = devices_[devId];
+        EraseSorted(device.processes, processId);
+        if (device.processes.empty()) {
+            RemoveDevice(devId);
+        }
+    }
+    RemoveProcess(processId);
+    size_ -= deviceIds.size();
+    return deviceIds.size();
+}
+
+size_t DmNotifyStateTable::EraseProcess(const ProcessInfo &processInfo)
+{
+    const Id *processId = FindProcessId(processInfo);
+    if (processId == nullptr) {
+        return 0;
+    }
+    return EraseProcessById(*processId);
+}
+
+size_t DmNotifyStateTable::ErasePkgName(const std::string &pkgName)
+{
+    auto pkgIter = pkgNameIndex_.find(pkgName);
+    if (pkgIter == pkgNameIndex_.end()) {
+        return 0;
+    }
+    // Copied, erasing the last process of the package drops the index entry.
+    std::vector<Id> processIds = pkgIter->second;
+    size_t erased = 0;
+    for (Id processId : processIds) {
+        erased += EraseProcessById(processId);
+    }
+    return erased;
+}
+
+size_t DmNotifyStateTable::EraseProcessIf(const std::function<bool(const ProcessInfo &)> &pred)
+{
+    std::vector<Id> processIds;
+    for (const auto &item : processes_) {
+        if (pred(item.second.processInfo)) {
+            processIds.push_back(item.first);
+        }
+    }
+    size_t erased = 0;
+    for (Id processId : processIds) {
+        erased += EraseProcessById(processId);
+    }
+    return erased;
+}
+
+std::vector<ProcessInfo> DmNotifyStateTable::GetProcesses() const
+{
+    std::vector<ProcessInfo> processInfos;
+    processInfos.reserve(processIds_.size());
+    for (const auto &item : processIds_) {
+        processInfos.push_back(processes_.at(item.second).processInfo);
+    }
+    return processInfos;
+}
+
+std::vector<std::string> DmNotifyStateTable::GetDevices(const ProcessInfo &processInfo) const
+{
+    std::vector<std::string> deviceIds;
+    const Id *processId = FindProcessId(processInfo);
+    if (processId == nullptr) {
+        return deviceIds;
+    }
+    const std::vector<Id> &devIds = processes_.at(*processId).devices;
+    deviceIds.reserve(devIds.size());
+    for (Id devId : devIds) {
+        deviceIds.push_back(devices_.at(devId).deviceId);
+    }
+    return deviceIds;
+}
+
+size_t DmNotifyStateTable::Size() const
+{
+    return size_;
+}
+
+bool DmNotifyStateTable::Empty() const
+{
+    return size_ == 0;
+}
+
+size_t DmNotifyStateTable::GetProcessNum() const
+{
+    return processes_.size();
+}
+
+size_t DmNotifyStateTable::GetDeviceNum() const
+{
+    return devices_.size();
+}
+
+void DmNotifyStateTable::Clear()
+{
+    processIds_.clear();
+    deviceIds_.clear();
+    processes_.clear();
+    devices_.clear();
+    pkgNameIndex_.clear();
+    size_ = 0;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
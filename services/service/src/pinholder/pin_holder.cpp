@@ -18,6 +18,7 @@
 #include "dm_anonymous.h"
 #include "dm_crypto.h"
 #include "dm_log.h"
+#include "dm_perf_stats.h"
 #include "dm_radar_helper.h"
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
 #include "multiple_user_connector.h"
@@ -40,6 +41,10 @@ constexpr int32_t MSG_TYPE_PIN_CLOSE_SESSION = 800;
 
 constexpr const char* PINHOLDER_CREATE_TIMEOUT_TASK = "deviceManagerTimer:pinholdercreate";
 constexpr int32_t PIN_HOLDER_SESSION_CREATE_TIMEOUT = 60;
+constexpr const char* PINHOLDER_SESSION_IDLE_TIMEOUT_TASK = "deviceManagerTimer:pinholdersessionidle";
+// The source closes an idle session first, the sink only waits longer in case that close is lost.
+constexpr int32_t PIN_HOLDER_SESSION_IDLE_TIMEOUT = 30;
+constexpr int32_t PIN_HOLDER_SINK_SESSION_IDLE_TIMEOUT = 2 * PIN_HOLDER_SESSION_IDLE_TIMEOUT;
 
 constexpr const char* TAG_PIN_TYPE = "PIN_TYPE";
 constexpr const char* TAG_PAYLOAD = "PAYLOAD";
@@ -66,6 +71,15 @@ PinHolder::PinHolder(std::shared_ptr<IDeviceManagerServiceListener> listener): l
     }
     sinkState_ = SINK_INIT;
     sourceState_ = SOURCE_INIT;
+    processMsgFuncMap_ = {
+        {MSG_TYPE_PIN_CLOSE_SESSION, &PinHolder::ProcessCloseSessionMsg},
+        {MSG_TYPE_CREATE_PIN_HOLDER, &PinHolder::ProcessCreateMsg},
+        {MSG_TYPE_CREATE_PIN_HOLDER_RESP, &PinHolder::ProcessCreateRespMsg},
+        {MSG_TYPE_DESTROY_PIN_HOLDER, &PinHolder::ProcessDestroyMsg},
+        {MSG_TYPE_DESTROY_PIN_HOLDER_RESP, &PinHolder::ProcessDestroyResMsg},
+        {MSG_TYPE_PIN_HOLDER_CHANGE, &PinHolder::ProcessChangeMsg},
+        {MSG_TYPE_PIN_HOLDER_CHANGE_RESP, &PinHolder::ProcessChangeRespMsg},
+    };
 }
 
 PinHolder::~PinHolder()
@@ -74,6 +88,7 @@ PinHolder::~PinHolder()
         timer_->DeleteAll();
         timer_ = nullptr;
     }
+    CloseIdleSession();
 }
 
 int32_t PinHolder::RegisterPinHolderCallback(const std::string &pkgName)
@@ -99,6 +114,7 @@ int32_t PinHolder::UnRegisterPinHolderCallback(const std::string &pkgName)
         LOGE("session is nullptr.");
         return ERR_DM_FAILED;
     }
+    CloseIdleSession();
     session_->UnRegisterSessionCallback();
     LOGI("success.");
     return DM_OK;
@@ -125,13 +141,25 @@ int32_t PinHolder::CreatePinHolder(const std::string &pkgName,
         LOGE("state is %{public}d.", sourceState_);
         return ERR_DM_FAILED;
     }
+    std::string peerKey = GetPeerKey(targetId);
+    if (isSessionIdle_ && peerKey != sessionPeerKey_) {
+        CloseIdleSession();
+    }
     if (sessionId_ != SESSION_ID_INVALID) {
-        LOGI("session already create, sessionId: %{public}d.", sessionId_);
+        if (isSessionIdle_) {
+            LOGI("reuse idle session, sessionId: %{public}d.", sessionId_);
+            ResumeIdleSession();
+        } else {
+            LOGI("session already create, sessionId: %{public}d.", sessionId_);
+        }
+        pinType_ = pinType;
+        payload_ = payload;
         CreateGeneratePinHolderMsg();
         return DM_OK;
     }
 
     sessionId_ = session_->OpenSessionServer(targetId);
+    DM_PERF_COUNT(DmPerfCounter::PIN_HOLDER_SESSION_OPEN);
     int32_t stageRes =
         sessionId_ > 0 ? static_cast<int32_t>(StageRes::STAGE_SUCC) : static_cast<int32_t>(StageRes::STAGE_FAIL);
     DmRadarHelper::GetInstance().ReportCreatePinHolder(
@@ -144,6 +172,7 @@ int32_t PinHolder::CreatePinHolder(const std::string &pkgName,
         sessionId_ = SESSION_ID_INVALID;
         return sessionId_;
     }
+    sessionPeerKey_ = peerKey;
     pinType_ = pinType;
     payload_ = payload;
     return DM_OK;
@@ -166,7 +195,7 @@ int32_t PinHolder::DestroyPinHolder(const std::string &pkgName, const PeerTarget
         LOGE("targetId is invalid.");
         return ret;
     }
-    if (sessionId_ == SESSION_ID_INVALID) {
+    if (sessionId_ == SESSION_ID_INVALID || isSessionIdle_) {
         LOGI("session already destroy.");
         listener_->OnDestroyResult(processInfo_, ret);
         listener_->OnPinHolderEvent(processInfo_, DmPinHolderEvent::DESTROY_RESULT, ret, "");
@@ -235,22 +264,35 @@ int32_t PinHolder::CreateGeneratePinHolderMsg()
     return ret;
 }
 
-int32_t PinHolder::ParseMsgType(const std::string &message)
+int32_t PinHolder::ParsePinHolderMsg(const std::string &message, PinHolderMsg &msg)
 {
     JsonObject jsonObject(message);
     if (jsonObject.IsDiscarded()) {
         LOGE("DecodeRequest jsonStr error");
         return ERR_DM_FAILED;
     }
+    msg.hasPinType = IsInt32(jsonObject, TAG_PIN_TYPE);
+    if (msg.hasPinType) {
+        msg.pinType = static_cast<DmPinType>(jsonObject[TAG_PIN_TYPE].Get<int32_t>());
+    }
+    msg.hasPayload = IsString(jsonObject, TAG_PAYLOAD);
+    if (msg.hasPayload) {
+        msg.payload = jsonObject[TAG_PAYLOAD].Get<std::string>();
+    }
+    msg.hasReply = IsInt32(jsonObject, TAG_REPLY);
+    if (msg.hasReply) {
+        msg.reply = jsonObject[TAG_REPLY].Get<int32_t>();
+    }
+    msg.hasVersion = jsonObject.Contains(TAG_DM_VERSION);
     if (!IsInt32(jsonObject, TAG_MSG_TYPE)) {
         LOGE("err json string.");
         return ERR_DM_FAILED;
     }
-    int32_t msgType = jsonObject[TAG_MSG_TYPE].Get<int32_t>();
-    return msgType;
+    msg.msgType = jsonObject[TAG_MSG_TYPE].Get<int32_t>();
+    return DM_OK;
 }
 
-void PinHolder::ProcessCloseSessionMsg(const std::string &message)
+void PinHolder::ProcessCloseSessionMsg(const PinHolderMsg &msg)
 {
     if (listener_ == nullptr || session_ == nullptr) {
         LOGE("listener or session is nullptr.");
@@ -259,29 +301,26 @@ void PinHolder::ProcessCloseSessionMsg(const std::string &message)
     LOGI("CloseSessionMsg, message type is: %{public}d.", MSG_TYPE_PIN_CLOSE_SESSION);
     session_->CloseSessionServer(sessionId_);
     sessionId_ = SESSION_ID_INVALID;
+    sessionPeerKey_ = "";
+    isSessionIdle_ = false;
     sourceState_ = SOURCE_INIT;
     sinkState_ = SINK_INIT;
     listener_->OnCreateResult(processInfo_, ERR_DM_CREATE_PIN_HOLDER_BUSY);
 }
 
-void PinHolder::ProcessCreateMsg(const std::string &message)
+void PinHolder::ProcessCreateMsg(const PinHolderMsg &msg)
 {
     if (listener_ == nullptr || session_ == nullptr) {
         LOGE("listener or session is nullptr.");
         return;
     }
-    JsonObject jsonObject(message);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("DecodeRequest jsonStr error");
-        return;
-    }
-    if (!IsInt32(jsonObject, TAG_PIN_TYPE) || !IsString(jsonObject, TAG_PAYLOAD)) {
+    if (!msg.hasPinType || !msg.hasPayload) {
         LOGE("err json string.");
         return;
     }
-    DmPinType pinType = static_cast<DmPinType>(jsonObject[TAG_PIN_TYPE].Get<int32_t>());
-    std::string payload = jsonObject[TAG_PAYLOAD].Get<std::string>();
-    isRemoteSupported_ = jsonObject.Contains(TAG_DM_VERSION);
+    DmPinType pinType = msg.pinType;
+    const std::string &payload = msg.payload;
+    isRemoteSupported_ = msg.hasVersion;
     int32_t bizStage = static_cast<int32_t>(PinHolderStage::RECEIVE_CREATE_PIN_HOLDER_MSG);
     DmRadarHelper::GetInstance().ReportSendOrReceiveHolderMsg(bizStage, std::string("ProcessCreateMsg"), "");
     JsonObject jsonObj;
@@ -292,6 +331,9 @@ void PinHolder::ProcessCreateMsg(const std::string &message)
         jsonObj[TAG_REPLY] = REPLY_SUCCESS;
         sinkState_ = SINK_CREATE;
         sourceState_ = SOURCE_CREATE;
+        if (isSessionIdle_) {
+            ResumeIdleSession();
+        }
         listener_->OnPinHolderCreate(processInfo_, remoteDeviceId_, pinType, payload);
         JsonObject jsonContent;
         jsonContent[TAG_PIN_TYPE] = pinType;
@@ -302,28 +344,23 @@ void PinHolder::ProcessCreateMsg(const std::string &message)
     }
     jsonObj[TAG_DM_VERSION] = "";
 
-    std::string msg = jsonObj.Dump();
+    std::string message = jsonObj.Dump();
     LOGI("message type is: %{public}d.", MSG_TYPE_CREATE_PIN_HOLDER_RESP);
-    int32_t ret = session_->SendData(sessionId_, msg);
+    int32_t ret = session_->SendData(sessionId_, message);
     if (ret != DM_OK) {
         LOGE("[SOFTBUS]SendBytes failed, ret: %{public}d.", ret);
         return;
     }
 }
 
-void PinHolder::ProcessCreateRespMsg(const std::string &message)
+void PinHolder::ProcessCreateRespMsg(const PinHolderMsg &msg)
 {
-    JsonObject jsonObject(message);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("DecodeRequest jsonStr error.");
-        return;
-    }
-    if (!IsInt32(jsonObject, TAG_REPLY)) {
+    if (!msg.hasReply) {
         LOGE("err json string.");
         return;
     }
-    isRemoteSupported_ = jsonObject.Contains(TAG_DM_VERSION);
-    int32_t reply = jsonObject[TAG_REPLY].Get<int32_t>();
+    isRemoteSupported_ = msg.hasVersion;
+    int32_t reply = msg.reply;
     if (listener_ == nullptr || session_ == nullptr) {
         LOGE("listener or session is nullptr.");
         return;
@@ -339,29 +376,25 @@ void PinHolder::ProcessCreateRespMsg(const std::string &message)
         listener_->OnPinHolderEvent(processInfo_, DmPinHolderEvent::CREATE_RESULT, ERR_DM_FAILED, "");
         session_->CloseSessionServer(sessionId_);
         sessionId_ = SESSION_ID_INVALID;
+        sessionPeerKey_ = "";
         destroyState_ = STATE_REMOTE_WRONG;
         sourceState_ = SOURCE_INIT;
         sinkState_ = SINK_INIT;
     }
 }
 
-void PinHolder::ProcessDestroyMsg(const std::string &message)
+void PinHolder::ProcessDestroyMsg(const PinHolderMsg &msg)
 {
     if (listener_ == nullptr || session_ == nullptr) {
         LOGE("listener or session is nullptr.");
         return;
     }
-    JsonObject jsonObject(message);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("DecodeRequest jsonStr error.");
-        return;
-    }
-    if (!IsInt32(jsonObject, TAG_PIN_TYPE) || !IsString(jsonObject, TAG_PAYLOAD)) {
+    if (!msg.hasPinType || !msg.hasPayload) {
         LOGE("err json string.");
         return;
     }
-    DmPinType pinType = static_cast<DmPinType>(jsonObject[TAG_PIN_TYPE].Get<int32_t>());
-    std::string payload = jsonObject[TAG_PAYLOAD].Get<std::string>();
+    DmPinType pinType = msg.pinType;
+    const std::string &payload = msg.payload;
     int32_t bizStage = static_cast<int32_t>(PinHolderStage::RECEIVE_DESTROY_PIN_HOLDER_MSG);
     DmRadarHelper::GetInstance().ReportSendOrReceiveHolderMsg(bizStage, std::string("ProcessDestroyMsg"), "");
     JsonObject jsonObj;
@@ -381,11 +414,12 @@ void PinHolder::ProcessDestroyMsg(const std::string &message)
             listener_->OnPinHolderEvent(processInfo_, DmPinHolderEvent::DESTROY, DM_OK, content);
             isDestroy_.store(true);
         }
+        KeepSessionIdle(PIN_HOLDER_SINK_SESSION_IDLE_TIMEOUT);
     }
 
-    std::string msg = jsonObj.Dump();
+    std::string message = jsonObj.Dump();
     LOGI("message type is: %{public}d.", MSG_TYPE_DESTROY_PIN_HOLDER_RESP);
-    int32_t ret = session_->SendData(sessionId_, msg);
+    int32_t ret = session_->SendData(sessionId_, message);
     if (ret != DM_OK) {
         LOGE("[SOFTBUS]SendBytes failed, ret: %{public}d.", ret);
         return;
@@ -417,24 +451,21 @@ void PinHolder::CloseSession(const std::string &name)
     }
     destroyState_ = STATE_TIME_OUT;
     sessionId_ = SESSION_ID_INVALID;
+    sessionPeerKey_ = "";
+    isSessionIdle_ = false;
     sinkState_ = SINK_INIT;
     sourceState_ = SOURCE_INIT;
     remoteDeviceId_ = "";
     isRemoteSupported_ = false;
 }
 
-void PinHolder::ProcessDestroyResMsg(const std::string &message)
+void PinHolder::ProcessDestroyResMsg(const PinHolderMsg &msg)
 {
-    JsonObject jsonObject(message);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("DecodeRequest jsonStr error.");
-        return;
-    }
-    if (!IsInt32(jsonObject, TAG_REPLY)) {
+    if (!msg.hasReply) {
         LOGE("err json string.");
         return;
     }
-    int32_t reply = jsonObject[TAG_REPLY].Get<int32_t>();
+    int32_t reply = msg.reply;
     if (listener_ == nullptr || session_ == nullptr) {
         LOGE("listener or session is nullptr.");
         return;
@@ -444,63 +475,87 @@ void PinHolder::ProcessDestroyResMsg(const std::string &message)
         listener_->OnPinHolderEvent(processInfo_, DmPinHolderEvent::DESTROY_RESULT, DM_OK, "");
         sourceState_ = SOURCE_INIT;
         sinkState_ = SINK_INIT;
-        if (timer_ != nullptr) {
-            timer_->DeleteAll();
-        }
-    } else {
-        LOGE("remote state is wrong.");
-        listener_->OnDestroyResult(processInfo_, ERR_DM_FAILED);
-        listener_->OnPinHolderEvent(processInfo_, DmPinHolderEvent::DESTROY_RESULT, ERR_DM_FAILED, "");
-        sinkState_ = SINK_INIT;
-        sourceState_ = SOURCE_INIT;
+        KeepSessionIdle(PIN_HOLDER_SESSION_IDLE_TIMEOUT);
+        return;
+    }
+    LOGE("remote state is wrong.");
+    listener_->OnDestroyResult(processInfo_, ERR_DM_FAILED);
+    listener_->OnPinHolderEvent(processInfo_, DmPinHolderEvent::DESTROY_RESULT, ERR_DM_FAILED, "");
+    sinkState_ = SINK_INIT;
+    sourceState_ = SOURCE_INIT;
+    session_->CloseSessionServer(sessionId_);
+    sessionId_ = SESSION_ID_INVALID;
+    sessionPeerKey_ = "";
+    remoteDeviceId_ = "";
+}
+
+void PinHolder::KeepSessionIdle(int32_t timeout)
+{
+    LOGI("keep idle session, sessionId: %{public}d.", sessionId_);
+    isSessionIdle_ = true;
+    if (timer_ != nullptr) {
+        timer_->DeleteAll();
+        timer_->StartTimer(std::string(PINHOLDER_SESSION_IDLE_TIMEOUT_TASK), timeout,
+            [this] (std::string name) {
+                (void)name;
+                PinHolder::CloseIdleSession();
+            });
     }
+}
+
+void PinHolder::ResumeIdleSession()
+{
+    isSessionIdle_ = false;
+    isDestroy_.store(false);
+    destroyState_ = STATE_UNKNOW;
+    if (timer_ != nullptr) {
+        timer_->DeleteTimer(std::string(PINHOLDER_SESSION_IDLE_TIMEOUT_TASK));
+    }
+    DM_PERF_COUNT(DmPerfCounter::PIN_HOLDER_SESSION_REUSE);
+}
+
+void PinHolder::CloseIdleSession()
+{
+    if (!isSessionIdle_ || session_ == nullptr) {
+        return;
+    }
+    LOGI("close idle session, sessionId: %{public}d.", sessionId_);
     session_->CloseSessionServer(sessionId_);
+    isSessionIdle_ = false;
     sessionId_ = SESSION_ID_INVALID;
+    sessionPeerKey_ = "";
     remoteDeviceId_ = "";
+    isRemoteSupported_ = false;
+}
+
+std::string PinHolder::GetPeerKey(const PeerTargetId &targetId)
+{
+    return targetId.deviceId + "#" + targetId.brMac + "#" + targetId.bleMac + "#" + targetId.wifiIp + "#" +
+        std::to_string(targetId.wifiPort);
 }
 
 void PinHolder::OnDataReceived(int32_t sessionId, std::string message)
 {
-    int32_t msgType = ParseMsgType(message);
-    LOGI("msgType: %{public}d.", msgType);
+    PinHolderMsg msg;
+    (void)ParsePinHolderMsg(message, msg);
+    LOGI("msgType: %{public}d.", msg.msgType);
     int32_t sessionSide = GetSessionSide(sessionId);
     if (sessionSide == SESSION_SIDE_SERVER && sessionId != sessionId_) {
         LOGE("another session opened, close this sessionId: %{public}d.", sessionId);
         JsonObject jsonObj;
         jsonObj[TAG_MSG_TYPE] = MSG_TYPE_PIN_CLOSE_SESSION;
-        std::string msg = jsonObj.Dump();
-        int32_t ret = session_->SendData(sessionId, msg);
+        int32_t ret = session_->SendData(sessionId, jsonObj.Dump());
         if (ret != DM_OK) {
             LOGE("[SOFTBUS] SendBytes failed. ret: %{public}d.", ret);
             listener_->OnPinHolderEvent(processInfo_, DmPinHolderEvent::CREATE_RESULT, ERR_DM_FAILED, "");
         }
         return;
     }
-    switch (msgType) {
-        case MSG_TYPE_PIN_CLOSE_SESSION:
-            ProcessCloseSessionMsg(message);
-            break;
-        case MSG_TYPE_CREATE_PIN_HOLDER:
-            ProcessCreateMsg(message);
-            break;
-        case MSG_TYPE_CREATE_PIN_HOLDER_RESP:
-            ProcessCreateRespMsg(message);
-            break;
-        case MSG_TYPE_DESTROY_PIN_HOLDER:
-            ProcessDestroyMsg(message);
-            break;
-        case MSG_TYPE_DESTROY_PIN_HOLDER_RESP:
-            ProcessDestroyResMsg(message);
-            break;
-        case MSG_TYPE_PIN_HOLDER_CHANGE:
-            ProcessChangeMsg(message);
-            break;
-        case MSG_TYPE_PIN_HOLDER_CHANGE_RESP:
-            ProcessChangeRespMsg(message);
-            break;
-        default:
-            break;
+    auto iter = processMsgFuncMap_.find(msg.msgType);
+    if (iter == processMsgFuncMap_.end()) {
+        return;
     }
+    (this->*(iter->second))(msg);
 }
 
 void PinHolder::GetPeerDeviceId(int32_t sessionId, std::string &udidHash)
@@ -537,6 +592,9 @@ void PinHolder::OnSessionOpened(int32_t sessionId, int32_t sessionSide, int32_t
         std::string("OnSessionOpened"), std::string(peerDeviceId));
     if (sessionSide == SESSION_SIDE_SERVER) {
         LOGI("[SOFTBUS]onSesssionOpened success, side is sink. sessionId: %{public}d.", sessionId);
+        if (isSessionIdle_ && sessionId != sessionId_) {
+            CloseIdleSession();
+        }
         GetPeerDeviceId(sessionId, remoteDeviceId_);
         if (sessionId_ == SESSION_ID_INVALID) {
             sessionId_ = sessionId;
@@ -550,6 +608,7 @@ void PinHolder::OnSessionOpened(int32_t sessionId, int32_t sessionSide, int32_t
     }
     LOGE("[SOFTBUS]onSesssionOpened failed. sessionId: %{public}d.", sessionId);
     sessionId_ = SESSION_ID_INVALID;
+    sessionPeerKey_ = "";
     if (listener_ != nullptr) {
         listener_->OnCreateResult(processInfo_, result);
         listener_->OnPinHolderEvent(processInfo_, DmPinHolderEvent::CREATE_RESULT, result, "");
@@ -563,11 +622,21 @@ void PinHolder::OnSessionClosed(int32_t sessionId)
         return;
     }
     LOGI("[SOFTBUS]OnSessionClosed sessionId: %{public}d.", sessionId);
+    bool isSessionIdle = isSessionIdle_;
     sessionId_ = SESSION_ID_INVALID;
+    sessionPeerKey_ = "";
+    isSessionIdle_ = false;
     sinkState_ = SINK_INIT;
     sourceState_ = SOURCE_INIT;
     remoteDeviceId_ = "";
     isRemoteSupported_ = false;
+    if (timer_ != nullptr) {
+        timer_->DeleteAll();
+    }
+    if (isSessionIdle) {
+        // No exchange was running on it, nothing to report.
+        return;
+    }
     JsonObject jsonObj;
     jsonObj[DM_CONNECTION_DISCONNECTED] = true;
     std::string payload = jsonObj.Dump();
@@ -586,9 +655,6 @@ void PinHolder::OnSessionClosed(int32_t sessionId)
         }
         isDestroy_.store(true);
     }
-    if (timer_ != nullptr) {
-        timer_->DeleteAll();
-    }
     return;
 }
 
@@ -612,7 +678,7 @@ int32_t PinHolder::NotifyPinHolderEvent(const std::string &pkgName, const std::s
         LOGE("pkgName: %{public}s is not register callback.", pkgName.c_str());
         return ERR_DM_FAILED;
     }
-    if (sessionId_ == SESSION_ID_INVALID) {
+    if (sessionId_ == SESSION_ID_INVALID || isSessionIdle_) {
         LOGE("session invalid.");
         return ERR_DM_FAILED;
     }
@@ -648,22 +714,17 @@ int32_t PinHolder::NotifyPinHolderEvent(const std::string &pkgName, const std::s
     return ret;
 }
 
-void PinHolder::ProcessChangeMsg(const std::string &message)
+void PinHolder::ProcessChangeMsg(const PinHolderMsg &msg)
 {
     if (listener_ == nullptr || session_ == nullptr) {
         LOGE("listener or session is nullptr.");
         return;
     }
-    JsonObject jsonObject(message);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("DecodeRequest jsonStr error.");
-        return;
-    }
-    if (!IsInt32(jsonObject, TAG_PIN_TYPE)) {
+    if (!msg.hasPinType) {
         LOGE("err json string.");
         return;
     }
-    DmPinType pinType = static_cast<DmPinType>(jsonObject[TAG_PIN_TYPE].Get<int32_t>());
+    DmPinType pinType = msg.pinType;
 
     JsonObject jsonObj;
     jsonObj[TAG_MSG_TYPE] = MSG_TYPE_PIN_HOLDER_CHANGE_RESP;
@@ -684,27 +745,22 @@ void PinHolder::ProcessChangeMsg(const std::string &message)
         }
     }
 
-    std::string msg = jsonObj.Dump();
+    std::string message = jsonObj.Dump();
     LOGI("message type is: %{public}d.", MSG_TYPE_PIN_HOLDER_CHANGE_RESP);
-    int32_t ret = session_->SendData(sessionId_, msg);
+    int32_t ret = session_->SendData(sessionId_, message);
     if (ret != DM_OK) {
         LOGE("[SOFTBUS]SendBytes failed, ret: %{public}d.", ret);
         return;
     }
 }
 
-void PinHolder::ProcessChangeRespMsg(const std::string &message)
+void PinHolder::ProcessChangeRespMsg(const PinHolderMsg &msg)
 {
-    JsonObject jsonObject(message);
-    if (jsonObject.IsDiscarded()) {
-        LOGE("DecodeRequest jsonStr error.");
-        return;
-    }
-    if (!IsInt32(jsonObject, TAG_REPLY)) {
+    if (!msg.hasReply) {
         LOGE("err json string.");
         return;
     }
-    int32_t reply = jsonObject[TAG_REPLY].Get<int32_t>();
+    int32_t reply = msg.reply;
     if (listener_ == nullptr || session_ == nullptr) {
         LOGE("listener or session is nullptr.");
         return;
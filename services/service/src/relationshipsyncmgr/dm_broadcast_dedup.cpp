@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dm_broadcast_dedup.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+constexpr uint32_t BITS_PER_BYTE = 8;
+}
+
+void BroadCastDigest::Update(const void *data, size_t len)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < len; i++) {
+        hash_ ^= bytes[i];
+        hash_ *= FNV_PRIME;
+    }
+}
+
+void BroadCastDigest::Update(const std::string &value)
+{
+    Update(static_cast<uint64_t>(value.size()));
+    Update(value.data(), value.size());
+}
+
+void BroadCastDigest::Update(uint64_t value)
+{
+    for (size_t i = 0; i < sizeof(value); i++) {
+        hash_ ^= static_cast<uint8_t>(value >> (i * BITS_PER_BYTE));
+        hash_ *= FNV_PRIME;
+    }
+}
+
+BroadCastDedupSet::BroadCastDedupSet(int64_t windowSec, size_t maxSize)
+    : buckets_(static_cast<size_t>(windowSec > 0 ? windowSec : 1) + 1), maxSize_(maxSize)
+{
+}
+
+bool BroadCastDedupSet::CheckAndInsert(const BroadCastFingerprint &fingerprint, int64_t nowSec)
+{
+    Rotate(nowSec);
+    for (const auto &bucket : buckets_) {
+        if (bucket.find(fingerprint) != bucket.end()) {
+            return false;
+        }
+    }
+    if (Size() >= maxSize_) {
+        return true;
+    }
+    buckets_[currentIndex_].insert(fingerprint);
+    return true;
+}
+
+size_t BroadCastDedupSet::Size() const
+{
+    size_t size = 0;
+    for (const auto &bucket : buckets_) {
+        size += bucket.size();
+    }
+    return size;
+}
+
+void BroadCastDedupSet::Clear()
+{
+    for (auto &bucket : buckets_) {
+        bucket.clear();
+    }
+}
+
+void BroadCastDedupSet::Rotate(int64_t nowSec)
+{
+    if (nowSec <= currentSec_) {
+        return;
+    }
+    int64_t steps = nowSec - currentSec_;
+    currentSec_ = nowSec;
+    if (steps >= static_cast<int64_t>(buckets_.size())) {
+        Clear();
+        return;
+    }
+    for (int64_t i = 0; i < steps; i++) {
+        currentIndex_ = (currentIndex_ + 1) % buckets_.size();
+        buckets_[currentIndex_].clear();
+    }
+}
+} // namespace DistributedHardware
+} // namespace OHOS
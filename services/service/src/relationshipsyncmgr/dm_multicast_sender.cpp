@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dm_multicast_sender.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "dm_error_type.h"
+#include "dm_log.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr const char* MULTICAST_TASK = "DmMulticastSendTask";
+
+int64_t GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Shared with the workers, outlives Send() when a peer is still blocked at the deadline.
+struct MulticastState {
+    std::vector<std::string> networkIds;
+    DmPeerSendFunc sendFunc;
+    DmPeerLateResultFunc lateResultFunc;
+    int64_t deadlineMs = 0;
+    std::atomic<size_t> next {0};
+    ffrt::mutex mtx;
+    ffrt::condition_variable cv;
+    std::vector<DmPeerSendResult> results;
+    size_t finished = 0;
+    // Set once Send() took its copy of the results, later completions go to lateResultFunc.
+    bool isReturned = false;
+};
+
+void RunWorker(std::shared_ptr<MulticastState> state)
+{
+    size_t total = state->networkIds.size();
+    for (size_t index = state->next.fetch_add(1); index < total; index = state->next.fetch_add(1)) {
+        int64_t beginMs = GetSteadyTimeMs();
+        {
+            // Started under the lock, so Send() either sees the peer in flight or never sends to it.
+            std::lock_guard<ffrt::mutex> lock(state->mtx);
+            if (state->isReturned) {
+                continue;
+            }
+            if (beginMs >= state->deadlineMs) {
+                state->finished++;
+                state->cv.notify_all();
+                continue;
+            }
+            state->results[index].isInFlight = true;
+        }
+        int32_t result = state->sendFunc(state->networkIds[index]);
+        {
+            std::lock_guard<ffrt::mutex> lock(state->mtx);
+            if (!state->isReturned) {
+                state->results[index].result = result;
+                state->results[index].costMs = GetSteadyTimeMs() - beginMs;
+                state->results[index].isInFlight = false;
+                state->finished++;
+                state->cv.notify_all();
+                continue;
+            }
+        }
+        LOGI("late result: %{public}d, index: %{public}zu.", result, index);
+        if (state->lateResultFunc != nullptr) {
+            state->lateResultFunc(index, result);
+        }
+    }
+}
+}
+
+std::vector<DmPeerSendResult> DmMulticastSender::Send(const std::vector<std::string> &networkIds,
+    DmPeerSendFunc sendFunc, int64_t timeoutMs, uint32_t maxConcurrency, DmPeerLateResultFunc lateResultFunc)
+{
+    std::vector<DmPeerSendResult> results;
+    for (const auto &networkId : networkIds) {
+        results.push_back({ networkId, ERR_DM_TIME_OUT, 0 });
+    }
+    if (networkIds.empty()) {
+        return results;
+    }
+    if (sendFunc == nullptr || timeoutMs <= 0) {
+        LOGE("invalid param, timeoutMs: %{public}d.", static_cast<int32_t>(timeoutMs));
+        for (auto &item : results) {
+            item.result = ERR_DM_INPUT_PARA_INVALID;
+        }
+        return results;
+    }
+    auto state = std::make_shared<MulticastState>();
+    state->networkIds = networkIds;
+    state->sendFunc = sendFunc;
+    state->lateResultFunc = lateResultFunc;
+    state->deadlineMs = GetSteadyTimeMs() + timeoutMs;
+    state->results = results;
+    size_t workerNum = maxConcurrency == 0 ? 1 : maxConcurrency;
+    if (workerNum > networkIds.size()) {
+        workerNum = networkIds.size();
+    }
+    for (size_t i = 0; i < workerNum; i++) {
+        ffrt::submit([state]() { RunWorker(state); }, ffrt::task_attr().name(MULTICAST_TASK));
+    }
+    std::unique_lock<ffrt::mutex> lock(state->mtx);
+    int64_t remainMs = state->deadlineMs - GetSteadyTimeMs();
+    if (remainMs > 0) {
+        state->cv.wait_for(lock, std::chrono::milliseconds(remainMs),
+            [state] { return state->finished == state->networkIds.size(); });
+    }
+    results = state->results;
+    state->isReturned = true;
+    LOGI("peers: %{public}zu, finished: %{public}zu, success: %{public}zu.", results.size(), state->finished,
+        CountSuccess(results));
+    return results;
+}
+
+size_t DmMulticastSender::CountSuccess(const std::vector<DmPeerSendResult> &results)
+{
+    size_t count = 0;
+    for (const auto &item : results) {
+        if (item.result == DM_OK) {
+            count++;
+        }
+    }
+    return count;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
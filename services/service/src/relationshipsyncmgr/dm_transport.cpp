@@ -20,6 +20,7 @@
 #include "dm_comm_tool.h"
 #include "dm_constants.h"
 #include "dm_log.h"
+#include "dm_perf_stats.h"
 #include "dm_softbus_cache.h"
 #include "dm_transport_msg.h"
 #include "softbus_error_code.h"
@@ -435,7 +436,10 @@ int32_t DMTransport::StartSocketInner(const std::string &rmtNetworkId, int32_t &
         .dataType = DATA_TYPE_BYTES
     };
     OnSocketOpened(socket, peerSocketInfo);
-    sourceSocketIds_.insert(socket);
+    {
+        std::lock_guard<ffrt::mutex> lock(rmtSocketIdMtx_);
+        sourceSocketIds_.insert(socket);
+    }
     socketId = socket;
     return DM_OK;
 }
@@ -460,6 +464,7 @@ int32_t DMTransport::StopSocket(const std::string &rmtNetworkId)
 
 int32_t DMTransport::Send(const std::string &rmtNetworkId, const std::string &payload, int32_t socketId)
 {
+    DM_PERF_SCOPE(DmPerfOp::TRANSPORT_SEND);
     if (!IsIdLengthValid(rmtNetworkId) || !IsMessageLengthValid(payload)) {
         return ERR_DM_INPUT_PARA_INVALID;
     }
@@ -492,6 +497,7 @@ int32_t DMTransport::Send(const std::string &rmtNetworkId, const std::string &pa
     free(buf);
     if (ret != DM_OK) {
         LOGE("dsoftbus send error, ret: %{public}d", ret);
+        DM_PERF_COUNT(DmPerfCounter::TRANSPORT_SEND_FAILED);
         return ERR_DM_FAILED;
     }
     LOGI("Send payload success");
@@ -15,6 +15,8 @@
 
 #include "relationship_sync_mgr.h"
 
+#include <algorithm>
+#include <chrono>
 #include <ctime>
 #include <sstream>
 
@@ -126,6 +128,48 @@ namespace {
     const uint16_t ALL_USERID_NUM_MASK = 0b00111000;
     const uint32_t MAX_MEM_MALLOC_SIZE = 4 * 1024;
     const uint32_t MAX_USER_ID_NUM = 4;
+    /**
+     * @brief Versioned sync userid payload: the layout above with the 6th bit of the first byte set and
+     *        the sequence number appended after the broadcastId, both ignored by receivers of the layout
+     *        above. The 5th bit asks the peer to send its next user id list in full.
+     */
+    const int32_t USERID_VERSIONED_MASK_OFFSET = 5;
+    const int32_t USERID_RESYNC_MASK_OFFSET = 4;
+    /**
+     * @brief sync userid delta payload length 4 + 2 * entry num bytes
+     * |  1 byte  |  1 byte  | 1 byte |   2 bytes per entry   | 1 byte      |
+     * |  flags   | base seq |  seq   | changed/removed users | broadcastId |
+     *        The flags byte is laid out as for the full list. An entry holds the userid in its lower
+     *        14 bits, the 15th bit marks it removed and the 16th foreground.
+     */
+    const int32_t SYNC_USERID_DELTA_HEADER_LEN = 3;
+    const int32_t SYNC_USERID_DELTA_BASE_SEQ_INDEX = 1;
+    const int32_t SYNC_USERID_DELTA_SEQ_INDEX = 2;
+    const uint32_t SYNC_USERID_DELTA_MAX_ENTRY_NUM = 7;
+    const int32_t DELTA_USER_REMOVED_FLAG_OFFSET = 6;
+    const uint16_t DELTA_USER_ID_MASK = 0x3FFF;
+    const uint8_t DELTA_USER_HIGH_BYTE_MASK = 0x3F;
+    // Sequence numbers wrap, one less than half the range behind the current one counts as already seen.
+    const uint8_t USERID_SEQ_HALF_RANGE = 128;
+    const int32_t FINGERPRINT_BASE_SEQ_OFFSET = 8;
+    const int32_t FINGERPRINT_VERSIONED_OFFSET = 16;
+    const int32_t FINGERPRINT_RESYNC_OFFSET = 17;
+
+    // Serial number order of the wrapping 8 bit sequence: seq lies less than half the range ahead of ref.
+    bool IsUserIdSeqAfter(uint8_t seq, uint8_t ref)
+    {
+        return seq != ref && static_cast<uint8_t>(seq - ref) < USERID_SEQ_HALF_RANGE;
+    }
+
+    bool GetPayloadByte(const cJSON *payloadJson, int32_t index, uint8_t &value)
+    {
+        cJSON *payloadItem = cJSON_GetArrayItem(payloadJson, index);
+        if (payloadItem == nullptr || !cJSON_IsNumber(payloadItem)) {
+            return false;
+        }
+        value = static_cast<uint8_t>(payloadItem->valueint);
+        return true;
+    }
 }
 
 RelationShipChangeMsg::RelationShipChangeMsg() : type(RelationShipChangeType::TYPE_MAX),
@@ -203,6 +247,9 @@ bool RelationShipChangeMsg::ToBroadcastPayLoadTwo(uint8_t *&msg, uint32_t &len)
             ToAccountEventPayLoad(msg, len);
             ret = true;
             break;
+        case RelationShipChangeType::SYNC_USERID_DELTA:
+            ret = ToSyncUserIdDeltaPayLoad(msg, len);
+            break;
         default:
             LOGE("RelationShipChange type invalid");
             break;
@@ -342,6 +389,9 @@ bool RelationShipChangeMsg::FromBroadcastPayLoad(const cJSON *payloadJson, Relat
         case RelationShipChangeType::ACCOUNT_EVENT:
             ret = ParseAccountEventPayload(payloadJson);
             break;
+        case RelationShipChangeType::SYNC_USERID_DELTA:
+            ret = FromSyncUserIdDeltaPayLoad(payloadJson);
+            break;
         default:
             LOGE("RelationShipChange type invalid");
             break;
@@ -442,6 +492,14 @@ bool RelationShipChangeMsg::IsValid() const
         case RelationShipChangeType::ACCOUNT_EVENT:
             ret = (userId != UINT32_MAX);
             break;
+        case RelationShipChangeType::SYNC_USERID_DELTA:
+            ret = (static_cast<uint32_t>(userIdInfos.size() + removedUserIds.size()) <=
+                SYNC_USERID_DELTA_MAX_ENTRY_NUM) &&
+                std::all_of(userIdInfos.begin(), userIdInfos.end(),
+                    [](const UserIdInfo &info) { return info.userId <= DELTA_USER_ID_MASK; }) &&
+                std::all_of(removedUserIds.begin(), removedUserIds.end(),
+                    [](uint16_t removedUserId) { return removedUserId <= DELTA_USER_ID_MASK; });
+            break;
         default:
             ret = false;
             break;
@@ -456,7 +514,7 @@ bool RelationShipChangeMsg::IsChangeTypeValid()
         (type == RelationShipChangeType::DEL_USER) || (type == RelationShipChangeType::STOP_USER) ||
         (type == RelationShipChangeType::SERVICE_UNBIND) || (type == RelationShipChangeType::APP_UNINSTALL) ||
         (type == RelationShipChangeType::SERVICEINFO_UNREGISTER) ||
-        (type == RelationShipChangeType::ACCOUNT_EVENT);
+        (type == RelationShipChangeType::ACCOUNT_EVENT) || (type == RelationShipChangeType::SYNC_USERID_DELTA);
 }
 
 bool RelationShipChangeMsg::IsChangeTypeValid(uint32_t type)
@@ -471,7 +529,8 @@ bool RelationShipChangeMsg::IsChangeTypeValid(uint32_t type)
         (type == (uint32_t)RelationShipChangeType::SERVICE_UNBIND) ||
         (type == (uint32_t)RelationShipChangeType::APP_UNINSTALL) ||
         (type == (uint32_t)RelationShipChangeType::SERVICEINFO_UNREGISTER) ||
-        (type == (uint32_t)RelationShipChangeType::ACCOUNT_EVENT);
+        (type == (uint32_t)RelationShipChangeType::ACCOUNT_EVENT) ||
+        (type == (uint32_t)RelationShipChangeType::SYNC_USERID_DELTA);
 }
 
 void RelationShipChangeMsg::ToAccountLogoutPayLoad(uint8_t *&msg, uint32_t &len) const
@@ -610,6 +669,9 @@ bool RelationShipChangeMsg::ToSyncFrontOrBackUserIdPayLoad(uint8_t *&msg, uint32
     }
 
     len = (userIdNum + 1) * USERID_BYTES;
+    if (isUserIdVersioned) {
+        len += 1;
+    }
 
     if (len > INVALIED_PAYLOAD_SIZE) {
         LOGE("len too long");
@@ -624,10 +686,17 @@ bool RelationShipChangeMsg::ToSyncFrontOrBackUserIdPayLoad(uint8_t *&msg, uint32
     if (isNewEvent) {
         msg[0] |= 0x1 << IS_NEW_USER_SYNC_MASK_OFFSET;
     }
+    if (isUserIdVersioned) {
+        msg[0] |= 0x1 << USERID_VERSIONED_MASK_OFFSET;
+        if (needUserIdResync) {
+            msg[0] |= 0x1 << USERID_RESYNC_MASK_OFFSET;
+        }
+        msg[len - 1] = userIdSeq;
+    }
 
     msg[0] |= userIdNum;
     int32_t userIdIdx = 0;
-    for (uint32_t idx = 1; idx <=  (len - USERID_BYTES);) {
+    for (uint32_t idx = 1; idx <= userIdNum * USERID_BYTES;) {
         msg[idx] |= userIdInfos[userIdIdx].userId & 0xFF;
         msg[idx + 1] |= (userIdInfos[userIdIdx].userId >> BITS_PER_BYTE) & 0xFF;
         if (userIdInfos[userIdIdx].isForeground) {
@@ -640,6 +709,49 @@ bool RelationShipChangeMsg::ToSyncFrontOrBackUserIdPayLoad(uint8_t *&msg, uint32
     return true;
 }
 
+bool RelationShipChangeMsg::ToSyncUserIdDeltaPayLoad(uint8_t *&msg, uint32_t &len) const
+{
+    uint32_t entryNum = static_cast<uint32_t>(userIdInfos.size() + removedUserIds.size());
+    if (entryNum > SYNC_USERID_DELTA_MAX_ENTRY_NUM) {
+        LOGE("entryNum too many, %{public}u", entryNum);
+        return false;
+    }
+    // The entry count field holds up to 7, the broadcast payload only fits 4 entries.
+    uint32_t payloadLen = SYNC_USERID_DELTA_HEADER_LEN + entryNum * USERID_BYTES + 1;
+    if (payloadLen > INVALIED_PAYLOAD_SIZE) {
+        LOGE("len too long, %{public}u", payloadLen);
+        return false;
+    }
+    len = payloadLen;
+    msg = new uint8_t[len]();
+    if (syncUserIdFlag) {
+        msg[0] |= 0x1 << NEED_RSP_MASK_OFFSET;
+    }
+    if (isNewEvent) {
+        msg[0] |= 0x1 << IS_NEW_USER_SYNC_MASK_OFFSET;
+    }
+    msg[0] |= entryNum;
+    msg[SYNC_USERID_DELTA_BASE_SEQ_INDEX] = baseUserIdSeq;
+    msg[SYNC_USERID_DELTA_SEQ_INDEX] = userIdSeq;
+    uint32_t idx = SYNC_USERID_DELTA_HEADER_LEN;
+    for (const auto &userIdInfo : userIdInfos) {
+        msg[idx] = userIdInfo.userId & BYTE_MASK;
+        msg[idx + 1] = (userIdInfo.userId >> BITS_PER_BYTE) & DELTA_USER_HIGH_BYTE_MASK;
+        if (userIdInfo.isForeground) {
+            msg[idx + 1] |= 0x1 << FRONT_OR_BACK_USER_FLAG_OFFSET;
+        }
+        idx += USERID_BYTES;
+    }
+    for (uint16_t removedUserId : removedUserIds) {
+        msg[idx] = removedUserId & BYTE_MASK;
+        msg[idx + 1] = (removedUserId >> BITS_PER_BYTE) & DELTA_USER_HIGH_BYTE_MASK;
+        msg[idx + 1] |= 0x1 << DELTA_USER_REMOVED_FLAG_OFFSET;
+        idx += USERID_BYTES;
+    }
+    msg[idx] = broadCastId;
+    return true;
+}
+
 void RelationShipChangeMsg::ToDelUserPayLoad(uint8_t *&msg, uint32_t &len) const
 {
     len = DEL_USER_PAYLOAD_LEN;
@@ -993,10 +1105,13 @@ bool RelationShipChangeMsg::FromSyncFrontOrBackUserIdPayLoad(const cJSON *payloa
     cJSON *payloadItem = cJSON_GetArrayItem(payloadJson, 0);
     CHECK_NULL_RETURN(payloadItem, false);
     uint32_t userIdNum = 0;
+    bool isVersioned = false;
     if (cJSON_IsNumber(payloadItem)) {
         uint8_t val = static_cast<uint8_t>(payloadItem->valueint);
         this->syncUserIdFlag = (((val >> NEED_RSP_MASK_OFFSET) & 0x1) == 0x1);
         this->isNewEvent = (((val >> IS_NEW_USER_SYNC_MASK_OFFSET) & 0x1) == 0x1);
+        isVersioned = (((val >> USERID_VERSIONED_MASK_OFFSET) & 0x1) == 0x1);
+        this->needUserIdResync = isVersioned && (((val >> USERID_RESYNC_MASK_OFFSET) & 0x1) == 0x1);
         userIdNum = ((static_cast<uint8_t>(payloadItem->valueint)) & FOREGROUND_USERID_LEN_MASK);
     }
 
@@ -1029,9 +1144,57 @@ bool RelationShipChangeMsg::FromSyncFrontOrBackUserIdPayLoad(const cJSON *payloa
             isForegroundUser = false;
         }
     }
+    if (isVersioned && GetPayloadByte(payloadJson, effectiveLen, this->userIdSeq)) {
+        this->isUserIdVersioned = true;
+    }
     return GetBroadCastId(payloadJson, userIdNum);
 }
 
+bool RelationShipChangeMsg::FromSyncUserIdDeltaPayLoad(const cJSON *payloadJson)
+{
+    if (payloadJson == NULL) {
+        LOGE("payloadJson is null.");
+        return false;
+    }
+    int32_t arraySize = cJSON_GetArraySize(payloadJson);
+    uint8_t val = 0;
+    if (arraySize <= SYNC_USERID_DELTA_HEADER_LEN || !GetPayloadByte(payloadJson, 0, val)) {
+        LOGE("Payload invalid, the size is %{public}d.", arraySize);
+        return false;
+    }
+    this->syncUserIdFlag = (((val >> NEED_RSP_MASK_OFFSET) & 0x1) == 0x1);
+    this->isNewEvent = (((val >> IS_NEW_USER_SYNC_MASK_OFFSET) & 0x1) == 0x1);
+    uint32_t entryNum = val & FOREGROUND_USERID_LEN_MASK;
+    int32_t broadCastIdx = static_cast<int32_t>(SYNC_USERID_DELTA_HEADER_LEN + entryNum * USERID_BYTES);
+    if (broadCastIdx + 1 != arraySize) {
+        LOGE("payload entryNum invalid, entryNum: %{public}u, arraySize: %{public}d", entryNum, arraySize);
+        return false;
+    }
+    if (!GetPayloadByte(payloadJson, SYNC_USERID_DELTA_BASE_SEQ_INDEX, this->baseUserIdSeq) ||
+        !GetPayloadByte(payloadJson, SYNC_USERID_DELTA_SEQ_INDEX, this->userIdSeq)) {
+        LOGE("Payload invalid, seq not integer");
+        return false;
+    }
+    for (int32_t idx = SYNC_USERID_DELTA_HEADER_LEN; idx < broadCastIdx; idx += USERID_BYTES) {
+        uint8_t lowByte = 0;
+        uint8_t highByte = 0;
+        if (!GetPayloadByte(payloadJson, idx, lowByte) || !GetPayloadByte(payloadJson, idx + 1, highByte)) {
+            LOGE("Payload invalid, user id not integer");
+            return false;
+        }
+        uint16_t deltaUserId = static_cast<uint16_t>(lowByte |
+            ((highByte & DELTA_USER_HIGH_BYTE_MASK) << BITS_PER_BYTE));
+        if (((highByte >> DELTA_USER_REMOVED_FLAG_OFFSET) & 0x1) == 0x1) {
+            this->removedUserIds.push_back(deltaUserId);
+            continue;
+        }
+        bool isForegroundUser = (((highByte & FRONT_OR_BACK_FLAG_MASK) >> FRONT_OR_BACK_USER_FLAG_OFFSET) == 0b1);
+        this->userIdInfos.push_back(UserIdInfo(isForegroundUser, deltaUserId));
+    }
+    this->isUserIdVersioned = true;
+    return GetPayloadByte(payloadJson, broadCastIdx, this->broadCastId);
+}
+
 bool RelationShipChangeMsg::FromDelUserPayLoad(const cJSON *payloadJson)
 {
     if (payloadJson == NULL) {
@@ -1239,13 +1402,34 @@ const std::string RelationShipChangeMsg::ToMapKey() const
     return ret.str();
 }
 
-void ReleationShipSyncMgr::HandleRecvBroadCastTimeout(const std::string &key)
+BroadCastFingerprint RelationShipChangeMsg::ToFingerprint() const
 {
-    std::lock_guard<ffrt::mutex> autoLock(lock_);
-    auto iter = recvBroadCastIdMap_.find(key);
-    if (iter != recvBroadCastIdMap_.end()) {
-        recvBroadCastIdMap_.erase(iter);
-    }
+    BroadCastDigest digest;
+    digest.Update(accountId);
+    digest.Update(peerUdid);
+    digest.Update(credId);
+    digest.Update(static_cast<uint64_t>(userIdInfos.size()));
+    for (const auto &userIdInfo : userIdInfos) {
+        digest.Update((static_cast<uint64_t>(userIdInfo.isForeground) << USERID_BYTES * BITS_PER_BYTE) |
+            userIdInfo.userId);
+    }
+    // A remove-only delta has no user id infos, its sequence and removed ids tell it from the next one.
+    digest.Update((static_cast<uint64_t>(needUserIdResync ? 1 : 0) << FINGERPRINT_RESYNC_OFFSET) |
+        (static_cast<uint64_t>(isUserIdVersioned ? 1 : 0) << FINGERPRINT_VERSIONED_OFFSET) |
+        (static_cast<uint64_t>(baseUserIdSeq) << FINGERPRINT_BASE_SEQ_OFFSET) | userIdSeq);
+    digest.Update(static_cast<uint64_t>(removedUserIds.size()));
+    for (uint16_t removedUserId : removedUserIds) {
+        digest.Update(static_cast<uint64_t>(removedUserId));
+    }
+    BroadCastFingerprint fingerprint;
+    fingerprint.digest = digest.Final();
+    fingerprint.tokenId = tokenId;
+    fingerprint.peerTokenId = peerTokenId;
+    fingerprint.userId = userId;
+    fingerprint.type = static_cast<uint8_t>(type);
+    fingerprint.flags = static_cast<uint8_t>((isNewEvent ? 1 : 0) | (syncUserIdFlag ? 1 << 1 : 0));
+    fingerprint.broadCastId = broadCastId;
+    return fingerprint;
 }
 
 bool ReleationShipSyncMgr::GetCurrentTimeSec(int32_t &sec)
@@ -1298,44 +1482,141 @@ std::string ReleationShipSyncMgr::SyncTrustRelationShip(RelationShipChangeMsg &m
     return msg.ToJson();
 }
 
+std::vector<std::string> ReleationShipSyncMgr::SyncUserIdsRelationShip(RelationShipChangeMsg &msg)
+{
+    std::vector<std::string> broadCastMsgs;
+    RelationShipChangeMsg deltaMsg;
+    uint8_t broadCastId = 0;
+    if (BuildUserIdDelta(msg, deltaMsg)) {
+        broadCastMsgs.push_back(SyncTrustRelationShip(deltaMsg, broadCastId));
+        if (msg.peerUdids.empty()) {
+            return broadCastMsgs;
+        }
+    }
+    broadCastMsgs.push_back(SyncTrustRelationShip(msg, broadCastId));
+    return broadCastMsgs;
+}
+
+// Moves the peers already holding the previous list from msg to deltaMsg, false when there are none.
+bool ReleationShipSyncMgr::BuildUserIdDelta(RelationShipChangeMsg &msg, RelationShipChangeMsg &deltaMsg)
+{
+    std::vector<UserIdInfo> changedUserIdInfos;
+    std::vector<uint16_t> removedUserIds;
+    std::lock_guard<ffrt::mutex> autoLock(userIdLock_);
+    GetUserIdInfosDelta(localUserIdInfos_, msg.userIdInfos, changedUserIdInfos, removedUserIds);
+    uint64_t baseUserIdGen = localUserIdGen_;
+    bool isChanged = !changedUserIdInfos.empty() || !removedUserIds.empty();
+    if (isChanged) {
+        localUserIdGen_++;
+        localUserIdInfos_ = msg.userIdInfos;
+    }
+    msg.isUserIdVersioned = true;
+    msg.userIdSeq = static_cast<uint8_t>(localUserIdGen_);
+    deltaMsg = msg;
+    deltaMsg.type = RelationShipChangeType::SYNC_USERID_DELTA;
+    deltaMsg.baseUserIdSeq = static_cast<uint8_t>(baseUserIdGen);
+    deltaMsg.userIdInfos = changedUserIdInfos;
+    deltaMsg.removedUserIds = removedUserIds;
+    deltaMsg.peerUdids.clear();
+    // Only worth it while shorter than the full list. An unchanged list goes out in full, a delta
+    // with base equal to seq would not follow the list the peer holds.
+    bool useDelta = isChanged && !msg.needUserIdResync && deltaMsg.IsValid() &&
+        changedUserIdInfos.size() + removedUserIds.size() < msg.userIdInfos.size();
+    std::vector<std::string> fullPeerUdids;
+    for (const auto &peerUdid : msg.peerUdids) {
+        // Compared untruncated, a peer that missed a whole wrap of the 8 bit sequence still gets the full list.
+        auto iter = sentUserIdGens_.find(peerUdid);
+        if (useDelta && iter != sentUserIdGens_.end() && iter->second == baseUserIdGen &&
+            recvUserIdStates_.find(peerUdid) != recvUserIdStates_.end()) {
+            deltaMsg.peerUdids.push_back(peerUdid);
+        } else {
+            fullPeerUdids.push_back(peerUdid);
+        }
+        if (iter == sentUserIdGens_.end() && sentUserIdGens_.size() >= MAX_CONTAINER_SIZE) {
+            sentUserIdGens_.erase(sentUserIdGens_.begin());
+        }
+        sentUserIdGens_[peerUdid] = localUserIdGen_;
+    }
+    msg.peerUdids = fullPeerUdids;
+    return !deltaMsg.peerUdids.empty();
+}
+
 RelationShipChangeMsg ReleationShipSyncMgr::ParseTrustRelationShipChange(const std::string &msgJson)
 {
     RelationShipChangeMsg msgObj;
     if (!msgObj.FromJson(msgJson)) {
         LOGE("Parse json failed");
+        return msgObj;
     }
+    UpdatePeerUserIds(msgObj);
     return msgObj;
 }
 
+// Resolves a delta into the full user id list of the peer. A delta that does not follow the list held
+// for the peer stays SYNC_USERID_DELTA, the caller then asks the peer for the full list.
+void ReleationShipSyncMgr::UpdatePeerUserIds(RelationShipChangeMsg &msg)
+{
+    if (msg.type != RelationShipChangeType::SYNC_USERID && msg.type != RelationShipChangeType::SYNC_USERID_DELTA) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> autoLock(userIdLock_);
+    if (msg.needUserIdResync) {
+        sentUserIdGens_.erase(msg.peerUdid);
+    }
+    auto iter = recvUserIdStates_.find(msg.peerUdid);
+    if (msg.type == RelationShipChangeType::SYNC_USERID) {
+        if (!msg.isUserIdVersioned) {
+            // The peer sends the legacy layout and can not decode deltas either.
+            if (iter != recvUserIdStates_.end()) {
+                recvUserIdStates_.erase(iter);
+            }
+            return;
+        }
+        if (iter == recvUserIdStates_.end()) {
+            if (recvUserIdStates_.size() >= MAX_CONTAINER_SIZE) {
+                recvUserIdStates_.erase(recvUserIdStates_.begin());
+            }
+            iter = recvUserIdStates_.emplace(msg.peerUdid, PeerUserIdState()).first;
+        }
+        iter->second.seq = msg.userIdSeq;
+        iter->second.userIdInfos = msg.userIdInfos;
+        return;
+    }
+    if (iter == recvUserIdStates_.end()) {
+        LOGI("no user ids of peer %{public}s, seq %{public}u", GetAnonyString(msg.peerUdid).c_str(), msg.userIdSeq);
+        return;
+    }
+    // Every change advances the sequence by one, anything else is not a delta this side can apply.
+    bool isNextSeq = static_cast<uint8_t>(msg.baseUserIdSeq + 1) == msg.userIdSeq;
+    // An empty resend of the list already held, base and seq equal.
+    bool isUnchanged = msg.baseUserIdSeq == msg.userIdSeq && iter->second.seq == msg.userIdSeq;
+    if (isNextSeq && iter->second.seq == msg.baseUserIdSeq) {
+        ApplyUserIdInfosDelta(iter->second.userIdInfos, msg.userIdInfos, msg.removedUserIds);
+        iter->second.seq = msg.userIdSeq;
+    } else if (!isUnchanged && (!isNextSeq || IsUserIdSeqAfter(msg.userIdSeq, iter->second.seq))) {
+        LOGI("user ids gap of peer %{public}s, held seq %{public}u, base seq %{public}u",
+            GetAnonyString(msg.peerUdid).c_str(), iter->second.seq, msg.baseUserIdSeq);
+        return;
+    }
+    // Otherwise a repeat of a delta already applied, answered with the list held.
+    msg.type = RelationShipChangeType::SYNC_USERID;
+    msg.userIdInfos = iter->second.userIdInfos;
+    msg.removedUserIds.clear();
+}
+
 bool ReleationShipSyncMgr::IsNewBroadCastId(const RelationShipChangeMsg &msg)
 {
     if (msg.broadCastId == 0) {
         return true;
     }
-    std::string key = msg.ToMapKey();
+    BroadCastFingerprint fingerprint = msg.ToFingerprint();
+    int64_t nowSec = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
     std::lock_guard<ffrt::mutex> autoLock(lock_);
-    if (timer_ == nullptr) {
-        timer_ = std::make_shared<DmTimer>();
-    }
-    auto iter = recvBroadCastIdMap_.find(key);
-    if (iter == recvBroadCastIdMap_.end()) {
-        CHECK_SIZE_RETURN(recvBroadCastIdMap_, true);
-        recvBroadCastIdMap_[key] = msg.broadCastId;
-        timer_->StartTimer(key, BROADCAST_TIMEOUT_S, [this](std::string key) {
-            ReleationShipSyncMgr::HandleRecvBroadCastTimeout(key);
-        });
-        return true;
-    } else if (iter != recvBroadCastIdMap_.end() && recvBroadCastIdMap_[key] != msg.broadCastId) {
-        timer_->DeleteTimer(key);
-        recvBroadCastIdMap_[key] = msg.broadCastId;
-        timer_->StartTimer(key, BROADCAST_TIMEOUT_S, [this](std::string key) {
-            ReleationShipSyncMgr::HandleRecvBroadCastTimeout(key);
-        });
-        return true;
-    } else {
-        return false;
+    if (recvBroadCastIds_ == nullptr) {
+        recvBroadCastIds_ = std::make_shared<BroadCastDedupSet>(BROADCAST_TIMEOUT_S, MAX_CONTAINER_SIZE);
     }
-    return false;
+    return recvBroadCastIds_->CheckAndInsert(fingerprint, nowSec);
 }
 
 const std::string RelationShipChangeMsg::ToString() const
@@ -1355,6 +1636,10 @@ const std::string RelationShipChangeMsg::ToString() const
     ret << ", syncUserIdFlag: " << std::to_string(syncUserIdFlag);
     ret << ", userIds: " << GetUserIdInfoList(userIdInfos);
     ret << ", isLastBatchStr: " << isLastBatchStr;
+    if (isUserIdVersioned) {
+        ret << ", userIdSeq: " << std::to_string(baseUserIdSeq) << "->" << std::to_string(userIdSeq);
+        ret << ", removedUserIds: " << GetIntegerList<uint16_t>(removedUserIds);
+    }
     ret << ", broadCastId: " << std::to_string(broadCastId) << " }";
     return ret.str();
 }
@@ -1395,5 +1680,44 @@ void GetFrontAndBackUserIdInfos(const std::vector<UserIdInfo> &remoteUserIdInfos
         }
     }
 }
+
+void GetUserIdInfosDelta(const std::vector<UserIdInfo> &baseUserIdInfos, const std::vector<UserIdInfo> &userIdInfos,
+    std::vector<UserIdInfo> &changedUserIdInfos, std::vector<uint16_t> &removedUserIds)
+{
+    changedUserIdInfos.clear();
+    removedUserIds.clear();
+    for (auto const &u : userIdInfos) {
+        auto iter = std::find_if(baseUserIdInfos.begin(), baseUserIdInfos.end(),
+            [&u](const UserIdInfo &item) { return item.userId == u.userId; });
+        if (iter == baseUserIdInfos.end() || iter->isForeground != u.isForeground) {
+            changedUserIdInfos.push_back(u);
+        }
+    }
+    for (auto const &u : baseUserIdInfos) {
+        auto iter = std::find_if(userIdInfos.begin(), userIdInfos.end(),
+            [&u](const UserIdInfo &item) { return item.userId == u.userId; });
+        if (iter == userIdInfos.end()) {
+            removedUserIds.push_back(u.userId);
+        }
+    }
+}
+
+void ApplyUserIdInfosDelta(std::vector<UserIdInfo> &userIdInfos, const std::vector<UserIdInfo> &changedUserIdInfos,
+    const std::vector<uint16_t> &removedUserIds)
+{
+    for (uint16_t removedUserId : removedUserIds) {
+        userIdInfos.erase(std::remove_if(userIdInfos.begin(), userIdInfos.end(),
+            [removedUserId](const UserIdInfo &item) { return item.userId == removedUserId; }), userIdInfos.end());
+    }
+    for (auto const &u : changedUserIdInfos) {
+        auto iter = std::find_if(userIdInfos.begin(), userIdInfos.end(),
+            [&u](const UserIdInfo &item) { return item.userId == u.userId; });
+        if (iter != userIdInfos.end()) {
+            iter->isForeground = u.isForeground;
+        } else {
+            userIdInfos.push_back(u);
+        }
+    }
+}
 } // DistributedHardware
 } // OHOS
\ No newline at end of file
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "discovered_device_cache.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr uint32_t SLOT_MASK_BITS = 32;
+
+bool IsIpAddrType(ConnectionAddrType type)
+{
+    return type == ConnectionAddrType::CONNECTION_ADDR_ETH || type == ConnectionAddrType::CONNECTION_ADDR_WLAN ||
+        type == ConnectionAddrType::CONNECTION_ADDR_NCM;
+}
+}
+
+DiscoveredDeviceCache::DiscoveredDeviceCache(size_t capacity, int64_t ttlMs) : ttlMs_(ttlMs), entries_(capacity)
+{
+    static_assert(ADDR_SLOT_NUM <= SLOT_MASK_BITS, "too many address types for the slot mask");
+}
+
+bool DiscoveredDeviceCache::Put(const std::string &deviceId, const DeviceInfo &device, int64_t nowMs)
+{
+    if (deviceId.empty() || device.addrNum <= 0) {
+        return false;
+    }
+    const ConnectionAddr &addr = device.addr[0];
+    int32_t type = static_cast<int32_t>(addr.type);
+    if (type < 0 || static_cast<size_t>(type) >= ADDR_SLOT_NUM) {
+        return false;
+    }
+    size_t slot = static_cast<size_t>(type);
+    bool inserted = false;
+    bool evicted = false;
+    Entry &entry = entries_.Put(deviceId, inserted, evicted);
+    if (evicted) {
+        stats_.evict++;
+    }
+    if (inserted) {
+        stats_.insert++;
+    } else if (ttlMs_ > 0 && nowMs - entry.updateTimeMs > ttlMs_) {
+        // Addresses of the previous sighting are stale, start over.
+        stats_.expire++;
+        entry = Entry {};
+    } else {
+        stats_.update++;
+    }
+    entry.slots[slot] = addr;
+    entry.validMask |= (1u << slot);
+    entry.latestType = addr.type;
+    entry.updateTimeMs = nowMs;
+    return true;
+}
+
+DiscoveredDeviceCache::Entry *DiscoveredDeviceCache::FindLive(const std::string &deviceId, int64_t nowMs)
+{
+    Entry *entry = entries_.Find(deviceId);
+    if (entry == nullptr) {
+        stats_.miss++;
+        return nullptr;
+    }
+    if (ttlMs_ > 0 && nowMs - entry->updateTimeMs > ttlMs_) {
+        entries_.Erase(deviceId);
+        stats_.expire++;
+        stats_.miss++;
+        return nullptr;
+    }
+    stats_.hit++;
+    return entry;
+}
+
+bool DiscoveredDeviceCache::GetLatestAddr(const std::string &deviceId, int64_t nowMs, ConnectionAddr &addr)
+{
+    Entry *entry = FindLive(deviceId, nowMs);
+    if (entry == nullptr) {
+        return false;
+    }
+    addr = entry->slots[static_cast<size_t>(entry->latestType)];
+    return true;
+}
+
+bool DiscoveredDeviceCache::GetIpAddrType(const std::string &deviceId, const std::string &ip, int64_t nowMs,
+    ConnectionAddrType &addrType)
+{
+    Entry *entry = FindLive(deviceId, nowMs);
+    if (entry == nullptr) {
+        return false;
+    }
+    for (size_t slot = 0; slot < ADDR_SLOT_NUM; slot++) {
+        if ((entry->validMask & (1u << slot)) == 0) {
+            continue;
+        }
+        const ConnectionAddr &addr = entry->slots[slot];
+        if (IsIpAddrType(addr.type) && ip == addr.info.ip.ip) {
+            addrType = addr.type;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DiscoveredDeviceCache::Erase(const std::string &deviceId)
+{
+    return entries_.Erase(deviceId);
+}
+
+void DiscoveredDeviceCache::Clear()
+{
+    entries_.Clear();
+}
+
+size_t DiscoveredDeviceCache::Size() const
+{
+    return entries_.Size();
+}
+
+DiscoveredDeviceCacheStats DiscoveredDeviceCache::GetStats() const
+{
+    return stats_;
+}
+
+void DiscoveredDeviceCache::ResetStats()
+{
+    stats_ = DiscoveredDeviceCacheStats {};
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -15,6 +15,10 @@
 
 #include "mine_softbus_listener.h"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
 #include <dlfcn.h>
 #include <mutex>
 #include <pthread.h>
@@ -23,12 +27,14 @@
 #include <unistd.h>
 #include <condition_variable>
 #include <list>
+#include <unordered_set>
 
 #include "device_manager_service.h"
 #include "dm_anonymous.h"
 #include "dm_constants.h"
 #include "dm_device_info.h"
 #include "dm_log.h"
+#include "dm_perf_stats.h"
 #include "parameter.h"
 #include "system_ability_definition.h"
 #include "softbus_listener.h"
@@ -57,6 +63,7 @@ constexpr int32_t DM_TLV_SCOPE_DATA_OFFSET = 4;
 constexpr int32_t MAX_SOFTBUS_DELAY_TIME = 10;
 #if (defined(MINE_HARMONY))
 constexpr int32_t DM_SEARCH_BROADCAST_MIN_LEN = 18;
+constexpr int32_t MATCH_DEAL_WORKER_NUM = 2;
 #endif
 constexpr const char* FIELD_DEVICE_MODE = "findDeviceMode";
 constexpr const char* FIELD_TRUST_OPTIONS = "tructOptions";
@@ -77,7 +84,25 @@ constexpr uint32_t EVP_OK = 1;
 
 static std::mutex g_matchWaitDeviceLock;
 static std::mutex g_publishLnnLock;
-static std::list<DeviceInfo> g_matchQueue;
+static std::mutex g_localIdentityLock;
+// Digests of the local identity, refreshed only when the underlying parameters change.
+static DevicePolicyInfo g_localIdentity = {};
+static bool g_aliasChecked = false;
+static bool g_numberChecked = false;
+static bool g_aliasWatched = false;
+static bool g_numberWatched = false;
+struct MatchTask {
+    std::string key;
+    DeviceInfo deviceInfo;
+    std::chrono::steady_clock::time_point enqueueTime;
+};
+// Broadcasts waiting for a match worker, g_matchPendingKeys holds the keys of the queued ones.
+static std::list<MatchTask> g_matchQueue;
+static std::unordered_set<std::string> g_matchPendingKeys;
+static MatchQueueStats g_matchQueueStats;
+#if (defined(MINE_HARMONY))
+static int32_t g_matchDealWorkerNum = 0;
+#endif
 static std::vector<std::string> pkgNameVec_ = {};
 bool g_publishLnnFlag = false;
 bool g_matchDealFlag = false;
@@ -125,6 +150,48 @@ void FromJson(const JsonItemObject &object, ScopeOptionInfo &optionInfo)
     object["endNumber"].GetTo(optionInfo.endNumber);
 }
 
+struct VertexMatchEntry {
+    bool accepted = false;
+    const char *digest = nullptr;
+};
+using VertexMatchTable = std::array<VertexMatchEntry, DM_MAX_VERTEX_TLV_NUM>;
+
+// Indexed by the tlv type, so every tlv is matched with one lookup and one memcmp.
+static void BuildVertexMatchTable(const DevicePolicyInfo &devicePolicyInfo, VertexMatchTable &table)
+{
+    table[DEVICE_TYPE_TYPE] = { true, devicePolicyInfo.typeHashValid ? devicePolicyInfo.typeHash : nullptr };
+    table[DEVICE_SN_TYPE] = { true, devicePolicyInfo.snHashValid ? devicePolicyInfo.snHash : nullptr };
+    table[DEVICE_UDID_TYPE] = { true, devicePolicyInfo.udidHashValid ? devicePolicyInfo.udidHash : nullptr };
+}
+
+// A searcher repeats its broadcast until it hears a return-wave, the payload tells its searches apart.
+static std::string GetMatchKey(const DeviceInfo &deviceInfo)
+{
+    std::string key(deviceInfo.devId, strnlen(deviceInfo.devId, sizeof(deviceInfo.devId)));
+#if (defined(MINE_HARMONY))
+    size_t dataLen = std::min(static_cast<size_t>(deviceInfo.businessDataLen), sizeof(deviceInfo.businessData));
+    key.append("#").append(std::to_string(std::hash<std::string>()(std::string(deviceInfo.businessData, dataLen))));
+#endif
+    return key;
+}
+
+#if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
+static void OnLocalIdentityParamChanged(const char *key, const char *value, void *context)
+{
+    (void)value;
+    (void)context;
+    if (key == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> autoLock(g_localIdentityLock);
+    if (strcmp(key, DEVICE_ALIAS) == 0) {
+        g_aliasChecked = false;
+    } else if (strcmp(key, DEVICE_NUMBER) == 0) {
+        g_numberChecked = false;
+    }
+}
+#endif
+
 MineSoftbusListener::MineSoftbusListener()
 {
 #if (defined(MINE_HARMONY))
@@ -134,7 +201,14 @@ MineSoftbusListener::MineSoftbusListener()
     {
         std::lock_guard<std::mutex> autoLock(g_matchWaitDeviceLock);
         g_matchDealFlag = true;
-        std::thread([]() { MatchSearchDealTask(); }).detach();
+        // Workers of a previous instance that have not stopped yet are reused.
+        for (; g_matchDealWorkerNum < MATCH_DEAL_WORKER_NUM; g_matchDealWorkerNum++) {
+            std::thread([]() {
+                MatchSearchDealTask();
+                std::lock_guard<std::mutex> autoLock(g_matchWaitDeviceLock);
+                g_matchDealWorkerNum--;
+            }).detach();
+        }
     }
 #endif
     LOGI("constructor");
@@ -149,7 +223,11 @@ MineSoftbusListener::~MineSoftbusListener()
     {
         std::lock_guard<std::mutex> autoLock(g_matchWaitDeviceLock);
         g_matchDealFlag = false;
+        g_matchQueue.clear();
+        g_matchPendingKeys.clear();
+        g_matchQueueStats.depth = 0;
     }
+    g_matchDealNotify.notify_all();
 #endif
     LOGI("destructor");
 }
@@ -211,11 +289,38 @@ void MineSoftbusListener::OnPublishDeviceFound(const DeviceInfo *deviceInfo)
     }
     LOGI("broadcast data is received with DataLen: %{public}u", deviceInfo->businessDataLen);
 #endif
-    std::unique_lock<std::mutex> autoLock(g_matchWaitDeviceLock);
-    g_matchQueue.push_back(*deviceInfo);
+    std::string key = GetMatchKey(*deviceInfo);
+    {
+        std::lock_guard<std::mutex> autoLock(g_matchWaitDeviceLock);
+        if (g_matchPendingKeys.find(key) != g_matchPendingKeys.end()) {
+            g_matchQueueStats.deduplicated++;
+            DM_PERF_COUNT(DmPerfCounter::MINE_MATCH_DEDUPLICATED);
+            return;
+        }
+        if (g_matchQueue.size() >= DM_MAX_MATCH_QUEUE_SIZE) {
+            // Searchers repeat their broadcasts, a dropped one is answered on a later round.
+            if (g_matchQueueStats.dropped++ % DM_MAX_MATCH_QUEUE_SIZE == 0) {
+                LOGE("match queue is full, dropped: %{public}" PRIu64 ".", g_matchQueueStats.dropped);
+            }
+            DM_PERF_COUNT(DmPerfCounter::MINE_MATCH_DROPPED);
+            return;
+        }
+        g_matchPendingKeys.insert(key);
+        g_matchQueue.push_back({ key, *deviceInfo, std::chrono::steady_clock::now() });
+        g_matchQueueStats.enqueued++;
+        g_matchQueueStats.depth = g_matchQueue.size();
+        g_matchQueueStats.peakDepth = std::max(g_matchQueueStats.peakDepth, g_matchQueueStats.depth);
+        DM_PERF_GAUGE(DmPerfGauge::MINE_MATCH_QUEUE, static_cast<int64_t>(g_matchQueueStats.depth));
+    }
     g_matchDealNotify.notify_one();
 }
 
+MatchQueueStats MineSoftbusListener::GetMatchQueueStats()
+{
+    std::lock_guard<std::mutex> autoLock(g_matchWaitDeviceLock);
+    return g_matchQueueStats;
+}
+
 void MineSoftbusListener::OnRePublish(void)
 {
     LOGI("try to rePublishLNN");
@@ -630,19 +735,30 @@ void MineSoftbusListener::MatchSearchDealTask(void)
 {
     LOGI("the match deal task has started to run.");
 #if (defined(MINE_HARMONY))
-    DeviceInfo tempDeviceInfo;
     while (true) {
+        MatchTask task;
+        uint64_t waitUs = 0;
         {
             std::unique_lock<std::mutex> autoLock(g_matchWaitDeviceLock);
+            g_matchDealNotify.wait(autoLock, [] { return !g_matchDealFlag || !g_matchQueue.empty(); });
             if (!g_matchDealFlag) {
                 LOGI("the match deal task will stop to run.");
                 return;
             }
-            g_matchDealNotify.wait(autoLock, [] { return !g_matchQueue.empty(); });
-            tempDeviceInfo = g_matchQueue.front();
+            task = std::move(g_matchQueue.front());
             g_matchQueue.pop_front();
+            g_matchPendingKeys.erase(task.key);
+            waitUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - task.enqueueTime).count());
+            g_matchQueueStats.processed++;
+            g_matchQueueStats.depth = g_matchQueue.size();
+            g_matchQueueStats.totalWaitUs += waitUs;
+            g_matchQueueStats.maxWaitUs = std::max(g_matchQueueStats.maxWaitUs, waitUs);
+        }
+        if (DmPerfStats::GetInstance().IsEnabled()) {
+            DmPerfStats::GetInstance().RecordLatency(DmPerfOp::MINE_MATCH_QUEUE_WAIT, waitUs);
         }
-        if (ParseBroadcastInfo(tempDeviceInfo) != DM_OK) {
+        if (ParseBroadcastInfo(task.deviceInfo) != DM_OK) {
             LOGE("failed to parse broadcast info.");
         }
     }
@@ -733,18 +849,47 @@ Action MineSoftbusListener::MatchSearchAllDevice(DeviceInfo &deviceInfo, const B
     }
 }
 
-void MineSoftbusListener::GetScopeDevicePolicyInfo(DevicePolicyInfo &devicePolicyInfo)
+void MineSoftbusListener::RefreshLocalIdentityLocked()
 {
-    devicePolicyInfo.numberValid = false;
-    devicePolicyInfo.aliasHashValid = false;
-    if (GetDeviceAliasHash(devicePolicyInfo.aliasHash)) {
-        devicePolicyInfo.aliasHashValid = true;
+#if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
+    // The watchers live as long as the process and only touch the file scope cache.
+    if (!g_aliasWatched) {
+        g_aliasWatched = (WatchParameter(DEVICE_ALIAS, OnLocalIdentityParamChanged, nullptr) == 0);
     }
-    if (GetDeviceNumber(devicePolicyInfo.number)) {
-        devicePolicyInfo.numberValid = true;
+    if (!g_numberWatched) {
+        g_numberWatched = (WatchParameter(DEVICE_NUMBER, OnLocalIdentityParamChanged, nullptr) == 0);
+    }
+#endif
+    if (!g_aliasChecked) {
+        g_localIdentity.aliasHashValid = GetDeviceAliasHash(g_localIdentity.aliasHash);
+        g_aliasChecked = g_aliasWatched;
+    }
+    if (!g_numberChecked) {
+        g_localIdentity.numberValid = GetDeviceNumber(g_localIdentity.number);
+        g_numberChecked = g_numberWatched;
+    }
+    // Serial, udid and type never change at runtime, they are read again only until they succeed once.
+    if (!g_localIdentity.snHashValid) {
+        g_localIdentity.snHashValid = GetDeviceSnHash(g_localIdentity.snHash);
+    }
+    if (!g_localIdentity.udidHashValid) {
+        g_localIdentity.udidHashValid = GetDeviceUdidHash(g_localIdentity.udidHash);
+    }
+    if (!g_localIdentity.typeHashValid) {
+        g_localIdentity.typeHashValid = GetDeviceTypeHash(g_localIdentity.typeHash);
     }
 }
 
+void MineSoftbusListener::GetScopeDevicePolicyInfo(DevicePolicyInfo &devicePolicyInfo)
+{
+    std::lock_guard<std::mutex> autoLock(g_localIdentityLock);
+    RefreshLocalIdentityLocked();
+    devicePolicyInfo.aliasHashValid = g_localIdentity.aliasHashValid;
+    devicePolicyInfo.numberValid = g_localIdentity.numberValid;
+    (void)memcpy_s(devicePolicyInfo.aliasHash, DM_HASH_DATA_LEN, g_localIdentity.aliasHash, DM_HASH_DATA_LEN);
+    (void)memcpy_s(devicePolicyInfo.number, DM_DEVICE_NUMBER_LEN, g_localIdentity.number, DM_DEVICE_NUMBER_LEN);
+}
+
 Action MineSoftbusListener::MatchSearchScopeDevice(DeviceInfo &deviceInfo, char *output,
     const DevicePolicyInfo &devicePolicyInfo, const BroadcastHead &broadcastHead)
 {
@@ -790,18 +935,22 @@ Action MineSoftbusListener::MatchSearchScopeDevice(DeviceInfo &deviceInfo, char
 
 void MineSoftbusListener::GetVertexDevicePolicyInfo(DevicePolicyInfo &devicePolicyInfo)
 {
-    devicePolicyInfo.snHashValid = false;
-    devicePolicyInfo.typeHashValid = false;
-    devicePolicyInfo.udidHashValid = false;
-    if (GetDeviceSnHash(devicePolicyInfo.snHash)) {
-        devicePolicyInfo.snHashValid = true;
-    }
-    if (GetDeviceUdidHash(devicePolicyInfo.udidHash)) {
-        devicePolicyInfo.udidHashValid = true;
-    }
-    if (GetDeviceTypeHash(devicePolicyInfo.typeHash)) {
-        devicePolicyInfo.typeHashValid = true;
-    }
+    std::lock_guard<std::mutex> autoLock(g_localIdentityLock);
+    RefreshLocalIdentityLocked();
+    devicePolicyInfo.snHashValid = g_localIdentity.snHashValid;
+    devicePolicyInfo.typeHashValid = g_localIdentity.typeHashValid;
+    devicePolicyInfo.udidHashValid = g_localIdentity.udidHashValid;
+    (void)memcpy_s(devicePolicyInfo.snHash, DM_HASH_DATA_LEN, g_localIdentity.snHash, DM_HASH_DATA_LEN);
+    (void)memcpy_s(devicePolicyInfo.typeHash, DM_HASH_DATA_LEN, g_localIdentity.typeHash, DM_HASH_DATA_LEN);
+    (void)memcpy_s(devicePolicyInfo.udidHash, DM_HASH_DATA_LEN, g_localIdentity.udidHash, DM_HASH_DATA_LEN);
+}
+
+void MineSoftbusListener::ClearLocalIdentityCache()
+{
+    std::lock_guard<std::mutex> autoLock(g_localIdentityLock);
+    g_localIdentity = {};
+    g_aliasChecked = false;
+    g_numberChecked = false;
 }
 
 Action MineSoftbusListener::MatchSearchVertexDevice(DeviceInfo &deviceInfo, char *output,
@@ -816,30 +965,20 @@ Action MineSoftbusListener::MatchSearchVertexDevice(DeviceInfo &deviceInfo, char
         return BUSINESS_EXACT_NOT_MATCH;
     }
 
-    size_t tlvLen = broadcastHead.tlvDataLen;
+    VertexMatchTable matchTable;
+    BuildVertexMatchTable(devicePolicyInfo, matchTable);
+    size_t tlvLen = static_cast<unsigned char>(broadcastHead.tlvDataLen);
     const size_t ONE_TLV_DATA_LEN = DM_TLV_VERTEX_DATA_OFFSET + DM_HASH_DATA_LEN;
     for (size_t i = 0; (i + ONE_TLV_DATA_LEN) <= tlvLen; i += ONE_TLV_DATA_LEN) {
-        size_t dataPosition = 0;
-        if (output[i] == DEVICE_TYPE_TYPE) {
-            dataPosition = i + DM_TLV_VERTEX_DATA_OFFSET;
-            matchItemNum[DEVICE_TYPE_TYPE] = 1;
-            if (CheckDeviceTypeMatch(devicePolicyInfo, &output[dataPosition])) {
-                matchItemResult[DEVICE_TYPE_TYPE] = 1;
-            }
-        } else if (output[i] == DEVICE_SN_TYPE) {
-            dataPosition = i + DM_TLV_VERTEX_DATA_OFFSET;
-            matchItemNum[DEVICE_SN_TYPE] = 1;
-            if (CheckDeviceSnMatch(devicePolicyInfo, &output[dataPosition])) {
-                matchItemResult[DEVICE_SN_TYPE] = 1;
-            }
-        } else if (output[i] == DEVICE_UDID_TYPE) {
-            dataPosition = i + DM_TLV_VERTEX_DATA_OFFSET;
-            matchItemNum[DEVICE_UDID_TYPE] = 1;
-            if (CheckDeviceUdidMatch(devicePolicyInfo, &output[dataPosition])) {
-                matchItemResult[DEVICE_UDID_TYPE] = 1;
-            }
-        } else {
-            LOGE("the value of type is not allowed with type: %{public}u.", output[i]);
+        size_t type = static_cast<unsigned char>(output[i]);
+        if (type >= DM_MAX_VERTEX_TLV_NUM || !matchTable[type].accepted) {
+            LOGE("the value of type is not allowed with type: %{public}zu.", type);
+            continue;
+        }
+        matchItemNum[type] = 1;
+        const char *digest = matchTable[type].digest;
+        if (digest != nullptr && memcmp(&output[i + DM_TLV_VERTEX_DATA_OFFSET], digest, DM_HASH_DATA_LEN) == 0) {
+            matchItemResult[type] = 1;
         }
     }
     return GetMatchResult(matchItemNum, matchItemResult);
@@ -1004,54 +1143,6 @@ bool MineSoftbusListener::CheckDeviceNumberMatch(const DevicePolicyInfo &deviceP
     return true;
 }
 
-bool MineSoftbusListener::CheckDeviceSnMatch(const DevicePolicyInfo &devicePolicyInfo, const char *data)
-{
-    if (!devicePolicyInfo.snHashValid) {
-        LOGE("device sn is not valid");
-        return false;
-    }
-    for (size_t i = 0; i < DM_HASH_DATA_LEN; i++) {
-        if (data[i] != devicePolicyInfo.snHash[i]) {
-            LOGI("device sn is not match.");
-            return false;
-        }
-    }
-    LOGI("device sn is match.");
-    return true;
-}
-
-bool MineSoftbusListener::CheckDeviceTypeMatch(const DevicePolicyInfo &devicePolicyInfo, const char *data)
-{
-    if (!devicePolicyInfo.typeHashValid) {
-        LOGE("device type is not valid");
-        return false;
-    }
-    for (size_t i = 0; i < DM_HASH_DATA_LEN; i++) {
-        if (data[i] != devicePolicyInfo.typeHash[i]) {
-            LOGI("device type is not match.");
-            return false;
-        }
-    }
-    LOGI("device type is match.");
-    return true;
-}
-
-bool MineSoftbusListener::CheckDeviceUdidMatch(const DevicePolicyInfo &devicePolicyInfo, const char *data)
-{
-    if (!devicePolicyInfo.udidHashValid) {
-        LOGE("device udid is not valid");
-        return false;
-    }
-    for (size_t i = 0; i < DM_HASH_DATA_LEN; i++) {
-        if (data[i] != devicePolicyInfo.udidHash[i]) {
-            LOGI("device udid is not match.");
-            return false;
-        }
-    }
-    LOGI("device udid is match.");
-    return true;
-}
-
 Action MineSoftbusListener::GetMatchResult(const vector<int> &matchItemNum, const vector<int> &matchItemResult)
 {
     int matchItemSum = 0;
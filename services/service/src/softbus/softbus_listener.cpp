@@ -15,7 +15,10 @@
 
 #include "softbus_listener.h"
 
+#include <chrono>
+#include <deque>
 #include <dlfcn.h>
+#include <functional>
 #include <mutex>
 #include <pthread.h>
 #include <securec.h>
@@ -26,6 +29,7 @@
 #include "dm_crypto.h"
 #include "dm_constants.h"
 #include "dm_log.h"
+#include "dm_perf_stats.h"
 #include "dm_softbus_cache.h"
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
 #include "datetime_ex.h"
@@ -34,6 +38,7 @@
 #include "kv_adapter_manager.h"
 #include "multiple_user_connector.h"
 #include "dm_constraints_manager.h"
+#include "dm_init_stage_graph.h"
 #endif
 #include "ipc_skeleton.h"
 #include "parameter.h"
@@ -47,6 +52,7 @@ namespace DistributedHardware {
 const int32_t SOFTBUS_CHECK_INTERVAL = 100000; // 100ms
 const int32_t SOFTBUS_SUBSCRIBE_ID_MASK = 0x0000FFFF;
 const int32_t MAX_CACHED_DISCOVERED_DEVICE_SIZE = 100;
+constexpr int64_t DISCOVERED_DEVICE_TTL_MS = 30 * 60 * 1000;
 const int32_t MAX_SOFTBUS_MSG_LEN = 2000;
 const int32_t MAX_OSTYPE_SIZE = 1000;
 constexpr int32_t MAX_CACHED_MAP_NUM = 5000;
@@ -77,6 +83,7 @@ constexpr const char* DEVICE_USER_ID_CHECK_SUM_CHANGE_TASK = "DeviceUserIdCheckS
 
 static std::mutex g_deviceMapMutex;
 static std::mutex g_lnnCbkMapMutex;
+static std::mutex g_actionIdMapMutex;
 static std::mutex g_radarLoadLock;
 static std::mutex g_onlineDeviceNumLock;
 
@@ -98,11 +105,9 @@ static std::mutex g_lockDevInfoChange;
 static std::mutex g_lockDevScreenStatusChange;
 #endif
 static std::mutex g_lockDeviceIdSet;
-static std::map<std::string,
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>> discoveredDeviceMap;
-static std::map<std::string, std::shared_ptr<ISoftbusDiscoveringCallback>> lnnOpsCbkMap;
-static std::map<std::string, int32_t> discoveredDeviceActionIdMap;
-static std::set<std::string> deviceIdSet;
+static DiscoveredDeviceCache discoveredDeviceCache(MAX_CACHED_DISCOVERED_DEVICE_SIZE, DISCOVERED_DEVICE_TTL_MS);
+static DmLruMap<int32_t> discoveredDeviceActionIdMap(MAX_CACHED_MAP_NUM);
+static DmLruMap<bool> deviceIdSet(MAX_CACHED_MAP_NUM);
 bool SoftbusListener::isRadarSoLoad_ = false;
 IDmRadarHelper* SoftbusListener::dmRadarHelper_ = nullptr;
 void* SoftbusListener::radarHandle_ = nullptr;
@@ -111,6 +116,103 @@ std::string SoftbusListener::hostName_ = "";
 int32_t g_onlineDeviceNum = 0;
 static std::map<std::string, std::queue<DmSoftbusEvent>> g_dmSoftbusEventQueueMap;
 
+#if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
+constexpr const char* LNN_OPS_DISPATCH_TASK = "LnnOpsDispatchTask";
+constexpr size_t MAX_LNN_OPS_PENDING_NUM = 256;
+
+/*
+ * Runs the callbacks of one subscriber in order on a ffrt task, so a slow subscriber does not hold the
+ * softbus thread. When the subscriber falls behind by MAX_LNN_OPS_PENDING_NUM events the oldest is dropped.
+ */
+class LnnOpsDispatchQueue : public std::enable_shared_from_this<LnnOpsDispatchQueue> {
+public:
+    void Post(std::function<void()> event)
+    {
+        bool dropped = false;
+        {
+            std::lock_guard<ffrt::mutex> lock(mtx_);
+            if (closed_) {
+                return;
+            }
+            if (events_.size() >= MAX_LNN_OPS_PENDING_NUM) {
+                events_.pop_front();
+                dropped = true;
+            }
+            events_.push_back(std::move(event));
+            if (!running_) {
+                running_ = true;
+                std::shared_ptr<LnnOpsDispatchQueue> self = shared_from_this();
+                ffrt::submit([self]() { self->Drain(); }, ffrt::task_attr().name(LNN_OPS_DISPATCH_TASK));
+            }
+        }
+        if (dropped) {
+            LOGE("subscriber falls behind, drop the oldest event.");
+            DM_PERF_COUNT(DmPerfCounter::SOFTBUS_CALLBACK_DROPPED);
+        }
+    }
+
+    // Pending events are discarded, an event already running is allowed to finish.
+    void Close()
+    {
+        std::lock_guard<ffrt::mutex> lock(mtx_);
+        closed_ = true;
+        events_.clear();
+    }
+
+    size_t PendingNum()
+    {
+        std::lock_guard<ffrt::mutex> lock(mtx_);
+        return events_.size();
+    }
+
+private:
+    void Drain()
+    {
+        while (true) {
+            std::function<void()> event;
+            {
+                std::lock_guard<ffrt::mutex> lock(mtx_);
+                if (closed_ || events_.empty()) {
+                    running_ = false;
+                    return;
+                }
+                event = std::move(events_.front());
+                events_.pop_front();
+            }
+            event();
+        }
+    }
+
+    ffrt::mutex mtx_;
+    std::deque<std::function<void()>> events_;
+    bool running_ = false;
+    bool closed_ = false;
+};
+#endif
+
+struct LnnOpsSubscriber {
+    std::shared_ptr<ISoftbusDiscoveringCallback> callback;
+#if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
+    // Null for subscribers that are called on the softbus thread.
+    std::shared_ptr<LnnOpsDispatchQueue> queue;
+#endif
+};
+using LnnOpsSubscriberMap = std::map<std::string, LnnOpsSubscriber>;
+
+// Immutable snapshot, replaced as a whole under g_lnnCbkMapMutex and read without any lock.
+static std::shared_ptr<const LnnOpsSubscriberMap> g_lnnOpsSubscribers = std::make_shared<const LnnOpsSubscriberMap>();
+
+static std::shared_ptr<const LnnOpsSubscriberMap> GetLnnOpsSubscribers()
+{
+    return std::atomic_load(&g_lnnOpsSubscribers);
+}
+
+static int64_t GetCacheTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 static int OnSessionOpened(int sessionId, int result)
 {
     return DeviceManagerService::GetInstance().OnSessionOpened(sessionId, result);
@@ -702,6 +804,7 @@ void SoftbusListener::OnDeviceTrustedChange(TrustChangeType type, const char *ms
 void SoftbusListener::OnSoftbusDeviceFound(const DeviceInfo *device)
 {
     CHECK_NULL_VOID(device);
+    DM_PERF_COUNT(DmPerfCounter::DEVICE_FOUND);
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
     if (DmConstrainsManager::GetInstance().CheckOsAccountConstraintEnabled(
         MultipleUserConnector::GetForgroundUserId(), DM_ACCOUNT_CONSTRAINT)) {
@@ -713,12 +816,13 @@ void SoftbusListener::OnSoftbusDeviceFound(const DeviceInfo *device)
     ConvertDeviceInfoToDmDevice(*device, dmDevInfo);
     {
         std::lock_guard<std::mutex> lock(g_lockDeviceIdSet);
-        if (deviceIdSet.find(std::string(dmDevInfo.deviceId)) == deviceIdSet.end()) {
-            if (deviceIdSet.size() >= MAX_CACHED_MAP_NUM) {
-                LOGE("deviceIdSet size exceed the limit!");
-                deviceIdSet.erase(deviceIdSet.begin());
-            }
-            deviceIdSet.insert(std::string(dmDevInfo.deviceId));
+        bool inserted = false;
+        bool evicted = false;
+        deviceIdSet.Put(std::string(dmDevInfo.deviceId), inserted, evicted);
+        if (evicted) {
+            LOGE("deviceIdSet size exceed the limit!");
+        }
+        if (inserted) {
             struct RadarInfo info = {
                 .funcName = "OnSoftbusDeviceFound",
                 .stageRes = static_cast<int32_t>(StageRes::STAGE_SUCC),
@@ -739,24 +843,51 @@ void SoftbusListener::OnSoftbusDeviceFound(const DeviceInfo *device)
         LOGE("GetAttrFromExtraData failed");
         return;
     }
-    std::lock_guard<std::mutex> lock(g_lnnCbkMapMutex);
-    if (discoveredDeviceActionIdMap.size() >= MAX_CACHED_MAP_NUM) {
-        LOGE("discoveredDeviceActionIdMap size exceed the limit!");
-        discoveredDeviceActionIdMap.erase(discoveredDeviceActionIdMap.begin());
+    {
+        std::lock_guard<std::mutex> lock(g_actionIdMapMutex);
+        bool inserted = false;
+        bool evicted = false;
+        discoveredDeviceActionIdMap.Put(dmDevInfo.deviceId, inserted, evicted) = actionId;
+        if (evicted) {
+            LOGE("discoveredDeviceActionIdMap size exceed the limit!");
+        }
     }
-    discoveredDeviceActionIdMap[dmDevInfo.deviceId] = actionId;
     CacheDiscoveredDevice(device);
-    for (auto &iter : lnnOpsCbkMap) {
-        iter.second->OnDeviceFound(iter.first, dmDevInfo, device->isOnline);
+    DM_PERF_SCOPE(DmPerfOp::SOFTBUS_DISCOVERY_CALLBACK);
+    bool isOnline = device->isOnline;
+    std::shared_ptr<const LnnOpsSubscriberMap> subscribers = GetLnnOpsSubscribers();
+    for (const auto &item : *subscribers) {
+#if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
+        if (item.second.queue != nullptr) {
+            std::string pkgName = item.first;
+            std::shared_ptr<ISoftbusDiscoveringCallback> callback = item.second.callback;
+            item.second.queue->Post([pkgName, callback, dmDevInfo, isOnline]() {
+                callback->OnDeviceFound(pkgName, dmDevInfo, isOnline);
+            });
+            continue;
+        }
+#endif
+        item.second.callback->OnDeviceFound(item.first, dmDevInfo, isOnline);
     }
 }
 
 void SoftbusListener::OnSoftbusDiscoveryResult(int subscribeId, RefreshResult result)
 {
     uint16_t originId = static_cast<uint16_t>((static_cast<uint32_t>(subscribeId)) & SOFTBUS_SUBSCRIBE_ID_MASK);
-    std::lock_guard<std::mutex> lock(g_lnnCbkMapMutex);
-    for (auto &iter : lnnOpsCbkMap) {
-        iter.second->OnDiscoveringResult(iter.first, originId, result);
+    DM_PERF_SCOPE(DmPerfOp::SOFTBUS_DISCOVERY_CALLBACK);
+    std::shared_ptr<const LnnOpsSubscriberMap> subscribers = GetLnnOpsSubscribers();
+    for (const auto &item : *subscribers) {
+#if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
+        if (item.second.queue != nullptr) {
+            std::string pkgName = item.first;
+            std::shared_ptr<ISoftbusDiscoveringCallback> callback = item.second.callback;
+            item.second.queue->Post([pkgName, callback, originId, result]() {
+                callback->OnDiscoveringResult(pkgName, originId, result);
+            });
+            continue;
+        }
+#endif
+        item.second.callback->OnDiscoveringResult(item.first, originId, result);
     }
 }
 
@@ -776,11 +907,16 @@ SoftbusListener::SoftbusListener()
 void SoftbusListener::CreateSessionServers()
 {
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
-    CreateDefaultSessionServer();
-    CreatePinHolderSessionServer();
-    Create3rdAuthACLSessionServer();
-    Create3rdAuthSessionServer();
-    Create3rdAuthCredSessionServer();
+    // Each is a round trip to softbus and none depends on another.
+    DmInitStageGraph graph;
+    graph.AddStage("DefaultSessionServer", {}, [this]() { CreateDefaultSessionServer(); });
+    graph.AddStage("PinHolderSessionServer", {}, [this]() { CreatePinHolderSessionServer(); });
+    graph.AddStage("3rdAuthACLSessionServer", {}, [this]() { Create3rdAuthACLSessionServer(); });
+    graph.AddStage("3rdAuthSessionServer", {}, [this]() { Create3rdAuthSessionServer(); });
+    graph.AddStage("3rdAuthCredSessionServer", {}, [this]() { Create3rdAuthCredSessionServer(); });
+    if (graph.Run() != DM_OK) {
+        LOGE("create session servers failed.");
+    }
 #endif
 }
 
@@ -963,7 +1099,7 @@ int32_t SoftbusListener::StopRefreshSoftbusLNN(uint16_t subscribeId)
     LOGI("begin, subscribeId: %{public}d.", (int32_t)subscribeId);
     {
         std::lock_guard<std::mutex> lock(g_lockDeviceIdSet);
-        deviceIdSet.clear();
+        deviceIdSet.Clear();
     }
     int32_t ret = ::StopRefreshLNN(DM_PKG_NAME, subscribeId);
     struct RadarInfo info = {
@@ -1029,26 +1165,59 @@ int32_t SoftbusListener::StopPublishSoftbusLNN(int32_t publishId)
 }
 
 int32_t SoftbusListener::RegisterSoftbusLnnOpsCbk(const std::string &pkgName,
-    const std::shared_ptr<ISoftbusDiscoveringCallback> callback)
+    const std::shared_ptr<ISoftbusDiscoveringCallback> callback, bool asyncDispatch)
 {
     if (callback == nullptr) {
         LOGE("RegisterSoftbusDiscoveringCbk failed, input callback is null.");
         return ERR_DM_POINT_NULL;
     }
     std::lock_guard<std::mutex> lock(g_lnnCbkMapMutex);
-    if (lnnOpsCbkMap.size() >= MAX_CACHED_MAP_NUM) {
+    std::shared_ptr<const LnnOpsSubscriberMap> current = GetLnnOpsSubscribers();
+    auto iter = current->find(pkgName);
+    if (iter == current->end() && current->size() >= MAX_CACHED_MAP_NUM) {
         LOGE("lnnOpsCbkMap size exceed the limit!");
         return ERR_DM_FAILED;
     }
-    lnnOpsCbkMap.erase(pkgName);
-    lnnOpsCbkMap.emplace(pkgName, callback);
+    LnnOpsSubscriber subscriber;
+    subscriber.callback = callback;
+#if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
+    std::shared_ptr<LnnOpsDispatchQueue> oldQueue = (iter != current->end()) ? iter->second.queue : nullptr;
+    if (asyncDispatch && oldQueue != nullptr && iter->second.callback == callback) {
+        // Same subscriber registers again, keep its queue so the callbacks stay in order.
+        subscriber.queue = oldQueue;
+    } else {
+        if (oldQueue != nullptr) {
+            oldQueue->Close();
+        }
+        if (asyncDispatch) {
+            subscriber.queue = std::make_shared<LnnOpsDispatchQueue>();
+        }
+    }
+#else
+    (void)asyncDispatch;
+#endif
+    auto next = std::make_shared<LnnOpsSubscriberMap>(*current);
+    (*next)[pkgName] = subscriber;
+    std::atomic_store(&g_lnnOpsSubscribers, std::shared_ptr<const LnnOpsSubscriberMap>(std::move(next)));
     return DM_OK;
 }
 
 int32_t SoftbusListener::UnRegisterSoftbusLnnOpsCbk(const std::string &pkgName)
 {
     std::lock_guard<std::mutex> lock(g_lnnCbkMapMutex);
-    lnnOpsCbkMap.erase(pkgName);
+    std::shared_ptr<const LnnOpsSubscriberMap> current = GetLnnOpsSubscribers();
+    auto iter = current->find(pkgName);
+    if (iter == current->end()) {
+        return DM_OK;
+    }
+#if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
+    if (iter->second.queue != nullptr) {
+        iter->second.queue->Close();
+    }
+#endif
+    auto next = std::make_shared<LnnOpsSubscriberMap>(*current);
+    next->erase(pkgName);
+    std::atomic_store(&g_lnnOpsSubscribers, std::shared_ptr<const LnnOpsSubscriberMap>(std::move(next)));
     return DM_OK;
 }
 
@@ -1290,56 +1459,34 @@ int32_t SoftbusListener::GetDeviceSecurityLevel(const char *networkId, int32_t &
 
 void SoftbusListener::CacheDiscoveredDevice(const DeviceInfo *device)
 {
-    std::shared_ptr<DeviceInfo> infoPtr = std::make_shared<DeviceInfo>();
-    if (memcpy_s(infoPtr.get(), sizeof(DeviceInfo), device, sizeof(DeviceInfo)) != DM_OK) {
-        LOGE("copy device info failed.");
-        return;
-    }
-
+    CHECK_NULL_VOID(device);
     std::lock_guard<std::mutex> lock(g_deviceMapMutex);
-    if (discoveredDeviceMap.size() == MAX_CACHED_DISCOVERED_DEVICE_SIZE) {
-        discoveredDeviceMap.erase(discoveredDeviceMap.begin());
-    }
-    CacheDeviceInfo(device->devId, infoPtr);
+    discoveredDeviceCache.Put(device->devId, *device, GetCacheTimeMs());
 }
 
 int32_t SoftbusListener::GetTargetInfoFromCache(const std::string &deviceId, PeerTargetId &targetId,
     ConnectionAddrType &addrType)
 {
-    std::lock_guard<std::mutex> lock(g_deviceMapMutex);
-    auto iter = discoveredDeviceMap.find(deviceId);
-    if (iter == discoveredDeviceMap.end()) {
-        LOGE("cannot found device in cached discovered map.");
-        return ERR_DM_BIND_INPUT_PARA_INVALID;
-    }
-    auto deviceVectorIter = iter->second;
-    if (deviceVectorIter.size() == 0) {
-        LOGE("cannot found deviceVectorIter in cached discovered map.");
-        return ERR_DM_BIND_INPUT_PARA_INVALID;
-    }
-    const ConnectionAddr *addrInfo = &((--deviceVectorIter.end())->second->addr)[0];
-    if (addrInfo == nullptr) {
-        LOGE("connection address of discovered device is nullptr.");
-        return ERR_DM_BIND_COMMON_FAILED;
+    ConnectionAddr addrInfo;
+    {
+        std::lock_guard<std::mutex> lock(g_deviceMapMutex);
+        if (!discoveredDeviceCache.GetLatestAddr(deviceId, GetCacheTimeMs(), addrInfo)) {
+            LOGE("cannot found device in cached discovered map.");
+            return ERR_DM_BIND_INPUT_PARA_INVALID;
+        }
     }
 
-    addrType = addrInfo->type;
-    if (addrInfo->type == ConnectionAddrType::CONNECTION_ADDR_ETH) {
-        std::string wifiIp((addrInfo->info).ip.ip);
-        targetId.wifiIp = wifiIp;
-        targetId.wifiPort = (addrInfo->info).ip.port;
-    } else if (addrInfo->type == ConnectionAddrType::CONNECTION_ADDR_WLAN) {
-        std::string wifiIp((addrInfo->info).ip.ip);
-        targetId.wifiIp = wifiIp;
-        targetId.wifiPort = (addrInfo->info).ip.port;
-    } else if (addrInfo->type == ConnectionAddrType::CONNECTION_ADDR_BR) {
-        std::string brMac((addrInfo->info).br.brMac);
-        targetId.brMac = brMac;
-    } else if (addrInfo->type == ConnectionAddrType::CONNECTION_ADDR_BLE) {
-        std::string bleMac((addrInfo->info).ble.bleMac);
-        targetId.bleMac = bleMac;
+    addrType = addrInfo.type;
+    if (addrInfo.type == ConnectionAddrType::CONNECTION_ADDR_ETH ||
+        addrInfo.type == ConnectionAddrType::CONNECTION_ADDR_WLAN) {
+        targetId.wifiIp = std::string(addrInfo.info.ip.ip);
+        targetId.wifiPort = addrInfo.info.ip.port;
+    } else if (addrInfo.type == ConnectionAddrType::CONNECTION_ADDR_BR) {
+        targetId.brMac = std::string(addrInfo.info.br.brMac);
+    } else if (addrInfo.type == ConnectionAddrType::CONNECTION_ADDR_BLE) {
+        targetId.bleMac = std::string(addrInfo.info.ble.bleMac);
     } else {
-        LOGI("Unknown connection address type: %{public}d.", addrInfo->type);
+        LOGI("Unknown connection address type: %{public}d.", addrInfo.type);
         return ERR_DM_BIND_COMMON_FAILED;
     }
     targetId.deviceId = deviceId;
@@ -1349,7 +1496,13 @@ int32_t SoftbusListener::GetTargetInfoFromCache(const std::string &deviceId, Pee
 void SoftbusListener::ClearDiscoveredDevice()
 {
     std::lock_guard<std::mutex> lock(g_deviceMapMutex);
-    discoveredDeviceMap.clear();
+    discoveredDeviceCache.Clear();
+}
+
+DiscoveredDeviceCacheStats SoftbusListener::GetDiscoveredDeviceCacheStats()
+{
+    std::lock_guard<std::mutex> lock(g_deviceMapMutex);
+    return discoveredDeviceCache.GetStats();
 }
 
 IDmRadarHelper* SoftbusListener::GetDmRadarHelperObj()
@@ -1407,69 +1560,26 @@ bool SoftbusListener::CloseDmRadarHelperObj(std::string name)
 
 void SoftbusListener::CacheDeviceInfo(const std::string deviceId, std::shared_ptr<DeviceInfo> infoPtr)
 {
-    if (deviceId.empty()) {
+    if (deviceId.empty() || infoPtr == nullptr) {
         return;
     }
     if (infoPtr->addrNum <= 0) {
         LOGE("infoPtr->addr is empty.");
         return;
     }
-    ConnectionAddrType addrType;
-    const ConnectionAddr *addrInfo = &(infoPtr->addr)[0];
-    if (addrInfo == nullptr) {
-        LOGE("connection address of discovered device is nullptr.");
-        return;
-    }
-    addrType = addrInfo->type;
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    auto iter = discoveredDeviceMap.find(deviceId);
-    if (iter != discoveredDeviceMap.end()) {
-        deviceVec = iter->second;
-        for (auto it = deviceVec.begin(); it != deviceVec.end();) {
-            if (it->first == addrType) {
-                it = deviceVec.erase(it);
-                continue;
-            } else {
-                it++;
-            }
-        }
-        discoveredDeviceMap.erase(deviceId);
-    }
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    std::lock_guard<std::mutex> lock(g_deviceMapMutex);
+    discoveredDeviceCache.Put(deviceId, *infoPtr, GetCacheTimeMs());
 }
 
 int32_t SoftbusListener::GetIPAddrTypeFromCache(const std::string &deviceId, const std::string &ip,
     ConnectionAddrType &addrType)
 {
     std::lock_guard<std::mutex> lock(g_deviceMapMutex);
-    auto iter = discoveredDeviceMap.find(deviceId);
-    if (iter == discoveredDeviceMap.end()) {
-        LOGE("cannot found device in cached discovered map.");
+    if (!discoveredDeviceCache.GetIpAddrType(deviceId, ip, GetCacheTimeMs(), addrType)) {
+        LOGE("cannot found ip addr of device in cached discovered map.");
         return ERR_DM_BIND_INPUT_PARA_INVALID;
     }
-    auto deviceVectorIter = iter->second;
-    if (deviceVectorIter.size() == 0) {
-        LOGE("GetTargetInfoFromCache failed, cannot found deviceVectorIter in cached discovered map.");
-        return ERR_DM_BIND_INPUT_PARA_INVALID;
-    }
-    for (auto it = deviceVectorIter.begin(); it != deviceVectorIter.end(); ++it) {
-        const ConnectionAddr *addrInfo = &((it->second)->addr)[0];
-        if (addrInfo == nullptr) {
-            continue;
-        }
-        if (addrInfo->type == ConnectionAddrType::CONNECTION_ADDR_ETH ||
-            addrInfo->type == ConnectionAddrType::CONNECTION_ADDR_WLAN ||
-            addrInfo->type == ConnectionAddrType::CONNECTION_ADDR_NCM) {
-            std::string cacheIp((addrInfo->info).ip.ip);
-            if (cacheIp == ip) {
-                addrType = addrInfo->type;
-                return DM_OK;
-            }
-        }
-    }
-    return ERR_DM_BIND_INPUT_PARA_INVALID;
+    return DM_OK;
 }
 
 void SoftbusListener::SetHostPkgName(const std::string hostName)
@@ -1720,11 +1830,12 @@ int32_t SoftbusListener::GetAttrFromCustomData(const cJSON *const customDataJson
 
 void SoftbusListener::GetActionId(const std::string &deviceId, int32_t &actionId)
 {
-    std::lock_guard<std::mutex> lock(g_lnnCbkMapMutex);
-    if (discoveredDeviceActionIdMap.find(deviceId) == discoveredDeviceActionIdMap.end()) {
+    std::lock_guard<std::mutex> lock(g_actionIdMapMutex);
+    int32_t *cachedActionId = discoveredDeviceActionIdMap.Find(deviceId);
+    if (cachedActionId == nullptr) {
         return;
     }
-    actionId = discoveredDeviceActionIdMap.find(deviceId)->second;
+    actionId = *cachedActionId;
 }
 
 #if !(defined(__LITEOS_M__) || defined(LITE_DEVICE))
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dm_init_stage_graph.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <queue>
+
+#include "dm_error_type.h"
+#include "dm_log.h"
+#include "dm_perf_stats.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+int64_t GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}
+
+int32_t DmInitStageGraph::AddStage(const std::string &name, const std::vector<std::string> &depends,
+    DmInitStageTask task)
+{
+    if (name.empty() || task == nullptr || stageIndex_.find(name) != stageIndex_.end()) {
+        LOGE("invalid stage %{public}s.", name.c_str());
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    Stage stage;
+    stage.name = name;
+    stage.depends = depends;
+    stage.task = task;
+    stageIndex_[name] = stages_.size();
+    stages_.push_back(std::move(stage));
+    return DM_OK;
+}
+
+bool DmInitStageGraph::BuildDependents()
+{
+    for (size_t i = 0; i < stages_.size(); i++) {
+        stages_[i].dependents.clear();
+    }
+    for (size_t i = 0; i < stages_.size(); i++) {
+        stages_[i].pendingDepends = stages_[i].depends.size();
+        for (const auto &depend : stages_[i].depends) {
+            auto iter = stageIndex_.find(depend);
+            if (iter == stageIndex_.end()) {
+                LOGE("stage %{public}s depends on unknown %{public}s.", stages_[i].name.c_str(), depend.c_str());
+                return false;
+            }
+            stages_[iter->second].dependents.push_back(i);
+        }
+    }
+    // Kahn's algorithm on a copy of the in-degree, any stage left over is part of a cycle.
+    std::vector<size_t> inDegree(stages_.size());
+    std::queue<size_t> ready;
+    for (size_t i = 0; i < stages_.size(); i++) {
+        inDegree[i] = stages_[i].pendingDepends;
+        if (inDegree[i] == 0) {
+            ready.push(i);
+        }
+    }
+    size_t visited = 0;
+    while (!ready.empty()) {
+        size_t index = ready.front();
+        ready.pop();
+        visited++;
+        for (size_t dependent : stages_[index].dependents) {
+            if (--inDegree[dependent] == 0) {
+                ready.push(dependent);
+            }
+        }
+    }
+    if (visited != stages_.size()) {
+        LOGE("init stage graph has a cycle.");
+        return false;
+    }
+    return true;
+}
+
+int32_t DmInitStageGraph::Run()
+{
+    if (stages_.empty()) {
+        return DM_OK;
+    }
+    if (!BuildDependents()) {
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    runBeginMs_ = GetSteadyTimeMs();
+    finishedCount_ = 0;
+    std::vector<size_t> roots;
+    for (size_t i = 0; i < stages_.size(); i++) {
+        if (stages_[i].pendingDepends == 0) {
+            roots.push_back(i);
+        }
+    }
+    for (size_t index : roots) {
+        Submit(index);
+    }
+    std::unique_lock<ffrt::mutex> lock(stageMutex_);
+    stageCv_.wait(lock, [this] { return finishedCount_ == stages_.size(); });
+    LOGI("all %{public}zu init stages finished, cost %{public}" PRId64 " ms.", stages_.size(),
+        GetSteadyTimeMs() - runBeginMs_);
+    return DM_OK;
+}
+
+void DmInitStageGraph::Submit(size_t index)
+{
+    ffrt::submit([this, index]() {
+            Stage &stage = stages_[index];
+            int64_t beginMs = GetSteadyTimeMs();
+            stage.task();
+            stage.costMs = GetSteadyTimeMs() - beginMs;
+            stage.beginMs = beginMs - runBeginMs_;
+            LOGI("init stage %{public}s begin at %{public}" PRId64 " ms, cost %{public}" PRId64 " ms.",
+                stage.name.c_str(), stage.beginMs, stage.costMs);
+            DmPerfStats::GetInstance().RecordStage(stage.name, stage.beginMs, stage.costMs);
+            OnStageDone(index);
+        }, ffrt::task_attr().name(stages_[index].name.c_str()));
+}
+
+void DmInitStageGraph::OnStageDone(size_t index)
+{
+    std::vector<size_t> readyStages;
+    {
+        std::lock_guard<ffrt::mutex> lock(stageMutex_);
+        for (size_t dependent : stages_[index].dependents) {
+            if (--stages_[dependent].pendingDepends == 0) {
+                readyStages.push_back(dependent);
+            }
+        }
+        finishedCount_++;
+        // Notify under the lock, Run() may return and release the graph right after.
+        stageCv_.notify_all();
+    }
+    for (size_t ready : readyStages) {
+        Submit(ready);
+    }
+}
+
+int64_t DmInitStageGraph::GetStageCostMs(const std::string &name) const
+{
+    auto iter = stageIndex_.find(name);
+    if (iter == stageIndex_.end()) {
+        return -1;
+    }
+    return stages_[iter->second].costMs;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
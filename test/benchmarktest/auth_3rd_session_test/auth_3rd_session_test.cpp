@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "dm_init_stage_graph.h"
+#include "session.h"
+#include "softbus_session_3rd.h"
+#include "softbus_session_stub.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::DistributedHardware;
+
+namespace {
+constexpr int64_t SOFTBUS_LATENCY_US = 2000;
+constexpr int32_t SESSION_IDLE_TIMEOUT = 10;
+constexpr int32_t SESSION_SERVER_NUM = 5;
+const char* const BENCHMARK_PKG_NAME = "com.ohos.benchmark.auth3rd";
+
+class Auth3rdSessionTest : public benchmark::Fixture {
+public:
+    Auth3rdSessionTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~Auth3rdSessionTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        SoftbusSessionStub::GetInstance().Reset();
+        session_ = std::make_shared<SoftbusSession3rd>();
+        targetId_.wifiIp = "192.168.1.2";
+        targetId_.wifiPort = 1;
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        session_ = nullptr;
+        SoftbusSessionStub::GetInstance().Reset();
+    }
+
+    static void CreateServer(int32_t index)
+    {
+        std::string sessionName = std::string(BENCHMARK_PKG_NAME) + ".session" + std::to_string(index);
+        CreateSessionServer(BENCHMARK_PKG_NAME, sessionName.c_str(), nullptr);
+    }
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+    std::shared_ptr<SoftbusSession3rd> session_ = nullptr;
+    PeerTargetId3rd targetId_;
+};
+
+// The previous startup created the session servers one after another.
+BENCHMARK_DEFINE_F(Auth3rdSessionTest, SequentialSessionServersTestCase)(benchmark::State &state)
+{
+    SoftbusSessionStub::GetInstance().SetLatencyUs(state.range(0));
+    for (auto _ : state) {
+        for (int32_t i = 0; i < SESSION_SERVER_NUM; i++) {
+            CreateServer(i);
+        }
+    }
+}
+BENCHMARK_REGISTER_F(Auth3rdSessionTest, SequentialSessionServersTestCase)->Arg(0)->Arg(SOFTBUS_LATENCY_US);
+
+BENCHMARK_DEFINE_F(Auth3rdSessionTest, StageGraphSessionServersTestCase)(benchmark::State &state)
+{
+    SoftbusSessionStub::GetInstance().SetLatencyUs(state.range(0));
+    for (auto _ : state) {
+        DmInitStageGraph graph;
+        for (int32_t i = 0; i < SESSION_SERVER_NUM; i++) {
+            graph.AddStage("session" + std::to_string(i), {}, [i]() { CreateServer(i); });
+        }
+        benchmark::DoNotOptimize(graph.Run());
+    }
+}
+BENCHMARK_REGISTER_F(Auth3rdSessionTest, StageGraphSessionServersTestCase)->Arg(0)->Arg(SOFTBUS_LATENCY_US);
+
+// The previous flow: every auth request to the peer opens its own session and closes it when done.
+BENCHMARK_DEFINE_F(Auth3rdSessionTest, ReopenSessionTestCase)(benchmark::State &state)
+{
+    SoftbusSessionStub::GetInstance().SetLatencyUs(state.range(0));
+    for (auto _ : state) {
+        bool isReused = false;
+        int32_t sessionId = session_->OpenSessionServer(targetId_, isReused);
+        session_->CloseAuthSession(sessionId);
+    }
+    state.counters["SessionOpens"] = static_cast<double>(SoftbusSessionStub::GetInstance().GetOpenCount());
+}
+BENCHMARK_REGISTER_F(Auth3rdSessionTest, ReopenSessionTestCase)->Arg(0)->Arg(SOFTBUS_LATENCY_US);
+
+BENCHMARK_DEFINE_F(Auth3rdSessionTest, ReuseIdleSessionTestCase)(benchmark::State &state)
+{
+    SoftbusSessionStub::GetInstance().SetLatencyUs(state.range(0));
+    for (auto _ : state) {
+        bool isReused = false;
+        int32_t sessionId = session_->OpenSessionServer(targetId_, isReused);
+        session_->ReleaseAuthSession(sessionId, SESSION_IDLE_TIMEOUT);
+    }
+    state.counters["SessionOpens"] = static_cast<double>(SoftbusSessionStub::GetInstance().GetOpenCount());
+}
+BENCHMARK_REGISTER_F(Auth3rdSessionTest, ReuseIdleSessionTestCase)->Arg(0)->Arg(SOFTBUS_LATENCY_US);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
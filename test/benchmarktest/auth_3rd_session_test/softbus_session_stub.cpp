@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "softbus_session_stub.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "inner_session.h"
+#include "session.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+std::mutex g_stubMutex;
+}
+
+SoftbusSessionStub &SoftbusSessionStub::GetInstance()
+{
+    static SoftbusSessionStub instance;
+    return instance;
+}
+
+void SoftbusSessionStub::SetLatencyUs(int64_t latencyUs)
+{
+    std::lock_guard<std::mutex> lock(g_stubMutex);
+    latencyUs_ = latencyUs;
+}
+
+void SoftbusSessionStub::Reset()
+{
+    std::lock_guard<std::mutex> lock(g_stubMutex);
+    latencyUs_ = 0;
+    nextSessionId_ = 1;
+    openCount_ = 0;
+    openedCount_ = 0;
+}
+
+uint64_t SoftbusSessionStub::GetOpenCount() const
+{
+    std::lock_guard<std::mutex> lock(g_stubMutex);
+    return openCount_;
+}
+
+uint64_t SoftbusSessionStub::GetOpenedCount() const
+{
+    std::lock_guard<std::mutex> lock(g_stubMutex);
+    return openedCount_;
+}
+
+void SoftbusSessionStub::Wait() const
+{
+    int64_t latencyUs = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_stubMutex);
+        latencyUs = latencyUs_;
+    }
+    if (latencyUs > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(latencyUs));
+    }
+}
+
+int32_t SoftbusSessionStub::Open()
+{
+    Wait();
+    std::lock_guard<std::mutex> lock(g_stubMutex);
+    openCount_++;
+    openedCount_++;
+    return nextSessionId_++;
+}
+
+void SoftbusSessionStub::Close(int32_t sessionId)
+{
+    (void)sessionId;
+    std::lock_guard<std::mutex> lock(g_stubMutex);
+    if (openedCount_ > 0) {
+        openedCount_--;
+    }
+}
+
+int32_t SoftbusSessionStub::CreateServer()
+{
+    Wait();
+    return 0;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
+
+using OHOS::DistributedHardware::SoftbusSessionStub;
+
+int OpenAuthSession(const char *sessionName, const ConnectionAddr *addrInfo, int num, const char *mixAddr)
+{
+    (void)sessionName;
+    (void)addrInfo;
+    (void)num;
+    (void)mixAddr;
+    return SoftbusSessionStub::GetInstance().Open();
+}
+
+void CloseSession(int sessionId)
+{
+    SoftbusSessionStub::GetInstance().Close(sessionId);
+}
+
+int SendBytes(int sessionId, const void *data, unsigned int len)
+{
+    (void)sessionId;
+    (void)data;
+    (void)len;
+    return 0;
+}
+
+int CreateSessionServer(const char *pkgName, const char *sessionName, const ISessionListener *listener)
+{
+    (void)pkgName;
+    (void)sessionName;
+    (void)listener;
+    return SoftbusSessionStub::GetInstance().CreateServer();
+}
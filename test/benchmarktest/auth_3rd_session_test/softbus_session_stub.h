@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_SOFTBUS_SESSION_STUB_H
+#define OHOS_SOFTBUS_SESSION_STUB_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedHardware {
+/*
+ * Stands in for the softbus client calls the auth session paths make, each one sleeping for
+ * the configured cost of a round trip to the softbus service.
+ */
+class SoftbusSessionStub {
+public:
+    static SoftbusSessionStub &GetInstance();
+
+    void SetLatencyUs(int64_t latencyUs);
+    void Reset();
+    uint64_t GetOpenCount() const;
+    uint64_t GetOpenedCount() const;
+
+    int32_t Open();
+    void Close(int32_t sessionId);
+    int32_t CreateServer();
+
+private:
+    void Wait() const;
+
+    int64_t latencyUs_ = 0;
+    int32_t nextSessionId_ = 1;
+    uint64_t openCount_ = 0;
+    uint64_t openedCount_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_SOFTBUS_SESSION_STUB_H
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "dm_auth_message_schema.h"
+#include "dm_error_type.h"
+#include "json_object.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::DistributedHardware;
+
+namespace {
+// Same keys as the auth v2 message processor.
+const char* const TAG_MSG_TYPE = "MSG_TYPE";
+const char* const TAG_DATA = "data";
+const char* const TAG_LNN_PUBLIC_KEY = "lnnPublicKey";
+const char* const TAG_TRANSMIT_PUBLIC_KEY = "transmitPublicKey";
+const char* const TAG_DEVICE_ID = "DEVICEID";
+const char* const TAG_PEER_USER_SPACE_ID = "peerUserSpaceId";
+const char* const TAG_TOKEN_ID = "tokenId";
+const char* const TAG_REPLY = "REPLY";
+const char* const TAG_REASON = "reason";
+const char* const TAG_REMAINING_FROZEN_TIME = "remainingFrozenTime";
+constexpr int32_t MSG_TYPE_REQ_CREDENTIAL_EXCHANGE = 140;
+constexpr int32_t MSG_TYPE_AUTH_REQ_FINISH = 201;
+constexpr int32_t PUBLIC_KEY_LEN = 182;
+constexpr int32_t UDID_LEN = 64;
+std::atomic<int64_t> g_allocCount {0};
+}
+
+// Heap allocations, so every case can report how many one decode costs.
+void *operator new(size_t size)
+{
+    void *ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t size) noexcept
+{
+    (void)size;
+    free(ptr);
+}
+
+namespace {
+using CredExchangeSchema = DmAuthMsgSchema<DmAuthCredExchangeMsg>;
+using FinishSchema = DmAuthMsgSchema<DmAuthFinishMsg>;
+
+const CredExchangeSchema &GetCredExchangeSchema()
+{
+    static const CredExchangeSchema schema("credential exchange message", {
+        CredExchangeSchema::Str(TAG_TRANSMIT_PUBLIC_KEY, &DmAuthCredExchangeMsg::transmitPublicKey),
+        CredExchangeSchema::Str(TAG_DEVICE_ID, &DmAuthCredExchangeMsg::deviceId),
+        CredExchangeSchema::Int32(TAG_PEER_USER_SPACE_ID, &DmAuthCredExchangeMsg::userId),
+        CredExchangeSchema::Int64(TAG_TOKEN_ID, &DmAuthCredExchangeMsg::tokenId),
+        CredExchangeSchema::Str(TAG_LNN_PUBLIC_KEY, &DmAuthCredExchangeMsg::lnnPublicKey,
+            &DmAuthCredExchangeMsg::hasLnnPublicKey),
+    });
+    return schema;
+}
+
+const FinishSchema &GetFinishSchema()
+{
+    static const FinishSchema schema("finish message", {
+        FinishSchema::Int32(TAG_REPLY, &DmAuthFinishMsg::reply, &DmAuthFinishMsg::hasReply),
+        FinishSchema::Int32(TAG_REASON, &DmAuthFinishMsg::reason, &DmAuthFinishMsg::hasReason),
+        FinishSchema::Int64(TAG_REMAINING_FROZEN_TIME, &DmAuthFinishMsg::remainingFrozenTime,
+            &DmAuthFinishMsg::hasRemainingFrozenTime),
+    });
+    return schema;
+}
+
+// The previous 140 handler body, minus the decryption both paths share.
+int32_t LegacyParseCredExchange(const string &message, DmAuthCredExchangeMsg &msg)
+{
+    JsonObject jsonObject(message);
+    if (jsonObject.IsDiscarded() || !jsonObject[TAG_DATA].IsString()) {
+        return ERR_DM_FAILED;
+    }
+    string plainText = jsonObject[TAG_DATA].Get<std::string>();
+    JsonObject jsonData(plainText);
+    if (!jsonData[TAG_LNN_PUBLIC_KEY].IsString()) {
+        return ERR_DM_FAILED;
+    }
+    msg.lnnPublicKey = jsonData[TAG_LNN_PUBLIC_KEY].Get<std::string>();
+    if (!jsonData[TAG_TRANSMIT_PUBLIC_KEY].IsString() ||
+        !jsonData[TAG_DEVICE_ID].IsString() ||
+        !jsonData[TAG_PEER_USER_SPACE_ID].IsNumberInteger() ||
+        !jsonData[TAG_TOKEN_ID].IsNumberInteger()) {
+        return ERR_DM_FAILED;
+    }
+    msg.transmitPublicKey = jsonData[TAG_TRANSMIT_PUBLIC_KEY].Get<std::string>();
+    msg.deviceId = jsonData[TAG_DEVICE_ID].Get<std::string>();
+    msg.userId = jsonData[TAG_PEER_USER_SPACE_ID].Get<int32_t>();
+    msg.tokenId = jsonData[TAG_TOKEN_ID].Get<int64_t>();
+    return DM_OK;
+}
+
+int32_t SchemaParseCredExchange(const string &message, DmAuthCredExchangeMsg &msg)
+{
+    JsonObject jsonObject(message);
+    string plainText;
+    if (jsonObject.IsDiscarded() || !ReadAuthField(jsonObject, TAG_DATA, plainText)) {
+        return ERR_DM_FAILED;
+    }
+    JsonObject jsonData;
+    if (!jsonData.Parse(plainText)) {
+        return ERR_DM_FAILED;
+    }
+    return GetCredExchangeSchema().Decode(jsonData, msg);
+}
+
+// The previous 201 handler body.
+int32_t LegacyParseFinish(const string &message, DmAuthFinishMsg &msg)
+{
+    JsonObject jsonObject(message);
+    if (jsonObject[TAG_REPLY].IsNumberInteger()) {
+        msg.reply = jsonObject[TAG_REPLY].Get<int32_t>();
+    }
+    if (jsonObject[TAG_REASON].IsNumberInteger()) {
+        msg.reason = jsonObject[TAG_REASON].Get<int32_t>();
+    }
+    if (jsonObject[TAG_REMAINING_FROZEN_TIME].IsNumberInteger()) {
+        msg.remainingFrozenTime = jsonObject[TAG_REMAINING_FROZEN_TIME].Get<int64_t>();
+    }
+    return DM_OK;
+}
+
+int32_t SchemaParseFinish(const string &message, DmAuthFinishMsg &msg)
+{
+    JsonObject jsonObject(message);
+    return GetFinishSchema().Decode(jsonObject, msg);
+}
+
+class AuthMessageSchemaTest : public benchmark::Fixture {
+public:
+    AuthMessageSchemaTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~AuthMessageSchemaTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        JsonObject plainJson;
+        plainJson[TAG_LNN_PUBLIC_KEY] = string(PUBLIC_KEY_LEN, 'L');
+        plainJson[TAG_TRANSMIT_PUBLIC_KEY] = string(PUBLIC_KEY_LEN, 'T');
+        plainJson[TAG_DEVICE_ID] = string(UDID_LEN, 'D');
+        plainJson[TAG_PEER_USER_SPACE_ID] = 100;
+        plainJson[TAG_TOKEN_ID] = static_cast<int64_t>(537000000);
+        JsonObject credJson;
+        credJson[TAG_MSG_TYPE] = MSG_TYPE_REQ_CREDENTIAL_EXCHANGE;
+        credJson[TAG_DATA] = plainJson.Dump();
+        credMessage_ = credJson.Dump();
+
+        JsonObject finishJson;
+        finishJson[TAG_MSG_TYPE] = MSG_TYPE_AUTH_REQ_FINISH;
+        finishJson[TAG_REPLY] = DM_OK;
+        finishJson[TAG_REASON] = DM_OK;
+        finishJson[TAG_REMAINING_FROZEN_TIME] = static_cast<int64_t>(0);
+        finishMessage_ = finishJson.Dump();
+        GetCredExchangeSchema();
+        GetFinishSchema();
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+    }
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 10000;
+    string credMessage_;
+    string finishMessage_;
+};
+
+BENCHMARK_F(AuthMessageSchemaTest, LegacyCredExchangeTestCase)(benchmark::State &state)
+{
+    int64_t allocs = 0;
+    for (auto _ : state) {
+        DmAuthCredExchangeMsg msg;
+        int64_t before = g_allocCount.load(std::memory_order_relaxed);
+        benchmark::DoNotOptimize(LegacyParseCredExchange(credMessage_, msg));
+        allocs += g_allocCount.load(std::memory_order_relaxed) - before;
+    }
+    state.counters["AllocsPerMsg"] = static_cast<double>(allocs) / state.iterations();
+}
+
+BENCHMARK_F(AuthMessageSchemaTest, SchemaCredExchangeTestCase)(benchmark::State &state)
+{
+    int64_t allocs = 0;
+    for (auto _ : state) {
+        DmAuthCredExchangeMsg msg;
+        int64_t before = g_allocCount.load(std::memory_order_relaxed);
+        benchmark::DoNotOptimize(SchemaParseCredExchange(credMessage_, msg));
+        allocs += g_allocCount.load(std::memory_order_relaxed) - before;
+    }
+    state.counters["AllocsPerMsg"] = static_cast<double>(allocs) / state.iterations();
+}
+
+BENCHMARK_F(AuthMessageSchemaTest, LegacyFinishTestCase)(benchmark::State &state)
+{
+    int64_t allocs = 0;
+    for (auto _ : state) {
+        DmAuthFinishMsg msg;
+        int64_t before = g_allocCount.load(std::memory_order_relaxed);
+        benchmark::DoNotOptimize(LegacyParseFinish(finishMessage_, msg));
+        allocs += g_allocCount.load(std::memory_order_relaxed) - before;
+    }
+    state.counters["AllocsPerMsg"] = static_cast<double>(allocs) / state.iterations();
+}
+
+BENCHMARK_F(AuthMessageSchemaTest, SchemaFinishTestCase)(benchmark::State &state)
+{
+    int64_t allocs = 0;
+    for (auto _ : state) {
+        DmAuthFinishMsg msg;
+        int64_t before = g_allocCount.load(std::memory_order_relaxed);
+        benchmark::DoNotOptimize(SchemaParseFinish(finishMessage_, msg));
+        allocs += g_allocCount.load(std::memory_order_relaxed) - before;
+    }
+    state.counters["AllocsPerMsg"] = static_cast<double>(allocs) / state.iterations();
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+#include "mbedtls/base64.h"
+
+#include "crypto_mgr.h"
+#include "dm_auth_sync_envelope.h"
+#include "dm_error_type.h"
+#include "json_object.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::DistributedHardware;
+
+namespace {
+// Same keys as the auth v2 message processor.
+const char* const TAG_SYNC = "syncMessage";
+const char* const TAG_SYNC_V2 = "syncMessageV2";
+const char* const TAG_COMPRESS_ORI_LEN = "compressOriLen";
+const char* const TAG_COMPRESS = "compressMsg";
+constexpr int32_t MSG_TYPE_SYNC = 180;
+constexpr int32_t UDID_HASH_LEN = 64;
+
+string FakeHex(int32_t seed, int32_t len)
+{
+    static const char hexChars[] = "0123456789ABCDEF";
+    string result;
+    uint32_t value = static_cast<uint32_t>(seed) * 2654435761u + 1;
+    for (int32_t i = 0; i < len; i++) {
+        value = value * 1103515245u + 12345u;
+        result.push_back(hexChars[(value >> 16) & 0xF]);
+    }
+    return result;
+}
+
+// A 180 message body carrying aclCount access control entries, field set of DmAccessToSync.
+string BuildSyncMsg(int32_t aclCount)
+{
+    JsonObject syncJson;
+    syncJson["accessAppSKId"] = "1025";
+    syncJson["accessUserSKId"] = "1026";
+    syncJson["accessAppSKTimeStamp"] = "1767225600000";
+    syncJson["accessUserSKTimeStamp"] = "1767225600000";
+    syncJson["dmVersion"] = "5.1.3";
+    JsonObject aclArray(JsonCreateType::JSON_CREATE_TYPE_ARRAY);
+    for (int32_t i = 0; i < aclCount; i++) {
+        JsonObject acl;
+        acl["deviceName"] = "Phone " + to_string(i);
+        acl["deviceNameFull"] = "HUAWEI Phone " + to_string(i);
+        acl["deviceId"] = FakeHex(i, UDID_HASH_LEN);
+        acl["userId"] = 100;
+        acl["accountId"] = FakeHex(i + aclCount, UDID_HASH_LEN);
+        acl["tokenId"] = static_cast<int64_t>(537000000 + i);
+        acl["bundleName"] = "com.example.app" + to_string(i);
+        acl["pkgName"] = "com.example.app" + to_string(i);
+        acl["bindLevel"] = 3;
+        acl["sessionKeyId"] = 1000 + i;
+        acl["skTimeStamp"] = static_cast<int64_t>(1767225600000);
+        aclArray.PushBack(acl);
+    }
+    syncJson["accessControlTable"] = aclArray.Dump();
+    return syncJson.Dump();
+}
+
+string Base64Encode(const string &input)
+{
+    size_t maxLen = ((input.size() + 2) / 3) * 4 + 1;
+    vector<unsigned char> buffer(maxLen);
+    size_t outLen = 0;
+    if (mbedtls_base64_encode(buffer.data(), buffer.size(), &outLen,
+        reinterpret_cast<const unsigned char*>(input.data()), input.size()) != 0) {
+        return "";
+    }
+    return string(reinterpret_cast<const char*>(buffer.data()), outLen);
+}
+
+string Base64Decode(const string &input)
+{
+    size_t maxLen = (input.size() / 4) * 3 + 1;
+    vector<unsigned char> buffer(maxLen);
+    size_t outLen = 0;
+    if (mbedtls_base64_decode(buffer.data(), buffer.size(), &outLen,
+        reinterpret_cast<const unsigned char*>(input.data()), input.size()) != 0) {
+        return "";
+    }
+    return string(reinterpret_cast<const char*>(buffer.data()), outLen);
+}
+
+string Compress(const string &input)
+{
+    uLongf destLen = compressBound(input.size());
+    string output(destLen, '\0');
+    if (compress(reinterpret_cast<Bytef *>(&output[0]), &destLen,
+        reinterpret_cast<const Bytef *>(input.data()), input.size()) != Z_OK) {
+        return "";
+    }
+    output.resize(destLen);
+    return output;
+}
+
+string Decompress(const string &input, uint32_t oriLen)
+{
+    string output(oriLen, '\0');
+    uLongf destLen = oriLen;
+    if (uncompress(reinterpret_cast<Bytef *>(&output[0]), &destLen,
+        reinterpret_cast<const Bytef *>(input.data()), input.size()) != Z_OK) {
+        return "";
+    }
+    return output;
+}
+
+// Legacy sender: json -> zlib -> base64 -> json -> AES-GCM -> hex -> outer json.
+string LegacyEncode(CryptoMgr &cryptoMgr, const string &syncMsg)
+{
+    JsonObject plainJson;
+    plainJson[TAG_COMPRESS_ORI_LEN] = syncMsg.size();
+    plainJson[TAG_COMPRESS] = Base64Encode(Compress(syncMsg));
+    string encSyncMsg;
+    cryptoMgr.EncryptMessage(plainJson.Dump(), encSyncMsg);
+    JsonObject message;
+    message["MSG_TYPE"] = MSG_TYPE_SYNC;
+    message[TAG_SYNC] = encSyncMsg;
+    return message.Dump();
+}
+
+string LegacyDecode(CryptoMgr &cryptoMgr, const string &wire)
+{
+    JsonObject message(wire);
+    string plain;
+    cryptoMgr.DecryptMessage(message[TAG_SYNC].Get<string>(), plain);
+    JsonObject plainJson(plain);
+    string compressMsg = Base64Decode(plainJson[TAG_COMPRESS].Get<string>());
+    return Decompress(compressMsg, plainJson[TAG_COMPRESS_ORI_LEN].Get<uint32_t>());
+}
+
+// Envelope sender: header + zlib -> AES-GCM -> base64 -> outer json.
+string EnvelopeEncode(CryptoMgr &cryptoMgr, const string &syncMsg)
+{
+    string envelope;
+    DmAuthSyncEnvelope::Pack(syncMsg, envelope);
+    string cipherData;
+    cryptoMgr.EncryptData(envelope, cipherData);
+    JsonObject message;
+    message["MSG_TYPE"] = MSG_TYPE_SYNC;
+    message[TAG_SYNC_V2] = Base64Encode(cipherData);
+    return message.Dump();
+}
+
+string EnvelopeDecode(CryptoMgr &cryptoMgr, const string &wire)
+{
+    JsonObject message(wire);
+    string envelope;
+    cryptoMgr.DecryptData(Base64Decode(message[TAG_SYNC_V2].Get<string>()), envelope);
+    string syncMsg;
+    DmAuthSyncEnvelope::Unpack(envelope, syncMsg);
+    return syncMsg;
+}
+
+class AuthSyncEnvelopeTest : public benchmark::Fixture {
+public:
+    AuthSyncEnvelopeTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~AuthSyncEnvelopeTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        uint8_t sessionKey[SESSION_KEY_LENGTH] = "benchmark_session_key_000000000";
+        cryptoMgr_.ProcessSessionKey(sessionKey, SESSION_KEY_LENGTH);
+        syncMsg_ = BuildSyncMsg(static_cast<int32_t>(state.range(0)));
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        cryptoMgr_.ClearSessionKey();
+    }
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 200;
+    CryptoMgr cryptoMgr_;
+    string syncMsg_;
+};
+
+BENCHMARK_DEFINE_F(AuthSyncEnvelopeTest, LegacyEncodeTestCase)(benchmark::State &state)
+{
+    string wire;
+    for (auto _ : state) {
+        wire = LegacyEncode(cryptoMgr_, syncMsg_);
+    }
+    state.counters["plainBytes"] = static_cast<double>(syncMsg_.size());
+    state.counters["wireBytes"] = static_cast<double>(wire.size());
+}
+
+BENCHMARK_DEFINE_F(AuthSyncEnvelopeTest, EnvelopeEncodeTestCase)(benchmark::State &state)
+{
+    string wire;
+    for (auto _ : state) {
+        wire = EnvelopeEncode(cryptoMgr_, syncMsg_);
+    }
+    state.counters["plainBytes"] = static_cast<double>(syncMsg_.size());
+    state.counters["wireBytes"] = static_cast<double>(wire.size());
+}
+
+BENCHMARK_DEFINE_F(AuthSyncEnvelopeTest, LegacyDecodeTestCase)(benchmark::State &state)
+{
+    string wire = LegacyEncode(cryptoMgr_, syncMsg_);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LegacyDecode(cryptoMgr_, wire));
+    }
+}
+
+BENCHMARK_DEFINE_F(AuthSyncEnvelopeTest, EnvelopeDecodeTestCase)(benchmark::State &state)
+{
+    string wire = EnvelopeEncode(cryptoMgr_, syncMsg_);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(EnvelopeDecode(cryptoMgr_, wire));
+    }
+}
+
+// ACL counts seen between a phone and its peers, from a fresh pairing up to a crowded account.
+BENCHMARK_REGISTER_F(AuthSyncEnvelopeTest, LegacyEncodeTestCase)->Arg(1)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_REGISTER_F(AuthSyncEnvelopeTest, EnvelopeEncodeTestCase)->Arg(1)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_REGISTER_F(AuthSyncEnvelopeTest, LegacyDecodeTestCase)->Arg(1)->Arg(8)->Arg(32)->Arg(128);
+BENCHMARK_REGISTER_F(AuthSyncEnvelopeTest, EnvelopeDecodeTestCase)->Arg(1)->Arg(8)->Arg(32)->Arg(128);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "mbedtls/cipher.h"
+#include "mbedtls/gcm.h"
+
+#include "crypto_mgr.h"
+#include "dm_error_type.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::DistributedHardware;
+
+namespace {
+constexpr uint32_t TAG_LEN = 16;
+constexpr uint32_t KEY_BITS_UNIT = 8;
+constexpr uint32_t HEADER_LEN = 8;
+const uint8_t BENCH_KEY[SESSION_KEY_LENGTH] = "benchmark_session_key_000000000";
+
+// The previous per message path: expand the key schedule, encrypt, drop the context.
+int32_t PerCallEncrypt(const vector<uint8_t> &plain, vector<uint8_t> &output)
+{
+    output.assign(GCM_IV_LEN + plain.size() + TAG_LEN, 0);
+    mbedtls_gcm_context aesContext;
+    mbedtls_gcm_init(&aesContext);
+    int32_t ret = mbedtls_gcm_setkey(&aesContext, MBEDTLS_CIPHER_ID_AES, BENCH_KEY,
+        SESSION_KEY_LENGTH * KEY_BITS_UNIT);
+    if (ret == 0) {
+        ret = mbedtls_gcm_crypt_and_tag(&aesContext, MBEDTLS_GCM_ENCRYPT, plain.size(), output.data(), GCM_IV_LEN,
+            nullptr, 0, plain.data(), output.data() + GCM_IV_LEN, TAG_LEN,
+            output.data() + GCM_IV_LEN + plain.size());
+    }
+    mbedtls_gcm_free(&aesContext);
+    return ret == 0 ? DM_OK : ERR_DM_CRYPTO_OPT_FAILED;
+}
+
+class CryptoMgrTest : public benchmark::Fixture {
+public:
+    CryptoMgrTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~CryptoMgrTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        cryptoMgr_.ProcessSessionKey(BENCH_KEY, SESSION_KEY_LENGTH);
+        header_.assign(HEADER_LEN, 'h');
+        plain_.assign(static_cast<size_t>(state.range(0)), 'p');
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        cryptoMgr_.ClearSessionKey();
+    }
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 500;
+    CryptoMgr cryptoMgr_;
+    vector<uint8_t> header_;
+    vector<uint8_t> plain_;
+};
+
+BENCHMARK_DEFINE_F(CryptoMgrTest, PerCallSetKeyEncryptTestCase)(benchmark::State &state)
+{
+    vector<uint8_t> output;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(PerCallEncrypt(plain_, output));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(CryptoMgrTest, EncryptDataTestCase)(benchmark::State &state)
+{
+    string plain(plain_.begin(), plain_.end());
+    string output;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cryptoMgr_.EncryptData(plain, output));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Header and payload gathered without concatenating, into a buffer reused across messages.
+BENCHMARK_DEFINE_F(CryptoMgrTest, EncryptSegmentsTestCase)(benchmark::State &state)
+{
+    vector<DmCryptoSegment> segments = {
+        { header_.data(), static_cast<uint32_t>(header_.size()) },
+        { plain_.data(), static_cast<uint32_t>(plain_.size()) },
+    };
+    vector<uint8_t> output;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cryptoMgr_.EncryptSegments(segments, output));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(CryptoMgrTest, DecryptSegmentsTestCase)(benchmark::State &state)
+{
+    vector<uint8_t> cipher;
+    cryptoMgr_.EncryptSegments({ { plain_.data(), static_cast<uint32_t>(plain_.size()) } }, cipher);
+    vector<DmCryptoSegment> segments = { { cipher.data(), static_cast<uint32_t>(cipher.size()) } };
+    vector<uint8_t> output;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cryptoMgr_.DecryptSegments(segments, output));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// From a short control message up to a large sync payload.
+BENCHMARK_REGISTER_F(CryptoMgrTest, PerCallSetKeyEncryptTestCase)->Arg(64)->Arg(512)->Arg(4096)->Arg(65536);
+BENCHMARK_REGISTER_F(CryptoMgrTest, EncryptDataTestCase)->Arg(64)->Arg(512)->Arg(4096)->Arg(65536);
+BENCHMARK_REGISTER_F(CryptoMgrTest, EncryptSegmentsTestCase)->Arg(64)->Arg(512)->Arg(4096)->Arg(65536);
+BENCHMARK_REGISTER_F(CryptoMgrTest, DecryptSegmentsTestCase)->Arg(64)->Arg(512)->Arg(4096)->Arg(65536);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
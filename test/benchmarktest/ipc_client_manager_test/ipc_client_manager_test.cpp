@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "device_manager_ipc_interface_code.h"
+#include "dm_error_type.h"
+#include "ipc_client_manager.h"
+#include "ipc_remote_broker.h"
+#include "ipc_req.h"
+#include "ipc_rsp.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::DistributedHardware;
+
+namespace {
+constexpr int64_t TRANSACTION_LATENCY_US = 200;
+
+// Stands in for the service proxy, every command takes one binder round trip worth of time.
+class LoopbackBroker : public IpcRemoteBroker {
+public:
+    int32_t SendCmd(int32_t cmdCode, std::shared_ptr<IpcReq> req, std::shared_ptr<IpcRsp> rsp) override
+    {
+        (void)cmdCode;
+        (void)req;
+        std::this_thread::sleep_for(std::chrono::microseconds(TRANSACTION_LATENCY_US));
+        rsp->SetErrCode(DM_OK);
+        return DM_OK;
+    }
+
+    sptr<IRemoteObject> AsObject() override
+    {
+        return nullptr;
+    }
+};
+
+std::shared_ptr<IpcClientManager> GetClientManager()
+{
+    static std::shared_ptr<IpcClientManager> instance = [] {
+        std::shared_ptr<IpcClientManager> manager = std::make_shared<IpcClientManager>();
+        manager->dmInterface_ = sptr<IpcRemoteBroker>(new LoopbackBroker());
+        return manager;
+    }();
+    return instance;
+}
+
+class IpcClientManagerTest : public benchmark::Fixture {
+public:
+    IpcClientManagerTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~IpcClientManagerTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        GetClientManager();
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+    }
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 500;
+};
+
+// The previous SendRequest held the manager lock for the whole transaction.
+BENCHMARK_DEFINE_F(IpcClientManagerTest, GlobalLockSendRequestTestCase)(benchmark::State &state)
+{
+    static std::mutex sendLock;
+    std::shared_ptr<IpcClientManager> manager = GetClientManager();
+    for (auto _ : state) {
+        std::lock_guard<std::mutex> autoLock(sendLock);
+        benchmark::DoNotOptimize(manager->SendRequest(GET_TRUST_DEVICE_LIST,
+            std::make_shared<IpcReq>(), std::make_shared<IpcRsp>()));
+    }
+}
+BENCHMARK_REGISTER_F(IpcClientManagerTest, GlobalLockSendRequestTestCase)
+    ->Threads(1)->Threads(4)->Threads(8)->UseRealTime();
+
+BENCHMARK_DEFINE_F(IpcClientManagerTest, SendRequestTestCase)(benchmark::State &state)
+{
+    std::shared_ptr<IpcClientManager> manager = GetClientManager();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager->SendRequest(GET_TRUST_DEVICE_LIST,
+            std::make_shared<IpcReq>(), std::make_shared<IpcRsp>()));
+    }
+}
+BENCHMARK_REGISTER_F(IpcClientManagerTest, SendRequestTestCase)
+    ->Threads(1)->Threads(4)->Threads(8)->UseRealTime();
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <securec.h>
+
+#include "mine_softbus_listener.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::DistributedHardware;
+
+namespace {
+constexpr char VERTEX_TYPE_TLV = 1;
+constexpr char VERTEX_SN_TLV = 2;
+constexpr char VERTEX_UDID_TLV = 3;
+constexpr size_t VERTEX_TLV_DATA_OFFSET = 2;
+constexpr size_t VERTEX_TLV_LEN = VERTEX_TLV_DATA_OFFSET + DM_HASH_DATA_LEN;
+
+class MineSoftbusListenerTest : public benchmark::Fixture {
+public:
+    MineSoftbusListenerTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~MineSoftbusListenerTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        (void)memset_s(&deviceInfo_, sizeof(deviceInfo_), 0, sizeof(deviceInfo_));
+        (void)memset_s(output_, sizeof(output_), 0, sizeof(output_));
+        // A vertex search for type, sn and udid, the common shape of a targeted search broadcast.
+        const char types[] = { VERTEX_TYPE_TLV, VERTEX_SN_TLV, VERTEX_UDID_TLV };
+        size_t offset = 0;
+        for (char type : types) {
+            output_[offset] = type;
+            output_[offset + 1] = DM_HASH_DATA_LEN;
+            (void)memset_s(&output_[offset + VERTEX_TLV_DATA_OFFSET], DM_HASH_DATA_LEN, type, DM_HASH_DATA_LEN);
+            offset += VERTEX_TLV_LEN;
+        }
+        (void)memset_s(&broadcastHead_, sizeof(broadcastHead_), 0, sizeof(broadcastHead_));
+        broadcastHead_.findMode = 3;
+        broadcastHead_.tlvDataLen = static_cast<char>(offset);
+        MineSoftbusListener::ClearLocalIdentityCache();
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+    }
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+    DeviceInfo deviceInfo_;
+    char output_[DISC_MAX_CUST_DATA_LEN];
+    BroadcastHead broadcastHead_;
+};
+
+// The previous per broadcast path: read every parameter and hash it again.
+BENCHMARK_F(MineSoftbusListenerTest, RecomputeDigestsMatchTestCase)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        DevicePolicyInfo devicePolicyInfo = {};
+        devicePolicyInfo.snHashValid = MineSoftbusListener::GetDeviceSnHash(devicePolicyInfo.snHash);
+        devicePolicyInfo.udidHashValid = MineSoftbusListener::GetDeviceUdidHash(devicePolicyInfo.udidHash);
+        devicePolicyInfo.typeHashValid = MineSoftbusListener::GetDeviceTypeHash(devicePolicyInfo.typeHash);
+        benchmark::DoNotOptimize(MineSoftbusListener::MatchSearchVertexDevice(deviceInfo_, output_,
+            devicePolicyInfo, broadcastHead_));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_F(MineSoftbusListenerTest, CachedDigestsMatchTestCase)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        DevicePolicyInfo devicePolicyInfo = {};
+        MineSoftbusListener::GetVertexDevicePolicyInfo(devicePolicyInfo);
+        benchmark::DoNotOptimize(MineSoftbusListener::MatchSearchVertexDevice(deviceInfo_, output_,
+            devicePolicyInfo, broadcastHead_));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_F(MineSoftbusListenerTest, CachedScopeMatchTestCase)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        DevicePolicyInfo devicePolicyInfo = {};
+        MineSoftbusListener::GetScopeDevicePolicyInfo(devicePolicyInfo);
+        benchmark::DoNotOptimize(MineSoftbusListener::MatchSearchScopeDevice(deviceInfo_, output_,
+            devicePolicyInfo, broadcastHead_));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <malloc.h>
+#include <map>
+#include <new>
+#include <securec.h>
+#include <string>
+#include <vector>
+
+#include "dm_device_info.h"
+#include "dm_notify_state_table.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::DistributedHardware;
+
+namespace {
+constexpr int32_t SUBSCRIBER_NUM = 50;
+constexpr int32_t DEVICE_NUM = 200;
+constexpr int32_t USER_ID = 100;
+std::atomic<int64_t> g_liveBytes {0};
+}
+
+// Live heap bytes, so the fill cases can report the footprint of each layout.
+void *operator new(size_t size)
+{
+    void *ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    g_liveBytes.fetch_add(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed);
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    g_liveBytes.fetch_sub(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed);
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t size) noexcept
+{
+    (void)size;
+    operator delete(ptr);
+}
+
+namespace {
+// The previous layout: one "pkg#userId#tokenId#deviceId" key and one device copy per pair.
+using LegacyNotifyMap = map<string, DmDeviceInfo>;
+
+string MakeLegacyKey(const ProcessInfo &processInfo, const string &deviceId)
+{
+    return processInfo.pkgName + "#" + to_string(processInfo.userId) + "#" + to_string(processInfo.tokenId) + "#" +
+        deviceId;
+}
+
+class NotifyStateTableTest : public benchmark::Fixture {
+public:
+    NotifyStateTableTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~NotifyStateTableTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        processInfos_.clear();
+        deviceIds_.clear();
+        deviceInfos_.clear();
+        for (int32_t i = 0; i < SUBSCRIBER_NUM; i++) {
+            ProcessInfo processInfo;
+            processInfo.pkgName = "com.ohos.benchmark.subscriber" + to_string(i);
+            processInfo.userId = USER_ID;
+            processInfo.tokenId = static_cast<uint32_t>(i + 1);
+            processInfos_.push_back(processInfo);
+        }
+        for (int32_t i = 0; i < DEVICE_NUM; i++) {
+            // Shaped like the anonymized udid hash the listener keys on.
+            string deviceId = string(48, 'a') + to_string(10000 + i);
+            DmDeviceInfo info;
+            (void)memset_s(&info, sizeof(info), 0, sizeof(info));
+            (void)memcpy_s(info.deviceId, sizeof(info.deviceId), deviceId.c_str(), deviceId.length());
+            deviceIds_.push_back(deviceId);
+            deviceInfos_.push_back(info);
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+    }
+
+    void FillLegacy(LegacyNotifyMap &notifyMap) const
+    {
+        for (const auto &processInfo : processInfos_) {
+            for (size_t i = 0; i < deviceIds_.size(); i++) {
+                notifyMap[MakeLegacyKey(processInfo, deviceIds_[i])] = deviceInfos_[i];
+            }
+        }
+    }
+
+    void FillTable(DmNotifyStateTable &table) const
+    {
+        for (const auto &processInfo : processInfos_) {
+            for (const auto &deviceId : deviceIds_) {
+                table.Insert(processInfo, deviceId);
+            }
+        }
+    }
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 100;
+    vector<ProcessInfo> processInfos_;
+    vector<string> deviceIds_;
+    vector<DmDeviceInfo> deviceInfos_;
+};
+
+BENCHMARK_F(NotifyStateTableTest, LegacyFillTestCase)(benchmark::State &state)
+{
+    int64_t bytes = 0;
+    for (auto _ : state) {
+        int64_t before = g_liveBytes.load(std::memory_order_relaxed);
+        LegacyNotifyMap notifyMap;
+        FillLegacy(notifyMap);
+        bytes = g_liveBytes.load(std::memory_order_relaxed) - before;
+        benchmark::DoNotOptimize(notifyMap);
+    }
+    state.counters["LiveBytes"] = static_cast<double>(bytes);
+    state.SetItemsProcessed(state.iterations() * SUBSCRIBER_NUM * DEVICE_NUM);
+}
+
+BENCHMARK_F(NotifyStateTableTest, StateTableFillTestCase)(benchmark::State &state)
+{
+    int64_t bytes = 0;
+    for (auto _ : state) {
+        int64_t before = g_liveBytes.load(std::memory_order_relaxed);
+        DmNotifyStateTable table;
+        FillTable(table);
+        bytes = g_liveBytes.load(std::memory_order_relaxed) - before;
+        benchmark::DoNotOptimize(table);
+    }
+    state.counters["LiveBytes"] = static_cast<double>(bytes);
+    state.SetItemsProcessed(state.iterations() * SUBSCRIBER_NUM * DEVICE_NUM);
+}
+
+// One device goes offline for every subscriber, then comes back.
+BENCHMARK_F(NotifyStateTableTest, LegacyDeviceOfflineTestCase)(benchmark::State &state)
+{
+    LegacyNotifyMap notifyMap;
+    FillLegacy(notifyMap);
+    size_t index = 0;
+    for (auto _ : state) {
+        const DmDeviceInfo &info = deviceInfos_[index];
+        for (auto item = notifyMap.begin(); item != notifyMap.end();) {
+            if (string(item->second.deviceId) == string(info.deviceId)) {
+                item = notifyMap.erase(item);
+            } else {
+                ++item;
+            }
+        }
+        for (const auto &processInfo : processInfos_) {
+            notifyMap[MakeLegacyKey(processInfo, deviceIds_[index])] = info;
+        }
+        index = (index + 1) % deviceIds_.size();
+    }
+}
+
+BENCHMARK_F(NotifyStateTableTest, StateTableDeviceOfflineTestCase)(benchmark::State &state)
+{
+    DmNotifyStateTable table;
+    FillTable(table);
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.EraseDevice(deviceIds_[index]));
+        for (const auto &processInfo : processInfos_) {
+            table.Insert(processInfo, deviceIds_[index]);
+        }
+        index = (index + 1) % deviceIds_.size();
+    }
+}
+
+// One subscriber package is uninstalled, then registers again and sees every device.
+BENCHMARK_F(NotifyStateTableTest, LegacyAppUninstallTestCase)(benchmark::State &state)
+{
+    LegacyNotifyMap notifyMap;
+    FillLegacy(notifyMap);
+    size_t index = 0;
+    for (auto _ : state) {
+        const ProcessInfo &processInfo = processInfos_[index];
+        string prefix = processInfo.pkgName + "#";
+        for (auto item = notifyMap.begin(); item != notifyMap.end();) {
+            if (item->first.compare(0, prefix.length(), prefix) == 0) {
+                item = notifyMap.erase(item);
+            } else {
+                ++item;
+            }
+        }
+        for (size_t i = 0; i < deviceIds_.size(); i++) {
+            notifyMap[MakeLegacyKey(processInfo, deviceIds_[i])] = deviceInfos_[i];
+        }
+        index = (index + 1) % processInfos_.size();
+    }
+}
+
+BENCHMARK_F(NotifyStateTableTest, StateTableAppUninstallTestCase)(benchmark::State &state)
+{
+    DmNotifyStateTable table;
+    FillTable(table);
+    size_t index = 0;
+    for (auto _ : state) {
+        const ProcessInfo &processInfo = processInfos_[index];
+        benchmark::DoNotOptimize(table.ErasePkgName(processInfo.pkgName));
+        for (const auto &deviceId : deviceIds_) {
+            table.Insert(processInfo, deviceId);
+        }
+        index = (index + 1) % processInfos_.size();
+    }
+}
+
+// A device info change is checked against every subscriber.
+BENCHMARK_F(NotifyStateTableTest, LegacyNotifyLookupTestCase)(benchmark::State &state)
+{
+    LegacyNotifyMap notifyMap;
+    FillLegacy(notifyMap);
+    size_t index = 0;
+    for (auto _ : state) {
+        for (const auto &processInfo : processInfos_) {
+            benchmark::DoNotOptimize(notifyMap.find(MakeLegacyKey(processInfo, deviceIds_[index])));
+        }
+        index = (index + 1) % deviceIds_.size();
+    }
+    state.SetItemsProcessed(state.iterations() * SUBSCRIBER_NUM);
+}
+
+BENCHMARK_F(NotifyStateTableTest, StateTableNotifyLookupTestCase)(benchmark::State &state)
+{
+    DmNotifyStateTable table;
+    FillTable(table);
+    size_t index = 0;
+    for (auto _ : state) {
+        for (const auto &processInfo : processInfos_) {
+            benchmark::DoNotOptimize(table.Contains(processInfo, deviceIds_[index]));
+        }
+        index = (index + 1) % deviceIds_.size();
+    }
+    state.SetItemsProcessed(state.iterations() * SUBSCRIBER_NUM);
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
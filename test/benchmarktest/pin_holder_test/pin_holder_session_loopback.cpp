@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pin_holder_session_loopback.h"
+
+#include <chrono>
+#include <thread>
+
+#include "dm_error_type.h"
+#include "pin_holder_session.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t SESSION_SIDE_SERVER = 0;
+constexpr int32_t SESSION_SIDE_CLIENT = 1;
+constexpr const char *LOOPBACK_PEER_UDID = "pinholderloopbackpeerudid";
+}
+
+PinHolderLoopback &PinHolderLoopback::GetInstance()
+{
+    static PinHolderLoopback instance;
+    return instance;
+}
+
+void PinHolderLoopback::SetOpenLatencyUs(int64_t latencyUs)
+{
+    openLatencyUs_ = latencyUs;
+}
+
+void PinHolderLoopback::Pump()
+{
+    while (!events_.empty()) {
+        Event event = std::move(events_.front());
+        events_.pop_front();
+        if (event.callback == nullptr) {
+            continue;
+        }
+        switch (event.type) {
+            case EventType::OPENED:
+                event.callback->OnSessionOpened(event.sessionId, event.sessionSide, DM_OK);
+                break;
+            case EventType::CLOSED:
+                endpoints_.erase(event.sessionId);
+                event.callback->OnSessionClosed(event.sessionId);
+                break;
+            case EventType::DATA:
+                event.callback->OnDataReceived(event.sessionId, event.message);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void PinHolderLoopback::Reset()
+{
+    callbacks_.clear();
+    endpoints_.clear();
+    events_.clear();
+    nextSessionId_ = 1;
+    openLatencyUs_ = 0;
+    openCount_ = 0;
+}
+
+uint64_t PinHolderLoopback::GetOpenCount() const
+{
+    return openCount_;
+}
+
+void PinHolderLoopback::Register(const PinHolderSession *session, std::shared_ptr<IPinholderSessionCallback> callback)
+{
+    callbacks_[session] = callback;
+}
+
+void PinHolderLoopback::UnRegister(const PinHolderSession *session)
+{
+    callbacks_.erase(session);
+}
+
+int32_t PinHolderLoopback::Open(const PinHolderSession *session)
+{
+    auto source = callbacks_.find(session);
+    if (source == callbacks_.end()) {
+        return ERR_DM_FAILED;
+    }
+    std::shared_ptr<IPinholderSessionCallback> sinkCallback = nullptr;
+    for (const auto &item : callbacks_) {
+        if (item.first != session) {
+            sinkCallback = item.second;
+            break;
+        }
+    }
+    if (sinkCallback == nullptr) {
+        return ERR_DM_FAILED;
+    }
+    if (openLatencyUs_ > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(openLatencyUs_));
+    }
+    openCount_++;
+    int32_t clientId = nextSessionId_++;
+    int32_t serverId = nextSessionId_++;
+    endpoints_[clientId] = { source->second, SESSION_SIDE_CLIENT, serverId };
+    endpoints_[serverId] = { sinkCallback, SESSION_SIDE_SERVER, clientId };
+    events_.push_back({ EventType::OPENED, sinkCallback, serverId, SESSION_SIDE_SERVER, "" });
+    events_.push_back({ EventType::OPENED, source->second, clientId, SESSION_SIDE_CLIENT, "" });
+    return clientId;
+}
+
+void PinHolderLoopback::Close(int32_t sessionId)
+{
+    auto iter = endpoints_.find(sessionId);
+    if (iter == endpoints_.end()) {
+        return;
+    }
+    int32_t peerSessionId = iter->second.peerSessionId;
+    endpoints_.erase(iter);
+    auto peer = endpoints_.find(peerSessionId);
+    if (peer != endpoints_.end()) {
+        events_.push_back({ EventType::CLOSED, peer->second.callback, peerSessionId, peer->second.sessionSide, "" });
+    }
+}
+
+int32_t PinHolderLoopback::Send(int32_t sessionId, const std::string &message)
+{
+    auto iter = endpoints_.find(sessionId);
+    if (iter == endpoints_.end()) {
+        return ERR_DM_FAILED;
+    }
+    auto peer = endpoints_.find(iter->second.peerSessionId);
+    if (peer == endpoints_.end()) {
+        return ERR_DM_FAILED;
+    }
+    events_.push_back({ EventType::DATA, peer->second.callback, peer->first, peer->second.sessionSide, message });
+    return DM_OK;
+}
+
+int32_t PinHolderLoopback::GetSide(int32_t sessionId) const
+{
+    auto iter = endpoints_.find(sessionId);
+    return iter == endpoints_.end() ? ERR_DM_FAILED : iter->second.sessionSide;
+}
+
+PinHolderSession::PinHolderSession()
+{
+}
+
+PinHolderSession::~PinHolderSession()
+{
+}
+
+int32_t PinHolderSession::RegisterSessionCallback(std::shared_ptr<IPinholderSessionCallback> callback)
+{
+    PinHolderLoopback::GetInstance().Register(this, callback);
+    return DM_OK;
+}
+
+int32_t PinHolderSession::UnRegisterSessionCallback()
+{
+    PinHolderLoopback::GetInstance().UnRegister(this);
+    return DM_OK;
+}
+
+int32_t PinHolderSession::OpenSessionServer(const PeerTargetId &targetId)
+{
+    (void)targetId;
+    return PinHolderLoopback::GetInstance().Open(this);
+}
+
+int32_t PinHolderSession::CloseSessionServer(int32_t sessionId)
+{
+    PinHolderLoopback::GetInstance().Close(sessionId);
+    return DM_OK;
+}
+
+int32_t PinHolderSession::SendData(int32_t sessionId, const std::string &message)
+{
+    return PinHolderLoopback::GetInstance().Send(sessionId, message);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
+
+int GetSessionSide(int sessionId)
+{
+    return OHOS::DistributedHardware::PinHolderLoopback::GetInstance().GetSide(sessionId);
+}
+
+int GetPeerDeviceId(int sessionId, char *devId, unsigned int len)
+{
+    (void)sessionId;
+    if (devId == nullptr || strcpy_s(devId, len, OHOS::DistributedHardware::LOOPBACK_PEER_UDID) != EOK) {
+        return OHOS::DistributedHardware::ERR_DM_FAILED;
+    }
+    return OHOS::DistributedHardware::DM_OK;
+}
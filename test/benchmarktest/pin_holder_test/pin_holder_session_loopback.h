@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_PIN_HOLDER_SESSION_LOOPBACK_H
+#define OHOS_PIN_HOLDER_SESSION_LOOPBACK_H
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "pinholder_session_callback.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+class PinHolderSession;
+
+/*
+ * Stands in for softbus under PinHolderSession: two registered sessions are wired back to back,
+ * and opens, sends and closes are queued until Pump() delivers them on the calling thread.
+ */
+class PinHolderLoopback {
+public:
+    static PinHolderLoopback &GetInstance();
+
+    // Simulated auth session setup cost paid by every open.
+    void SetOpenLatencyUs(int64_t latencyUs);
+    void Pump();
+    void Reset();
+    uint64_t GetOpenCount() const;
+
+    void Register(const PinHolderSession *session, std::shared_ptr<IPinholderSessionCallback> callback);
+    void UnRegister(const PinHolderSession *session);
+    int32_t Open(const PinHolderSession *session);
+    void Close(int32_t sessionId);
+    int32_t Send(int32_t sessionId, const std::string &message);
+    int32_t GetSide(int32_t sessionId) const;
+
+private:
+    enum class EventType : int32_t {
+        OPENED = 0,
+        CLOSED,
+        DATA,
+    };
+
+    struct Event {
+        EventType type = EventType::DATA;
+        std::shared_ptr<IPinholderSessionCallback> callback = nullptr;
+        int32_t sessionId = -1;
+        int32_t sessionSide = 0;
+        std::string message = "";
+    };
+
+    struct Endpoint {
+        std::shared_ptr<IPinholderSessionCallback> callback = nullptr;
+        int32_t sessionSide = 0;
+        int32_t peerSessionId = -1;
+    };
+
+    std::map<const PinHolderSession *, std::shared_ptr<IPinholderSessionCallback>> callbacks_;
+    std::map<int32_t, Endpoint> endpoints_;
+    std::deque<Event> events_;
+    int32_t nextSessionId_ = 1;
+    int64_t openLatencyUs_ = 0;
+    uint64_t openCount_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_PIN_HOLDER_SESSION_LOOPBACK_H
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "device_manager_service_listener.h"
+#include "dm_constants.h"
+#include "json_object.h"
+#include "pin_holder.h"
+#include "pin_holder_session_loopback.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::DistributedHardware;
+
+namespace {
+constexpr int32_t MSG_TYPE_CREATE_PIN_HOLDER = 600;
+constexpr const char* TAG_PIN_TYPE = "PIN_TYPE";
+constexpr const char* TAG_PAYLOAD = "PAYLOAD";
+constexpr int64_t OPEN_LATENCY_US = 2000;
+const string SOURCE_PKG_NAME = "com.ohos.benchmark.pinholder.source";
+const string SINK_PKG_NAME = "com.ohos.benchmark.pinholder.sink";
+const string PAY_LOAD = "benchmark_payload";
+
+// Keeps the pin holder callbacks local, counting the results the source sees.
+class PinHolderBenchmarkListener : public DeviceManagerServiceListener {
+public:
+    void OnPinHolderCreate(const ProcessInfo &processInfo, const std::string &deviceId, DmPinType pinType,
+        const std::string &payload) override
+    {
+        (void)processInfo;
+        (void)deviceId;
+        (void)pinType;
+        (void)payload;
+    }
+
+    void OnPinHolderDestroy(const ProcessInfo &processInfo, DmPinType pinType, const std::string &payload) override
+    {
+        (void)processInfo;
+        (void)pinType;
+        (void)payload;
+    }
+
+    void OnCreateResult(const ProcessInfo &processInfo, int32_t result) override
+    {
+        (void)processInfo;
+        if (result != DM_OK) {
+            failedNum++;
+        }
+    }
+
+    void OnDestroyResult(const ProcessInfo &processInfo, int32_t result) override
+    {
+        (void)processInfo;
+        if (result != DM_OK) {
+            failedNum++;
+            return;
+        }
+        doneNum++;
+    }
+
+    void OnPinHolderEvent(const ProcessInfo &processInfo, DmPinHolderEvent event, int32_t result,
+        const std::string &content) override
+    {
+        (void)processInfo;
+        (void)event;
+        (void)content;
+        if (result != DM_OK) {
+            failedNum++;
+        }
+    }
+
+    int64_t doneNum = 0;
+    int64_t failedNum = 0;
+};
+
+class PinHolderTest : public benchmark::Fixture {
+public:
+    PinHolderTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~PinHolderTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        PinHolderLoopback::GetInstance().Reset();
+        sourceListener_ = std::make_shared<PinHolderBenchmarkListener>();
+        source_ = std::make_shared<PinHolder>(sourceListener_);
+        sink_ = std::make_shared<PinHolder>(std::make_shared<PinHolderBenchmarkListener>());
+        source_->RegisterPinHolderCallback(SOURCE_PKG_NAME);
+        sink_->RegisterPinHolderCallback(SINK_PKG_NAME);
+        targetId_.deviceId = "pinholderloopbackpeer";
+        JsonObject jsonObj;
+        jsonObj[TAG_PIN_TYPE] = DmPinType::SUPER_SONIC;
+        changeEvent_ = jsonObj.Dump();
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        source_->UnRegisterPinHolderCallback(SOURCE_PKG_NAME);
+        sink_->UnRegisterPinHolderCallback(SINK_PKG_NAME);
+        PinHolderLoopback::GetInstance().Pump();
+        PinHolderLoopback::GetInstance().Reset();
+        source_ = nullptr;
+        sink_ = nullptr;
+    }
+
+    // One create, pin type change and destroy exchange with the sink.
+    void RoundTrip()
+    {
+        PinHolderLoopback &loopback = PinHolderLoopback::GetInstance();
+        source_->CreatePinHolder(SOURCE_PKG_NAME, targetId_, DmPinType::QR_CODE, PAY_LOAD);
+        loopback.Pump();
+        source_->NotifyPinHolderEvent(SOURCE_PKG_NAME, changeEvent_);
+        loopback.Pump();
+        source_->DestroyPinHolder(SOURCE_PKG_NAME, targetId_, DmPinType::QR_CODE, PAY_LOAD);
+        loopback.Pump();
+    }
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 200;
+    std::shared_ptr<PinHolderBenchmarkListener> sourceListener_ = nullptr;
+    std::shared_ptr<PinHolder> source_ = nullptr;
+    std::shared_ptr<PinHolder> sink_ = nullptr;
+    PeerTargetId targetId_;
+    string changeEvent_;
+};
+
+// The previous flow: every exchange opens its own session and closes it on destroy.
+BENCHMARK_DEFINE_F(PinHolderTest, ReopenSessionRoundTripTestCase)(benchmark::State &state)
+{
+    PinHolderLoopback::GetInstance().SetOpenLatencyUs(state.range(0));
+    for (auto _ : state) {
+        RoundTrip();
+        source_->CloseIdleSession();
+        PinHolderLoopback::GetInstance().Pump();
+    }
+    state.counters["SessionOpens"] = static_cast<double>(PinHolderLoopback::GetInstance().GetOpenCount());
+    state.counters["Done"] = static_cast<double>(sourceListener_->doneNum);
+    state.counters["Failed"] = static_cast<double>(sourceListener_->failedNum);
+}
+BENCHMARK_REGISTER_F(PinHolderTest, ReopenSessionRoundTripTestCase)->Arg(0)->Arg(OPEN_LATENCY_US);
+
+BENCHMARK_DEFINE_F(PinHolderTest, IdleSessionRoundTripTestCase)(benchmark::State &state)
+{
+    PinHolderLoopback::GetInstance().SetOpenLatencyUs(state.range(0));
+    for (auto _ : state) {
+        RoundTrip();
+    }
+    state.counters["SessionOpens"] = static_cast<double>(PinHolderLoopback::GetInstance().GetOpenCount());
+    state.counters["Done"] = static_cast<double>(sourceListener_->doneNum);
+    state.counters["Failed"] = static_cast<double>(sourceListener_->failedNum);
+}
+BENCHMARK_REGISTER_F(PinHolderTest, IdleSessionRoundTripTestCase)->Arg(0)->Arg(OPEN_LATENCY_US);
+
+// The previous receive path parsed the message for its type, then again in the handler.
+BENCHMARK_F(PinHolderTest, ParseTwiceTestCase)(benchmark::State &state)
+{
+    JsonObject jsonObj;
+    jsonObj[TAG_MSG_TYPE] = MSG_TYPE_CREATE_PIN_HOLDER;
+    jsonObj[TAG_PIN_TYPE] = DmPinType::QR_CODE;
+    jsonObj[TAG_PAYLOAD] = PAY_LOAD;
+    string message = jsonObj.Dump();
+    for (auto _ : state) {
+        JsonObject typeObject(message);
+        benchmark::DoNotOptimize(typeObject[TAG_MSG_TYPE].Get<int32_t>());
+        JsonObject bodyObject(message);
+        benchmark::DoNotOptimize(bodyObject[TAG_PIN_TYPE].Get<int32_t>());
+        benchmark::DoNotOptimize(bodyObject[TAG_PAYLOAD].Get<std::string>());
+    }
+}
+
+BENCHMARK_F(PinHolderTest, ParseOnceTestCase)(benchmark::State &state)
+{
+    JsonObject jsonObj;
+    jsonObj[TAG_MSG_TYPE] = MSG_TYPE_CREATE_PIN_HOLDER;
+    jsonObj[TAG_PIN_TYPE] = DmPinType::QR_CODE;
+    jsonObj[TAG_PAYLOAD] = PAY_LOAD;
+    string message = jsonObj.Dump();
+    for (auto _ : state) {
+        PinHolderMsg msg;
+        benchmark::DoNotOptimize(PinHolder::ParsePinHolderMsg(message, msg));
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "relationship_sync_mgr.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::DistributedHardware;
+
+namespace {
+constexpr int64_t BURST_MIN = 8;
+constexpr int64_t BURST_MAX = 512;
+constexpr uint32_t USER_ID_BASE = 100;
+constexpr uint8_t BROADCAST_ID_NUM = 10;
+constexpr uint16_t LOCAL_USER_NUM = 4;
+
+RelationShipChangeMsg BuildMsg(uint32_t index)
+{
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::SYNC_USERID;
+    msg.userId = USER_ID_BASE + index;
+    msg.accountId = "accountId_benchmark";
+    msg.peerUdid = "peerUdid_benchmark_" + to_string(index);
+    msg.tokenId = index;
+    msg.userIdInfos.push_back(UserIdInfo(true, static_cast<uint16_t>(USER_ID_BASE + index)));
+    msg.userIdInfos.push_back(UserIdInfo(false, static_cast<uint16_t>(USER_ID_BASE)));
+    msg.broadCastId = static_cast<uint8_t>(index % BROADCAST_ID_NUM + 1);
+    return msg;
+}
+
+// Four local users after the first one switched to the background, as the full list and as the delta.
+RelationShipChangeMsg BuildUserIdsMsg(bool isDelta)
+{
+    RelationShipChangeMsg msg;
+    msg.type = isDelta ? RelationShipChangeType::SYNC_USERID_DELTA : RelationShipChangeType::SYNC_USERID;
+    msg.isUserIdVersioned = true;
+    msg.baseUserIdSeq = 1;
+    msg.userIdSeq = 2;
+    msg.broadCastId = 1;
+    if (isDelta) {
+        msg.userIdInfos.push_back(UserIdInfo(false, static_cast<uint16_t>(USER_ID_BASE)));
+        return msg;
+    }
+    for (uint16_t i = 0; i < LOCAL_USER_NUM; i++) {
+        msg.userIdInfos.push_back(UserIdInfo(false, static_cast<uint16_t>(USER_ID_BASE + i)));
+    }
+    return msg;
+}
+
+cJSON *ToPayloadJson(const RelationShipChangeMsg &msg)
+{
+    uint8_t *payload = nullptr;
+    uint32_t len = 0;
+    cJSON *payloadJson = cJSON_CreateArray();
+    if (!msg.ToBroadcastPayLoad(payload, len) || payloadJson == nullptr) {
+        delete[] payload;
+        return payloadJson;
+    }
+    for (uint32_t i = 0; i < len; i++) {
+        cJSON_AddItemToArray(payloadJson, cJSON_CreateNumber(payload[i]));
+    }
+    delete[] payload;
+    return payloadJson;
+}
+
+class RelationShipSyncTest : public benchmark::Fixture {
+public:
+    RelationShipSyncTest()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+    }
+
+    ~RelationShipSyncTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+    }
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 1000;
+};
+
+// Key building alone, the old string key against the binary fingerprint.
+BENCHMARK_F(RelationShipSyncTest, ToMapKeyTestCase)(benchmark::State &state)
+{
+    RelationShipChangeMsg msg = BuildMsg(0);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(msg.ToMapKey());
+    }
+}
+
+BENCHMARK_F(RelationShipSyncTest, ToFingerprintTestCase)(benchmark::State &state)
+{
+    RelationShipChangeMsg msg = BuildMsg(0);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(msg.ToFingerprint());
+    }
+}
+
+// A BLE re-broadcast burst: the same message received range(0) times.
+BENCHMARK_DEFINE_F(RelationShipSyncTest, IdenticalBurstTestCase)(benchmark::State &state)
+{
+    RelationShipChangeMsg msg = BuildMsg(0);
+    int64_t newCount = 0;
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); i++) {
+            newCount += ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(msg) ? 1 : 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["new"] = static_cast<double>(newCount);
+}
+BENCHMARK_REGISTER_F(RelationShipSyncTest, IdenticalBurstTestCase)->RangeMultiplier(4)->Range(BURST_MIN, BURST_MAX);
+
+// range(0) different peers broadcasting at once.
+BENCHMARK_DEFINE_F(RelationShipSyncTest, DistinctBurstTestCase)(benchmark::State &state)
+{
+    vector<RelationShipChangeMsg> msgs;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        msgs.push_back(BuildMsg(static_cast<uint32_t>(i)));
+    }
+    int64_t newCount = 0;
+    for (auto _ : state) {
+        for (const auto &msg : msgs) {
+            newCount += ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(msg) ? 1 : 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["new"] = static_cast<double>(newCount);
+}
+BENCHMARK_REGISTER_F(RelationShipSyncTest, DistinctBurstTestCase)->RangeMultiplier(4)->Range(BURST_MIN, BURST_MAX);
+
+// range(0) == 0 encodes the full user id list, 1 the delta.
+BENCHMARK_DEFINE_F(RelationShipSyncTest, EncodeUserIdsTestCase)(benchmark::State &state)
+{
+    RelationShipChangeMsg msg = BuildUserIdsMsg(state.range(0) != 0);
+    uint32_t len = 0;
+    for (auto _ : state) {
+        uint8_t *payload = nullptr;
+        benchmark::DoNotOptimize(msg.ToBroadcastPayLoad(payload, len));
+        delete[] payload;
+    }
+    state.counters["PayloadBytes"] = static_cast<double>(len);
+}
+BENCHMARK_REGISTER_F(RelationShipSyncTest, EncodeUserIdsTestCase)->Arg(0)->Arg(1);
+
+BENCHMARK_DEFINE_F(RelationShipSyncTest, DecodeUserIdsTestCase)(benchmark::State &state)
+{
+    RelationShipChangeMsg msg = BuildUserIdsMsg(state.range(0) != 0);
+    cJSON *payloadJson = ToPayloadJson(msg);
+    for (auto _ : state) {
+        RelationShipChangeMsg parsed;
+        benchmark::DoNotOptimize(parsed.FromBroadcastPayLoad(payloadJson, msg.type));
+    }
+    state.counters["PayloadBytes"] = static_cast<double>(cJSON_GetArraySize(payloadJson));
+    cJSON_Delete(payloadJson);
+}
+BENCHMARK_REGISTER_F(RelationShipSyncTest, DecodeUserIdsTestCase)->Arg(0)->Arg(1);
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -3763,5 +3763,57 @@ HWTEST_F(DeviceProfileConnectorSecondTest, GetVersionByExtra_201, testing::ext::
     EXPECT_EQ(ret, DM_OK);
     EXPECT_EQ(dmVersion, "5.1.0");
 }
+
+/**
+ * @tc.name: ApplyAclBatch_001
+ * @tc.desc: ApplyAclBatch updates each acl once with its last profile and skips acls deleted in the batch
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(DeviceProfileConnectorSecondTest, ApplyAclBatch_001, testing::ext::TestSize.Level1)
+{
+    DmAclBatch batch;
+    batch.updateProfiles.emplace_back(GenerateAccessControlProfile(1, 1, "peerUdid", 0, 1, INACTIVE,
+        1, "localUdid", 1, "accesserAccountId", 1, "peerUdid", 1, "accesseeAccountId", 1, "bundleName1", 1, ""));
+    batch.updateProfiles.emplace_back(GenerateAccessControlProfile(1, 1, "peerUdid", 0, 1, ACTIVE,
+        1, "localUdid", 1, "accesserAccountId", 1, "peerUdid", 1, "accesseeAccountId", 1, "bundleName1", 1, ""));
+    batch.updateProfiles.emplace_back(GenerateAccessControlProfile(2, 1, "peerUdid", 0, 1, ACTIVE,
+        2, "localUdid", 1, "accesserAccountId", 2, "peerUdid", 1, "accesseeAccountId", 1, "bundleName1", 1, ""));
+    DmAclIdParam delAcl;
+    delAcl.accessControlId = 2;
+    batch.delAclInfos.push_back(delAcl);
+    batch.delAclInfos.push_back(delAcl);
+    EXPECT_CALL(*distributedDeviceProfileClientMock_, UpdateAccessControlProfile(_))
+        .WillOnce([](const DistributedDeviceProfile::AccessControlProfile &profile) {
+            EXPECT_EQ(profile.GetAccessControlId(), 1);
+            EXPECT_EQ(profile.GetStatus(), ACTIVE);
+            return DM_OK;
+        });
+    int32_t ret = DeviceProfileConnector::GetInstance().ApplyAclBatch(batch);
+    EXPECT_EQ(ret, DM_OK);
+}
+
+/**
+ * @tc.name: ApplyAclBatch_002
+ * @tc.desc: ApplyAclBatch applies the rest of the batch and returns the first failure
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(DeviceProfileConnectorSecondTest, ApplyAclBatch_002, testing::ext::TestSize.Level1)
+{
+    DmAclBatch batch;
+    batch.updateProfiles.emplace_back(GenerateAccessControlProfile(1, 1, "peerUdid", 0, 1, ACTIVE,
+        1, "localUdid", 1, "accesserAccountId", 1, "peerUdid", 1, "accesseeAccountId", 1, "bundleName1", 1, ""));
+    batch.updateProfiles.emplace_back(GenerateAccessControlProfile(2, 1, "peerUdid", 0, 1, ACTIVE,
+        2, "localUdid", 1, "accesserAccountId", 2, "peerUdid", 1, "accesseeAccountId", 1, "bundleName1", 1, ""));
+    EXPECT_CALL(*distributedDeviceProfileClientMock_, UpdateAccessControlProfile(_))
+        .Times(2).WillOnce(Return(ERR_DM_FAILED)).WillOnce(Return(DM_OK));
+    int32_t ret = DeviceProfileConnector::GetInstance().ApplyAclBatch(batch);
+    EXPECT_EQ(ret, ERR_DM_FAILED);
+
+    DmAclBatch emptyBatch;
+    ret = DeviceProfileConnector::GetInstance().ApplyAclBatch(emptyBatch);
+    EXPECT_EQ(ret, DM_OK);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "UTTest_hichain_group_cache.h"
+
+#include "dm_error_type.h"
+#include "hichain_group_cache.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t USER_ID = 100;
+constexpr const char *PKG_NAME = "ohos.distributedhardware.devicemanager";
+constexpr const char *QUERY_PARAMS = "{\"groupType\":256}";
+constexpr const char *PEER_UDID = "peerUdid";
+constexpr const char *GROUPS_STR = "[{\"groupName\":\"name\",\"groupId\":\"groupId\",\"groupOwner\":\"owner\","
+    "\"groupType\":256,\"groupVisibility\":-1,\"userId\":\"accountId\"}]";
+
+struct TestGroup {
+    std::string groupName;
+    std::string groupId;
+    std::string groupOwner;
+    int32_t groupType = 0;
+    int32_t groupVisibility = 0;
+    std::string userId;
+};
+}
+
+void HichainGroupCacheTest::SetUp()
+{
+    HichainGroupCache::GetInstance().SetGroupCacheEnabled(true);
+    HichainGroupCache::GetInstance().SetCredentialCacheEnabled(true);
+}
+
+void HichainGroupCacheTest::TearDown()
+{
+    HichainGroupCache::GetInstance().SetGroupCacheEnabled(false);
+    HichainGroupCache::GetInstance().SetCredentialCacheEnabled(false);
+}
+
+void HichainGroupCacheTest::SetUpTestCase()
+{
+}
+
+void HichainGroupCacheTest::TearDownTestCase()
+{
+}
+
+namespace {
+/**
+ * @tc.name: ParseGroups_001
+ * @tc.desc: hichain group array is parsed into typed records
+ * @tc.type: FUNC
+ */
+HWTEST_F(HichainGroupCacheTest, ParseGroups_001, testing::ext::TestSize.Level1)
+{
+    std::vector<HichainGroupRecord> groups;
+    EXPECT_EQ(HichainGroupCache::ParseGroups("invalid", groups), ERR_DM_FAILED);
+    EXPECT_EQ(HichainGroupCache::ParseGroups("{}", groups), ERR_DM_FAILED);
+    ASSERT_EQ(HichainGroupCache::ParseGroups(GROUPS_STR, groups), DM_OK);
+    ASSERT_EQ(groups.size(), 1);
+    std::vector<TestGroup> groupList;
+    HichainGroupCache::ToGroupList(groups, groupList);
+    ASSERT_EQ(groupList.size(), 1);
+    EXPECT_EQ(groupList[0].groupName, "name");
+    EXPECT_EQ(groupList[0].groupId, "groupId");
+    EXPECT_EQ(groupList[0].groupOwner, "owner");
+    EXPECT_EQ(groupList[0].groupType, 256);
+    EXPECT_EQ(groupList[0].groupVisibility, -1);
+    EXPECT_EQ(groupList[0].userId, "accountId");
+}
+
+/**
+ * @tc.name: GetGroupInfo_001
+ * @tc.desc: cached query is dropped by user and group invalidation
+ * @tc.type: FUNC
+ */
+HWTEST_F(HichainGroupCacheTest, GetGroupInfo_001, testing::ext::TestSize.Level1)
+{
+    HichainGroupCache &cache = HichainGroupCache::GetInstance();
+    HichainGroupRecord group;
+    group.groupId = "groupId";
+    std::vector<HichainGroupRecord> groups = { group };
+    std::vector<HichainGroupRecord> result;
+    EXPECT_FALSE(cache.GetGroupInfo(USER_ID, PKG_NAME, QUERY_PARAMS, result));
+
+    cache.PutGroupInfo(USER_ID, PKG_NAME, QUERY_PARAMS, groups, cache.GetGeneration());
+    EXPECT_TRUE(cache.GetGroupInfo(USER_ID, PKG_NAME, QUERY_PARAMS, result));
+    EXPECT_EQ(result.size(), 1);
+    cache.InvalidateUser(USER_ID + 1);
+    EXPECT_TRUE(cache.GetGroupInfo(USER_ID, PKG_NAME, QUERY_PARAMS, result));
+    cache.InvalidateGroup("groupId");
+    EXPECT_FALSE(cache.GetGroupInfo(USER_ID, PKG_NAME, QUERY_PARAMS, result));
+
+    cache.PutGroupInfo(USER_ID, PKG_NAME, QUERY_PARAMS, groups, cache.GetGeneration());
+    cache.InvalidateUser(USER_ID);
+    EXPECT_FALSE(cache.GetGroupInfo(USER_ID, PKG_NAME, QUERY_PARAMS, result));
+}
+
+/**
+ * @tc.name: GetRelatedGroups_001
+ * @tc.desc: empty result is cached and dropped by peer invalidation
+ * @tc.type: FUNC
+ */
+HWTEST_F(HichainGroupCacheTest, GetRelatedGroups_001, testing::ext::TestSize.Level1)
+{
+    HichainGroupCache &cache = HichainGroupCache::GetInstance();
+    std::vector<HichainGroupRecord> result;
+    cache.PutRelatedGroups(USER_ID, PKG_NAME, PEER_UDID, {}, cache.GetGeneration());
+    EXPECT_TRUE(cache.GetRelatedGroups(USER_ID, PKG_NAME, PEER_UDID, result));
+    EXPECT_TRUE(result.empty());
+    cache.InvalidatePeer("otherUdid");
+    EXPECT_TRUE(cache.GetRelatedGroups(USER_ID, PKG_NAME, PEER_UDID, result));
+    cache.InvalidatePeer(PEER_UDID);
+    EXPECT_FALSE(cache.GetRelatedGroups(USER_ID, PKG_NAME, PEER_UDID, result));
+}
+
+/**
+ * @tc.name: PutGroupInfo_001
+ * @tc.desc: result queried before an invalidation or while disabled is not cached
+ * @tc.type: FUNC
+ */
+HWTEST_F(HichainGroupCacheTest, PutGroupInfo_001, testing::ext::TestSize.Level1)
+{
+    HichainGroupCache &cache = HichainGroupCache::GetInstance();
+    std::vector<HichainGroupRecord> result;
+    uint64_t generation = cache.GetGeneration();
+    cache.InvalidatePeer(PEER_UDID);
+    cache.PutRelatedGroups(USER_ID, PKG_NAME, PEER_UDID, {}, generation);
+    EXPECT_FALSE(cache.GetRelatedGroups(USER_ID, PKG_NAME, PEER_UDID, result));
+
+    cache.SetGroupCacheEnabled(false);
+    cache.PutRelatedGroups(USER_ID, PKG_NAME, PEER_UDID, {}, cache.GetGeneration());
+    EXPECT_FALSE(cache.GetRelatedGroups(USER_ID, PKG_NAME, PEER_UDID, result));
+}
+
+/**
+ * @tc.name: GetCredentialInfo_001
+ * @tc.desc: credential info is cached per user and dropped by credential invalidation
+ * @tc.type: FUNC
+ */
+HWTEST_F(HichainGroupCacheTest, GetCredentialInfo_001, testing::ext::TestSize.Level1)
+{
+    HichainGroupCache &cache = HichainGroupCache::GetInstance();
+    std::string credInfo;
+    cache.PutCredentialInfo(USER_ID, "credId", "{\"credType\":1}", cache.GetGeneration());
+    EXPECT_TRUE(cache.GetCredentialInfo(USER_ID, "credId", credInfo));
+    EXPECT_EQ(credInfo, "{\"credType\":1}");
+    EXPECT_FALSE(cache.GetCredentialInfo(USER_ID + 1, "credId", credInfo));
+    cache.InvalidateCredential("credId");
+    EXPECT_FALSE(cache.GetCredentialInfo(USER_ID, "credId", credInfo));
+}
+} // namespace
+} // namespace DistributedHardware
+} // namespace OHOS
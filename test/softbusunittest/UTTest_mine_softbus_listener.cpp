@@ -120,6 +120,41 @@ HWTEST_F(MineSoftbusListenerTest, OnPublishDeviceFound_002, testing::ext::TestSi
     EXPECT_NE(mineListener->PublishDeviceDiscovery(), DM_OK);
 }
 
+HWTEST_F(MineSoftbusListenerTest, OnPublishDeviceFound_003, testing::ext::TestSize.Level1)
+{
+    DeviceInfo deviceInfo = {
+        .devId = "repeat_searcher",
+        .devType = (DeviceType)1,
+        .devName = "11111"
+    };
+    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
+    MatchQueueStats before = MineSoftbusListener::GetMatchQueueStats();
+    mineListener->OnPublishDeviceFound(&deviceInfo);
+    mineListener->OnPublishDeviceFound(&deviceInfo);
+    MatchQueueStats after = MineSoftbusListener::GetMatchQueueStats();
+    EXPECT_EQ(after.enqueued + after.deduplicated + after.dropped,
+        before.enqueued + before.deduplicated + before.dropped + 2);
+    EXPECT_LE(after.enqueued, before.enqueued + 1);
+}
+
+HWTEST_F(MineSoftbusListenerTest, OnPublishDeviceFound_004, testing::ext::TestSize.Level1)
+{
+    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
+    MatchQueueStats before = MineSoftbusListener::GetMatchQueueStats();
+    for (int32_t i = 0; i <= DM_MAX_MATCH_QUEUE_SIZE; i++) {
+        DeviceInfo deviceInfo = {
+            .devType = (DeviceType)1,
+        };
+        std::string devId = "storm_searcher_" + std::to_string(i);
+        ASSERT_EQ(strcpy_s(deviceInfo.devId, sizeof(deviceInfo.devId), devId.c_str()), EOK);
+        mineListener->OnPublishDeviceFound(&deviceInfo);
+    }
+    MatchQueueStats after = MineSoftbusListener::GetMatchQueueStats();
+    EXPECT_LE(after.depth, static_cast<size_t>(DM_MAX_MATCH_QUEUE_SIZE));
+    EXPECT_LE(after.peakDepth, static_cast<size_t>(DM_MAX_MATCH_QUEUE_SIZE));
+    EXPECT_EQ(after.enqueued + after.dropped, before.enqueued + before.dropped + DM_MAX_MATCH_QUEUE_SIZE + 1);
+}
+
 HWTEST_F(MineSoftbusListenerTest, OnRePublish_001, testing::ext::TestSize.Level1)
 {
     std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
@@ -976,6 +1011,54 @@ HWTEST_F(MineSoftbusListenerTest, MatchSearchVertexDevice_003, testing::ext::Tes
     EXPECT_EQ(ret, BUSINESS_EXACT_NOT_MATCH);
 }
 
+HWTEST_F(MineSoftbusListenerTest, GetVertexDevicePolicyInfo_002, testing::ext::TestSize.Level1)
+{
+    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
+    mineListener->ClearLocalIdentityCache();
+    DevicePolicyInfo first = {};
+    DevicePolicyInfo second = {};
+    mineListener->GetVertexDevicePolicyInfo(first);
+    mineListener->GetVertexDevicePolicyInfo(second);
+    EXPECT_EQ(first.snHashValid, second.snHashValid);
+    EXPECT_EQ(memcmp(first.snHash, second.snHash, DM_HASH_DATA_LEN), 0);
+    EXPECT_EQ(memcmp(first.udidHash, second.udidHash, DM_HASH_DATA_LEN), 0);
+    EXPECT_EQ(memcmp(first.typeHash, second.typeHash, DM_HASH_DATA_LEN), 0);
+}
+
+HWTEST_F(MineSoftbusListenerTest, MatchSearchVertexDevice_004, testing::ext::TestSize.Level1)
+{
+    const size_t oneTlvLen = 2 + DM_HASH_DATA_LEN;
+    DeviceInfo deviceInfo;
+    deviceInfo.isOnline = false;
+    DevicePolicyInfo devicePolicyInfo = {};
+    devicePolicyInfo.snHashValid = true;
+    (void)memset_s(devicePolicyInfo.snHash, DM_HASH_DATA_LEN, 'a', DM_HASH_DATA_LEN);
+    char output[DISC_MAX_CUST_DATA_LEN] = {0};
+    output[0] = 2;
+    output[1] = DM_HASH_DATA_LEN;
+    (void)memset_s(&output[2], DM_HASH_DATA_LEN, 'a', DM_HASH_DATA_LEN);
+    BroadcastHead broadcastHead = {};
+    broadcastHead.trustFilter = 0;
+    broadcastHead.tlvDataLen = static_cast<char>(oneTlvLen);
+    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
+    EXPECT_EQ(mineListener->MatchSearchVertexDevice(deviceInfo, output, devicePolicyInfo, broadcastHead),
+        BUSINESS_EXACT_MATCH);
+
+    output[oneTlvLen] = 3;
+    output[oneTlvLen + 1] = DM_HASH_DATA_LEN;
+    broadcastHead.tlvDataLen = static_cast<char>(oneTlvLen + oneTlvLen);
+    EXPECT_EQ(mineListener->MatchSearchVertexDevice(deviceInfo, output, devicePolicyInfo, broadcastHead),
+        BUSINESS_PARTIAL_MATCH);
+
+    output[oneTlvLen] = 5;
+    EXPECT_EQ(mineListener->MatchSearchVertexDevice(deviceInfo, output, devicePolicyInfo, broadcastHead),
+        BUSINESS_EXACT_MATCH);
+
+    output[2] = 'b';
+    EXPECT_EQ(mineListener->MatchSearchVertexDevice(deviceInfo, output, devicePolicyInfo, broadcastHead),
+        BUSINESS_EXACT_NOT_MATCH);
+}
+
 HWTEST_F(MineSoftbusListenerTest, SendReturnwave_001, testing::ext::TestSize.Level1)
 {
     DeviceInfo deviceInfo;
@@ -1176,102 +1259,6 @@ HWTEST_F(MineSoftbusListenerTest, CheckDeviceNumberMatch_010, testing::ext::Test
     EXPECT_EQ(ret, true);
 }
 
-HWTEST_F(MineSoftbusListenerTest, CheckDeviceSnMatch_001, testing::ext::TestSize.Level1)
-{
-    DevicePolicyInfo devicePolicyInfo;
-    char output[DISC_MAX_CUST_DATA_LEN] = {1};
-    devicePolicyInfo.snHashValid = false;
-    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
-    auto ret = mineListener->CheckDeviceSnMatch(devicePolicyInfo, output);
-    EXPECT_EQ(ret, false);
-}
-
-HWTEST_F(MineSoftbusListenerTest, CheckDeviceSnMatch_002, testing::ext::TestSize.Level1)
-{
-    DevicePolicyInfo devicePolicyInfo;
-    char output[DISC_MAX_CUST_DATA_LEN] = {1};
-    devicePolicyInfo.snHashValid = true;
-    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
-    auto ret = mineListener->CheckDeviceSnMatch(devicePolicyInfo, output);
-    EXPECT_EQ(ret, false);
-}
-
-HWTEST_F(MineSoftbusListenerTest, CheckDeviceSnMatch_003, testing::ext::TestSize.Level1)
-{
-    DevicePolicyInfo devicePolicyInfo = {};
-    char output[DISC_MAX_CUST_DATA_LEN] = {0};
-    devicePolicyInfo.snHashValid = true;
-    (void)memset_s(devicePolicyInfo.snHash, DM_HASH_DATA_LEN, 0x11, DM_HASH_DATA_LEN);
-    (void)memset_s(output, DISC_MAX_CUST_DATA_LEN, 0x11, DM_HASH_DATA_LEN);
-    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
-    auto ret = mineListener->CheckDeviceSnMatch(devicePolicyInfo, output);
-    EXPECT_EQ(ret, true);
-}
-
-HWTEST_F(MineSoftbusListenerTest, CheckDeviceTypeMatch_001, testing::ext::TestSize.Level1)
-{
-    DevicePolicyInfo devicePolicyInfo;
-    char output[DISC_MAX_CUST_DATA_LEN] = {1};
-    devicePolicyInfo.typeHashValid = false;
-    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
-    auto ret = mineListener->CheckDeviceTypeMatch(devicePolicyInfo, output);
-    EXPECT_EQ(ret, false);
-}
-
-HWTEST_F(MineSoftbusListenerTest, CheckDeviceTypeMatch_002, testing::ext::TestSize.Level1)
-{
-    DevicePolicyInfo devicePolicyInfo;
-    char output[DISC_MAX_CUST_DATA_LEN] = {1};
-    devicePolicyInfo.typeHashValid = true;
-    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
-    auto ret = mineListener->CheckDeviceTypeMatch(devicePolicyInfo, output);
-    EXPECT_EQ(ret, false);
-}
-
-HWTEST_F(MineSoftbusListenerTest, CheckDeviceTypeMatch_003, testing::ext::TestSize.Level1)
-{
-    DevicePolicyInfo devicePolicyInfo = {};
-    char output[DISC_MAX_CUST_DATA_LEN] = {0};
-    devicePolicyInfo.typeHashValid = true;
-    (void)memset_s(devicePolicyInfo.typeHash, DM_HASH_DATA_LEN, 0x11, DM_HASH_DATA_LEN);
-    (void)memset_s(output, DISC_MAX_CUST_DATA_LEN, 0x11, DM_HASH_DATA_LEN);
-    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
-    auto ret = mineListener->CheckDeviceTypeMatch(devicePolicyInfo, output);
-    EXPECT_EQ(ret, true);
-}
-
-HWTEST_F(MineSoftbusListenerTest, CheckDeviceUdidMatch_001, testing::ext::TestSize.Level1)
-{
-    DevicePolicyInfo devicePolicyInfo;
-    char output[DISC_MAX_CUST_DATA_LEN] = {1};
-    devicePolicyInfo.udidHashValid = false;
-    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
-    auto ret = mineListener->CheckDeviceUdidMatch(devicePolicyInfo, output);
-    EXPECT_EQ(ret, false);
-}
-
-HWTEST_F(MineSoftbusListenerTest, CheckDeviceUdidMatch_002, testing::ext::TestSize.Level1)
-{
-    DevicePolicyInfo devicePolicyInfo;
-    char output[DISC_MAX_CUST_DATA_LEN] = {1};
-    devicePolicyInfo.udidHashValid = true;
-    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
-    auto ret = mineListener->CheckDeviceUdidMatch(devicePolicyInfo, output);
-    EXPECT_EQ(ret, false);
-}
-
-HWTEST_F(MineSoftbusListenerTest, CheckDeviceUdidMatch_003, testing::ext::TestSize.Level1)
-{
-    DevicePolicyInfo devicePolicyInfo = {};
-    char output[DISC_MAX_CUST_DATA_LEN] = {0};
-    devicePolicyInfo.udidHashValid = true;
-    (void)memset_s(devicePolicyInfo.udidHash, DM_HASH_DATA_LEN, 0x11, DM_HASH_DATA_LEN);
-    (void)memset_s(output, DISC_MAX_CUST_DATA_LEN, 0x11, DM_HASH_DATA_LEN);
-    std::shared_ptr<MineSoftbusListener> mineListener = std::make_shared<MineSoftbusListener>();
-    auto ret = mineListener->CheckDeviceUdidMatch(devicePolicyInfo, output);
-    EXPECT_EQ(ret, true);
-}
-
 HWTEST_F(MineSoftbusListenerTest, GetMatchResult_001, testing::ext::TestSize.Level1)
 {
     std::vector<int> matchItemNum;
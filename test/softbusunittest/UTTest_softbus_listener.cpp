@@ -329,6 +329,39 @@ HWTEST_F(SoftbusListenerTest, UnRegisterSoftbusLnnOpsCbk_001, testing::ext::Test
     EXPECT_EQ(ret, DM_OK);
 }
 
+HWTEST_F(SoftbusListenerTest, UnRegisterSoftbusLnnOpsCbk_002, testing::ext::TestSize.Level0)
+{
+    std::string pkgName = "com.ohos.sync_dispatch";
+    auto callback = std::make_shared<ISoftbusDiscoveringCallbackTest>();
+    if (softbusListener == nullptr) {
+        softbusListener = std::make_shared<SoftbusListener>();
+    }
+    EXPECT_EQ(softbusListener->RegisterSoftbusLnnOpsCbk(pkgName, callback), DM_OK);
+    softbusListener->OnSoftbusDiscoveryResult(1, RefreshResult::REFRESH_LNN_SUCCESS);
+    EXPECT_EQ(callback->resultCount.load(), 1);
+    EXPECT_EQ(softbusListener->UnRegisterSoftbusLnnOpsCbk(pkgName), DM_OK);
+    softbusListener->OnSoftbusDiscoveryResult(1, RefreshResult::REFRESH_LNN_SUCCESS);
+    EXPECT_EQ(callback->resultCount.load(), 1);
+}
+
+HWTEST_F(SoftbusListenerTest, RegisterSoftbusLnnOpsCbk_003, testing::ext::TestSize.Level0)
+{
+    std::string pkgName = "com.ohos.async_dispatch";
+    auto callback = std::make_shared<ISoftbusDiscoveringCallbackTest>();
+    if (softbusListener == nullptr) {
+        softbusListener = std::make_shared<SoftbusListener>();
+    }
+    EXPECT_EQ(softbusListener->RegisterSoftbusLnnOpsCbk(pkgName, callback, true), DM_OK);
+    EXPECT_EQ(softbusListener->RegisterSoftbusLnnOpsCbk(pkgName, callback, true), DM_OK);
+    softbusListener->OnSoftbusDiscoveryResult(1, RefreshResult::REFRESH_LNN_SUCCESS);
+    softbusListener->OnSoftbusDiscoveryResult(1, RefreshResult::REFRESH_LNN_SUCCESS);
+    for (int32_t i = 0; i < 100 && callback->resultCount.load() < 2; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(callback->resultCount.load(), 2);
+    EXPECT_EQ(softbusListener->UnRegisterSoftbusLnnOpsCbk(pkgName), DM_OK);
+}
+
 HWTEST_F(SoftbusListenerTest, GetUdidByNetworkId_001, testing::ext::TestSize.Level0)
 {
     std::string networkId = "networkId";
@@ -505,10 +538,7 @@ HWTEST_F(SoftbusListenerTest, GetTargetInfoFromCache_003, testing::ext::TestSize
     infoPtr->devType = static_cast<DeviceType>(1);
     infoPtr->addrNum = 1;
     InitTestConnectionAddr(infoPtr->addr[0], ConnectionAddrType::CONNECTION_ADDR_WLAN);
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, infoPtr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
@@ -525,10 +555,7 @@ HWTEST_F(SoftbusListenerTest, GetTargetInfoFromCache_004, testing::ext::TestSize
     infoPtr->devType = static_cast<DeviceType>(1);
     infoPtr->addrNum = 1;
     InitTestConnectionAddr(infoPtr->addr[0], ConnectionAddrType::CONNECTION_ADDR_ETH);
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, infoPtr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
@@ -546,10 +573,7 @@ HWTEST_F(SoftbusListenerTest, GetTargetInfoFromCache_005, testing::ext::TestSize
     infoPtr->devType = static_cast<DeviceType>(1);
     infoPtr->addrNum = 1;
     InitTestConnectionAddr(infoPtr->addr[0], ConnectionAddrType::CONNECTION_ADDR_BR);
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, infoPtr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
@@ -566,10 +590,7 @@ HWTEST_F(SoftbusListenerTest, GetTargetInfoFromCache_006, testing::ext::TestSize
     infoPtr->devType = static_cast<DeviceType>(1);
     infoPtr->addrNum = 1;
     InitTestConnectionAddr(infoPtr->addr[0], ConnectionAddrType::CONNECTION_ADDR_BLE);
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, infoPtr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
@@ -582,9 +603,7 @@ HWTEST_F(SoftbusListenerTest, GetTargetInfoFromCache_007, testing::ext::TestSize
     std::string deviceId = "deviceId_007";
     PeerTargetId targetId;
     ConnectionAddrType addrType;
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, nullptr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
@@ -825,15 +844,13 @@ HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_002, testing::ext::TestSize
     std::string deviceId = "deviceId";
     std::string ip = "10.11.12.13.14";
     ConnectionAddrType addrType;
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, nullptr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
     int32_t ret = softbusListener->GetIPAddrTypeFromCache(deviceId, ip, addrType);
     EXPECT_EQ(ret, ERR_DM_BIND_INPUT_PARA_INVALID);
-    discoveredDeviceMap.clear();
+    SoftbusListener::ClearDiscoveredDevice();
 }
 
 HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_003, testing::ext::TestSize.Level0)
@@ -842,16 +859,13 @@ HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_003, testing::ext::TestSize
     std::string ip = "10.11.12.13.14";
     ConnectionAddrType addrType;
     std::shared_ptr<DeviceInfo> infoPtr = std::make_shared<DeviceInfo>();
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, infoPtr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
     int32_t ret = softbusListener->GetIPAddrTypeFromCache(deviceId, ip, addrType);
     EXPECT_EQ(ret, ERR_DM_BIND_INPUT_PARA_INVALID);
-    discoveredDeviceMap.clear();
+    SoftbusListener::ClearDiscoveredDevice();
 }
 
 HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_004, testing::ext::TestSize.Level0)
@@ -863,17 +877,14 @@ HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_004, testing::ext::TestSize
     infoPtr->devType = static_cast<DeviceType>(1);
     infoPtr->addrNum = 1;
     InitTestConnectionAddr(infoPtr->addr[0], ConnectionAddrType::CONNECTION_ADDR_WLAN);
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, infoPtr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
     int32_t ret = softbusListener->GetIPAddrTypeFromCache(deviceId, ip, addrType);
     softbusListener->CacheDeviceInfo(deviceId, infoPtr);
     EXPECT_EQ(ret, DM_OK);
-    discoveredDeviceMap.clear();
+    SoftbusListener::ClearDiscoveredDevice();
 }
 
 HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_005, testing::ext::TestSize.Level0)
@@ -885,16 +896,13 @@ HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_005, testing::ext::TestSize
     infoPtr->devType = static_cast<DeviceType>(1);
     infoPtr->addrNum = 1;
     InitTestConnectionAddr(infoPtr->addr[0], ConnectionAddrType::CONNECTION_ADDR_ETH);
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, infoPtr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
     int32_t ret = softbusListener->GetIPAddrTypeFromCache(deviceId, ip, addrType);
     EXPECT_EQ(ret, DM_OK);
-    discoveredDeviceMap.clear();
+    SoftbusListener::ClearDiscoveredDevice();
 }
 
 HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_006, testing::ext::TestSize.Level0)
@@ -906,16 +914,13 @@ HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_006, testing::ext::TestSize
     infoPtr->devType = static_cast<DeviceType>(1);
     infoPtr->addrNum = 1;
     InitTestConnectionAddr(infoPtr->addr[0], ConnectionAddrType::CONNECTION_ADDR_NCM);
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, infoPtr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
     int32_t ret = softbusListener->GetIPAddrTypeFromCache(deviceId, ip, addrType);
     EXPECT_EQ(ret, DM_OK);
-    discoveredDeviceMap.clear();
+    SoftbusListener::ClearDiscoveredDevice();
 }
 
 HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_007, testing::ext::TestSize.Level0)
@@ -927,16 +932,83 @@ HWTEST_F(SoftbusListenerTest, GetIPAddrTypeFromCache_007, testing::ext::TestSize
     infoPtr->devType = static_cast<DeviceType>(1);
     infoPtr->addrNum = 1;
     InitTestConnectionAddr(infoPtr->addr[0], ConnectionAddrType::CONNECTION_ADDR_NCM);
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    deviceVec.push_back(std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>(addrType, infoPtr));
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, infoPtr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
     int32_t ret = softbusListener->GetIPAddrTypeFromCache(deviceId, ip, addrType);
     EXPECT_EQ(ret, ERR_DM_BIND_INPUT_PARA_INVALID);
-    discoveredDeviceMap.clear();
+    SoftbusListener::ClearDiscoveredDevice();
+}
+
+HWTEST_F(SoftbusListenerTest, GetTargetInfoFromCache_008, testing::ext::TestSize.Level0)
+{
+    std::string deviceId = "deviceId_008";
+    DeviceInfo deviceInfo {};
+    InitTestDeviceInfo(deviceInfo, deviceId.c_str(), ConnectionAddrType::CONNECTION_ADDR_WLAN);
+    SoftbusListener::ClearDiscoveredDevice();
+    SoftbusListener::CacheDiscoveredDevice(&deviceInfo);
+    deviceInfo.addr[0].type = ConnectionAddrType::CONNECTION_ADDR_BR;
+    (void)strcpy_s(deviceInfo.addr[0].info.br.brMac, sizeof(deviceInfo.addr[0].info.br.brMac), "brMac");
+    SoftbusListener::CacheDiscoveredDevice(&deviceInfo);
+    uint64_t hit = SoftbusListener::GetDiscoveredDeviceCacheStats().hit;
+
+    PeerTargetId targetId;
+    ConnectionAddrType addrType = ConnectionAddrType::CONNECTION_ADDR_MAX;
+    EXPECT_EQ(SoftbusListener::GetTargetInfoFromCache(deviceId, targetId, addrType), DM_OK);
+    EXPECT_EQ(addrType, ConnectionAddrType::CONNECTION_ADDR_BR);
+    EXPECT_EQ(targetId.brMac, "brMac");
+    EXPECT_EQ(SoftbusListener::GetIPAddrTypeFromCache(deviceId, "172.0.0.1", addrType), DM_OK);
+    EXPECT_EQ(addrType, ConnectionAddrType::CONNECTION_ADDR_WLAN);
+    EXPECT_EQ(SoftbusListener::GetDiscoveredDeviceCacheStats().hit, hit + 2);
+    SoftbusListener::ClearDiscoveredDevice();
+}
+
+HWTEST_F(SoftbusListenerTest, DiscoveredDeviceCache_001, testing::ext::TestSize.Level0)
+{
+    DiscoveredDeviceCache cache(2, 0);
+    DeviceInfo deviceInfo {};
+    InitTestDeviceInfo(deviceInfo, "a", ConnectionAddrType::CONNECTION_ADDR_WLAN);
+    EXPECT_TRUE(cache.Put("a", deviceInfo, 0));
+    EXPECT_TRUE(cache.Put("b", deviceInfo, 0));
+    ConnectionAddr addr;
+    EXPECT_TRUE(cache.GetLatestAddr("a", 0, addr));
+    EXPECT_TRUE(cache.Put("c", deviceInfo, 0));
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_TRUE(cache.GetLatestAddr("a", 0, addr));
+    EXPECT_FALSE(cache.GetLatestAddr("b", 0, addr));
+    DiscoveredDeviceCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.insert, 3);
+    EXPECT_EQ(stats.evict, 1);
+    EXPECT_EQ(stats.hit, 2);
+    EXPECT_EQ(stats.miss, 1);
+}
+
+HWTEST_F(SoftbusListenerTest, DiscoveredDeviceCache_002, testing::ext::TestSize.Level0)
+{
+    DiscoveredDeviceCache cache(2, 100);
+    DeviceInfo deviceInfo {};
+    InitTestDeviceInfo(deviceInfo, "a", ConnectionAddrType::CONNECTION_ADDR_ETH);
+    EXPECT_TRUE(cache.Put("a", deviceInfo, 0));
+    deviceInfo.addr[0].type = ConnectionAddrType::CONNECTION_ADDR_NCM;
+    (void)strcpy_s(deviceInfo.addr[0].info.ip.ip, sizeof(deviceInfo.addr[0].info.ip.ip), "172.0.0.2");
+    EXPECT_TRUE(cache.Put("a", deviceInfo, 50));
+    EXPECT_EQ(cache.Size(), 1);
+    EXPECT_EQ(cache.GetStats().update, 1);
+
+    ConnectionAddrType addrType = ConnectionAddrType::CONNECTION_ADDR_MAX;
+    EXPECT_TRUE(cache.GetIpAddrType("a", "172.0.0.1", 100, addrType));
+    EXPECT_EQ(addrType, ConnectionAddrType::CONNECTION_ADDR_ETH);
+    EXPECT_TRUE(cache.GetIpAddrType("a", "172.0.0.2", 100, addrType));
+    EXPECT_EQ(addrType, ConnectionAddrType::CONNECTION_ADDR_NCM);
+
+    ConnectionAddr addr;
+    EXPECT_FALSE(cache.GetLatestAddr("a", 200, addr));
+    EXPECT_EQ(cache.Size(), 0);
+    EXPECT_EQ(cache.GetStats().expire, 1);
+    deviceInfo.addrNum = 0;
+    EXPECT_FALSE(cache.Put("a", deviceInfo, 200));
+    EXPECT_FALSE(cache.Put("", deviceInfo, 200));
 }
 
 HWTEST_F(SoftbusListenerTest, InitSoftbusListener_001, testing::ext::TestSize.Level0)
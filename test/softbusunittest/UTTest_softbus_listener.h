@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 #include <refbase.h>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -67,7 +68,9 @@ public:
         (void)pkgName;
         (void)subscribeId;
         (void)result;
+        resultCount++;
     }
+    std::atomic<int32_t> resultCount {0};
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -202,14 +202,12 @@ HWTEST_F(SoftbusListenerTwoTest, GetIPAddrTypeFromCache_001, testing::ext::TestS
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
-    discoveredDeviceMap.clear();
+    SoftbusListener::ClearDiscoveredDevice();
     std::string deviceId = "deviceId";
     std::string ip = "10.11.12.13.14";
     ConnectionAddrType addrType;
     std::shared_ptr<DeviceInfo> infoPtr = std::make_shared<DeviceInfo>();
-    std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>> deviceVec;
-    discoveredDeviceMap.insert(std::pair<std::string,
-        std::vector<std::pair<ConnectionAddrType, std::shared_ptr<DeviceInfo>>>>(deviceId, deviceVec));
+    SoftbusListener::CacheDeviceInfo(deviceId, nullptr);
     if (softbusListener == nullptr) {
         softbusListener = std::make_shared<SoftbusListener>();
     }
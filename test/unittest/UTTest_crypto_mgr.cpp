@@ -193,5 +193,129 @@ HWTEST_F(CryptoMgrTest, DecryptMessage_InvalidHex_001, testing::ext::TestSize.Le
     ret = cryptoMgr->DecryptMessage(invalidHex, decryptData);
     EXPECT_NE(ret, DM_OK);
 }
+
+HWTEST_F(CryptoMgrTest, EncryptData_DecryptData_001, testing::ext::TestSize.Level2)
+{
+    auto cryptoMgr = std::make_shared<CryptoMgr>();
+    uint8_t sessionKey[SESSION_KEY_LENGTH] = "sessionKey_rm44";
+    auto ret = cryptoMgr->ProcessSessionKey(sessionKey, SESSION_KEY_LENGTH);
+    ASSERT_EQ(ret, DM_OK);
+    std::string plain("raw\0binary\xff", 14);
+    std::string cipher;
+    ret = cryptoMgr->EncryptData(plain, cipher);
+    ASSERT_EQ(ret, DM_OK);
+    // iv and tag only, no hex expansion.
+    EXPECT_EQ(cipher.size(), plain.size() + GCM_IV_LEN + 16);
+    std::string decrypted;
+    ret = cryptoMgr->DecryptData(cipher, decrypted);
+    EXPECT_EQ(ret, DM_OK);
+    EXPECT_EQ(decrypted, plain);
+
+    cipher[cipher.size() - 1] ^= 0x01;
+    ret = cryptoMgr->DecryptData(cipher, decrypted);
+    EXPECT_NE(ret, DM_OK);
+}
+
+HWTEST_F(CryptoMgrTest, EncryptData_InvalidPara_001, testing::ext::TestSize.Level2)
+{
+    auto cryptoMgr = std::make_shared<CryptoMgr>();
+    std::string output;
+    EXPECT_EQ(cryptoMgr->EncryptData("", output), ERR_DM_CRYPTO_PARA_INVALID);
+    EXPECT_EQ(cryptoMgr->DecryptData("short", output), ERR_DM_CRYPTO_PARA_INVALID);
+}
+
+HWTEST_F(CryptoMgrTest, EncryptSegments_DecryptSegments_001, testing::ext::TestSize.Level2)
+{
+    auto cryptoMgr = std::make_shared<CryptoMgr>();
+    uint8_t sessionKey[SESSION_KEY_LENGTH] = "sessionKey_sm55";
+    auto ret = cryptoMgr->ProcessSessionKey(sessionKey, SESSION_KEY_LENGTH);
+    ASSERT_EQ(ret, DM_OK);
+    std::string head = "header|";
+    std::string body = "segmented body";
+    std::vector<DmCryptoSegment> plainSegs = {
+        { reinterpret_cast<const uint8_t *>(head.data()), static_cast<uint32_t>(head.size()) },
+        { nullptr, 0 },
+        { reinterpret_cast<const uint8_t *>(body.data()), static_cast<uint32_t>(body.size()) },
+    };
+    std::vector<uint8_t> cipher;
+    ret = cryptoMgr->EncryptSegments(plainSegs, cipher);
+    ASSERT_EQ(ret, DM_OK);
+    ASSERT_EQ(cipher.size(), head.size() + body.size() + GCM_IV_LEN + 16);
+
+    // split the cipher text across the iv and tag boundaries.
+    const uint32_t splitA = 5;
+    const uint32_t splitB = static_cast<uint32_t>(cipher.size()) - 3;
+    std::vector<DmCryptoSegment> cipherSegs = {
+        { cipher.data(), splitA },
+        { cipher.data() + splitA, splitB - splitA },
+        { cipher.data() + splitB, static_cast<uint32_t>(cipher.size()) - splitB },
+    };
+    std::vector<uint8_t> plain;
+    ret = cryptoMgr->DecryptSegments(cipherSegs, plain);
+    ASSERT_EQ(ret, DM_OK);
+    EXPECT_EQ(std::string(plain.begin(), plain.end()), head + body);
+
+    std::string legacy;
+    ret = cryptoMgr->DecryptData(std::string(cipher.begin(), cipher.end()), legacy);
+    EXPECT_EQ(ret, DM_OK);
+    EXPECT_EQ(legacy, head + body);
+}
+
+HWTEST_F(CryptoMgrTest, EncryptSegments_ReuseBuffer_001, testing::ext::TestSize.Level2)
+{
+    auto cryptoMgr = std::make_shared<CryptoMgr>();
+    uint8_t sessionKey[SESSION_KEY_LENGTH] = "sessionKey_tm66";
+    auto ret = cryptoMgr->ProcessSessionKey(sessionKey, SESSION_KEY_LENGTH);
+    ASSERT_EQ(ret, DM_OK);
+    std::string large(1024, 'a');
+    std::string small = "small";
+    std::vector<uint8_t> cipher;
+    std::vector<uint8_t> plain;
+    ret = cryptoMgr->EncryptSegments({ { reinterpret_cast<const uint8_t *>(large.data()),
+        static_cast<uint32_t>(large.size()) } }, cipher);
+    ASSERT_EQ(ret, DM_OK);
+    const uint8_t *buffer = cipher.data();
+    ret = cryptoMgr->EncryptSegments({ { reinterpret_cast<const uint8_t *>(small.data()),
+        static_cast<uint32_t>(small.size()) } }, cipher);
+    ASSERT_EQ(ret, DM_OK);
+    EXPECT_EQ(cipher.data(), buffer);
+    ret = cryptoMgr->DecryptSegments({ { cipher.data(), static_cast<uint32_t>(cipher.size()) } }, plain);
+    ASSERT_EQ(ret, DM_OK);
+    EXPECT_EQ(std::string(plain.begin(), plain.end()), small);
+
+    cipher[GCM_IV_LEN] ^= 0x01;
+    ret = cryptoMgr->DecryptSegments({ { cipher.data(), static_cast<uint32_t>(cipher.size()) } }, plain);
+    EXPECT_NE(ret, DM_OK);
+    EXPECT_TRUE(plain.empty());
+}
+
+HWTEST_F(CryptoMgrTest, EncryptSegments_ClearSessionKey_001, testing::ext::TestSize.Level2)
+{
+    auto cryptoMgr = std::make_shared<CryptoMgr>();
+    uint8_t sessionKey[SESSION_KEY_LENGTH] = "sessionKey_um77";
+    auto ret = cryptoMgr->ProcessSessionKey(sessionKey, SESSION_KEY_LENGTH);
+    ASSERT_EQ(ret, DM_OK);
+    std::string message = "message";
+    std::vector<DmCryptoSegment> segs = {
+        { reinterpret_cast<const uint8_t *>(message.data()), static_cast<uint32_t>(message.size()) }
+    };
+    std::vector<uint8_t> cipher;
+    ASSERT_EQ(cryptoMgr->EncryptSegments(segs, cipher), DM_OK);
+
+    // the cached context goes away with the key.
+    cryptoMgr->ClearSessionKey();
+    std::vector<uint8_t> output;
+    EXPECT_NE(cryptoMgr->EncryptSegments(segs, output), DM_OK);
+    EXPECT_NE(cryptoMgr->DecryptSegments({ { cipher.data(), static_cast<uint32_t>(cipher.size()) } }, output),
+        DM_OK);
+
+    // a new key replaces the context, the old cipher text no longer authenticates.
+    uint8_t otherKey[SESSION_KEY_LENGTH] = "sessionKey_vm88";
+    ASSERT_EQ(cryptoMgr->ProcessSessionKey(otherKey, SESSION_KEY_LENGTH), DM_OK);
+    EXPECT_NE(cryptoMgr->DecryptSegments({ { cipher.data(), static_cast<uint32_t>(cipher.size()) } }, output),
+        DM_OK);
+    EXPECT_EQ(cryptoMgr->EncryptSegments({}, output), ERR_DM_CRYPTO_PARA_INVALID);
+    EXPECT_EQ(cryptoMgr->EncryptSegments({ { nullptr, 1 } }, output), ERR_DM_CRYPTO_PARA_INVALID);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
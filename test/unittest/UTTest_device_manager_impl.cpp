@@ -64,6 +64,8 @@ void DeviceManagerImplTest::SetUp()
     tokenId = GetAccessTokenId(&infoInstance);
     SetSelfTokenID(tokenId);
     OHOS::Security::AccessToken::AccessTokenKit::ReloadNativeTokenInfo();
+    // Drops permission grants cached by an earlier case, as a service death would.
+    DeviceManagerImpl::GetInstance().OnDmServiceDied();
 }
 
 void DeviceManagerImplTest::TearDown()
@@ -267,11 +269,49 @@ HWTEST_F(DeviceManagerImplTest, GetLocalDeviceId_102, testing::ext::TestSize.Lev
     std::string deviceId = "deviceId";
     std::shared_ptr<DmInitCallback> callback = std::make_shared<DmInitCallbackTest>();
     int32_t ret = DeviceManager::GetInstance().InitDeviceManager(packName, callback);
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(GET_LOCAL_DEVICE_INFO, testing::_, testing::_))
+                .Times(1).WillOnce(testing::Invoke(
+                    [](int32_t cmdCode, std::shared_ptr<IpcReq> req, std::shared_ptr<IpcRsp> rsp) {
+                        (void)cmdCode;
+                        (void)req;
+                        DmDeviceInfo info;
+                        (void)strcpy_s(info.networkId, DM_MAX_DEVICE_ID_LEN, "networkId");
+                        (void)strcpy_s(info.deviceId, DM_MAX_DEVICE_ID_LEN, "deviceId");
+                        std::static_pointer_cast<IpcGetLocalDeviceInfoRsp>(rsp)->SetLocalDeviceInfo(info);
+                        rsp->SetErrCode(DM_OK);
+                        return DM_OK;
+                    }));
     ret = DeviceManager::GetInstance().GetLocalDeviceId(packName, deviceId);
     ASSERT_EQ(ret, DM_OK);
     DeviceManager::GetInstance().UnInitDeviceManager(packName);
 }
 
+/**
+ * @tc.name: GetLocalDeviceId_103
+ * @tc.desc: 1. the service answers with the networkId alone, as it does for a caller without DATASYNC
+ *           2. call DeviceManagerImpl::GetLocalDeviceId with parameter
+ *           3. check ret is ERR_DM_NO_PERMISSION
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceManagerImplTest, GetLocalDeviceId_103, testing::ext::TestSize.Level0)
+{
+    std::string packName = "com.ohos.test";
+    std::string deviceId = "deviceId";
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(GET_LOCAL_DEVICE_INFO, testing::_, testing::_))
+                .Times(1).WillOnce(testing::Invoke(
+                    [](int32_t cmdCode, std::shared_ptr<IpcReq> req, std::shared_ptr<IpcRsp> rsp) {
+                        (void)cmdCode;
+                        (void)req;
+                        DmDeviceInfo info;
+                        (void)strcpy_s(info.networkId, DM_MAX_DEVICE_ID_LEN, "networkId");
+                        std::static_pointer_cast<IpcGetLocalDeviceInfoRsp>(rsp)->SetLocalDeviceInfo(info);
+                        rsp->SetErrCode(DM_OK);
+                        return DM_OK;
+                    }));
+    int32_t ret = DeviceManager::GetInstance().GetLocalDeviceId(packName, deviceId);
+    ASSERT_EQ(ret, ERR_DM_NO_PERMISSION);
+}
+
 /**
  * @tc.name: GetLocalDeviceName_101
  * @tc.desc: 1. set packName null
@@ -347,11 +387,49 @@ HWTEST_F(DeviceManagerImplTest, GetLocalDeviceType_102, testing::ext::TestSize.L
     int32_t deviceType = 0;
     std::shared_ptr<DmInitCallback> callback = std::make_shared<DmInitCallbackTest>();
     int32_t ret = DeviceManager::GetInstance().InitDeviceManager(packName, callback);
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(GET_LOCAL_DEVICE_INFO, testing::_, testing::_))
+                .Times(1).WillOnce(testing::Invoke(
+                    [](int32_t cmdCode, std::shared_ptr<IpcReq> req, std::shared_ptr<IpcRsp> rsp) {
+                        (void)cmdCode;
+                        (void)req;
+                        DmDeviceInfo info;
+                        (void)strcpy_s(info.networkId, DM_MAX_DEVICE_ID_LEN, "networkId");
+                        (void)strcpy_s(info.deviceId, DM_MAX_DEVICE_ID_LEN, "deviceId");
+                        std::static_pointer_cast<IpcGetLocalDeviceInfoRsp>(rsp)->SetLocalDeviceInfo(info);
+                        rsp->SetErrCode(DM_OK);
+                        return DM_OK;
+                    }));
     ret = DeviceManager::GetInstance().GetLocalDeviceType(packName, deviceType);
     ASSERT_EQ(ret, DM_OK);
     DeviceManager::GetInstance().UnInitDeviceManager(packName);
 }
 
+/**
+ * @tc.name: GetLocalDeviceType_103
+ * @tc.desc: 1. the service answers with the networkId alone, as it does for a caller without DATASYNC
+ *           2. call DeviceManagerImpl::GetLocalDeviceType with parameter
+ *           3. check ret is ERR_DM_NO_PERMISSION
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceManagerImplTest, GetLocalDeviceType_103, testing::ext::TestSize.Level0)
+{
+    std::string packName = "com.ohos.test";
+    int32_t deviceType = 0;
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(GET_LOCAL_DEVICE_INFO, testing::_, testing::_))
+                .Times(1).WillOnce(testing::Invoke(
+                    [](int32_t cmdCode, std::shared_ptr<IpcReq> req, std::shared_ptr<IpcRsp> rsp) {
+                        (void)cmdCode;
+                        (void)req;
+                        DmDeviceInfo info;
+                        (void)strcpy_s(info.networkId, DM_MAX_DEVICE_ID_LEN, "networkId");
+                        std::static_pointer_cast<IpcGetLocalDeviceInfoRsp>(rsp)->SetLocalDeviceInfo(info);
+                        rsp->SetErrCode(DM_OK);
+                        return DM_OK;
+                    }));
+    int32_t ret = DeviceManager::GetInstance().GetLocalDeviceType(packName, deviceType);
+    ASSERT_EQ(ret, ERR_DM_NO_PERMISSION);
+}
+
 /**
  * @tc.name: GetDeviceName_101
  * @tc.desc: 1. set packName null
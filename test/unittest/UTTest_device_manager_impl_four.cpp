@@ -28,6 +28,7 @@
 #include "dm_constants.h"
 #include "dm_log.h"
 #include "ipc_authenticate_device_req.h"
+#include "ipc_batch_query_rsp.h"
 #include "ipc_get_info_by_network_req.h"
 #include "ipc_get_info_by_network_rsp.h"
 #include "ipc_get_local_device_info_rsp.h"
@@ -1651,6 +1652,102 @@ HWTEST_F(DeviceManagerImplTest, UpdateServiceInfo_006, testing::ext::TestSize.Le
     int32_t ret = DeviceManagerImpl::GetInstance().UpdateServiceInfo(serviceId, regServiceInfo);
     ASSERT_EQ(ret, DM_OK);
 }
+
+HWTEST_F(DeviceManagerImplTest, BatchQuery_001, testing::ext::TestSize.Level1)
+{
+    std::vector<DmBatchQueryItem> items(1);
+    int32_t ret = DeviceManagerImpl::GetInstance().BatchQuery("", items);
+    ASSERT_EQ(ret, ERR_DM_INPUT_PARA_INVALID);
+    std::vector<DmBatchQueryItem> emptyItems;
+    ret = DeviceManagerImpl::GetInstance().BatchQuery("com.ohos.test", emptyItems);
+    ASSERT_EQ(ret, ERR_DM_INPUT_PARA_INVALID);
+    std::vector<DmBatchQueryItem> bigItems(DM_BATCH_QUERY_MAX_NUM + 1);
+    ret = DeviceManagerImpl::GetInstance().BatchQuery("com.ohos.test", bigItems);
+    ASSERT_EQ(ret, ERR_DM_INPUT_PARA_INVALID);
+}
+
+HWTEST_F(DeviceManagerImplTest, BatchQuery_002, testing::ext::TestSize.Level1)
+{
+    std::vector<DmBatchQueryItem> items(3);
+    items[0].type = DM_BATCH_QUERY_UDID_BY_NETWORK;
+    items[0].networkId = "networkId";
+    items[1].type = DM_BATCH_QUERY_NETWORK_TYPE_BY_NETWORK;
+    items[1].networkId = "networkId";
+    items[2].type = DM_BATCH_QUERY_UUID_BY_NETWORK;
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(BATCH_QUERY, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(DoAll(
+            WithArg<2>([](std::shared_ptr<IpcRsp> rsp) {
+                std::shared_ptr<IpcBatchQueryRsp> batchRsp = std::static_pointer_cast<IpcBatchQueryRsp>(rsp);
+                ASSERT_EQ(batchRsp->GetCmds().size(), 2u);
+                std::shared_ptr<IpcGetInfoByNetWorkRsp> udidRsp =
+                    std::static_pointer_cast<IpcGetInfoByNetWorkRsp>(batchRsp->GetCmds()[0].rsp);
+                udidRsp->SetUdid("udid");
+                udidRsp->SetErrCode(DM_OK);
+                batchRsp->GetCmds()[1].rsp->SetErrCode(ERR_DM_FAILED);
+                batchRsp->SetErrCode(DM_OK);
+            }),
+            Return(DM_OK)
+        ));
+    int32_t ret = DeviceManagerImpl::GetInstance().BatchQuery("com.ohos.test", items);
+    ASSERT_EQ(ret, DM_OK);
+    EXPECT_EQ(items[0].result, DM_OK);
+    EXPECT_EQ(items[0].udid, "udid");
+    EXPECT_EQ(items[1].result, ERR_DM_FAILED);
+    EXPECT_EQ(items[2].result, ERR_DM_INPUT_PARA_INVALID);
+}
+
+HWTEST_F(DeviceManagerImplTest, BatchQuery_003, testing::ext::TestSize.Level1)
+{
+    std::vector<DmBatchQueryItem> items(2);
+    items[0].type = DM_BATCH_QUERY_UDID_BY_NETWORK;
+    items[0].networkId = "networkId";
+    items[1].type = DM_BATCH_QUERY_UUID_BY_NETWORK;
+    items[1].networkId = "networkId";
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(BATCH_QUERY, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(Return(ERR_DM_UNSUPPORTED_IPC_COMMAND));
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(GET_UDID_BY_NETWORK, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(DoAll(
+            WithArg<2>([](std::shared_ptr<IpcRsp> rsp) {
+                std::static_pointer_cast<IpcGetInfoByNetWorkRsp>(rsp)->SetUdid("udid");
+                rsp->SetErrCode(DM_OK);
+            }),
+            Return(DM_OK)
+        ));
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(GET_UUID_BY_NETWORK, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(Return(ERR_DM_IPC_SEND_REQUEST_FAILED));
+    int32_t ret = DeviceManagerImpl::GetInstance().BatchQuery("com.ohos.test", items);
+    ASSERT_EQ(ret, DM_OK);
+    EXPECT_EQ(items[0].result, DM_OK);
+    EXPECT_EQ(items[0].udid, "udid");
+    EXPECT_EQ(items[1].result, ERR_DM_IPC_SEND_REQUEST_FAILED);
+}
+
+HWTEST_F(DeviceManagerImplTest, BatchQuery_004, testing::ext::TestSize.Level1)
+{
+    std::vector<DmBatchQueryItem> items(2);
+    items[0].type = DM_BATCH_QUERY_UDID_BY_NETWORK;
+    items[0].networkId = "networkId";
+    items[1].type = DM_BATCH_QUERY_UUID_BY_NETWORK;
+    items[1].networkId = "networkId";
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(BATCH_QUERY, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(DoAll(
+            WithArg<2>([](std::shared_ptr<IpcRsp> rsp) {
+                rsp->SetErrCode(ERR_DM_IPC_CMD_BUSY);
+            }),
+            Return(DM_OK)
+        ));
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(GET_UDID_BY_NETWORK, testing::_, testing::_)).Times(0);
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(GET_UUID_BY_NETWORK, testing::_, testing::_)).Times(0);
+    int32_t ret = DeviceManagerImpl::GetInstance().BatchQuery("com.ohos.test", items);
+    ASSERT_EQ(ret, DM_OK);
+    EXPECT_EQ(items[0].result, ERR_DM_IPC_CMD_BUSY);
+    EXPECT_EQ(items[1].result, ERR_DM_IPC_CMD_BUSY);
+}
 } // namespace
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -16,7 +16,9 @@
 #include "UTTest_device_manager_impl.h"
 #include "dm_device_info.h"
 
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <unistd.h>
 #include "accesstoken_kit.h"
 #include "device_manager_notify.h"
@@ -1626,6 +1628,66 @@ HWTEST_F(DeviceManagerImplTest, CheckNewAPIAccessPermission_201, testing::ext::T
     ASSERT_EQ(ret, ERR_DM_IPC_SEND_REQUEST_FAILED);
 }
 
+HWTEST_F(DeviceManagerImplTest, CheckNewAPIAccessPermission_202, testing::ext::TestSize.Level0)
+{
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(testing::_, testing::_, testing::_))
+                .Times(1).WillOnce(testing::Return(DM_OK));
+    int32_t ret = DeviceManager::GetInstance().CheckNewAPIAccessPermission();
+    ASSERT_EQ(ret, DM_OK);
+    ret = DeviceManager::GetInstance().CheckNewAPIAccessPermission();
+    ASSERT_EQ(ret, DM_OK);
+    testing::Mock::VerifyAndClearExpectations(ipcClientProxyMock_.get());
+
+    DeviceManagerImpl::GetInstance().OnDmServiceDied();
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(testing::_, testing::_, testing::_))
+                .Times(1).WillOnce(testing::Return(ERR_DM_IPC_SEND_REQUEST_FAILED));
+    ret = DeviceManager::GetInstance().CheckNewAPIAccessPermission();
+    ASSERT_EQ(ret, ERR_DM_IPC_SEND_REQUEST_FAILED);
+}
+
+HWTEST_F(DeviceManagerImplTest, CheckNewAPIAccessPermission_203, testing::ext::TestSize.Level0)
+{
+    const int32_t cacheExpireMs = 600;
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(testing::_, testing::_, testing::_))
+                .Times(1).WillOnce(testing::Return(DM_OK));
+    int32_t ret = DeviceManager::GetInstance().CheckNewAPIAccessPermission();
+    ASSERT_EQ(ret, DM_OK);
+    testing::Mock::VerifyAndClearExpectations(ipcClientProxyMock_.get());
+
+    // Revoked after the grant was cached, the service denies once the grant has expired.
+    std::this_thread::sleep_for(std::chrono::milliseconds(cacheExpireMs));
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(testing::_, testing::_, testing::_))
+                .Times(2).WillRepeatedly(testing::Invoke(
+                    [](int32_t cmdCode, std::shared_ptr<IpcReq> req, std::shared_ptr<IpcRsp> rsp) {
+                        (void)cmdCode;
+                        (void)req;
+                        rsp->SetErrCode(ERR_DM_NO_PERMISSION);
+                        return DM_OK;
+                    }));
+    ret = DeviceManager::GetInstance().CheckNewAPIAccessPermission();
+    ASSERT_EQ(ret, ERR_DM_NO_PERMISSION);
+    ret = DeviceManager::GetInstance().CheckNewAPIAccessPermission();
+    ASSERT_EQ(ret, ERR_DM_NO_PERMISSION);
+}
+
+HWTEST_F(DeviceManagerImplTest, CheckNewAPIAccessPermission_204, testing::ext::TestSize.Level0)
+{
+    // The service dies while the check is in flight, the grant it returned must not be cached.
+    EXPECT_CALL(*ipcClientProxyMock_, SendRequest(testing::_, testing::_, testing::_))
+                .Times(2).WillRepeatedly(testing::Invoke(
+                    [](int32_t cmdCode, std::shared_ptr<IpcReq> req, std::shared_ptr<IpcRsp> rsp) {
+                        (void)cmdCode;
+                        (void)req;
+                        DeviceManagerImpl::GetInstance().OnDmServiceDied();
+                        rsp->SetErrCode(DM_OK);
+                        return DM_OK;
+                    }));
+    int32_t ret = DeviceManager::GetInstance().CheckNewAPIAccessPermission();
+    ASSERT_EQ(ret, DM_OK);
+    ret = DeviceManager::GetInstance().CheckNewAPIAccessPermission();
+    ASSERT_EQ(ret, DM_OK);
+}
+
 HWTEST_F(DeviceManagerImplTest, UnBindDevice_201, testing::ext::TestSize.Level0)
 {
     std::string pkgName = "pkgName_201";
@@ -64,6 +64,15 @@ void DeviceManagerServiceListenerTest::TearDownTestCase()
 }
 
 namespace {
+ProcessInfo MakeNotifyProcess(const std::string &pkgName, int32_t userId, uint32_t tokenId)
+{
+    ProcessInfo processInfo;
+    processInfo.pkgName = pkgName;
+    processInfo.userId = userId;
+    processInfo.tokenId = tokenId;
+    return processInfo;
+}
+
 /**
  * @tc.name: OnDeviceStateChange_001
  * @tc.desc: OnDeviceStateChange, construct a dummy listener, pass in pkgName, use the constructed listener to get
@@ -586,9 +595,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_002, testing
     bool isOnline = true;
 
     // Pre-populate alreadyOnlinePkgName_
-    std::string notifyPkgName = processInfo.pkgName + "#" + std::to_string(processInfo.userId) +
-        "#" + std::to_string(processInfo.tokenId) + "#" + std::string(info.deviceId);
-    listener_->alreadyOnlinePkgName_[notifyPkgName] = info;
+    listener_->alreadyOnlinePkgName_.Insert(processInfo, std::string(info.deviceId));
 
     // Create mock process info list
     std::vector<ProcessInfo> processInfoVec;
@@ -601,7 +608,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_002, testing
     listener_->ProcessDeviceStateChange(processInfo, state, info, deviceBasicInfo, isOnline);
 
     // Assert - Verify device was marked as offline (removed from alreadyOnlinePkgName_)
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -641,7 +648,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_005, testing
     listener_->ProcessDeviceStateChange(processInfo, state, info, deviceBasicInfo, isOnline);
 
     // Assert - For unknown state, nothing should happen
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -677,7 +684,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_006, testing
     listener_->ProcessDeviceStateChange(processInfo, state, info, deviceBasicInfo, isOnline);
 
     // Assert - No process info means no state change processing
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -730,7 +737,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_007, testing
     listener_->ProcessDeviceStateChange(processInfo, state, info, deviceBasicInfo, isOnline);
 
     // Assert - Verify device was marked as online
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -779,7 +786,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_008, testing
     listener_->ProcessDeviceStateChange(processInfo, state, info, deviceBasicInfo, isOnline);
 
     // Assert
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -828,7 +835,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_009, testing
     listener_->ProcessDeviceStateChange(processInfo, state, info, deviceBasicInfo, isOnline);
 
     // Assert
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -858,9 +865,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_010, testing
     bool isOnline = false;
 
     // Pre-populate alreadyOnlinePkgName_
-    std::string notifyPkgName = processInfo.pkgName + "#" + std::to_string(processInfo.userId) +
-        "#" + std::to_string(processInfo.tokenId) + "#" + std::string(info.deviceId);
-    listener_->alreadyOnlinePkgName_[notifyPkgName] = info;
+    listener_->alreadyOnlinePkgName_.Insert(processInfo, std::string(info.deviceId));
 
     // Create mock process info list
     std::vector<ProcessInfo> processInfoVec;
@@ -873,7 +878,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_010, testing
     listener_->ProcessDeviceStateChange(processInfo, state, info, deviceBasicInfo, isOnline);
 
     // Assert
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -921,7 +926,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceStateChange_011, testing
         listener_->ProcessDeviceStateChange(processInfo, state, info, deviceBasicInfo, isOnline);
 
         // Assert - Clear for next iteration
-        listener_->alreadyOnlinePkgName_.clear();
+        listener_->alreadyOnlinePkgName_.Clear();
     }
 
     // Final assertion - all iterations completed
@@ -938,7 +943,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, OnCredentialAuthStatus_001, testing::
     uint16_t deviceTypeId = 1;
     int32_t errcode = 0;
     listener_->OnCredentialAuthStatus(processInfo, deviceList, deviceTypeId, errcode);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 HWTEST_F(DeviceManagerServiceListenerTest, OnProcessRemove_001, testing::ext::TestSize.Level1)
@@ -947,12 +952,10 @@ HWTEST_F(DeviceManagerServiceListenerTest, OnProcessRemove_001, testing::ext::Te
     ProcessInfo processInfo;
     processInfo.userId = 100;
     processInfo.pkgName = "com.ohos.helloworld";
-    DmDeviceInfo dmDeviceInfo;
-    listener_->alreadyOnlinePkgName_["com.ohos.helloworld#100#0#deviceId1"] = dmDeviceInfo;
-    DmDeviceInfo dmDeviceInfo1;
-    listener_->alreadyOnlinePkgName_["com.ohos.network#100#0#deviceId2"] = dmDeviceInfo;
+    listener_->alreadyOnlinePkgName_.Insert(MakeNotifyProcess("com.ohos.helloworld", 100, 0), "deviceId1");
+    listener_->alreadyOnlinePkgName_.Insert(MakeNotifyProcess("com.ohos.network", 100, 0), "deviceId2");
     listener_->OnProcessRemove(processInfo);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), false);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), false);
 }
 
 HWTEST_F(DeviceManagerServiceListenerTest, ConvertUdidHashToAnoyAndSave_001, testing::ext::TestSize.Level1)
@@ -1003,7 +1006,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, OnDeviceTrustChange_001, testing::ext
     systemSA.insert("pkgName");
     EXPECT_CALL(*ipcServerListenerMock_, GetAllProcessInfo()).WillOnce(Return(processInfos));
     listener_->OnDeviceTrustChange(udid, uuid, authForm);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), false);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), false);
 }
 
 HWTEST_F(DeviceManagerServiceListenerTest, RemoveOnlinePkgName_001, testing::ext::TestSize.Level1)
@@ -1011,23 +1014,20 @@ HWTEST_F(DeviceManagerServiceListenerTest, RemoveOnlinePkgName_001, testing::ext
     std::shared_ptr<DeviceManagerServiceListener> listener_ = std::make_shared<DeviceManagerServiceListener>();
     DmDeviceInfo info;
     memcpy_s(info.deviceId, sizeof(info.deviceId), "pkgName", sizeof("pkgName"));
-    listener_->alreadyOnlinePkgName_["onlinePkgName1"] = info;
-    DmDeviceInfo info1;
-    listener_->alreadyOnlinePkgName_["onlinePkgName2"] = info1;
+    listener_->alreadyOnlinePkgName_.Insert(MakeNotifyProcess("onlinePkgName1", 100, 0), std::string(info.deviceId));
+    listener_->alreadyOnlinePkgName_.Insert(MakeNotifyProcess("onlinePkgName2", 100, 0), "otherDeviceId");
     listener_->RemoveOnlinePkgName(info);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), false);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), false);
 }
 
 HWTEST_F(DeviceManagerServiceListenerTest, OnAppUnintall_001, testing::ext::TestSize.Level1)
 {
     std::shared_ptr<DeviceManagerServiceListener> listener_ = std::make_shared<DeviceManagerServiceListener>();
-    DmDeviceInfo info;
-    listener_->alreadyOnlinePkgName_["onlinePkgName1#100#0#devId1"] = info;
-    DmDeviceInfo info1;
-    listener_->alreadyOnlinePkgName_["onlinePkgName2#100#0#devId2"] = info1;
+    listener_->alreadyOnlinePkgName_.Insert(MakeNotifyProcess("onlinePkgName1", 100, 0), "devId1");
+    listener_->alreadyOnlinePkgName_.Insert(MakeNotifyProcess("onlinePkgName2", 100, 0), "devId2");
     std::string pkgName = "onlinePkgName1";
     listener_->OnAppUnintall(pkgName);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), false);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), false);
 }
 
 HWTEST_F(DeviceManagerServiceListenerTest, OnCredentialAuthStatus_002, testing::ext::TestSize.Level1)
@@ -1049,7 +1049,7 @@ HWTEST_F(DeviceManagerServiceListenerTest, OnCredentialAuthStatus_002, testing::
     systemSA.insert("pkgName");
     EXPECT_CALL(*ipcServerListenerMock_, GetAllProcessInfo()).WillOnce(Return(processInfos));
     listener_->OnCredentialAuthStatus(processInfo, deviceList, deviceTypeId, errcode);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), false);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), false);
 }
 
 HWTEST_F(DeviceManagerServiceListenerTest, GetWhiteListSAProcessInfo_001, testing::ext::TestSize.Level1)
@@ -1137,11 +1137,9 @@ HWTEST_F(DeviceManagerServiceListenerTest, ProcessDeviceOffline_001, testing::ex
     DmDeviceState state = DmDeviceState::DEVICE_INFO_CHANGED;
     DmDeviceInfo info;
     DmDeviceBasicInfo deviceBasicInfo;
-    std::string notifyPkgName = pro.pkgName + "#" + std::to_string(pro.userId) + "#" +
-        std::to_string(pro.tokenId) + "#" + std::string(info.deviceId);
-    listener_->alreadyOnlinePkgName_[notifyPkgName] = info;
+    listener_->alreadyOnlinePkgName_.Insert(pro, std::string(info.deviceId));
     listener_->ProcessDeviceOffline(procInfoVec, processInfo, state, info, deviceBasicInfo, true);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 HWTEST_F(DeviceManagerServiceListenerTest, RemoveNotExistProcess_001, testing::ext::TestSize.Level1)
@@ -1160,12 +1158,9 @@ HWTEST_F(DeviceManagerServiceListenerTest, RemoveNotExistProcess_001, testing::e
     DeviceManagerServiceNotify::GetInstance().RegisterCallBack(dmNotifyEvent, processInfo);
     DeviceManagerServiceNotify::GetInstance().RegisterCallBack(dmNotifyEvent, processInfo1);
     DeviceManagerServiceNotify::GetInstance().RegisterCallBack(dmNotifyEvent, pro);
-    std::string notifyPkgName = processInfo.pkgName + "#" + std::to_string(processInfo.userId) +
-        "#" + std::to_string(processInfo.tokenId) + "#";
-    DmDeviceInfo info;
-    listener_->alreadyOnlinePkgName_[notifyPkgName] = info;
+    listener_->alreadyOnlinePkgName_.Insert(processInfo, "");
     listener_->RemoveNotExistProcess();
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 HWTEST_F(DeviceManagerServiceListenerTest, GetLocalDisplayDeviceName_001, testing::ext::TestSize.Level1)
@@ -1212,27 +1207,24 @@ HWTEST_F(DeviceManagerServiceListenerTest, OnDevDbReadyCallbackAdd_002, testing:
     memcpy_s(info.deviceId, sizeof(info.deviceId), "dbReadyDev2", strlen("dbReadyDev2"));
     info.deviceTypeId = 2;
     deviceList.push_back(info);
-    std::string notifyKey = processInfo.pkgName + "#" + std::to_string(processInfo.userId) + "#" +
-        std::to_string(processInfo.tokenId) + "#" + std::string(info.deviceId);
-    listener_->alreadyDbReadyPkgName_[notifyKey] = info;
-    size_t before = listener_->alreadyDbReadyPkgName_.size();
+    listener_->alreadyDbReadyPkgName_.Insert(processInfo, std::string(info.deviceId));
+    size_t before = listener_->alreadyDbReadyPkgName_.Size();
     listener_->OnDevDbReadyCallbackAdd(processInfo, deviceList);
-    EXPECT_EQ(listener_->alreadyDbReadyPkgName_.size(), before);
+    EXPECT_EQ(listener_->alreadyDbReadyPkgName_.Size(), before);
 }
 
 /**
  * @tc.name: ClearDbReadyMap_001
- * @tc.desc: ClearDbReadyMap removes an existing notify key from alreadyDbReadyPkgName_
+ * @tc.desc: ClearDbReadyMap removes an existing notify entry from alreadyDbReadyPkgName_
  * @tc.type: FUNC
  */
 HWTEST_F(DeviceManagerServiceListenerTest, ClearDbReadyMap_001, testing::ext::TestSize.Level1)
 {
     std::shared_ptr<DeviceManagerServiceListener> listener_ = std::make_shared<DeviceManagerServiceListener>();
-    std::string notifyKey = "pkgA#100#0#devA";
-    DmDeviceInfo info;
-    listener_->alreadyDbReadyPkgName_[notifyKey] = info;
-    listener_->ClearDbReadyMap(notifyKey);
-    EXPECT_EQ(listener_->alreadyDbReadyPkgName_.count(notifyKey), 0U);
+    ProcessInfo processInfo = MakeNotifyProcess("pkgA", 100, 0);
+    listener_->alreadyDbReadyPkgName_.Insert(processInfo, "devA");
+    listener_->ClearDbReadyMap(processInfo, "devA");
+    EXPECT_FALSE(listener_->alreadyDbReadyPkgName_.Contains(processInfo, "devA"));
 }
 
 /**
@@ -1267,14 +1259,13 @@ HWTEST_F(DeviceManagerServiceListenerTest, SetExistPkgName_002, testing::ext::Te
 
 /**
  * @tc.name: GetAlreadyOnlineProcess_001
- * @tc.desc: GetAlreadyOnlineProcess parses notify keys and returns the set of online ProcessInfo
+ * @tc.desc: GetAlreadyOnlineProcess returns the set of online ProcessInfo
  * @tc.type: FUNC
  */
 HWTEST_F(DeviceManagerServiceListenerTest, GetAlreadyOnlineProcess_001, testing::ext::TestSize.Level1)
 {
     std::shared_ptr<DeviceManagerServiceListener> listener_ = std::make_shared<DeviceManagerServiceListener>();
-    DmDeviceInfo info;
-    listener_->alreadyOnlinePkgName_["onlineProcPkg#100#5#devX"] = info;
+    listener_->alreadyOnlinePkgName_.Insert(MakeNotifyProcess("onlineProcPkg", 100, 5), "devX");
     auto ret = listener_->GetAlreadyOnlineProcess();
     EXPECT_EQ(ret.empty(), false);
 }
@@ -1287,11 +1278,72 @@ HWTEST_F(DeviceManagerServiceListenerTest, GetAlreadyOnlineProcess_001, testing:
 HWTEST_F(DeviceManagerServiceListenerTest, GetAlreadyOnlineProcess_002, testing::ext::TestSize.Level1)
 {
     std::shared_ptr<DeviceManagerServiceListener> listener_ = std::make_shared<DeviceManagerServiceListener>();
-    listener_->alreadyOnlinePkgName_.clear();
+    listener_->alreadyOnlinePkgName_.Clear();
     auto ret = listener_->GetAlreadyOnlineProcess();
     EXPECT_EQ(ret.empty(), true);
 }
 
+/**
+ * @tc.name: NotifyStateTable_001
+ * @tc.desc: Erasing a device drops it for every subscriber and keeps the other devices
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceManagerServiceListenerTest, NotifyStateTable_001, testing::ext::TestSize.Level1)
+{
+    DmNotifyStateTable table;
+    ProcessInfo processA = MakeNotifyProcess("pkgA", 100, 1);
+    ProcessInfo processB = MakeNotifyProcess("pkgB", 100, 2);
+    EXPECT_TRUE(table.Insert(processA, "dev1"));
+    EXPECT_TRUE(table.Insert(processA, "dev2"));
+    EXPECT_TRUE(table.Insert(processB, "dev1"));
+    EXPECT_FALSE(table.Insert(processA, "dev1"));
+    EXPECT_EQ(table.Size(), 3U);
+    EXPECT_EQ(table.GetDeviceNum(), 2U);
+    EXPECT_FALSE(table.Contains(MakeNotifyProcess("pkgA", 100, 2), "dev1"));
+
+    EXPECT_EQ(table.EraseDevice("dev1"), 2U);
+    EXPECT_FALSE(table.Contains(processA, "dev1"));
+    EXPECT_TRUE(table.Contains(processA, "dev2"));
+    EXPECT_EQ(table.GetProcessNum(), 1U);
+    EXPECT_EQ(table.EraseDevice("dev1"), 0U);
+
+    EXPECT_TRUE(table.Erase(processA, "dev2"));
+    EXPECT_FALSE(table.Erase(processA, "dev2"));
+    EXPECT_TRUE(table.Empty());
+    EXPECT_EQ(table.GetProcessNum(), 0U);
+    EXPECT_EQ(table.GetDeviceNum(), 0U);
+}
+
+/**
+ * @tc.name: NotifyStateTable_002
+ * @tc.desc: Erasing a package or a process only drops the subscribers it owns
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceManagerServiceListenerTest, NotifyStateTable_002, testing::ext::TestSize.Level1)
+{
+    DmNotifyStateTable table;
+    table.Insert(MakeNotifyProcess("pkgA", 100, 1), "dev1");
+    table.Insert(MakeNotifyProcess("pkgA", 101, 1), "dev1");
+    table.Insert(MakeNotifyProcess("pkgA", 100, 1), "dev2");
+    table.Insert(MakeNotifyProcess("pkgAB", 100, 3), "dev1");
+    table.Insert(MakeNotifyProcess("pkgB", 100, 2), "dev3");
+
+    EXPECT_EQ(table.EraseProcess(MakeNotifyProcess("pkgA", 101, 1)), 1U);
+    EXPECT_EQ(table.ErasePkgName("pkgA"), 2U);
+    EXPECT_EQ(table.Size(), 2U);
+    std::vector<ProcessInfo> processInfos = table.GetProcesses();
+    ASSERT_EQ(processInfos.size(), 2U);
+    EXPECT_EQ(table.GetDevices(MakeNotifyProcess("pkgAB", 100, 3)), std::vector<std::string>({ "dev1" }));
+
+    size_t erased = table.EraseProcessIf([](const ProcessInfo &processInfo) {
+        return processInfo.pkgName == "pkgB";
+    });
+    EXPECT_EQ(erased, 1U);
+    EXPECT_FALSE(table.Contains(MakeNotifyProcess("pkgB", 100, 2), "dev3"));
+    table.Clear();
+    EXPECT_TRUE(table.Empty());
+}
+
 } // namespace
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -78,7 +78,7 @@ HWTEST_F(DeviceManagerServiceListenerTwoTest, OnDeviceStateChange_003, testing::
     };
     ASSERT_NE(listener_, nullptr);
     listener_->OnDeviceStateChange(processInfo, state, info, true);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -100,7 +100,7 @@ HWTEST_F(DeviceManagerServiceListenerTwoTest, OnDeviceStateChange_004, testing::
     };
     ASSERT_NE(listener_, nullptr);
     listener_->OnDeviceStateChange(processInfo, state, info, true);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -249,7 +249,7 @@ HWTEST_F(DeviceManagerServiceListenerTwoTest, OnGetDeviceProfileInfoListResult_0
 
     ASSERT_NE(listener_, nullptr);
     listener_->OnGetDeviceProfileInfoListResult(processInfo, deviceProfileInfos, code);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -271,7 +271,7 @@ HWTEST_F(DeviceManagerServiceListenerTwoTest, OnLeaveLNNResult_002, testing::ext
 
     ASSERT_NE(listener_, nullptr);
     listener_->OnLeaveLNNResult(pkgName, networkId, retCode);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -290,7 +290,7 @@ HWTEST_F(DeviceManagerServiceListenerTwoTest, OnSetLocalDeviceNameResult_002, te
 
     ASSERT_NE(listener_, nullptr);
     listener_->OnSetLocalDeviceNameResult(processInfo, deviceName, code);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -310,7 +310,7 @@ HWTEST_F(DeviceManagerServiceListenerTwoTest, OnSetRemoteDeviceNameResult_002, t
 
     ASSERT_NE(listener_, nullptr);
     listener_->OnSetRemoteDeviceNameResult(processInfo, deviceId, deviceName, code);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -336,7 +336,7 @@ HWTEST_F(DeviceManagerServiceListenerTwoTest, OnDeviceStateChange_006, testing::
 
     ASSERT_NE(listener_, nullptr);
     listener_->OnDeviceStateChange(processInfo, state, info, serviceIds);
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.empty(), true);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Empty(), true);
 }
 
 /**
@@ -416,10 +416,14 @@ HWTEST_F(DeviceManagerServiceListenerTwoTest, OnAppUnintall_002, testing::ext::T
 {
     std::shared_ptr<DeviceManagerServiceListener> listener_ = std::make_shared<DeviceManagerServiceListener>();
     ASSERT_NE(listener_, nullptr);
-    listener_->alreadyOnlinePkgName_["com.ohos.other#100#1#dev"] = ProcessInfo();
-    size_t sizeBefore = listener_->alreadyOnlinePkgName_.size();
+    ProcessInfo processInfo;
+    processInfo.pkgName = "com.ohos.other";
+    processInfo.userId = 100;
+    processInfo.tokenId = 1;
+    listener_->alreadyOnlinePkgName_.Insert(processInfo, "dev");
+    size_t sizeBefore = listener_->alreadyOnlinePkgName_.Size();
     listener_->OnAppUnintall("com.ohos.unmatched");
-    EXPECT_EQ(listener_->alreadyOnlinePkgName_.size(), sizeBefore);
+    EXPECT_EQ(listener_->alreadyOnlinePkgName_.Size(), sizeBefore);
 }
 } // namespace
 } // namespace DistributedHardware
@@ -79,6 +79,30 @@ HWTEST_F(DeviceManagerServiceNotifyTest, RegisterCallBack_001, testing::ext::Tes
     DeviceManagerServiceNotify::GetInstance().callbackMap_[notifyEvent].insert(processInfo1);
     DeviceManagerServiceNotify::GetInstance().ClearDiedProcessCallback(processInfo1);
 }
+
+HWTEST_F(DeviceManagerServiceNotifyTest, RegisterCallBack_002, testing::ext::TestSize.Level1)
+{
+    // The local device name change notify needs no permission, the UT process has none.
+    int32_t regEvent = static_cast<int32_t>(DmCommonNotifyEvent::REG_LOCAL_DEVICE_NAME_CHANGE);
+    int32_t unRegEvent = static_cast<int32_t>(DmCommonNotifyEvent::UN_REG_LOCAL_DEVICE_NAME_CHANGE);
+    ProcessInfo processInfo;
+    int32_t ret = DeviceManagerServiceNotify::GetInstance().RegisterCallBack(regEvent, processInfo);
+    ASSERT_EQ(ret, ERR_DM_INPUT_PARA_INVALID);
+
+    processInfo.pkgName = "pkgName";
+    processInfo.userId = 100;
+    ret = DeviceManagerServiceNotify::GetInstance().RegisterCallBack(regEvent, processInfo);
+    ASSERT_EQ(ret, DM_OK);
+    std::set<ProcessInfo> processInfos;
+    DeviceManagerServiceNotify::GetInstance().GetCallBack(regEvent, processInfos);
+    EXPECT_EQ(processInfos.count(processInfo), 1);
+
+    ret = DeviceManagerServiceNotify::GetInstance().RegisterCallBack(unRegEvent, processInfo);
+    ASSERT_EQ(ret, DM_OK);
+    processInfos.clear();
+    DeviceManagerServiceNotify::GetInstance().GetCallBack(regEvent, processInfos);
+    EXPECT_EQ(processInfos.count(processInfo), 0);
+}
 }
 } // namespace DistributedHardware
 } // namespace OHOS
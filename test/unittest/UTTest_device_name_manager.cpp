@@ -309,5 +309,46 @@ HWTEST_F(DeviceNameManagerTest, DependsIsReady_003, testing::ext::TestSize.Level
     DeviceNameManager::GetInstance().isAccountSysReady_ = srcAccountSysReady;
     DeviceNameManager::GetInstance().remoteObj_ = srcRemoteObj;
 }
+
+/**
+ * @tc.name: GetUserDefinedDeviceName_Cache_001
+ * @tc.type: FUNC
+ */
+HWTEST_F(DeviceNameManagerTest, GetUserDefinedDeviceName_Cache_001, testing::ext::TestSize.Level1)
+{
+    ASSERT_TRUE(client_ != nullptr);
+    ASSERT_TRUE(helper_ != nullptr);
+
+    const int32_t userId = 100;
+    std::string userDefinedName = "MyPhone";
+    auto bundleMgr = sptr<BundleMgrMock>(new (std::nothrow) BundleMgrMock());
+    auto systemAbilityManager = sptr<SystemAbilityManagerMock>(new (std::nothrow) SystemAbilityManagerMock());
+    EXPECT_CALL(*systemAbilityManager, GetSystemAbility(_)).WillRepeatedly(Return(bundleMgr));
+    EXPECT_CALL(*client_, GetSystemAbilityManager()).WillRepeatedly(Return(systemAbilityManager));
+    auto resultSet = std::make_shared<DataShareResultSetMock>(nullptr);
+    EXPECT_CALL(*resultSet, GetRowCount(_)).WillRepeatedly(DoAll(SetArgReferee<0>(1), Return(DataShare::E_OK)));
+    EXPECT_CALL(*resultSet, GetString(_, _)).WillRepeatedly(
+        DoAll(SetArgReferee<1>(userDefinedName), Return(DataShare::E_OK)));
+    EXPECT_CALL(*helper_, Release()).WillRepeatedly(Return(true));
+    {
+        std::lock_guard<ffrt::mutex> lock(DeviceNameManager::GetInstance().monitorMapMtx_);
+        DeviceNameManager::GetInstance().monitorMap_[userId] =
+            sptr<DeviceNameChangeMonitor>(new DeviceNameChangeMonitor(userId));
+    }
+
+    // the second read is served from the cache, OnChange drops it.
+    EXPECT_CALL(*helper_, Query(_, _, _, _)).Times(2).WillRepeatedly(Return(resultSet));
+    std::string deviceName;
+    EXPECT_EQ(DeviceNameManager::GetInstance().GetUserDefinedDeviceName(userId, deviceName), DM_OK);
+    EXPECT_EQ(deviceName, userDefinedName);
+    deviceName.clear();
+    EXPECT_EQ(DeviceNameManager::GetInstance().GetUserDefinedDeviceName(userId, deviceName), DM_OK);
+    EXPECT_EQ(deviceName, userDefinedName);
+    DeviceNameManager::GetInstance().ClearSettingsCache(userId);
+    EXPECT_EQ(DeviceNameManager::GetInstance().GetUserDefinedDeviceName(userId, deviceName), DM_OK);
+    EXPECT_EQ(DeviceNameManager::GetInstance().helperPool_.size(), 1u);
+    DeviceNameManager::GetInstance().UnInit();
+    EXPECT_TRUE(DeviceNameManager::GetInstance().helperPool_.empty());
+}
 } // DistributedHardware
 } // OHOS
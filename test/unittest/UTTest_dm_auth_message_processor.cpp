@@ -18,7 +18,9 @@
 #include "dm_constants.h"
 #include "dm_auth_message_processor.h"
 #include "dm_auth_context.h"
+#include "dm_auth_message_schema.h"
 #include "dm_auth_state_machine.h"
+#include "dm_auth_sync_envelope.h"
 #include "deviceprofile_connector.h"
 #include "distributed_device_profile_client_mock.h"
 #include "UTTest_dm_auth_message_processor.h"
@@ -658,5 +660,110 @@ HWTEST_F(DmAuthMessageProcessorTest, PutDeviceControlList_Sentinel_NoAclDays, te
 
     EXPECT_EQ(processor->PutDeviceControlList(context, accesser, accessee, profile, access), DM_OK);
 }
+
+HWTEST_F(DmAuthMessageProcessorTest, SyncEnvelope_PackUnpack_001, testing::ext::TestSize.Level1)
+{
+    JsonObject syncJson;
+    syncJson[TAG_TRANSMIT_SK_ID] = "1";
+    syncJson[TAG_DMVERSION] = "5.1.1";
+    std::string syncMsg = syncJson.Dump();
+    std::string envelope;
+    ASSERT_EQ(DmAuthSyncEnvelope::Pack(syncMsg, envelope), DM_OK);
+    EXPECT_GT(envelope.size(), DmAuthSyncEnvelope::HEADER_LEN);
+    std::string output;
+    EXPECT_EQ(DmAuthSyncEnvelope::Unpack(envelope, output), DM_OK);
+    EXPECT_EQ(output, syncMsg);
+}
+
+HWTEST_F(DmAuthMessageProcessorTest, SyncEnvelope_Unpack_Invalid_001, testing::ext::TestSize.Level1)
+{
+    std::string output;
+    EXPECT_NE(DmAuthSyncEnvelope::Pack("", output), DM_OK);
+    EXPECT_NE(DmAuthSyncEnvelope::Unpack("DS", output), DM_OK);
+
+    std::string envelope;
+    ASSERT_EQ(DmAuthSyncEnvelope::Pack("{\"a\":1}", envelope), DM_OK);
+    std::string badMagic = envelope;
+    badMagic[0] = 'X';
+    EXPECT_NE(DmAuthSyncEnvelope::Unpack(badMagic, output), DM_OK);
+    std::string badVersion = envelope;
+    badVersion[2] = static_cast<char>(DmAuthSyncEnvelope::ENVELOPE_VERSION + 1);
+    EXPECT_NE(DmAuthSyncEnvelope::Unpack(badVersion, output), DM_OK);
+    std::string badLen = envelope;
+    badLen[7] = static_cast<char>(badLen[7] + 1);
+    EXPECT_NE(DmAuthSyncEnvelope::Unpack(badLen, output), DM_OK);
+}
+
+HWTEST_F(DmAuthMessageProcessorTest, ParseSyncField_001, testing::ext::TestSize.Level1)
+{
+    auto context = std::make_shared<DmAuthContext>();
+    auto processor = std::make_shared<DmAuthMessageProcessor>();
+    JsonObject jsonObject;
+    EXPECT_EQ(processor->ParseSyncField(jsonObject, context, context->accesser), ERR_DM_FAILED);
+    jsonObject[TAG_SYNC_V2] = "invalid";
+    EXPECT_NE(processor->ParseSyncField(jsonObject, context, context->accesser), DM_OK);
+}
+
+HWTEST_F(DmAuthMessageProcessorTest, AuthMsgSchema_Decode_001, testing::ext::TestSize.Level1)
+{
+    using Schema = DmAuthMsgSchema<DmAuthCredExchangeMsg>;
+    Schema schema("test message", {
+        Schema::Str(TAG_DEVICE_ID, &DmAuthCredExchangeMsg::deviceId),
+        Schema::Int32(TAG_PEER_USER_SPACE_ID, &DmAuthCredExchangeMsg::userId),
+        Schema::Int64(TAG_TOKEN_ID, &DmAuthCredExchangeMsg::tokenId),
+        Schema::Str(TAG_LNN_PUBLIC_KEY, &DmAuthCredExchangeMsg::lnnPublicKey,
+            &DmAuthCredExchangeMsg::hasLnnPublicKey),
+    });
+    JsonObject jsonObject;
+    jsonObject[TAG_DEVICE_ID] = "deviceId";
+    jsonObject[TAG_PEER_USER_SPACE_ID] = 100;
+    jsonObject[TAG_TOKEN_ID] = static_cast<int64_t>(123456789012);
+    DmAuthCredExchangeMsg msg;
+    EXPECT_EQ(schema.Decode(jsonObject, msg), DM_OK);
+    EXPECT_EQ(msg.deviceId, "deviceId");
+    EXPECT_EQ(msg.userId, 100);
+    EXPECT_EQ(msg.tokenId, 123456789012);
+    EXPECT_FALSE(msg.hasLnnPublicKey);
+
+    jsonObject[TAG_LNN_PUBLIC_KEY] = "lnnPublicKey";
+    EXPECT_EQ(schema.Decode(jsonObject, msg), DM_OK);
+    EXPECT_TRUE(msg.hasLnnPublicKey);
+    EXPECT_EQ(msg.lnnPublicKey, "lnnPublicKey");
+}
+
+HWTEST_F(DmAuthMessageProcessorTest, AuthMsgSchema_Decode_002, testing::ext::TestSize.Level1)
+{
+    using Schema = DmAuthMsgSchema<DmAuthCredExchangeMsg>;
+    Schema schema("test message", {
+        Schema::Str(TAG_DEVICE_ID, &DmAuthCredExchangeMsg::deviceId),
+        Schema::Int32(TAG_PEER_USER_SPACE_ID, &DmAuthCredExchangeMsg::userId),
+    });
+    DmAuthCredExchangeMsg msg;
+    JsonObject discarded("{");
+    EXPECT_EQ(schema.Decode(discarded, msg), ERR_DM_FAILED);
+
+    JsonObject jsonObject;
+    jsonObject[TAG_DEVICE_ID] = "deviceId";
+    EXPECT_EQ(schema.Decode(jsonObject, msg), ERR_DM_FAILED);
+    jsonObject[TAG_PEER_USER_SPACE_ID] = "100";
+    EXPECT_EQ(schema.Decode(jsonObject, msg), ERR_DM_FAILED);
+    jsonObject[TAG_PEER_USER_SPACE_ID] = static_cast<int64_t>(INT32_MAX) + 1;
+    EXPECT_EQ(schema.Decode(jsonObject, msg), ERR_DM_FAILED);
+    jsonObject[TAG_PEER_USER_SPACE_ID] = 100;
+    jsonObject[TAG_DEVICE_ID] = 1;
+    EXPECT_EQ(schema.Decode(jsonObject, msg), ERR_DM_FAILED);
+}
+
+HWTEST_F(DmAuthMessageProcessorTest, DecryptDataField_001, testing::ext::TestSize.Level1)
+{
+    auto processor = std::make_shared<DmAuthMessageProcessor>();
+    JsonObject jsonObject;
+    JsonObject plainJson;
+    EXPECT_EQ(processor->DecryptDataField(jsonObject, plainJson), ERR_DM_FAILED);
+    jsonObject[TAG_DATA] = 1;
+    EXPECT_EQ(processor->DecryptDataField(jsonObject, plainJson), ERR_DM_FAILED);
+    jsonObject[TAG_DATA] = "invalid";
+    EXPECT_EQ(processor->DecryptDataField(jsonObject, plainJson), ERR_DM_FAILED);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "UTTest_dm_init_stage_graph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include "dm_error_type.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+void DmInitStageGraphTest::SetUp()
+{
+}
+
+void DmInitStageGraphTest::TearDown()
+{
+}
+
+void DmInitStageGraphTest::SetUpTestCase()
+{
+}
+
+void DmInitStageGraphTest::TearDownTestCase()
+{
+}
+
+namespace {
+/**
+ * @tc.name: AddStage_001
+ * @tc.desc: empty name, null task and duplicated name are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmInitStageGraphTest, AddStage_001, testing::ext::TestSize.Level1)
+{
+    DmInitStageGraph graph;
+    EXPECT_EQ(graph.AddStage("", {}, []() {}), ERR_DM_INPUT_PARA_INVALID);
+    EXPECT_EQ(graph.AddStage("a", {}, nullptr), ERR_DM_INPUT_PARA_INVALID);
+    EXPECT_EQ(graph.AddStage("a", {}, []() {}), DM_OK);
+    EXPECT_EQ(graph.AddStage("a", {}, []() {}), ERR_DM_INPUT_PARA_INVALID);
+    EXPECT_EQ(graph.GetStageCostMs("b"), -1);
+}
+
+/**
+ * @tc.name: Run_001
+ * @tc.desc: every stage runs once and only after all of its dependencies
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmInitStageGraphTest, Run_001, testing::ext::TestSize.Level1)
+{
+    std::mutex orderMutex;
+    std::vector<std::string> order;
+    auto record = [&orderMutex, &order](const std::string &name) {
+        return [&orderMutex, &order, name]() {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(name);
+        };
+    };
+    DmInitStageGraph graph;
+    EXPECT_EQ(graph.AddStage("a", {}, record("a")), DM_OK);
+    EXPECT_EQ(graph.AddStage("b", {}, record("b")), DM_OK);
+    EXPECT_EQ(graph.AddStage("c", { "a" }, record("c")), DM_OK);
+    EXPECT_EQ(graph.AddStage("d", { "b", "c" }, record("d")), DM_OK);
+    EXPECT_EQ(graph.Run(), DM_OK);
+    ASSERT_EQ(order.size(), 4);
+    auto position = [&order](const std::string &name) {
+        return std::find(order.begin(), order.end(), name) - order.begin();
+    };
+    EXPECT_LT(position("a"), position("c"));
+    EXPECT_LT(position("c"), position("d"));
+    EXPECT_LT(position("b"), position("d"));
+    EXPECT_GE(graph.GetStageCostMs("d"), 0);
+}
+
+/**
+ * @tc.name: Run_002
+ * @tc.desc: unknown dependency and cycle fail before any stage is run
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmInitStageGraphTest, Run_002, testing::ext::TestSize.Level1)
+{
+    std::atomic<int32_t> runCount {0};
+    auto task = [&runCount]() { runCount++; };
+    DmInitStageGraph unknown;
+    EXPECT_EQ(unknown.AddStage("a", { "x" }, task), DM_OK);
+    EXPECT_EQ(unknown.Run(), ERR_DM_INPUT_PARA_INVALID);
+
+    DmInitStageGraph cycle;
+    EXPECT_EQ(cycle.AddStage("a", {}, task), DM_OK);
+    EXPECT_EQ(cycle.AddStage("b", { "a", "c" }, task), DM_OK);
+    EXPECT_EQ(cycle.AddStage("c", { "b" }, task), DM_OK);
+    EXPECT_EQ(cycle.Run(), ERR_DM_INPUT_PARA_INVALID);
+    EXPECT_EQ(runCount.load(), 0);
+}
+} // namespace
+} // namespace DistributedHardware
+} // namespace OHOS
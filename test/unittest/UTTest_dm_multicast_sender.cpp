@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "UTTest_dm_multicast_sender.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "dm_error_type.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+void DmMulticastSenderTest::SetUp()
+{
+}
+
+void DmMulticastSenderTest::TearDown()
+{
+}
+
+void DmMulticastSenderTest::SetUpTestCase()
+{
+}
+
+void DmMulticastSenderTest::TearDownTestCase()
+{
+}
+
+namespace {
+constexpr int64_t SEND_TIMEOUT_MS = 2000;
+constexpr int64_t SHORT_TIMEOUT_MS = 100;
+constexpr int64_t BLOCK_TIME_MS = 500;
+
+/**
+ * @tc.name: Send_001
+ * @tc.desc: empty peer list, null send function and non-positive timeout
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmMulticastSenderTest, Send_001, testing::ext::TestSize.Level1)
+{
+    std::vector<std::string> networkIds;
+    EXPECT_TRUE(DmMulticastSender::Send(networkIds, nullptr, SEND_TIMEOUT_MS).empty());
+
+    networkIds = { "networkId1", "networkId2" };
+    std::vector<DmPeerSendResult> results = DmMulticastSender::Send(networkIds, nullptr, SEND_TIMEOUT_MS);
+    ASSERT_EQ(results.size(), networkIds.size());
+    EXPECT_EQ(results[0].result, ERR_DM_INPUT_PARA_INVALID);
+    results = DmMulticastSender::Send(networkIds, [] (const std::string &) { return DM_OK; }, 0);
+    ASSERT_EQ(results.size(), networkIds.size());
+    EXPECT_EQ(results[1].result, ERR_DM_INPUT_PARA_INVALID);
+}
+
+/**
+ * @tc.name: Send_002
+ * @tc.desc: every peer is sent once, results keep the input order and concurrency stays bounded
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmMulticastSenderTest, Send_002, testing::ext::TestSize.Level1)
+{
+    std::vector<std::string> networkIds;
+    for (int32_t i = 0; i < 10; i++) {
+        networkIds.push_back("networkId" + std::to_string(i));
+    }
+    std::atomic<int32_t> running {0};
+    std::atomic<int32_t> maxRunning {0};
+    std::atomic<int32_t> calls {0};
+    std::vector<DmPeerSendResult> results = DmMulticastSender::Send(networkIds,
+        [&running, &maxRunning, &calls] (const std::string &networkId) {
+            int32_t cur = ++running;
+            int32_t max = maxRunning.load();
+            while (cur > max && !maxRunning.compare_exchange_weak(max, cur)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            calls++;
+            running--;
+            return networkId == "networkId3" ? ERR_DM_FAILED : DM_OK;
+        }, SEND_TIMEOUT_MS, 2);
+    ASSERT_EQ(results.size(), networkIds.size());
+    EXPECT_EQ(calls.load(), 10);
+    EXPECT_LE(maxRunning.load(), 2);
+    for (size_t i = 0; i < results.size(); i++) {
+        EXPECT_EQ(results[i].networkId, networkIds[i]);
+    }
+    EXPECT_EQ(results[3].result, ERR_DM_FAILED);
+    EXPECT_EQ(DmMulticastSender::CountSuccess(results), 9u);
+}
+
+/**
+ * @tc.name: Send_003
+ * @tc.desc: a peer blocked past the shared deadline is reported as timed out
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmMulticastSenderTest, Send_003, testing::ext::TestSize.Level1)
+{
+    std::vector<std::string> networkIds = { "fast", "slow" };
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<DmPeerSendResult> results = DmMulticastSender::Send(networkIds,
+        [] (const std::string &networkId) {
+            if (networkId == "slow") {
+                std::this_thread::sleep_for(std::chrono::milliseconds(BLOCK_TIME_MS));
+            }
+            return DM_OK;
+        }, SHORT_TIMEOUT_MS);
+    auto costMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    EXPECT_LT(costMs, BLOCK_TIME_MS);
+    ASSERT_EQ(results.size(), networkIds.size());
+    EXPECT_EQ(results[0].result, DM_OK);
+    EXPECT_EQ(results[1].result, ERR_DM_TIME_OUT);
+    EXPECT_FALSE(results[0].isInFlight);
+    EXPECT_TRUE(results[1].isInFlight);
+    std::this_thread::sleep_for(std::chrono::milliseconds(BLOCK_TIME_MS));
+}
+
+/**
+ * @tc.name: Send_004
+ * @tc.desc: a send that succeeds after the deadline is handed to the late result callback, a peer
+ *           not started before the deadline is never sent to and gets no late result
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmMulticastSenderTest, Send_004, testing::ext::TestSize.Level1)
+{
+    std::vector<std::string> networkIds = { "slow", "notStarted" };
+    std::atomic<int32_t> calls {0};
+    std::atomic<int32_t> lateCalls {0};
+    std::atomic<size_t> lateIndex {networkIds.size()};
+    std::atomic<int32_t> lateResult {ERR_DM_FAILED};
+    std::vector<DmPeerSendResult> results = DmMulticastSender::Send(networkIds,
+        [&calls] (const std::string &networkId) {
+            calls++;
+            if (networkId == "slow") {
+                std::this_thread::sleep_for(std::chrono::milliseconds(BLOCK_TIME_MS));
+            }
+            return DM_OK;
+        }, SHORT_TIMEOUT_MS, 1,
+        [&lateCalls, &lateIndex, &lateResult] (size_t index, int32_t result) {
+            lateIndex = index;
+            lateResult = result;
+            lateCalls++;
+        });
+    ASSERT_EQ(results.size(), networkIds.size());
+    EXPECT_EQ(results[0].result, ERR_DM_TIME_OUT);
+    EXPECT_TRUE(results[0].isInFlight);
+    EXPECT_EQ(results[1].result, ERR_DM_TIME_OUT);
+    EXPECT_FALSE(results[1].isInFlight);
+    EXPECT_EQ(lateCalls.load(), 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(BLOCK_TIME_MS * 2));
+    EXPECT_EQ(calls.load(), 1);
+    EXPECT_EQ(lateCalls.load(), 1);
+    EXPECT_EQ(lateIndex.load(), 0u);
+    EXPECT_EQ(lateResult.load(), DM_OK);
+}
+} // namespace
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "UTTest_dm_perf_stats.h"
+
+#include "dm_error_type.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+void DmPerfStatsTest::SetUp()
+{
+    DmPerfStats::GetInstance().Reset();
+    DmPerfStats::GetInstance().SetEnabled(true);
+}
+
+void DmPerfStatsTest::TearDown()
+{
+    DmPerfStats::GetInstance().SetEnabled(false);
+    DmPerfStats::GetInstance().Reset();
+}
+
+void DmPerfStatsTest::SetUpTestCase()
+{
+}
+
+void DmPerfStatsTest::TearDownTestCase()
+{
+}
+
+namespace {
+/**
+ * @tc.name: BucketIndex_001
+ * @tc.desc: bucket lower bound never exceeds the recorded value and keeps 1/8 relative error
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmPerfStatsTest, BucketIndex_001, testing::ext::TestSize.Level1)
+{
+    const uint64_t maxValue = 1 << 20;
+    for (uint64_t value = 0; value < maxValue; value++) {
+        uint64_t lower = DmLatencyHistogram::BucketLowerBound(DmLatencyHistogram::BucketIndex(value));
+        ASSERT_LE(lower, value);
+        ASSERT_LE(value - lower, value / DmLatencyHistogram::HISTOGRAM_SUB_BUCKETS);
+    }
+    EXPECT_EQ(DmLatencyHistogram::BucketIndex(UINT64_MAX), DmLatencyHistogram::HISTOGRAM_BUCKETS - 1);
+}
+
+/**
+ * @tc.name: RecordLatency_001
+ * @tc.desc: percentiles follow the recorded distribution
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmPerfStatsTest, RecordLatency_001, testing::ext::TestSize.Level1)
+{
+    DmLatencyHistogram histogram;
+    const uint64_t count = 1000;
+    for (uint64_t i = 1; i <= count; i++) {
+        histogram.Record(i);
+    }
+    EXPECT_EQ(histogram.GetCount(), count);
+    EXPECT_EQ(histogram.GetMax(), count);
+    EXPECT_EQ(histogram.GetMean(), 500);
+    uint64_t p50 = histogram.GetPercentile(50.0);
+    EXPECT_GE(p50, 448);
+    EXPECT_LE(p50, 500);
+    EXPECT_LE(histogram.GetPercentile(100.0), count);
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetCount(), 0);
+    EXPECT_EQ(histogram.GetPercentile(50.0), 0);
+}
+
+/**
+ * @tc.name: RecordLatency_002
+ * @tc.desc: nothing is recorded while stats are disabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmPerfStatsTest, RecordLatency_002, testing::ext::TestSize.Level1)
+{
+    DmPerfStats::GetInstance().SetEnabled(false);
+    {
+        DM_PERF_SCOPE(DmPerfOp::TRANSPORT_SEND);
+    }
+    DM_PERF_COUNT(DmPerfCounter::DEVICE_FOUND);
+    DmPerfStats::GetInstance().SetEnabled(true);
+    std::string result = DmPerfStats::GetInstance().Dump();
+    EXPECT_NE(result.find("TransportSend count=0"), std::string::npos);
+    EXPECT_NE(result.find("DeviceFound=0"), std::string::npos);
+
+    {
+        DM_PERF_SCOPE(DmPerfOp::TRANSPORT_SEND);
+    }
+    DM_PERF_COUNT(DmPerfCounter::DEVICE_FOUND);
+    DM_PERF_GAUGE(DmPerfGauge::AUTH_STATE_QUEUE, 3);
+    DM_PERF_GAUGE(DmPerfGauge::AUTH_STATE_QUEUE, 1);
+    result = DmPerfStats::GetInstance().Dump();
+    EXPECT_NE(result.find("TransportSend count=1"), std::string::npos);
+    EXPECT_NE(result.find("DeviceFound=1"), std::string::npos);
+    EXPECT_NE(result.find("AuthStateQueue last=1 peak=3"), std::string::npos);
+}
+
+/**
+ * @tc.name: ExportToFile_001
+ * @tc.desc: export rejects an empty path
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmPerfStatsTest, ExportToFile_001, testing::ext::TestSize.Level1)
+{
+    EXPECT_EQ(DmPerfStats::GetInstance().ExportToFile(""), ERR_DM_INPUT_PARA_INVALID);
+    EXPECT_EQ(DmPerfStats::GetInstance().ExportToFile("/data/test/dm_perf_stats.txt"), DM_OK);
+}
+} // namespace
+} // namespace DistributedHardware
+} // namespace OHOS
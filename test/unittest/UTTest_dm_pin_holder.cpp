@@ -127,10 +127,18 @@ constexpr int32_t REPLY_FAILED = -1;
 constexpr const char* TAG_PIN_TYPE = "PIN_TYPE";
 constexpr const char* TAG_PAYLOAD = "PAYLOAD";
 constexpr const char* TAG_REPLY = "REPLY";
+constexpr const char* TAG_DM_VERSION = "DM_VERSION";
 constexpr int32_t SESSION_ID_INVALID = -1;
 const std::string PACKAGE_NAME = "com.ohos.dmtest";
 const std::string PAY_LOAD = "mock_payLoad";
 namespace {
+PinHolderMsg ParseMsg(const std::string &message)
+{
+    PinHolderMsg msg;
+    (void)PinHolder::ParsePinHolderMsg(message, msg);
+    return msg;
+}
+
 /**
  * @tc.name: InitDeviceManager_001
  * @tc.desc: 1. set packName not null
@@ -436,22 +444,40 @@ HWTEST_F(DmPinHolderTest, CreateGeneratePinHolderMsg_102, testing::ext::TestSize
     ASSERT_EQ(ret, ERR_DM_FAILED);
 }
 
-HWTEST_F(DmPinHolderTest, ParseMsgType_101, testing::ext::TestSize.Level1)
+HWTEST_F(DmPinHolderTest, ParsePinHolderMsg_101, testing::ext::TestSize.Level1)
 {
-    std::shared_ptr<IDeviceManagerServiceListener> listener = std::make_shared<IDeviceManagerServiceListenerTest>();
-    std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     std::string message;
-    int32_t ret = pinHolder->ParseMsgType(message);
+    PinHolderMsg msg;
+    int32_t ret = PinHolder::ParsePinHolderMsg(message, msg);
     ASSERT_EQ(ret, ERR_DM_FAILED);
 }
 
+HWTEST_F(DmPinHolderTest, ParsePinHolderMsg_102, testing::ext::TestSize.Level1)
+{
+    JsonObject jsonObject;
+    jsonObject[TAG_MSG_TYPE] = MSG_TYPE_CREATE_PIN_HOLDER;
+    jsonObject[TAG_PIN_TYPE] = DmPinType::QR_CODE;
+    jsonObject[TAG_PAYLOAD] = PAY_LOAD;
+    jsonObject[TAG_DM_VERSION] = "";
+    PinHolderMsg msg;
+    int32_t ret = PinHolder::ParsePinHolderMsg(jsonObject.Dump(), msg);
+    ASSERT_EQ(ret, DM_OK);
+    EXPECT_EQ(msg.msgType, MSG_TYPE_CREATE_PIN_HOLDER);
+    EXPECT_TRUE(msg.hasPinType);
+    EXPECT_EQ(msg.pinType, DmPinType::QR_CODE);
+    EXPECT_TRUE(msg.hasPayload);
+    EXPECT_EQ(msg.payload, PAY_LOAD);
+    EXPECT_FALSE(msg.hasReply);
+    EXPECT_TRUE(msg.hasVersion);
+}
+
 HWTEST_F(DmPinHolderTest, ProcessCreateMsg_101, testing::ext::TestSize.Level1)
 {
     std::shared_ptr<IDeviceManagerServiceListener> listener = std::make_shared<IDeviceManagerServiceListenerTest>();
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     std::string message;
     pinHolder->listener_ = nullptr;
-    pinHolder->ProcessCreateMsg(message);
+    pinHolder->ProcessCreateMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -461,7 +487,7 @@ HWTEST_F(DmPinHolderTest, ProcessCreateMsg_102, testing::ext::TestSize.Level1)
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     std::string message;
     pinHolder->session_ = nullptr;
-    pinHolder->ProcessCreateMsg(message);
+    pinHolder->ProcessCreateMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -471,7 +497,7 @@ HWTEST_F(DmPinHolderTest, ProcessCreateMsg_103, testing::ext::TestSize.Level1)
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     JsonObject jsonObject;
     std::string message = jsonObject.Dump();
-    pinHolder->ProcessCreateMsg(message);
+    pinHolder->ProcessCreateMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -482,7 +508,7 @@ HWTEST_F(DmPinHolderTest, ProcessCreateMsg_104, testing::ext::TestSize.Level1)
     JsonObject jsonObject;
     jsonObject[TAG_PIN_TYPE] = "TAG_PIN_TYPE";
     std::string message = jsonObject.Dump();
-    pinHolder->ProcessCreateMsg(message);
+    pinHolder->ProcessCreateMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -494,7 +520,7 @@ HWTEST_F(DmPinHolderTest, ProcessCreateMsg_105, testing::ext::TestSize.Level1)
     jsonObject[TAG_PIN_TYPE] = DmPinType::SUPER_SONIC;
     jsonObject[TAG_PAYLOAD] = DmPinType::SUPER_SONIC;
     std::string message = jsonObject.Dump();
-    pinHolder->ProcessCreateMsg(message);
+    pinHolder->ProcessCreateMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -504,7 +530,7 @@ HWTEST_F(DmPinHolderTest, ProcessCreateRespMsg_101, testing::ext::TestSize.Level
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     JsonObject jsonObject;
     std::string message = jsonObject.Dump();
-    pinHolder->ProcessCreateRespMsg(message);
+    pinHolder->ProcessCreateRespMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -516,7 +542,7 @@ HWTEST_F(DmPinHolderTest, ProcessCreateRespMsg_102, testing::ext::TestSize.Level
     jsonObject[TAG_REPLY] = DmPinType::NUMBER_PIN_CODE;
     std::string message = jsonObject.Dump();
     pinHolder->listener_ = nullptr;
-    pinHolder->ProcessCreateRespMsg(message);
+    pinHolder->ProcessCreateRespMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -528,7 +554,7 @@ HWTEST_F(DmPinHolderTest, ProcessCreateRespMsg_103, testing::ext::TestSize.Level
     jsonObject[TAG_REPLY] = DmPinType::SUPER_SONIC;
     std::string message = jsonObject.Dump();
     pinHolder->session_ = nullptr;
-    pinHolder->ProcessCreateRespMsg(message);
+    pinHolder->ProcessCreateRespMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -540,7 +566,7 @@ HWTEST_F(DmPinHolderTest, ProcessCreateRespMsg_104, testing::ext::TestSize.Level
     jsonObject[TAG_REPLY] = DmPinType::NUMBER_PIN_CODE;
     std::string message = jsonObject.Dump();
     pinHolder->session_ = nullptr;
-    pinHolder->ProcessCreateRespMsg(message);
+    pinHolder->ProcessCreateRespMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -550,7 +576,7 @@ HWTEST_F(DmPinHolderTest, ProcessDestroyMsg_101, testing::ext::TestSize.Level1)
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     std::string message;
     pinHolder->listener_ = nullptr;
-    pinHolder->ProcessDestroyMsg(message);
+    pinHolder->ProcessDestroyMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -560,7 +586,7 @@ HWTEST_F(DmPinHolderTest, ProcessDestroyMsg_102, testing::ext::TestSize.Level1)
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     std::string message;
     pinHolder->session_ = nullptr;
-    pinHolder->ProcessDestroyMsg(message);
+    pinHolder->ProcessDestroyMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -570,7 +596,7 @@ HWTEST_F(DmPinHolderTest, ProcessDestroyMsg_103, testing::ext::TestSize.Level1)
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     JsonObject jsonObject;
     std::string message = jsonObject.Dump();
-    pinHolder->ProcessDestroyMsg(message);
+    pinHolder->ProcessDestroyMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -581,7 +607,7 @@ HWTEST_F(DmPinHolderTest, ProcessDestroyMsg_104, testing::ext::TestSize.Level1)
     JsonObject jsonObject;
     jsonObject[TAG_PIN_TYPE] = "TAG_PIN_TYPE";
     std::string message = jsonObject.Dump();
-    pinHolder->ProcessDestroyMsg(message);
+    pinHolder->ProcessDestroyMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -593,7 +619,7 @@ HWTEST_F(DmPinHolderTest, ProcessDestroyMsg_105, testing::ext::TestSize.Level1)
     jsonObject[TAG_PIN_TYPE] = DmPinType::SUPER_SONIC;
     jsonObject[TAG_PAYLOAD] = DmPinType::SUPER_SONIC;
     std::string message = jsonObject.Dump();
-    pinHolder->ProcessDestroyMsg(message);
+    pinHolder->ProcessDestroyMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -811,7 +837,7 @@ HWTEST_F(DmPinHolderTest, SendData_103, testing::ext::TestSize.Level1)
     std::shared_ptr<IDeviceManagerServiceListener> listener = std::make_shared<IDeviceManagerServiceListenerTest>();
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     pinHolder->session_ = nullptr;
-    pinHolder->ProcessChangeMsg(message);
+    pinHolder->ProcessChangeMsg(ParseMsg(message));
 
     message = R"(
     {
@@ -819,14 +845,14 @@ HWTEST_F(DmPinHolderTest, SendData_103, testing::ext::TestSize.Level1)
     }}
     )";
     pinHolder->session_ = std::make_shared<PinHolderSession>();
-    pinHolder->ProcessChangeMsg(message);
+    pinHolder->ProcessChangeMsg(ParseMsg(message));
 
     message = R"(
     {
         "MSG_TYPE" : 100
     }
     )";
-    pinHolder->ProcessChangeMsg(message);
+    pinHolder->ProcessChangeMsg(ParseMsg(message));
 
     message = R"(
     {
@@ -834,10 +860,10 @@ HWTEST_F(DmPinHolderTest, SendData_103, testing::ext::TestSize.Level1)
     }
     )";
     pinHolder->sinkState_ = PinHolderState::SINK_INIT;
-    pinHolder->ProcessChangeMsg(message);
+    pinHolder->ProcessChangeMsg(ParseMsg(message));
 
     pinHolder->sinkState_ = PinHolderState::SINK_CREATE;
-    pinHolder->ProcessChangeMsg(message);
+    pinHolder->ProcessChangeMsg(ParseMsg(message));
 }
 
 HWTEST_F(DmPinHolderTest, GetAddrByTargetId_101, testing::ext::TestSize.Level1)
@@ -861,14 +887,14 @@ HWTEST_F(DmPinHolderTest, GetAddrByTargetId_101, testing::ext::TestSize.Level1)
         "MSG_TYPE" : 100
     }}
     )";
-    pinHolder->ProcessChangeRespMsg(message);
+    pinHolder->ProcessChangeRespMsg(ParseMsg(message));
 
     message = R"(
     {
         "MSG_TYPE" : 100
     }
     )";
-    pinHolder->ProcessChangeRespMsg(message);
+    pinHolder->ProcessChangeRespMsg(ParseMsg(message));
 
     message = R"(
     {
@@ -876,17 +902,17 @@ HWTEST_F(DmPinHolderTest, GetAddrByTargetId_101, testing::ext::TestSize.Level1)
     }
     )";
     pinHolder->session_ = nullptr;
-    pinHolder->ProcessChangeRespMsg(message);
+    pinHolder->ProcessChangeRespMsg(ParseMsg(message));
 
     pinHolder->session_ = std::make_shared<PinHolderSession>();
-    pinHolder->ProcessChangeRespMsg(message);
+    pinHolder->ProcessChangeRespMsg(ParseMsg(message));
 
     message = R"(
     {
         "REPLY" : 0
     }
     )";
-    pinHolder->ProcessChangeRespMsg(message);
+    pinHolder->ProcessChangeRespMsg(ParseMsg(message));
 }
 
 HWTEST_F(DmPinHolderTest, NotifyPinHolderEvent_102, testing::ext::TestSize.Level1)
@@ -1230,7 +1256,7 @@ HWTEST_F(DmPinHolderTest, DestroyPinHolder_109, testing::ext::TestSize.Level1)
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     std::string message;
     pinHolder->listener_ = nullptr;
-    pinHolder->ProcessCloseSessionMsg(message);
+    pinHolder->ProcessCloseSessionMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -1240,7 +1266,7 @@ HWTEST_F(DmPinHolderTest, ProcessCloseSessionMsg_102, testing::ext::TestSize.Lev
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     std::string message;
     pinHolder->session_ = nullptr;
-    pinHolder->ProcessCloseSessionMsg(message);
+    pinHolder->ProcessCloseSessionMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
  HWTEST_F(DmPinHolderTest, ProcessDestroyMsg_106, testing::ext::TestSize.Level1)
@@ -1252,7 +1278,7 @@ HWTEST_F(DmPinHolderTest, ProcessCloseSessionMsg_102, testing::ext::TestSize.Lev
     jsonObject[TAG_PAYLOAD] = DmPinType::SUPER_SONIC;
     std::string message = jsonObject.Dump();
     pinHolder->sinkState_ = SINK_CREATE;
-    pinHolder->ProcessDestroyMsg(message);
+    pinHolder->ProcessDestroyMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
  HWTEST_F(DmPinHolderTest, CloseSession_102, testing::ext::TestSize.Level1)
@@ -1280,7 +1306,7 @@ HWTEST_F(DmPinHolderTest, ProcessDestroyResMsg_101, testing::ext::TestSize.Level
     std::shared_ptr<IDeviceManagerServiceListener> listener = std::make_shared<IDeviceManagerServiceListenerTest>();
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     std::string message;
-    pinHolder->ProcessDestroyResMsg(message);
+    pinHolder->ProcessDestroyResMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -1291,7 +1317,7 @@ HWTEST_F(DmPinHolderTest, ProcessDestroyResMsg_102, testing::ext::TestSize.Level
     std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
     std::string message = jsonObject.Dump();
     jsonObject[TAG_REPLY] = DmPinType::NUMBER_PIN_CODE;
-    pinHolder->ProcessDestroyResMsg(message);
+    pinHolder->ProcessDestroyResMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -1303,7 +1329,7 @@ HWTEST_F(DmPinHolderTest, ProcessDestroyResMsg_103, testing::ext::TestSize.Level
     std::string message = jsonObject.Dump();
     jsonObject[TAG_REPLY] = DmPinType::NUMBER_PIN_CODE;
     pinHolder->session_ = nullptr;
-    pinHolder->ProcessDestroyResMsg(message);
+    pinHolder->ProcessDestroyResMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
 
@@ -1315,7 +1341,7 @@ HWTEST_F(DmPinHolderTest, ProcessDestroyResMsg_104, testing::ext::TestSize.Level
     std::string message = jsonObject.Dump();
     jsonObject[TAG_REPLY] = DmPinType::NUMBER_PIN_CODE;
     pinHolder->listener_ = nullptr;
-    pinHolder->ProcessDestroyResMsg(message);
+    pinHolder->ProcessDestroyResMsg(ParseMsg(message));
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
  HWTEST_F(DmPinHolderTest, UnRegisterPinHolderCallback_101, testing::ext::TestSize.Level1)
@@ -1367,6 +1393,83 @@ HWTEST_F(DmPinHolderTest, OnSessionClosed_103, testing::ext::TestSize.Level1)
     pinHolder->OnSessionClosed(sessionId);
     ASSERT_NE(pinHolder->timer_, nullptr);
 }
+
+HWTEST_F(DmPinHolderTest, KeepSessionIdle_101, testing::ext::TestSize.Level1)
+{
+    PeerTargetId targetId = {
+        .deviceId = "deviceId",
+        .brMac = "brMac",
+        .bleMac = "bleMac",
+        .wifiIp = "wifiIp",
+    };
+    std::shared_ptr<IDeviceManagerServiceListener> listener = std::make_shared<IDeviceManagerServiceListenerTest>();
+    std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
+    pinHolder->processInfo_.pkgName = PACKAGE_NAME;
+    pinHolder->sessionId_ = 1;
+    pinHolder->sessionPeerKey_ = PinHolder::GetPeerKey(targetId);
+    pinHolder->sourceState_ = SOURCE_CREATE;
+    PinHolderMsg msg;
+    msg.msgType = MSG_TYPE_DESTROY_PIN_HOLDER_RESP;
+    msg.hasReply = true;
+    msg.reply = REPLY_SUCCESS;
+    pinHolder->ProcessDestroyResMsg(msg);
+    EXPECT_TRUE(pinHolder->isSessionIdle_);
+    EXPECT_EQ(pinHolder->sessionId_, 1);
+    EXPECT_EQ(pinHolder->sourceState_, SOURCE_INIT);
+
+    int32_t ret = pinHolder->DestroyPinHolder(PACKAGE_NAME, targetId, DmPinType::QR_CODE, PAY_LOAD);
+    EXPECT_EQ(ret, DM_OK);
+    ret = pinHolder->NotifyPinHolderEvent(PACKAGE_NAME, "event");
+    EXPECT_EQ(ret, ERR_DM_FAILED);
+
+    ret = pinHolder->CreatePinHolder(PACKAGE_NAME, targetId, DmPinType::QR_CODE, PAY_LOAD);
+    EXPECT_EQ(ret, DM_OK);
+    EXPECT_FALSE(pinHolder->isSessionIdle_);
+    EXPECT_EQ(pinHolder->sessionId_, 1);
+    EXPECT_EQ(pinHolder->pinType_, DmPinType::QR_CODE);
+    EXPECT_EQ(pinHolder->payload_, PAY_LOAD);
+}
+
+HWTEST_F(DmPinHolderTest, KeepSessionIdle_102, testing::ext::TestSize.Level1)
+{
+    std::shared_ptr<IDeviceManagerServiceListener> listener = std::make_shared<IDeviceManagerServiceListenerTest>();
+    std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
+    pinHolder->sessionId_ = 1;
+    pinHolder->sessionPeerKey_ = "peerKey";
+    pinHolder->KeepSessionIdle(1);
+    pinHolder->OnSessionClosed(1);
+    EXPECT_FALSE(pinHolder->isSessionIdle_);
+    EXPECT_FALSE(pinHolder->isDestroy_.load());
+    EXPECT_EQ(pinHolder->sessionId_, SESSION_ID_INVALID);
+    EXPECT_EQ(pinHolder->sessionPeerKey_, "");
+}
+
+HWTEST_F(DmPinHolderTest, CloseIdleSession_101, testing::ext::TestSize.Level1)
+{
+    std::shared_ptr<IDeviceManagerServiceListener> listener = std::make_shared<IDeviceManagerServiceListenerTest>();
+    std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
+    pinHolder->sessionId_ = 1;
+    pinHolder->CloseIdleSession();
+    EXPECT_EQ(pinHolder->sessionId_, 1);
+
+    pinHolder->sessionPeerKey_ = "peerKey";
+    pinHolder->KeepSessionIdle(1);
+    pinHolder->CloseIdleSession();
+    EXPECT_FALSE(pinHolder->isSessionIdle_);
+    EXPECT_EQ(pinHolder->sessionId_, SESSION_ID_INVALID);
+    EXPECT_EQ(pinHolder->sessionPeerKey_, "");
+}
+
+HWTEST_F(DmPinHolderTest, CloseIdleSession_102, testing::ext::TestSize.Level1)
+{
+    std::shared_ptr<IDeviceManagerServiceListener> listener = std::make_shared<IDeviceManagerServiceListenerTest>();
+    std::shared_ptr<PinHolder> pinHolder = std::make_shared<PinHolder>(listener);
+    pinHolder->sessionId_ = 1;
+    pinHolder->KeepSessionIdle(1);
+    pinHolder->OnSessionOpened(2, SESSION_ID, RESULT);
+    EXPECT_FALSE(pinHolder->isSessionIdle_);
+    EXPECT_EQ(pinHolder->sessionId_, 2);
+}
 } // namespace
 } // namespace DistributedHardware
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -308,5 +308,45 @@ HWTEST_F(FreezeProcessTest, ConvertJsonToDeviceFreezeState_WhenBothZero, testing
     EXPECT_EQ(freezeStateObj.startFreezeTimeStamp, 0);
     EXPECT_EQ(freezeStateObj.stopFreezeTimeStamp, 0);
 }
+
+HWTEST_F(FreezeProcessTest, FreezeTimeRing_001, testing::ext::TestSize.Level0)
+{
+    FreezeTimeRing ring;
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.back(), 0);
+    const int64_t total = static_cast<int64_t>(FreezeTimeRing::CAPACITY) + 4;
+    for (int64_t i = 1; i <= total; i++) {
+        ring.push_back(i);
+    }
+    EXPECT_EQ(ring.size(), FreezeTimeRing::CAPACITY);
+    EXPECT_EQ(ring[0], 5);
+    EXPECT_EQ(ring.back(), total);
+    EXPECT_EQ(ring.EraseBefore(10), 5);
+    EXPECT_EQ(ring[0], 10);
+    EXPECT_EQ(ring.ToVector().size(), ring.size());
+
+    ring = std::vector<int64_t>({ 30, 10, 20 });
+    EXPECT_EQ(ring.size(), 3);
+    EXPECT_EQ(ring[0], 10);
+    EXPECT_EQ(ring.back(), 30);
+}
+
+HWTEST_F(FreezeProcessTest, UpdateFreezeRecord_003, testing::ext::TestSize.Level0)
+{
+    FreezeProcess freezeProcess;
+    EXPECT_EQ(freezeProcess.UpdateFreezeRecord(), DM_OK);
+    EXPECT_EQ(freezeProcess.UpdateFreezeRecord(), DM_OK);
+    EXPECT_TRUE(freezeProcess.freezeStateCache_.IsEmpty());
+    // the third failure in a row freezes, the cache is updated before kv is written.
+    EXPECT_EQ(freezeProcess.UpdateFreezeRecord(), DM_OK);
+    EXPECT_EQ(freezeProcess.bindFailedEventsCache_.failedTimeStamps.size(), 3);
+    EXPECT_EQ(freezeProcess.bindFailedEventsCache_.freezeTimeStamps.size(), 1);
+    EXPECT_EQ(freezeProcess.freezeStateCache_.stopFreezeTimeStamp -
+        freezeProcess.freezeStateCache_.startFreezeTimeStamp, 60);
+
+    EXPECT_EQ(freezeProcess.DeleteFreezeRecord(), DM_OK);
+    EXPECT_TRUE(freezeProcess.freezeStateCache_.IsEmpty());
+    EXPECT_TRUE(freezeProcess.bindFailedEventsCache_.IsEmpty());
+}
 } // namespace DistributedHardware
 } // namespace OHOS
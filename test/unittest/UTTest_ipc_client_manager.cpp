@@ -26,6 +26,10 @@
 #include "dm_constants.h"
 #include "system_ability_definition.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <unistd.h>
 
 namespace OHOS {
@@ -626,6 +630,70 @@ HWTEST_F(IpcClientManagerTest, SendRequest_009, testing::ext::TestSize.Level0)
     ASSERT_EQ(ret, ERR_DM_INPUT_PARA_INVALID);
 }
 
+/**
+ * @tc.name: SendRequest_010
+ * @tc.desc: 1. Mock SendCmd to wait until two commands are in flight at the same time
+ *           2. call SendRequest from two threads
+ *           3. check both calls return DM_OK, so neither was serialized behind the other
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(IpcClientManagerTest, SendRequest_010, testing::ext::TestSize.Level0)
+{
+    sptr<IRemoteObject> remoteObject = nullptr;
+    auto mockInstance = new MockIpcClientManager(remoteObject);
+    std::mutex inFlightMtx;
+    std::condition_variable inFlightCv;
+    int32_t inFlight = 0;
+    auto sendCmd = [&](int32_t, std::shared_ptr<IpcReq>, std::shared_ptr<IpcRsp>) {
+        std::unique_lock<std::mutex> lock(inFlightMtx);
+        inFlight++;
+        inFlightCv.notify_all();
+        bool together = inFlightCv.wait_for(lock, std::chrono::seconds(1), [&] { return inFlight >= 2; });
+        return together ? DM_OK : ERR_DM_FAILED;
+    };
+    EXPECT_CALL(*mockInstance, SendCmd(testing::_, testing::_, testing::_))
+                .Times(2).WillRepeatedly(testing::Invoke(sendCmd));
+    std::shared_ptr<IpcClientManager> instance = std::make_shared<IpcClientManager>();
+    instance->dmInterface_ = mockInstance;
+    int32_t ret1 = ERR_DM_FAILED;
+    int32_t ret2 = ERR_DM_FAILED;
+    std::thread first([&] {
+        ret1 = instance->SendRequest(0, std::make_shared<IpcReq>(), std::make_shared<IpcRsp>());
+    });
+    std::thread second([&] {
+        ret2 = instance->SendRequest(0, std::make_shared<IpcReq>(), std::make_shared<IpcRsp>());
+    });
+    first.join();
+    second.join();
+    ASSERT_EQ(ret1, DM_OK);
+    ASSERT_EQ(ret2, DM_OK);
+}
+
+/**
+ * @tc.name: SendRequest_011
+ * @tc.desc: 1. Mock SendCmd to report the service died while the command is in flight
+ *           2. call SendRequest
+ *           3. check the in flight command completes and later requests fail with ERR_DM_INIT_FAILED
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(IpcClientManagerTest, SendRequest_011, testing::ext::TestSize.Level0)
+{
+    sptr<IRemoteObject> remoteObject = nullptr;
+    auto mockInstance = new MockIpcClientManager(remoteObject);
+    std::shared_ptr<IpcClientManager> instance = std::make_shared<IpcClientManager>();
+    instance->dmInterface_ = mockInstance;
+    EXPECT_CALL(*mockInstance, SendCmd(testing::_, testing::_, testing::_))
+                .Times(1).WillOnce(testing::Invoke([&](int32_t, std::shared_ptr<IpcReq>, std::shared_ptr<IpcRsp>) {
+                    return instance->OnDmServiceDied();
+                }));
+    int32_t ret = instance->SendRequest(0, std::make_shared<IpcReq>(), std::make_shared<IpcRsp>());
+    ASSERT_EQ(ret, DM_OK);
+    ret = instance->SendRequest(0, std::make_shared<IpcReq>(), std::make_shared<IpcRsp>());
+    ASSERT_EQ(ret, ERR_DM_INIT_FAILED);
+}
+
 /**
  * @tc.name: OnDmServiceDied_001
  * @tc.desc: 1. set IpcClientManager dmInterface_null
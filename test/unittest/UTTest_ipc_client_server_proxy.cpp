@@ -26,7 +26,10 @@
 #include "dm_log.h"
 #include "ipc_cmd_register.h"
 #include "ipc_def.h"
+#include "ipc_get_trustdevice_req.h"
+#include "ipc_get_trustdevice_rsp.h"
 #include "ipc_types.h"
+#include "iremote_stub.h"
 #include "ipc_set_useroperation_req.h"
 
 namespace OHOS {
@@ -48,6 +51,26 @@ void IpcClientServerProxyTest::TearDownTestCase()
 }
 
 namespace {
+class BusyServerStub : public IRemoteStub<IpcRemoteBroker> {
+public:
+    int32_t OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        (void)code;
+        (void)data;
+        (void)reply;
+        (void)option;
+        return ERR_DM_IPC_CMD_BUSY;
+    }
+
+    int32_t SendCmd(int32_t cmdCode, std::shared_ptr<IpcReq> req, std::shared_ptr<IpcRsp> rsp) override
+    {
+        (void)cmdCode;
+        (void)req;
+        (void)rsp;
+        return DM_OK;
+    }
+};
+
 /**
  * @tc.name: SendCmd_001
  * @tc.desc: 1. set cmdCode not null
@@ -110,6 +133,26 @@ HWTEST_F(IpcClientServerProxyTest, SendCmd_004, testing::ext::TestSize.Level0)
     int ret = instance->SendCmd(cmdCode, nullptr, nullptr);
     ASSERT_EQ(ret, ERR_DM_UNSUPPORTED_IPC_COMMAND);
 }
+
+/**
+ * @tc.name: SendCmd_005
+ * @tc.desc: the server stub rejects the command by admission, SendCmd reports ERR_DM_IPC_CMD_BUSY
+ *           through rsp instead of ERR_DM_IPC_SEND_REQUEST_FAILED
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(IpcClientServerProxyTest, SendCmd_005, testing::ext::TestSize.Level0)
+{
+    sptr<IRemoteObject> remoteObject = sptr<BusyServerStub>(new BusyServerStub());
+    std::shared_ptr<IpcGetTrustDeviceReq> req = std::make_shared<IpcGetTrustDeviceReq>();
+    std::shared_ptr<IpcGetTrustDeviceRsp> rsp = std::make_shared<IpcGetTrustDeviceRsp>();
+    req->SetPkgName("com.ohos.test");
+    auto instance = new IpcClientServerProxy(remoteObject);
+    int ret = instance->SendCmd(GET_TRUST_DEVICE_LIST, req, rsp);
+    EXPECT_EQ(ret, DM_OK);
+    EXPECT_EQ(rsp->GetErrCode(), ERR_DM_IPC_CMD_BUSY);
+    EXPECT_TRUE(rsp->GetDeviceVec().empty());
+}
 } // namespace
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -24,6 +24,8 @@
 #include "dm_device_info.h"
 #include "ipc_auth_info_req.h"
 #include "ipc_auth_info_rsp.h"
+#include "ipc_batch_query_req.h"
+#include "ipc_batch_query_rsp.h"
 #include "ipc_client_manager.h"
 #include "ipc_cmd_register.h"
 #include "ipc_common_param_req.h"
@@ -1392,6 +1394,82 @@ HWTEST_F(IpcCmdParserServiceTest, ReadResponse_GetOsTypeByNetwork_001, testing::
     ASSERT_EQ(rsp->GetErrCode(), DM_OK);
     ASSERT_EQ(rsp->GetOsType(), 1);
 }
+
+/**
+ * @tc.name: BatchQuery_001
+ * @tc.desc: Round trip of a batch: the batchable query is answered through its own codec, the
+ *           command that is not in the allow list only gets ERR_DM_UNSUPPORTED_IPC_COMMAND.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(IpcCmdParserServiceTest, BatchQuery_001, testing::ext::TestSize.Level1)
+{
+    std::shared_ptr<IpcGetInfoByNetWorkReq> udidReq = std::make_shared<IpcGetInfoByNetWorkReq>();
+    udidReq->SetPkgName("ohos.dm.test");
+    udidReq->SetNetworkId("networkId123");
+    std::shared_ptr<IpcGetInfoByNetWorkRsp> udidRsp = std::make_shared<IpcGetInfoByNetWorkRsp>();
+    std::shared_ptr<IpcReq> udidAnonyReq = std::make_shared<IpcReq>();
+    udidAnonyReq->SetPkgName("ohos.dm.test");
+    std::shared_ptr<IpcRsp> udidAnonyRsp = std::make_shared<IpcRsp>();
+    std::vector<IpcBatchQueryCmd> cmds;
+    cmds.push_back({ GET_UDID_BY_NETWORK, udidReq, udidRsp });
+    cmds.push_back({ GET_ANONY_LOCAL_UDID, udidAnonyReq, udidAnonyRsp });
+    std::shared_ptr<IpcBatchQueryReq> req = std::make_shared<IpcBatchQueryReq>();
+    req->SetPkgName("ohos.dm.test");
+    req->SetCmds(cmds);
+    std::shared_ptr<IpcBatchQueryRsp> rsp = std::make_shared<IpcBatchQueryRsp>();
+    rsp->SetCmds(cmds);
+
+    MessageParcel data;
+    MessageParcel reply;
+    SetIpcRequestFunc setPtr = GetIpcRequestFunc(BATCH_QUERY);
+    ASSERT_TRUE(setPtr != nullptr);
+    ASSERT_EQ(setPtr(req, data), DM_OK);
+    OnIpcCmdFunc cmdPtr = GetIpcCmdFunc(BATCH_QUERY);
+    ASSERT_TRUE(cmdPtr != nullptr);
+    ASSERT_EQ(cmdPtr(data, reply), DM_OK);
+    ReadResponseFunc readPtr = GetResponseFunc(BATCH_QUERY);
+    ASSERT_TRUE(readPtr != nullptr);
+    ASSERT_EQ(readPtr(reply, rsp), DM_OK);
+    EXPECT_EQ(rsp->GetErrCode(), DM_OK);
+    EXPECT_NE(udidRsp->GetErrCode(), ERR_DM_UNSUPPORTED_IPC_COMMAND);
+    EXPECT_NE(udidRsp->GetErrCode(), ERR_DM_IPC_READ_FAILED);
+    EXPECT_EQ(udidAnonyRsp->GetErrCode(), ERR_DM_UNSUPPORTED_IPC_COMMAND);
+}
+
+/**
+ * @tc.name: BatchQuery_002
+ * @tc.desc: An empty or oversized batch is rejected before anything is dispatched, and a reply
+ *           whose item count does not match the request fails to decode.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(IpcCmdParserServiceTest, BatchQuery_002, testing::ext::TestSize.Level1)
+{
+    OnIpcCmdFunc cmdPtr = GetIpcCmdFunc(BATCH_QUERY);
+    ASSERT_TRUE(cmdPtr != nullptr);
+    MessageParcel emptyData;
+    MessageParcel emptyReply;
+    emptyData.WriteString("ohos.dm.test");
+    emptyData.WriteInt32(0);
+    EXPECT_EQ(cmdPtr(emptyData, emptyReply), ERR_DM_INPUT_PARA_INVALID);
+    MessageParcel bigData;
+    MessageParcel bigReply;
+    bigData.WriteString("ohos.dm.test");
+    bigData.WriteInt32(DM_BATCH_QUERY_MAX_NUM + 1);
+    EXPECT_EQ(cmdPtr(bigData, bigReply), ERR_DM_INPUT_PARA_INVALID);
+
+    std::vector<IpcBatchQueryCmd> cmds;
+    cmds.push_back({ GET_LOCAL_DEVICE_INFO, std::make_shared<IpcReq>(), std::make_shared<IpcGetLocalDeviceInfoRsp>() });
+    std::shared_ptr<IpcBatchQueryRsp> rsp = std::make_shared<IpcBatchQueryRsp>();
+    rsp->SetCmds(cmds);
+    MessageParcel reply;
+    reply.WriteInt32(2);
+    ReadResponseFunc readPtr = GetResponseFunc(BATCH_QUERY);
+    ASSERT_TRUE(readPtr != nullptr);
+    EXPECT_EQ(readPtr(reply, rsp), ERR_DM_IPC_READ_FAILED);
+    EXPECT_EQ(rsp->GetErrCode(), ERR_DM_IPC_READ_FAILED);
+}
 } // namespace
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -22,6 +22,8 @@
 #include "device_manager_ipc_interface_code.h"
 #include "device_manager_service.h"
 #include "dm_device_info.h"
+#include "hichain_group_cache.h"
+#include "ipc_cmd_admission.h"
 #include "ipc_remote_broker.h"
 #include "ipc_server_stub.h"
 #include "device_manager_impl.h"
@@ -601,6 +603,63 @@ HWTEST_F(IpcServerStubTest, GetDmListener_005, testing::ext::TestSize.Level0)
     ASSERT_EQ(ret, nullptr);
 }
 
+/**
+ * @tc.name: GetDmListener_006
+ * @tc.desc: 1. Register the same pkgName for two userIds with different listeners
+ *           2. check each userId gets its own listener
+ *           3. UnRegister one userId, check the other one is still found
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(IpcServerStubTest, GetDmListener_006, testing::ext::TestSize.Level0)
+{
+    ProcessInfo processInfo;
+    processInfo.pkgName = "com.ohos.test.index";
+    processInfo.userId = 100;
+    ProcessInfo otherProcessInfo = processInfo;
+    otherProcessInfo.userId = 101;
+    sptr<IpcRemoteBroker> listener = sptr<IpcClientStub>(new IpcClientStub());
+    sptr<IpcRemoteBroker> otherListener = sptr<IpcClientStub>(new IpcClientStub());
+    ASSERT_EQ(IpcServerStub::GetInstance().RegisterDeviceManagerListener(processInfo, listener), DM_OK);
+    ASSERT_EQ(IpcServerStub::GetInstance().RegisterDeviceManagerListener(otherProcessInfo, otherListener), DM_OK);
+    EXPECT_EQ(IpcServerStub::GetInstance().GetDmListener(processInfo), listener);
+    EXPECT_EQ(IpcServerStub::GetInstance().GetDmListener(otherProcessInfo), otherListener);
+
+    ASSERT_EQ(IpcServerStub::GetInstance().UnRegisterDeviceManagerListener(processInfo), DM_OK);
+    EXPECT_EQ(IpcServerStub::GetInstance().GetDmListener(processInfo), nullptr);
+    EXPECT_EQ(IpcServerStub::GetInstance().GetDmListener(otherProcessInfo), otherListener);
+    ASSERT_EQ(IpcServerStub::GetInstance().UnRegisterDeviceManagerListener(otherProcessInfo), DM_OK);
+}
+
+/**
+ * @tc.name: GetDmListenerPkgName_001
+ * @tc.desc: 1. Register a listener, check its remote object maps back to the processInfo
+ *           2. Register the same processInfo with a new listener, check the old remote is no longer mapped
+ *           3. UnRegister, check the new remote is no longer mapped
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(IpcServerStubTest, GetDmListenerPkgName_001, testing::ext::TestSize.Level0)
+{
+    ProcessInfo processInfo;
+    processInfo.pkgName = "com.ohos.test.remote";
+    processInfo.userId = 100;
+    sptr<IpcClientStub> listener = sptr<IpcClientStub>(new IpcClientStub());
+    ASSERT_EQ(IpcServerStub::GetInstance().RegisterDeviceManagerListener(processInfo, listener), DM_OK);
+    ProcessInfo result = IpcServerStub::GetInstance().GetDmListenerPkgName(listener->AsObject());
+    EXPECT_EQ(result.pkgName, processInfo.pkgName);
+    EXPECT_EQ(result.userId, processInfo.userId);
+
+    sptr<IpcClientStub> newListener = sptr<IpcClientStub>(new IpcClientStub());
+    ASSERT_EQ(IpcServerStub::GetInstance().RegisterDeviceManagerListener(processInfo, newListener), DM_OK);
+    EXPECT_TRUE(IpcServerStub::GetInstance().GetDmListenerPkgName(listener->AsObject()).pkgName.empty());
+    EXPECT_EQ(IpcServerStub::GetInstance().GetDmListenerPkgName(newListener->AsObject()).pkgName,
+        processInfo.pkgName);
+
+    ASSERT_EQ(IpcServerStub::GetInstance().UnRegisterDeviceManagerListener(processInfo), DM_OK);
+    EXPECT_TRUE(IpcServerStub::GetInstance().GetDmListenerPkgName(newListener->AsObject()).pkgName.empty());
+}
+
 /**
  * @tc.name: OnRemoveSystemAbility_001
  * @tc.type: FUNC
@@ -625,6 +684,39 @@ HWTEST_F(IpcServerStubTest, OnRemoveSystemAbility_002, testing::ext::TestSize.Le
     ASSERT_EQ(DeviceManagerService::GetInstance().softbusListener_, nullptr);
 }
 
+/**
+ * @tc.name: OnRemoveSystemAbility_003
+ * @tc.desc: removing the device auth service disables the hichain group and credential caches
+ * @tc.type: FUNC
+ */
+HWTEST_F(IpcServerStubTest, OnRemoveSystemAbility_003, testing::ext::TestSize.Level0)
+{
+    HichainGroupCache &cache = HichainGroupCache::GetInstance();
+    cache.SetGroupCacheEnabled(true);
+    cache.SetCredentialCacheEnabled(true);
+    int32_t userId = 100;
+    std::string pkgName = "com.ohos.test";
+    std::string queryParams = "{}";
+    std::string credId = "credId";
+    std::vector<HichainGroupRecord> groups(1);
+    groups[0].groupId = "groupId";
+    cache.PutGroupInfo(userId, pkgName, queryParams, groups, cache.GetGeneration());
+    cache.PutCredentialInfo(userId, credId, "credInfo", cache.GetGeneration());
+    std::vector<HichainGroupRecord> cachedGroups;
+    std::string credInfo;
+    ASSERT_TRUE(cache.GetGroupInfo(userId, pkgName, queryParams, cachedGroups));
+    ASSERT_TRUE(cache.GetCredentialInfo(userId, credId, credInfo));
+
+    std::string deviceId;
+    IpcServerStub::GetInstance().OnRemoveSystemAbility(DEVICE_AUTH_SERVICE_ID, deviceId);
+    EXPECT_FALSE(cache.GetGroupInfo(userId, pkgName, queryParams, cachedGroups));
+    EXPECT_FALSE(cache.GetCredentialInfo(userId, credId, credInfo));
+    cache.PutGroupInfo(userId, pkgName, queryParams, groups, cache.GetGeneration());
+    cache.PutCredentialInfo(userId, credId, "credInfo", cache.GetGeneration());
+    EXPECT_FALSE(cache.GetGroupInfo(userId, pkgName, queryParams, cachedGroups));
+    EXPECT_FALSE(cache.GetCredentialInfo(userId, credId, credInfo));
+}
+
 /**
  * @tc.name: OnAddSystemAbility_001
  * @tc.type: FUNC
@@ -836,6 +928,58 @@ HWTEST_F(IpcServerStubTest, JoinPath2_006, testing::ext::TestSize.Level0)
     std::string result = IpcServerStub::GetInstance().JoinPath(prefixPath, midPath, subPath);
     ASSERT_EQ(result, "path//midpath//subpath");
 }
+
+HWTEST_F(IpcServerStubTest, IpcCmdAdmission_001, testing::ext::TestSize.Level0)
+{
+    EXPECT_EQ(IpcCmdAdmission::GetLane(GET_LOCAL_DEVICE_INFO), IpcCmdLane::LIGHT);
+    EXPECT_EQ(IpcCmdAdmission::GetLane(CHECK_API_PERMISSION), IpcCmdLane::LIGHT);
+    EXPECT_EQ(IpcCmdAdmission::GetLane(AUTHENTICATE_DEVICE), IpcCmdLane::HEAVY);
+    EXPECT_EQ(IpcCmdAdmission::GetLane(GET_TRUST_DEVICE_LIST), IpcCmdLane::NORMAL);
+    EXPECT_EQ(IpcCmdAdmission::GetLane(GET_ALL_TRUST_DEVICE_LIST), IpcCmdLane::NORMAL);
+    EXPECT_EQ(IpcCmdAdmission::GetLane(BATCH_QUERY), IpcCmdLane::NORMAL);
+    EXPECT_EQ(IpcCmdAdmission::GetLane(BIND_TARGET), IpcCmdLane::HEAVY);
+    EXPECT_EQ(IpcCmdAdmission::GetLane(START_DISCOVERING), IpcCmdLane::NORMAL);
+    EXPECT_EQ(IpcCmdAdmission::GetLane(-1), IpcCmdLane::NORMAL);
+}
+
+HWTEST_F(IpcServerStubTest, IpcCmdAdmission_002, testing::ext::TestSize.Level0)
+{
+    IpcLaneBudgets budgets = {{ { 2, 0, 0 }, { 1, 0, 0 }, { 1, 0, 0 } }};
+    IpcCmdAdmission admission(budgets);
+    EXPECT_EQ(admission.Acquire(IpcCmdLane::HEAVY), DM_OK);
+    EXPECT_EQ(admission.Acquire(IpcCmdLane::HEAVY), ERR_DM_IPC_CMD_BUSY);
+    // A full heavy lane does not hold back the other lanes.
+    EXPECT_EQ(admission.Acquire(IpcCmdLane::LIGHT), DM_OK);
+    EXPECT_EQ(admission.Acquire(IpcCmdLane::NORMAL), DM_OK);
+    admission.Release(IpcCmdLane::HEAVY);
+    EXPECT_EQ(admission.GetRunning(IpcCmdLane::HEAVY), 0);
+    EXPECT_EQ(admission.Acquire(IpcCmdLane::HEAVY), DM_OK);
+    EXPECT_EQ(admission.Acquire(IpcCmdLane::LANE_MAX), ERR_DM_INPUT_PARA_INVALID);
+}
+
+HWTEST_F(IpcServerStubTest, IpcCmdAdmission_003, testing::ext::TestSize.Level0)
+{
+    IpcLaneBudgets budgets = {{ { 2, 0, 0 }, { 1, 1, 200 }, { 1, 0, 0 } }};
+    IpcCmdAdmission admission(budgets);
+    EXPECT_EQ(admission.Acquire(IpcCmdLane::NORMAL), DM_OK);
+    int32_t waiterRet = ERR_DM_FAILED;
+    std::thread waiter([&admission, &waiterRet] { waiterRet = admission.Acquire(IpcCmdLane::NORMAL); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    admission.Release(IpcCmdLane::NORMAL);
+    waiter.join();
+    EXPECT_EQ(waiterRet, DM_OK);
+    EXPECT_EQ(admission.GetRunning(IpcCmdLane::NORMAL), 1);
+    {
+        IpcCmdAdmissionGuard guard(admission, IpcCmdLane::NORMAL);
+        EXPECT_EQ(guard.GetResult(), ERR_DM_IPC_CMD_BUSY);
+    }
+    admission.Release(IpcCmdLane::NORMAL);
+    {
+        IpcCmdAdmissionGuard guard(admission, IpcCmdLane::NORMAL);
+        EXPECT_EQ(guard.GetResult(), DM_OK);
+    }
+    EXPECT_EQ(admission.GetRunning(IpcCmdLane::NORMAL), 0);
+}
 } // namespace
 } // namespace DistributedHardware
 } // namespace OHOS
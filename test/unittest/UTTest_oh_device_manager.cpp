@@ -174,6 +174,63 @@ HWTEST_F(OhDeviceManagerTest, OH_DeviceManager_GetLocalDeviceNameC_005_StdFuncti
         delete[] localDeviceName;
     }
 }
+
+HWTEST_F(OhDeviceManagerTest, DmClient_GetLocalDeviceName_001, testing::ext::TestSize.Level1)
+{
+    // Neither a failed init nor an uninit leaves anything behind for the next call to serve.
+    std::string deviceName = "";
+    EXPECT_EQ(DmClient::GetInstance().GetLocalDeviceName(deviceName), DM_ERR_OBTAIN_BUNDLE_NAME);
+    EXPECT_EQ(DmClient::GetInstance().UnInit(), ERR_OK);
+    EXPECT_EQ(DmClient::GetInstance().GetLocalDeviceName(deviceName), DM_ERR_OBTAIN_BUNDLE_NAME);
+    EXPECT_EQ(DmClient::GetInstance().ReInit(), DM_ERR_OBTAIN_BUNDLE_NAME);
+    EXPECT_TRUE(deviceName.empty());
+}
+
+HWTEST_F(OhDeviceManagerTest, LocalDeviceNameCache_001, testing::ext::TestSize.Level1)
+{
+    LocalDeviceNameCache cache;
+    std::string deviceName = "";
+    uint64_t generation = 0;
+    EXPECT_FALSE(cache.Get(deviceName, generation));
+    cache.Put("phone", generation);
+    EXPECT_TRUE(cache.Get(deviceName, generation));
+    EXPECT_EQ(deviceName, "phone");
+    deviceName = "";
+    EXPECT_TRUE(cache.Get(deviceName, generation));
+    EXPECT_EQ(deviceName, "phone");
+}
+
+HWTEST_F(OhDeviceManagerTest, LocalDeviceNameCache_002, testing::ext::TestSize.Level1)
+{
+    LocalDeviceNameCache cache;
+    std::string deviceName = "";
+    uint64_t generation = 0;
+    EXPECT_FALSE(cache.Get(deviceName, generation));
+    cache.Put("phone", generation);
+    cache.Clear();
+    EXPECT_FALSE(cache.Get(deviceName, generation));
+    EXPECT_TRUE(deviceName.empty());
+    cache.Put("tablet", generation);
+    EXPECT_TRUE(cache.Get(deviceName, generation));
+    EXPECT_EQ(deviceName, "tablet");
+}
+
+HWTEST_F(OhDeviceManagerTest, LocalDeviceNameCache_003, testing::ext::TestSize.Level1)
+{
+    // A rename while the old name is being fetched must not let the old name into the cache.
+    LocalDeviceNameCache cache;
+    std::string deviceName = "";
+    uint64_t staleGeneration = 0;
+    EXPECT_FALSE(cache.Get(deviceName, staleGeneration));
+    cache.Clear();
+    cache.Put("old name", staleGeneration);
+    uint64_t generation = 0;
+    EXPECT_FALSE(cache.Get(deviceName, generation));
+    EXPECT_NE(generation, staleGeneration);
+    cache.Put("new name", generation);
+    EXPECT_TRUE(cache.Get(deviceName, generation));
+    EXPECT_EQ(deviceName, "new name");
+}
 } // namespace
 } // namespace DistributedHardware
 } // namespace OHOS
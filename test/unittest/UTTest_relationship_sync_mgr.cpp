@@ -15,6 +15,8 @@
 
 #include "UTTest_relationship_sync_mgr.h"
 
+#include <algorithm>
+
 #include "dm_constants.h"
 
 namespace OHOS {
@@ -40,6 +42,30 @@ void ReleationShipSyncMgrTest::TearDownTestCase()
 }
 
 namespace {
+// The message as softbus hands it to the receiver, which carries the sender udid.
+std::string ToReceivedMsg(const RelationShipChangeMsg &msg, const std::string &peerUdid)
+{
+    cJSON *msgObj = cJSON_Parse(msg.ToJson().c_str());
+    if (msgObj == nullptr) {
+        return "";
+    }
+    cJSON_DeleteItemFromObject(msgObj, "PEER_UDID");
+    cJSON_AddStringToObject(msgObj, "PEER_UDID", peerUdid.c_str());
+    char *msgStr = cJSON_PrintUnformatted(msgObj);
+    std::string receivedMsg = (msgStr == nullptr) ? "" : std::string(msgStr);
+    cJSON_free(msgStr);
+    cJSON_Delete(msgObj);
+    return receivedMsg;
+}
+
+int32_t GetMsgType(const std::string &broadCastMsg)
+{
+    cJSON *msgObj = cJSON_Parse(broadCastMsg.c_str());
+    cJSON *typeJson = cJSON_GetObjectItem(msgObj, "TYPE");
+    int32_t type = (typeJson != nullptr && cJSON_IsNumber(typeJson)) ? typeJson->valueint : -1;
+    cJSON_Delete(msgObj);
+    return type;
+}
 
 HWTEST_F(ReleationShipSyncMgrTest, SyncTrustRelationShip_001, testing::ext::TestSize.Level1)
 {
@@ -1817,6 +1843,449 @@ HWTEST_F(ReleationShipSyncMgrTest, ToJson_FromJson_001, testing::ext::TestSize.L
     RelationShipChangeMsg parsed = ReleationShipSyncMgr::GetInstance().ParseTrustRelationShipChange(json);
     EXPECT_EQ(parsed.userId, 100);
 }
+
+/**
+ * @tc.name: ToFingerprint_001
+ * @tc.desc: Verify the fingerprint is stable and changes with the peer udid and broadcast id.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, ToFingerprint_001, testing::ext::TestSize.Level1)
+{
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::DEL_USER;
+    msg.userId = 100;
+    msg.peerUdid = "peerUdid";
+    msg.broadCastId = 1;
+    EXPECT_TRUE(msg.ToFingerprint() == msg.ToFingerprint());
+
+    RelationShipChangeMsg other = msg;
+    other.peerUdid = "peerUdie";
+    EXPECT_FALSE(msg.ToFingerprint() == other.ToFingerprint());
+    other = msg;
+    other.broadCastId = 2;
+    EXPECT_FALSE(msg.ToFingerprint() == other.ToFingerprint());
+    other = msg;
+    other.userIdInfos.push_back(UserIdInfo(true, 100));
+    EXPECT_FALSE(msg.ToFingerprint() == other.ToFingerprint());
+}
+
+/**
+ * @tc.name: IsNewBroadCastId_001
+ * @tc.desc: Verify a repeated broadcast is dropped and a new broadcast id is accepted.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, IsNewBroadCastId_001, testing::ext::TestSize.Level1)
+{
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::STOP_USER;
+    msg.userId = 101;
+    msg.peerUdid = "IsNewBroadCastId_001";
+    msg.broadCastId = 0;
+    EXPECT_TRUE(ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(msg));
+    EXPECT_TRUE(ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(msg));
+    msg.broadCastId = 3;
+    EXPECT_TRUE(ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(msg));
+    EXPECT_FALSE(ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(msg));
+    msg.broadCastId = 4;
+    EXPECT_TRUE(ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(msg));
+}
+
+/**
+ * @tc.name: BroadCastDedupSet_001
+ * @tc.desc: Verify fingerprints expire once the window rotated past their bucket.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, BroadCastDedupSet_001, testing::ext::TestSize.Level1)
+{
+    const int64_t windowSec = 5;
+    BroadCastDedupSet dedupSet(windowSec, 2);
+    BroadCastFingerprint first;
+    first.digest = 1;
+    BroadCastFingerprint second;
+    second.digest = 2;
+    BroadCastFingerprint third;
+    third.digest = 3;
+    int64_t nowSec = 1000;
+    EXPECT_TRUE(dedupSet.CheckAndInsert(first, nowSec));
+    EXPECT_FALSE(dedupSet.CheckAndInsert(first, nowSec + windowSec));
+    EXPECT_TRUE(dedupSet.CheckAndInsert(second, nowSec + windowSec));
+    EXPECT_TRUE(dedupSet.CheckAndInsert(third, nowSec + windowSec));
+    EXPECT_TRUE(dedupSet.CheckAndInsert(third, nowSec + windowSec));
+    EXPECT_EQ(dedupSet.Size(), 2);
+    EXPECT_TRUE(dedupSet.CheckAndInsert(first, nowSec + windowSec + 1));
+    EXPECT_EQ(dedupSet.Size(), 2);
+    EXPECT_TRUE(dedupSet.CheckAndInsert(second, nowSec + windowSec * 3));
+    EXPECT_EQ(dedupSet.Size(), 1);
+}
+
+/**
+ * @tc.name: SyncUserIdDeltaPayLoad_001
+ * @tc.desc: Verify a user id delta survives the payload round trip.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, SyncUserIdDeltaPayLoad_001, testing::ext::TestSize.Level1)
+{
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::SYNC_USERID_DELTA;
+    msg.syncUserIdFlag = true;
+    msg.baseUserIdSeq = 255;
+    msg.userIdSeq = 0;
+    msg.userIdInfos.push_back(UserIdInfo(true, 0x3FFF));
+    msg.removedUserIds.push_back(101);
+    msg.broadCastId = 7;
+    uint8_t *msgPtr = nullptr;
+    uint32_t len = 0;
+    ASSERT_TRUE(msg.ToBroadcastPayLoad(msgPtr, len));
+    ASSERT_EQ(len, 8);
+    cJSON *payloadJson = cJSON_CreateArray();
+    for (uint32_t i = 0; i < len; i++) {
+        cJSON_AddItemToArray(payloadJson, cJSON_CreateNumber(msgPtr[i]));
+    }
+    delete[] msgPtr;
+    RelationShipChangeMsg parsed;
+    EXPECT_TRUE(parsed.FromBroadcastPayLoad(payloadJson, RelationShipChangeType::SYNC_USERID_DELTA));
+    cJSON_Delete(payloadJson);
+    EXPECT_TRUE(parsed.syncUserIdFlag);
+    EXPECT_EQ(parsed.baseUserIdSeq, 255);
+    EXPECT_EQ(parsed.userIdSeq, 0);
+    ASSERT_EQ(parsed.userIdInfos.size(), 1);
+    EXPECT_TRUE(parsed.userIdInfos[0].isForeground);
+    EXPECT_EQ(parsed.userIdInfos[0].userId, 0x3FFF);
+    ASSERT_EQ(parsed.removedUserIds.size(), 1);
+    EXPECT_EQ(parsed.removedUserIds[0], 101);
+    EXPECT_EQ(parsed.broadCastId, 7);
+
+    msg.userIdInfos.push_back(UserIdInfo(false, 0x4000));
+    EXPECT_FALSE(msg.IsValid());
+}
+
+/**
+ * @tc.name: SyncUserIdVersioned_001
+ * @tc.desc: Verify the versioned user id list keeps its sequence and still parses as the legacy layout.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, SyncUserIdVersioned_001, testing::ext::TestSize.Level1)
+{
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::SYNC_USERID;
+    msg.userIdInfos.push_back(UserIdInfo(true, 100));
+    msg.userIdInfos.push_back(UserIdInfo(false, 101));
+    msg.userIdInfos.push_back(UserIdInfo(false, 102));
+    msg.userIdInfos.push_back(UserIdInfo(false, 103));
+    msg.isUserIdVersioned = true;
+    msg.needUserIdResync = true;
+    msg.userIdSeq = 9;
+    msg.broadCastId = 3;
+    uint8_t *msgPtr = nullptr;
+    uint32_t len = 0;
+    ASSERT_TRUE(msg.ToBroadcastPayLoad(msgPtr, len));
+    ASSERT_EQ(len, 11);
+    cJSON *payloadJson = cJSON_CreateArray();
+    for (uint32_t i = 0; i < len; i++) {
+        cJSON_AddItemToArray(payloadJson, cJSON_CreateNumber(msgPtr[i]));
+    }
+    delete[] msgPtr;
+    RelationShipChangeMsg parsed;
+    EXPECT_TRUE(parsed.FromBroadcastPayLoad(payloadJson, RelationShipChangeType::SYNC_USERID));
+    cJSON_Delete(payloadJson);
+    EXPECT_TRUE(parsed.isUserIdVersioned);
+    EXPECT_TRUE(parsed.needUserIdResync);
+    EXPECT_EQ(parsed.userIdSeq, 9);
+    EXPECT_EQ(parsed.broadCastId, 3);
+    ASSERT_EQ(parsed.userIdInfos.size(), 4);
+    EXPECT_EQ(parsed.userIdInfos[3].userId, 103);
+
+    // The layout without the sequence byte stays unversioned.
+    msg.isUserIdVersioned = false;
+    ASSERT_TRUE(msg.ToBroadcastPayLoad(msgPtr, len));
+    ASSERT_EQ(len, 10);
+    payloadJson = cJSON_CreateArray();
+    for (uint32_t i = 0; i < len; i++) {
+        cJSON_AddItemToArray(payloadJson, cJSON_CreateNumber(msgPtr[i]));
+    }
+    delete[] msgPtr;
+    RelationShipChangeMsg legacy;
+    EXPECT_TRUE(legacy.FromBroadcastPayLoad(payloadJson, RelationShipChangeType::SYNC_USERID));
+    cJSON_Delete(payloadJson);
+    EXPECT_FALSE(legacy.isUserIdVersioned);
+    EXPECT_FALSE(legacy.needUserIdResync);
+}
+
+/**
+ * @tc.name: GetUserIdInfosDelta_001
+ * @tc.desc: Verify applying the delta of two user id lists restores the second one.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, GetUserIdInfosDelta_001, testing::ext::TestSize.Level1)
+{
+    std::vector<UserIdInfo> baseUserIdInfos = { UserIdInfo(true, 100), UserIdInfo(false, 101),
+        UserIdInfo(false, 102) };
+    std::vector<UserIdInfo> userIdInfos = { UserIdInfo(false, 100), UserIdInfo(false, 101),
+        UserIdInfo(true, 103) };
+    std::vector<UserIdInfo> changedUserIdInfos;
+    std::vector<uint16_t> removedUserIds;
+    GetUserIdInfosDelta(baseUserIdInfos, userIdInfos, changedUserIdInfos, removedUserIds);
+    EXPECT_EQ(changedUserIdInfos.size(), 2);
+    ASSERT_EQ(removedUserIds.size(), 1);
+    EXPECT_EQ(removedUserIds[0], 102);
+    ApplyUserIdInfosDelta(baseUserIdInfos, changedUserIdInfos, removedUserIds);
+    ASSERT_EQ(baseUserIdInfos.size(), userIdInfos.size());
+    for (const auto &userIdInfo : userIdInfos) {
+        auto iter = std::find_if(baseUserIdInfos.begin(), baseUserIdInfos.end(),
+            [&userIdInfo](const UserIdInfo &item) { return item.userId == userIdInfo.userId; });
+        ASSERT_TRUE(iter != baseUserIdInfos.end());
+        EXPECT_EQ(iter->isForeground, userIdInfo.isForeground);
+    }
+}
+
+/**
+ * @tc.name: SyncUserIdsRelationShip_001
+ * @tc.desc: Verify the peers holding the previous user id list get a delta and the others the full list.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, SyncUserIdsRelationShip_001, testing::ext::TestSize.Level1)
+{
+    const std::string versionedPeer = "SyncUserIdsRelationShip_001_versioned";
+    const std::string legacyPeer = "SyncUserIdsRelationShip_001_legacy";
+    ReleationShipSyncMgr &syncMgr = ReleationShipSyncMgr::GetInstance();
+    RelationShipChangeMsg peerMsg;
+    peerMsg.type = RelationShipChangeType::SYNC_USERID;
+    peerMsg.userIdInfos.push_back(UserIdInfo(true, 100));
+    peerMsg.isUserIdVersioned = true;
+    RelationShipChangeMsg parsed = syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(peerMsg, versionedPeer));
+    ASSERT_TRUE(parsed.isUserIdVersioned);
+
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::SYNC_USERID;
+    msg.userIdInfos = { UserIdInfo(true, 200), UserIdInfo(false, 201), UserIdInfo(false, 202) };
+    msg.peerUdids = { versionedPeer, legacyPeer };
+    std::vector<std::string> broadCastMsgs = syncMgr.SyncUserIdsRelationShip(msg);
+    EXPECT_EQ(broadCastMsgs.size(), 1);
+    EXPECT_TRUE(msg.isUserIdVersioned);
+    EXPECT_EQ(msg.peerUdids.size(), 2);
+
+    msg.userIdInfos = { UserIdInfo(false, 200), UserIdInfo(false, 201), UserIdInfo(false, 202) };
+    msg.peerUdids = { versionedPeer, legacyPeer };
+    broadCastMsgs = syncMgr.SyncUserIdsRelationShip(msg);
+    ASSERT_EQ(broadCastMsgs.size(), 2);
+    ASSERT_EQ(msg.peerUdids.size(), 1);
+    EXPECT_EQ(msg.peerUdids[0], legacyPeer);
+    EXPECT_EQ(GetMsgType(broadCastMsgs[0]), static_cast<int32_t>(RelationShipChangeType::SYNC_USERID_DELTA));
+    EXPECT_EQ(GetMsgType(broadCastMsgs[1]), static_cast<int32_t>(RelationShipChangeType::SYNC_USERID));
+}
+
+/**
+ * @tc.name: ParseTrustRelationShipChange_009
+ * @tc.desc: Verify a user id delta resolves against the list held for the peer, and a gap is left unresolved.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, ParseTrustRelationShipChange_009, testing::ext::TestSize.Level1)
+{
+    const std::string peerUdid = "ParseTrustRelationShipChange_009";
+    ReleationShipSyncMgr &syncMgr = ReleationShipSyncMgr::GetInstance();
+    RelationShipChangeMsg fullMsg;
+    fullMsg.type = RelationShipChangeType::SYNC_USERID;
+    fullMsg.userIdInfos = { UserIdInfo(true, 100), UserIdInfo(false, 101) };
+    fullMsg.isUserIdVersioned = true;
+    fullMsg.userIdSeq = 4;
+    syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(fullMsg, peerUdid));
+
+    RelationShipChangeMsg deltaMsg;
+    deltaMsg.type = RelationShipChangeType::SYNC_USERID_DELTA;
+    deltaMsg.baseUserIdSeq = 5;
+    deltaMsg.userIdSeq = 6;
+    RelationShipChangeMsg parsed = syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(deltaMsg, peerUdid));
+    EXPECT_EQ(parsed.type, RelationShipChangeType::SYNC_USERID_DELTA);
+
+    deltaMsg.baseUserIdSeq = 4;
+    deltaMsg.userIdSeq = 5;
+    deltaMsg.userIdInfos = { UserIdInfo(true, 102) };
+    deltaMsg.removedUserIds = { 100 };
+    for (int32_t i = 0; i < 2; i++) {
+        parsed = syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(deltaMsg, peerUdid));
+        EXPECT_EQ(parsed.type, RelationShipChangeType::SYNC_USERID);
+        ASSERT_EQ(parsed.userIdInfos.size(), 2);
+        EXPECT_EQ(parsed.userIdInfos[0].userId, 101);
+        EXPECT_EQ(parsed.userIdInfos[1].userId, 102);
+    }
+
+    fullMsg.isUserIdVersioned = false;
+    syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(fullMsg, peerUdid));
+    deltaMsg.baseUserIdSeq = 5;
+    deltaMsg.userIdSeq = 6;
+    parsed = syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(deltaMsg, peerUdid));
+    EXPECT_EQ(parsed.type, RelationShipChangeType::SYNC_USERID_DELTA);
+}
+
+/**
+ * @tc.name: IsNewBroadCastId_002
+ * @tc.desc: Verify two remove-only user id deltas sent to a peer within one second are both accepted.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, IsNewBroadCastId_002, testing::ext::TestSize.Level1)
+{
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::SYNC_USERID_DELTA;
+    msg.peerUdid = "IsNewBroadCastId_002";
+    msg.isUserIdVersioned = true;
+    msg.baseUserIdSeq = 1;
+    msg.userIdSeq = 2;
+    msg.removedUserIds = { 101 };
+    msg.broadCastId = 9;
+    RelationShipChangeMsg next = msg;
+    next.baseUserIdSeq = 2;
+    next.userIdSeq = 3;
+    next.removedUserIds = { 102 };
+    EXPECT_FALSE(msg.ToFingerprint() == next.ToFingerprint());
+    EXPECT_TRUE(ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(msg));
+    EXPECT_TRUE(ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(next));
+    EXPECT_FALSE(ReleationShipSyncMgr::GetInstance().IsNewBroadCastId(next));
+
+    RelationShipChangeMsg other = msg;
+    other.removedUserIds = { 103 };
+    EXPECT_FALSE(msg.ToFingerprint() == other.ToFingerprint());
+    other = msg;
+    other.needUserIdResync = true;
+    EXPECT_FALSE(msg.ToFingerprint() == other.ToFingerprint());
+}
+
+/**
+ * @tc.name: ParseTrustRelationShipChange_010
+ * @tc.desc: Verify a user id delta applies across the wrap of the sequence number and a malformed one does not.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, ParseTrustRelationShipChange_010, testing::ext::TestSize.Level1)
+{
+    const std::string peerUdid = "ParseTrustRelationShipChange_010";
+    ReleationShipSyncMgr &syncMgr = ReleationShipSyncMgr::GetInstance();
+    RelationShipChangeMsg fullMsg;
+    fullMsg.type = RelationShipChangeType::SYNC_USERID;
+    fullMsg.userIdInfos = { UserIdInfo(true, 100), UserIdInfo(false, 101) };
+    fullMsg.isUserIdVersioned = true;
+    fullMsg.userIdSeq = 255;
+    syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(fullMsg, peerUdid));
+
+    RelationShipChangeMsg deltaMsg;
+    deltaMsg.type = RelationShipChangeType::SYNC_USERID_DELTA;
+    deltaMsg.baseUserIdSeq = 255;
+    deltaMsg.userIdSeq = 3;
+    deltaMsg.removedUserIds = { 101 };
+    RelationShipChangeMsg parsed = syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(deltaMsg, peerUdid));
+    EXPECT_EQ(parsed.type, RelationShipChangeType::SYNC_USERID_DELTA);
+
+    deltaMsg.userIdSeq = 0;
+    parsed = syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(deltaMsg, peerUdid));
+    EXPECT_EQ(parsed.type, RelationShipChangeType::SYNC_USERID);
+    ASSERT_EQ(parsed.userIdInfos.size(), 1);
+    EXPECT_EQ(parsed.userIdInfos[0].userId, 100);
+
+    deltaMsg.baseUserIdSeq = 0;
+    deltaMsg.userIdSeq = 1;
+    deltaMsg.removedUserIds = { 100 };
+    parsed = syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(deltaMsg, peerUdid));
+    EXPECT_EQ(parsed.type, RelationShipChangeType::SYNC_USERID);
+    EXPECT_TRUE(parsed.userIdInfos.empty());
+}
+
+/**
+ * @tc.name: ToSyncUserIdDeltaPayLoad_001
+ * @tc.desc: Verify a user id delta is only encoded while it fits the broadcast payload.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, ToSyncUserIdDeltaPayLoad_001, testing::ext::TestSize.Level1)
+{
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::SYNC_USERID_DELTA;
+    msg.userIdInfos = { UserIdInfo(true, 100), UserIdInfo(false, 101) };
+    msg.removedUserIds = { 102, 103 };
+    uint8_t *payload = nullptr;
+    uint32_t len = 0;
+    ASSERT_TRUE(msg.ToSyncUserIdDeltaPayLoad(payload, len));
+    EXPECT_EQ(len, 12);
+    delete[] payload;
+    payload = nullptr;
+
+    msg.removedUserIds.push_back(104);
+    len = 0;
+    EXPECT_FALSE(msg.ToSyncUserIdDeltaPayLoad(payload, len));
+    EXPECT_EQ(payload, nullptr);
+    EXPECT_EQ(len, 0);
+}
+
+/**
+ * @tc.name: ParseTrustRelationShipChange_011
+ * @tc.desc: Verify an empty delta at the sequence already held is a repeat and not a gap.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, ParseTrustRelationShipChange_011, testing::ext::TestSize.Level1)
+{
+    const std::string peerUdid = "ParseTrustRelationShipChange_011";
+    ReleationShipSyncMgr &syncMgr = ReleationShipSyncMgr::GetInstance();
+    RelationShipChangeMsg fullMsg;
+    fullMsg.type = RelationShipChangeType::SYNC_USERID;
+    fullMsg.userIdInfos = { UserIdInfo(true, 100), UserIdInfo(false, 101) };
+    fullMsg.isUserIdVersioned = true;
+    fullMsg.userIdSeq = 5;
+    syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(fullMsg, peerUdid));
+
+    RelationShipChangeMsg deltaMsg;
+    deltaMsg.type = RelationShipChangeType::SYNC_USERID_DELTA;
+    deltaMsg.baseUserIdSeq = 5;
+    deltaMsg.userIdSeq = 5;
+    RelationShipChangeMsg parsed = syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(deltaMsg, peerUdid));
+    EXPECT_EQ(parsed.type, RelationShipChangeType::SYNC_USERID);
+    EXPECT_EQ(parsed.userIdInfos.size(), 2);
+
+    deltaMsg.baseUserIdSeq = 6;
+    deltaMsg.userIdSeq = 6;
+    parsed = syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(deltaMsg, peerUdid));
+    EXPECT_EQ(parsed.type, RelationShipChangeType::SYNC_USERID_DELTA);
+}
+
+/**
+ * @tc.name: SyncUserIdsRelationShip_002
+ * @tc.desc: Verify an unchanged user id list is resent as one full list and not as a delta.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJK
+ */
+HWTEST_F(ReleationShipSyncMgrTest, SyncUserIdsRelationShip_002, testing::ext::TestSize.Level1)
+{
+    const std::string versionedPeer = "SyncUserIdsRelationShip_002_versioned";
+    ReleationShipSyncMgr &syncMgr = ReleationShipSyncMgr::GetInstance();
+    RelationShipChangeMsg peerMsg;
+    peerMsg.type = RelationShipChangeType::SYNC_USERID;
+    peerMsg.userIdInfos.push_back(UserIdInfo(true, 100));
+    peerMsg.isUserIdVersioned = true;
+    syncMgr.ParseTrustRelationShipChange(ToReceivedMsg(peerMsg, versionedPeer));
+
+    RelationShipChangeMsg msg;
+    msg.type = RelationShipChangeType::SYNC_USERID;
+    msg.userIdInfos = { UserIdInfo(true, 300), UserIdInfo(false, 301), UserIdInfo(false, 302) };
+    msg.peerUdids = { versionedPeer };
+    std::vector<std::string> broadCastMsgs = syncMgr.SyncUserIdsRelationShip(msg);
+    EXPECT_EQ(broadCastMsgs.size(), 1);
+    uint8_t userIdSeq = msg.userIdSeq;
+
+    msg.peerUdids = { versionedPeer };
+    broadCastMsgs = syncMgr.SyncUserIdsRelationShip(msg);
+    ASSERT_EQ(broadCastMsgs.size(), 1);
+    EXPECT_EQ(GetMsgType(broadCastMsgs[0]), static_cast<int32_t>(RelationShipChangeType::SYNC_USERID));
+    EXPECT_EQ(msg.userIdSeq, userIdSeq);
+    ASSERT_EQ(msg.peerUdids.size(), 1);
+    EXPECT_EQ(msg.peerUdids[0], versionedPeer);
+}
 }
 } // namespace DistributedHardware
 } // namespace OHOS
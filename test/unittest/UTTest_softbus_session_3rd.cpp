@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "UTTest_softbus_session_3rd.h"
+
+#include <chrono>
+#include <thread>
+
+#include "dm_error_type_3rd.h"
+#include "dm_log_3rd.h"
+#include "softbus_session_stub.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+namespace {
+constexpr int32_t IDLE_TIMEOUT_LONG = 10;
+constexpr int32_t IDLE_TIMEOUT_SHORT = 1;
+constexpr int32_t IDLE_TIMEOUT_WAIT_MS = 1500;
+}
+
+void SoftbusSession3rdTest::SetUpTestCase()
+{
+    LOGI("SetUpTestCase start");
+}
+
+void SoftbusSession3rdTest::TearDownTestCase()
+{
+    LOGI("TearDownTestCase start");
+}
+
+void SoftbusSession3rdTest::SetUp()
+{
+    SoftbusSessionStub::GetInstance().Reset();
+    session_ = std::make_shared<SoftbusSession3rd>();
+    targetId_ = PeerTargetId3rd();
+    targetId_.wifiIp = "192.168.1.2";
+    targetId_.wifiPort = 1;
+}
+
+void SoftbusSession3rdTest::TearDown()
+{
+    session_ = nullptr;
+    SoftbusSessionStub::GetInstance().Reset();
+}
+
+HWTEST_F(SoftbusSession3rdTest, OpenSessionServer_001, testing::ext::TestSize.Level1)
+{
+    bool isReused = true;
+    int32_t sessionId = session_->OpenSessionServer(targetId_, isReused);
+    ASSERT_GT(sessionId, 0);
+    EXPECT_FALSE(isReused);
+    EXPECT_EQ(session_->ReleaseAuthSession(sessionId, IDLE_TIMEOUT_LONG), DM_OK);
+    EXPECT_EQ(SoftbusSessionStub::GetInstance().GetOpenedCount(), 1u);
+
+    int32_t reusedId = session_->OpenSessionServer(targetId_, isReused);
+    EXPECT_EQ(reusedId, sessionId);
+    EXPECT_TRUE(isReused);
+    EXPECT_EQ(SoftbusSessionStub::GetInstance().GetOpenCount(), 1u);
+}
+
+HWTEST_F(SoftbusSession3rdTest, OpenSessionServer_002, testing::ext::TestSize.Level1)
+{
+    bool isReused = false;
+    int32_t sessionId = session_->OpenSessionServer(targetId_, isReused);
+    ASSERT_GT(sessionId, 0);
+    EXPECT_EQ(session_->ReleaseAuthSession(sessionId, IDLE_TIMEOUT_LONG), DM_OK);
+
+    PeerTargetId3rd otherPort = targetId_;
+    otherPort.wifiPort = 2;
+    PeerTargetId3rd otherIp = targetId_;
+    otherIp.wifiIp = "192.168.1.3";
+    PeerTargetId3rd otherDevice = targetId_;
+    otherDevice.deviceId = "deviceId";
+    PeerTargetId3rd otherBle = targetId_;
+    otherBle.bleMac = "11:22:33:44:55:66";
+    PeerTargetId3rd otherBr = targetId_;
+    otherBr.brMac = "11:22:33:44:55:66";
+    for (const auto &target : { otherPort, otherIp, otherDevice, otherBle, otherBr }) {
+        int32_t otherId = session_->OpenSessionServer(target, isReused);
+        EXPECT_NE(otherId, sessionId);
+        EXPECT_FALSE(isReused);
+    }
+    // Same peer but another session name.
+    int32_t credId = session_->OpenCredSession(targetId_, isReused);
+    EXPECT_NE(credId, sessionId);
+    EXPECT_FALSE(isReused);
+    EXPECT_EQ(SoftbusSessionStub::GetInstance().GetOpenCount(), 7u);
+}
+
+HWTEST_F(SoftbusSession3rdTest, ReleaseAuthSession_001, testing::ext::TestSize.Level1)
+{
+    bool isReused = false;
+    int32_t sessionId = session_->OpenSessionServer(targetId_, isReused);
+    ASSERT_GT(sessionId, 0);
+    EXPECT_EQ(session_->ReleaseAuthSession(sessionId, IDLE_TIMEOUT_SHORT), DM_OK);
+    EXPECT_EQ(SoftbusSessionStub::GetInstance().GetOpenedCount(), 1u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_TIMEOUT_WAIT_MS));
+    EXPECT_EQ(SoftbusSessionStub::GetInstance().GetOpenedCount(), 0u);
+    int32_t newId = session_->OpenSessionServer(targetId_, isReused);
+    EXPECT_NE(newId, sessionId);
+    EXPECT_FALSE(isReused);
+}
+
+HWTEST_F(SoftbusSession3rdTest, OnSessionClosed_001, testing::ext::TestSize.Level1)
+{
+    bool isReused = false;
+    int32_t sessionId = session_->OpenSessionServer(targetId_, isReused);
+    ASSERT_GT(sessionId, 0);
+    EXPECT_EQ(session_->ReleaseAuthSession(sessionId, IDLE_TIMEOUT_LONG), DM_OK);
+
+    // Closed by the peer while idle, it must not be handed out again.
+    session_->OnSessionClosed(sessionId);
+    int32_t newId = session_->OpenSessionServer(targetId_, isReused);
+    EXPECT_NE(newId, sessionId);
+    EXPECT_FALSE(isReused);
+    EXPECT_EQ(SoftbusSessionStub::GetInstance().GetOpenCount(), 2u);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
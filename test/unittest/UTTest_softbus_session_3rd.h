@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTTEST_SOFTBUS_SESSION_3RD_H
+#define UTTEST_SOFTBUS_SESSION_3RD_H
+
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "softbus_session_3rd.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+class SoftbusSession3rdTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+protected:
+    std::shared_ptr<SoftbusSession3rd> session_;
+    PeerTargetId3rd targetId_;
+};
+}
+}
+#endif
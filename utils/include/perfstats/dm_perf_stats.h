@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DM_PERF_STATS_H
+#define OHOS_DM_PERF_STATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dm_single_instance.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+// Timed operations, each one owns a latency histogram.
+enum class DmPerfOp : int32_t {
+    GET_TRUSTED_DEVICE_LIST = 0,
+    HANDLE_ONLINE,
+    HANDLE_OFFLINE,
+    AUTH_STATE_ACTION,
+    TRANSPORT_SEND,
+    DP_GET_ACL,
+    DP_GET_ALL_ACL,
+    SOFTBUS_DISCOVERY_CALLBACK,
+    MINE_MATCH_QUEUE_WAIT,
+    IPC_LIGHT_QUEUE_WAIT,
+    IPC_NORMAL_QUEUE_WAIT,
+    IPC_HEAVY_QUEUE_WAIT,
+    OP_MAX,
+};
+
+// Monotonic event counters.
+enum class DmPerfCounter : int32_t {
+    DEVICE_ONLINE = 0,
+    DEVICE_OFFLINE,
+    DEVICE_FOUND,
+    TRANSPORT_SEND_FAILED,
+    AUTH_STATE_FAILED,
+    SOFTBUS_CALLBACK_DROPPED,
+    MINE_MATCH_DEDUPLICATED,
+    MINE_MATCH_DROPPED,
+    PIN_HOLDER_SESSION_OPEN,
+    PIN_HOLDER_SESSION_REUSE,
+    IPC_LIGHT_REJECTED,
+    IPC_NORMAL_REJECTED,
+    IPC_HEAVY_REJECTED,
+    COUNTER_MAX,
+};
+
+// Queue depth gauges, keep the last value and the high-water mark.
+enum class DmPerfGauge : int32_t {
+    AUTH_STATE_QUEUE = 0,
+    MINE_MATCH_QUEUE,
+    GAUGE_MAX,
+};
+
+/*
+ * Log-linear latency histogram in microseconds. Each power of two is split into
+ * HISTOGRAM_SUB_BUCKETS linear sub buckets, so the relative error is bounded by
+ * 1 / HISTOGRAM_SUB_BUCKETS over the whole range (HDR histogram layout).
+ */
+class DmLatencyHistogram {
+public:
+    static constexpr uint32_t HISTOGRAM_SUB_BUCKET_BITS = 3;
+    static constexpr uint32_t HISTOGRAM_SUB_BUCKETS = 1u << HISTOGRAM_SUB_BUCKET_BITS;
+    static constexpr uint32_t HISTOGRAM_MAX_BITS = 32;
+    static constexpr uint32_t HISTOGRAM_BUCKETS =
+        (HISTOGRAM_MAX_BITS - HISTOGRAM_SUB_BUCKET_BITS + 1) * HISTOGRAM_SUB_BUCKETS;
+
+    void Record(uint64_t valueUs);
+    void Reset();
+    uint64_t GetCount() const;
+    uint64_t GetMax() const;
+    uint64_t GetMean() const;
+    uint64_t GetPercentile(double percentile) const;
+
+    static uint32_t BucketIndex(uint64_t valueUs);
+    static uint64_t BucketLowerBound(uint32_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> buckets_ {};
+    std::atomic<uint64_t> count_ {0};
+    std::atomic<uint64_t> sum_ {0};
+    std::atomic<uint64_t> max_ {0};
+};
+
+class DmPerfStats {
+    DM_DECLARE_SINGLE_INSTANCE(DmPerfStats);
+public:
+    DM_EXPORT void SetEnabled(bool enabled);
+    inline bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+    DM_EXPORT void RecordLatency(DmPerfOp op, uint64_t costUs);
+    DM_EXPORT void IncCounter(DmPerfCounter counter, uint64_t delta = 1);
+    DM_EXPORT void SetGauge(DmPerfGauge gauge, int64_t value);
+    // One-shot startup stage timing, always recorded regardless of the enable switch.
+    DM_EXPORT void RecordStage(const std::string &name, int64_t beginMs, int64_t costMs);
+    DM_EXPORT void Reset();
+    DM_EXPORT std::string Dump() const;
+    DM_EXPORT int32_t ExportToFile(const std::string &path) const;
+
+    static const char *GetOpName(DmPerfOp op);
+    static const char *GetCounterName(DmPerfCounter counter);
+    static const char *GetGaugeName(DmPerfGauge gauge);
+
+private:
+    struct GaugeValue {
+        std::atomic<int64_t> last {0};
+        std::atomic<int64_t> peak {0};
+    };
+
+    std::atomic<bool> enabled_ {false};
+    std::array<DmLatencyHistogram, static_cast<size_t>(DmPerfOp::OP_MAX)> histograms_ {};
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(DmPerfCounter::COUNTER_MAX)> counters_ {};
+    std::array<GaugeValue, static_cast<size_t>(DmPerfGauge::GAUGE_MAX)> gauges_ {};
+
+    struct StageValue {
+        std::string name;
+        int64_t beginMs = 0;
+        int64_t costMs = 0;
+    };
+    mutable std::mutex stageMutex_;
+    std::vector<StageValue> stages_;
+};
+
+// Records the lifetime of the enclosing scope, costs one relaxed load when stats are disabled.
+class DmPerfScope {
+public:
+    explicit DmPerfScope(DmPerfOp op) : op_(op), active_(DmPerfStats::GetInstance().IsEnabled())
+    {
+        if (active_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~DmPerfScope()
+    {
+        if (!active_) {
+            return;
+        }
+        auto cost = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start_).count();
+        DmPerfStats::GetInstance().RecordLatency(op_, static_cast<uint64_t>(cost));
+    }
+
+    DmPerfScope(const DmPerfScope &) = delete;
+    DmPerfScope &operator=(const DmPerfScope &) = delete;
+
+private:
+    DmPerfOp op_;
+    bool active_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#define DM_PERF_CONCAT_INNER(a, b) a##b
+#define DM_PERF_CONCAT(a, b) DM_PERF_CONCAT_INNER(a, b)
+#define DM_PERF_SCOPE(op) DmPerfScope DM_PERF_CONCAT(dmPerfScope, __LINE__)(op)
+#define DM_PERF_COUNT(counter)                                      \
+    do {                                                            \
+        if (DmPerfStats::GetInstance().IsEnabled()) {               \
+            DmPerfStats::GetInstance().IncCounter(counter);         \
+        }                                                           \
+    } while (0)
+#define DM_PERF_GAUGE(gauge, value)                                 \
+    do {                                                            \
+        if (DmPerfStats::GetInstance().IsEnabled()) {               \
+            DmPerfStats::GetInstance().SetGauge(gauge, value);      \
+        }                                                           \
+    } while (0)
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_DM_PERF_STATS_H
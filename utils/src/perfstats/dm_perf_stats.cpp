@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dm_perf_stats.h"
+
+#include <fstream>
+
+#include "dm_error_type.h"
+#include "dm_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+DM_IMPLEMENT_SINGLE_INSTANCE(DmPerfStats);
+namespace {
+constexpr uint32_t UINT64_BITS = 64;
+constexpr double PERCENTILE_MAX = 100.0;
+constexpr size_t MAX_STAGE_NUM = 32;
+struct DumpPercentile {
+    double value;
+    const char *name;
+};
+constexpr DumpPercentile DUMP_PERCENTILES[] = {
+    { 50.0, "p50" }, { 90.0, "p90" }, { 99.0, "p99" }, { 99.9, "p999" },
+};
+
+const char *g_opNames[] = {
+    "GetTrustedDeviceList",
+    "HandleOnline",
+    "HandleOffline",
+    "AuthStateAction",
+    "TransportSend",
+    "DpGetAcl",
+    "DpGetAllAcl",
+    "SoftbusDiscoveryCallback",
+    "MineMatchQueueWait",
+    "IpcLightQueueWait",
+    "IpcNormalQueueWait",
+    "IpcHeavyQueueWait",
+};
+
+const char *g_counterNames[] = {
+    "DeviceOnline",
+    "DeviceOffline",
+    "DeviceFound",
+    "TransportSendFailed",
+    "AuthStateFailed",
+    "SoftbusCallbackDropped",
+    "MineMatchDeduplicated",
+    "MineMatchDropped",
+    "PinHolderSessionOpen",
+    "PinHolderSessionReuse",
+    "IpcLightRejected",
+    "IpcNormalRejected",
+    "IpcHeavyRejected",
+};
+
+const char *g_gaugeNames[] = {
+    "AuthStateQueue",
+    "MineMatchQueue",
+};
+
+static_assert(sizeof(g_opNames) / sizeof(g_opNames[0]) == static_cast<size_t>(DmPerfOp::OP_MAX),
+    "op names mismatch");
+static_assert(sizeof(g_counterNames) / sizeof(g_counterNames[0]) ==
+    static_cast<size_t>(DmPerfCounter::COUNTER_MAX), "counter names mismatch");
+static_assert(sizeof(g_gaugeNames) / sizeof(g_gaugeNames[0]) == static_cast<size_t>(DmPerfGauge::GAUGE_MAX),
+    "gauge names mismatch");
+
+uint32_t HighestBit(uint64_t value)
+{
+    return UINT64_BITS - 1 - static_cast<uint32_t>(__builtin_clzll(value));
+}
+
+void UpdateMax(std::atomic<uint64_t> &target, uint64_t value)
+{
+    uint64_t cur = target.load(std::memory_order_relaxed);
+    while (value > cur && !target.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+    }
+}
+
+void UpdateMax(std::atomic<int64_t> &target, int64_t value)
+{
+    int64_t cur = target.load(std::memory_order_relaxed);
+    while (value > cur && !target.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+    }
+}
+}
+
+uint32_t DmLatencyHistogram::BucketIndex(uint64_t valueUs)
+{
+    if (valueUs < HISTOGRAM_SUB_BUCKETS) {
+        return static_cast<uint32_t>(valueUs);
+    }
+    uint32_t shift = HighestBit(valueUs) - HISTOGRAM_SUB_BUCKET_BITS;
+    uint32_t sub = static_cast<uint32_t>(valueUs >> shift) & (HISTOGRAM_SUB_BUCKETS - 1);
+    uint64_t index = static_cast<uint64_t>(shift + 1) * HISTOGRAM_SUB_BUCKETS + sub;
+    return index >= HISTOGRAM_BUCKETS ? HISTOGRAM_BUCKETS - 1 : static_cast<uint32_t>(index);
+}
+
+uint64_t DmLatencyHistogram::BucketLowerBound(uint32_t index)
+{
+    if (index < HISTOGRAM_SUB_BUCKETS) {
+        return index;
+    }
+    uint32_t shift = index / HISTOGRAM_SUB_BUCKETS - 1;
+    uint64_t sub = index % HISTOGRAM_SUB_BUCKETS;
+    return (HISTOGRAM_SUB_BUCKETS + sub) << shift;
+}
+
+void DmLatencyHistogram::Record(uint64_t valueUs)
+{
+    buckets_[BucketIndex(valueUs)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(valueUs, std::memory_order_relaxed);
+    UpdateMax(max_, valueUs);
+}
+
+void DmLatencyHistogram::Reset()
+{
+    for (auto &bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t DmLatencyHistogram::GetCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t DmLatencyHistogram::GetMax() const
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+uint64_t DmLatencyHistogram::GetMean() const
+{
+    uint64_t count = GetCount();
+    return count == 0 ? 0 : sum_.load(std::memory_order_relaxed) / count;
+}
+
+uint64_t DmLatencyHistogram::GetPercentile(double percentile) const
+{
+    uint64_t count = GetCount();
+    if (count == 0) {
+        return 0;
+    }
+    if (percentile > PERCENTILE_MAX) {
+        percentile = PERCENTILE_MAX;
+    }
+    uint64_t target = static_cast<uint64_t>(static_cast<double>(count) * percentile / PERCENTILE_MAX);
+    if (target == 0) {
+        target = 1;
+    }
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            uint64_t bound = BucketLowerBound(i);
+            return bound > GetMax() ? GetMax() : bound;
+        }
+    }
+    return GetMax();
+}
+
+void DmPerfStats::SetEnabled(bool enabled)
+{
+    LOGI("perf stats enabled: %{public}d.", enabled);
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void DmPerfStats::RecordLatency(DmPerfOp op, uint64_t costUs)
+{
+    if (op < DmPerfOp::GET_TRUSTED_DEVICE_LIST || op >= DmPerfOp::OP_MAX || !IsEnabled()) {
+        return;
+    }
+    histograms_[static_cast<size_t>(op)].Record(costUs);
+}
+
+void DmPerfStats::IncCounter(DmPerfCounter counter, uint64_t delta)
+{
+    if (counter < DmPerfCounter::DEVICE_ONLINE || counter >= DmPerfCounter::COUNTER_MAX || !IsEnabled()) {
+        return;
+    }
+    counters_[static_cast<size_t>(counter)].fetch_add(delta, std::memory_order_relaxed);
+}
+
+void DmPerfStats::SetGauge(DmPerfGauge gauge, int64_t value)
+{
+    if (gauge < DmPerfGauge::AUTH_STATE_QUEUE || gauge >= DmPerfGauge::GAUGE_MAX || !IsEnabled()) {
+        return;
+    }
+    GaugeValue &item = gauges_[static_cast<size_t>(gauge)];
+    item.last.store(value, std::memory_order_relaxed);
+    UpdateMax(item.peak, value);
+}
+
+void DmPerfStats::RecordStage(const std::string &name, int64_t beginMs, int64_t costMs)
+{
+    std::lock_guard<std::mutex> lock(stageMutex_);
+    for (auto &stage : stages_) {
+        if (stage.name == name) {
+            stage.beginMs = beginMs;
+            stage.costMs = costMs;
+            return;
+        }
+    }
+    if (stages_.size() >= MAX_STAGE_NUM) {
+        LOGE("too many stages.");
+        return;
+    }
+    stages_.push_back({ name, beginMs, costMs });
+}
+
+void DmPerfStats::Reset()
+{
+    for (auto &histogram : histograms_) {
+        histogram.Reset();
+    }
+    for (auto &counter : counters_) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    for (auto &gauge : gauges_) {
+        gauge.last.store(0, std::memory_order_relaxed);
+        gauge.peak.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string DmPerfStats::Dump() const
+{
+    std::string result;
+    result.append("perf stats: ").append(IsEnabled() ? "enabled" : "disabled").append("\n");
+    result.append("latency(us):\n");
+    for (size_t i = 0; i < histograms_.size(); i++) {
+        const DmLatencyHistogram &histogram = histograms_[i];
+        result.append("    ").append(g_opNames[i]);
+        result.append(" count=").append(std::to_string(histogram.GetCount()));
+        result.append(" mean=").append(std::to_string(histogram.GetMean()));
+        for (const auto &percentile : DUMP_PERCENTILES) {
+            result.append(" ").append(percentile.name).append("=").append(
+                std::to_string(histogram.GetPercentile(percentile.value)));
+        }
+        result.append(" max=").append(std::to_string(histogram.GetMax())).append("\n");
+    }
+    result.append("counters:\n");
+    for (size_t i = 0; i < counters_.size(); i++) {
+        result.append("    ").append(g_counterNames[i]).append("=").append(
+            std::to_string(counters_[i].load(std::memory_order_relaxed))).append("\n");
+    }
+    result.append("gauges:\n");
+    for (size_t i = 0; i < gauges_.size(); i++) {
+        result.append("    ").append(g_gaugeNames[i]);
+        result.append(" last=").append(std::to_string(gauges_[i].last.load(std::memory_order_relaxed)));
+        result.append(" peak=").append(std::to_string(gauges_[i].peak.load(std::memory_order_relaxed)));
+        result.append("\n");
+    }
+    std::lock_guard<std::mutex> lock(stageMutex_);
+    result.append("startup stages(ms):\n");
+    for (const auto &stage : stages_) {
+        result.append("    ").append(stage.name);
+        result.append(" begin=").append(std::to_string(stage.beginMs));
+        result.append(" cost=").append(std::to_string(stage.costMs)).append("\n");
+    }
+    return result;
+}
+
+int32_t DmPerfStats::ExportToFile(const std::string &path) const
+{
+    if (path.empty()) {
+        LOGE("export path is empty.");
+        return ERR_DM_INPUT_PARA_INVALID;
+    }
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        LOGE("open export file failed.");
+        return ERR_DM_FAILED;
+    }
+    file << Dump();
+    file.close();
+    return file.fail() ? ERR_DM_FAILED : DM_OK;
+}
+
+const char *DmPerfStats::GetOpName(DmPerfOp op)
+{
+    if (op < DmPerfOp::GET_TRUSTED_DEVICE_LIST || op >= DmPerfOp::OP_MAX) {
+        return "";
+    }
+    return g_opNames[static_cast<size_t>(op)];
+}
+
+const char *DmPerfStats::GetCounterName(DmPerfCounter counter)
+{
+    if (counter < DmPerfCounter::DEVICE_ONLINE || counter >= DmPerfCounter::COUNTER_MAX) {
+        return "";
+    }
+    return g_counterNames[static_cast<size_t>(counter)];
+}
+
+const char *DmPerfStats::GetGaugeName(DmPerfGauge gauge)
+{
+    if (gauge < DmPerfGauge::AUTH_STATE_QUEUE || gauge >= DmPerfGauge::GAUGE_MAX) {
+        return "";
+    }
+    return g_gaugeNames[static_cast<size_t>(gauge)];
+}
+} // namespace DistributedHardware
+} // namespace OHOS